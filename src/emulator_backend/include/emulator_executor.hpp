@@ -5,26 +5,48 @@
 
 #pragma once
 
+#include "emulator_network.hpp"
 #include "vpux.hpp"
 #include "vpux/al/config/common.hpp"
 #include "vpux/utils/core/logger.hpp"
 
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 namespace vpux {
 
 class EmulatorExecutor final : public vpux::Executor {
 public:
-    EmulatorExecutor(const vpux::NetworkDescription::Ptr& network, const vpux::Config& config)
-            : _config(config), _network(network), _logger("EmulatorBackend", config.get<LOG_LEVEL>()) {
+    using NetworkFactory = std::function<IEmulatorNetwork::Ptr(const void* networkModel, const Config& config)>;
+
+    EmulatorExecutor(const vpux::NetworkDescription::Ptr& network, const vpux::Config& config,
+                     NetworkFactory networkFactory)
+            : _config(config),
+              _network(network),
+              _networkFactory(std::move(networkFactory)),
+              _logger("EmulatorBackend", config.get<LOG_LEVEL>()) {
     }
 
     NetworkDescription& getNetworkDesc() {
         return *_network.get();
     }
 
+    // Returns a network built in the emulator for the infer request.
+    // Networks released by destroyed infer requests are reused, so the network is built once
+    // per concurrently existing request rather than once per inference.
+    IEmulatorNetwork::Ptr acquireNetwork();
+    void releaseNetwork(IEmulatorNetwork::Ptr network);
+
 private:
-    Logger _logger;
     Config _config;
     vpux::NetworkDescription::Ptr _network;
+    NetworkFactory _networkFactory;
+    Logger _logger;
+
+    std::mutex _poolMutex;
+    std::vector<IEmulatorNetwork::Ptr> _networkPool;
 };
 
 }  // namespace vpux
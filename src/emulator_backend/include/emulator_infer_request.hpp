@@ -5,11 +5,10 @@
 
 #pragma once
 
+#include "emulator_executor.hpp"
 #include "vpux.hpp"
 #include "vpux/utils/core/logger.hpp"
 
-#include <emu/manager.hpp>
-
 namespace vpux {
 class EmulatorInferRequest final : public IInferRequest {
 public:
@@ -29,6 +28,8 @@ public:
 
     void GetResult() override;
 
+    ~EmulatorInferRequest() override;
+
 private:
     void push(const InferenceEngine::BlobMap& inputs);
     void pull(InferenceEngine::BlobMap& outputs);
@@ -38,7 +39,8 @@ private:
     Logger _logger;
     std::shared_ptr<InferenceEngine::IAllocator> _allocator;
 
-    mv::emu::Manager _manager;
+    // Borrowed from the executor on the first inference and returned on destruction
+    IEmulatorNetwork::Ptr _network;
 };
 
 }  //  namespace vpux
@@ -0,0 +1,39 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include "vpux/al/config/common.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace vpux {
+
+//
+// IEmulatorNetwork
+//
+
+// Network model instantiated in the emulator.
+// The network is built once on creation, every inference populates the inputs and runs it.
+class IEmulatorNetwork {
+public:
+    using Ptr = std::unique_ptr<IEmulatorNetwork>;
+
+    virtual ~IEmulatorNetwork() = default;
+
+    virtual std::vector<std::string> getInputNames() const = 0;
+    virtual std::vector<std::string> getOutputNames() const = 0;
+
+    virtual void populate(const std::string& inputName, const void* data) = 0;
+    virtual void run() = 0;
+    virtual const char* getOutputData(const std::string& outputName) const = 0;
+};
+
+// Builds the network model in the emulator manager
+IEmulatorNetwork::Ptr createEmulatorNetwork(const void* networkModel, const Config& config);
+
+}  // namespace vpux
@@ -21,7 +21,7 @@ std::shared_ptr<Executor> EmulatorDevice::createExecutor(const NetworkDescriptio
     if (network->getNetworkModel() == nullptr)
         IE_THROW() << "Network passed to emulator is incorrect";
     _logger.debug("::createExecutor() finished");
-    return std::make_shared<EmulatorExecutor>(network, config);
+    return std::make_shared<EmulatorExecutor>(network, config, createEmulatorNetwork);
 }
 
 std::string EmulatorDevice::getName() const {
@@ -0,0 +1,33 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "emulator_executor.hpp"
+
+namespace vpux {
+
+IEmulatorNetwork::Ptr EmulatorExecutor::acquireNetwork() {
+    {
+        std::lock_guard<std::mutex> lock(_poolMutex);
+        if (!_networkPool.empty()) {
+            auto network = std::move(_networkPool.back());
+            _networkPool.pop_back();
+            return network;
+        }
+    }
+
+    _logger.debug("Build the network in the emulator");
+    return _networkFactory(_network->getNetworkModel(), _config);
+}
+
+void EmulatorExecutor::releaseNetwork(IEmulatorNetwork::Ptr network) {
+    if (network == nullptr) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_poolMutex);
+    _networkPool.push_back(std::move(network));
+}
+
+}  // namespace vpux
@@ -5,6 +5,7 @@
 
 #include "emulator_infer_request.hpp"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <string>
@@ -63,22 +64,28 @@ static ie::Blob::Ptr allocateLocalBlob(const ie::TensorDesc& tensorDesc,
     return blob;
 }
 
+static const ie::DataPtr& findDeviceData(const NetworkIOVector& deviceData, const std::string& name) {
+    const auto it = std::find_if(deviceData.begin(), deviceData.end(), [&](const auto& p) {
+        return p.first == name;
+    });
+    VPUX_THROW_WHEN(it == deviceData.end(), "Emulator data '{0}' is different from network ones.", name);
+    return it->second;
+}
+
 }  // namespace
 
 EmulatorInferRequest::EmulatorInferRequest(const ie::InputsDataMap& networkInputs,
                                            const ie::OutputsDataMap& networkOutputs, const Executor::Ptr& executor,
-                                           const Config& config, const std::string& netName,
+                                           const Config& config, const std::string& /*netName*/,
                                            const std::vector<std::shared_ptr<const ov::Node>>& parameters,
                                            const std::vector<std::shared_ptr<const ov::Node>>& results,
-                                           const vpux::NetworkIOVector& networkStatesInfo,
+                                           const vpux::NetworkIOVector& /*networkStatesInfo*/,
                                            const std::shared_ptr<InferenceEngine::IAllocator>& allocator)
         : IInferRequest(networkInputs, networkOutputs),
           _executorPtr(executor),
           _config(config),
-          _allocator(allocator),
           _logger("EmulatorInferRequest", _config.get<LOG_LEVEL>()),
-          _manager(ie::getIELibraryPath() + "/npu_emulator", vpux::stringifyEnum(config.get<LOG_LEVEL>()).data(),
-                   config.get<DEVICE_ID>()) {
+          _allocator(allocator) {
     if (_networkOutputs.empty() || _networkInputs.empty()) {
         IE_THROW() << "No information about network's output/input.";
     }
@@ -100,46 +107,54 @@ EmulatorInferRequest::EmulatorInferRequest(const ie::InputsDataMap& networkInput
     }
 }
 
+EmulatorInferRequest::~EmulatorInferRequest() {
+    static_cast<EmulatorExecutor*>(_executorPtr.get())->releaseNetwork(std::move(_network));
+}
+
 void EmulatorInferRequest::push(const ie::BlobMap& inputs) {
     _logger.debug("EmulatorExecutor::push() started");
 
-    _manager.reset(static_cast<EmulatorExecutor*>(_executorPtr.get())->getNetworkDesc().getNetworkModel());
-    const auto& deviceInputs =
-            static_cast<EmulatorExecutor*>(_executorPtr.get())->getNetworkDesc().getDeviceInputsInfo();
+    auto executor = static_cast<EmulatorExecutor*>(_executorPtr.get());
+    if (_network == nullptr) {
+        _network = executor->acquireNetwork();
+    }
+
+    // The network is built once, the only per-inference state is its inputs, all of them are populated below
+    const auto& deviceInputs = executor->getNetworkDesc().getDeviceInputsInfo();
+    const auto inputNames = _network->getInputNames();
+    VPUX_THROW_UNLESS(inputNames.size() == inputs.size(), "Emulator inputs are different from network inputs.");
     auto inputIt = inputs.cbegin();
 
-    for (const auto inputName : _manager.getNetworkInputs()) {
-        if (deviceInputs.find(inputName) == deviceInputs.end()) {
-            VPUX_THROW("Emulator inputs are different from network inputs.");
-        }
+    for (const auto& inputName : inputNames) {
         const ie::Blob::Ptr& blob = inputIt->second;
         const ie::TensorDesc& inputDataAttributes = blob->getTensorDesc();
-        const ie::TensorDesc& deviceDataAttributes = deviceInputs.at(inputName)->getTensorDesc();
+        const ie::TensorDesc& deviceDataAttributes = findDeviceData(deviceInputs, inputName)->getTensorDesc();
         checkDataAttributesMatch(inputDataAttributes, deviceDataAttributes);
 
-        _manager.populate(inputName, blob->cbuffer().as<const void*>());
+        _network->populate(inputName, blob->cbuffer().as<const void*>());
         ++inputIt;
     }
-    _manager.run();
+    _network->run();
     _logger.debug("EmulatorExecutor::push() finished");
 }
 
 void EmulatorInferRequest::pull(ie::BlobMap& outputs) {
     _logger.debug("EmulatorExecutor::pull() started");
+    VPUX_THROW_WHEN(_network == nullptr, "Emulator results are requested before any inference was started");
     const auto& deviceOutputs =
             static_cast<EmulatorExecutor*>(_executorPtr.get())->getNetworkDesc().getDeviceOutputsInfo();
+    const auto outputNames = _network->getOutputNames();
+    VPUX_THROW_UNLESS(outputNames.size() == outputs.size(), "Emulator outputs are different from network outputs.");
     auto outputIt = outputs.begin();
 
-    for (const auto outputName : _manager.getNetworkOutputs()) {
-        if (deviceOutputs.find(outputName) == deviceOutputs.end()) {
-            VPUX_THROW("Emulator outputs are different from network outputs.");
-        }
+    // NB: The emulator can't write to user buffers, outputs are copied from the network ones
+    for (const auto& outputName : outputNames) {
         ie::Blob::Ptr blob = outputIt->second;
         const ie::TensorDesc& outputDataAttributes = blob->getTensorDesc();
-        const ie::TensorDesc& deviceDataAttributes = deviceOutputs.at(outputName)->getTensorDesc();
+        const ie::TensorDesc& deviceDataAttributes = findDeviceData(deviceOutputs, outputName)->getTensorDesc();
         checkDataAttributesMatch(outputDataAttributes, deviceDataAttributes);
 
-        std::copy_n(_manager.data(outputName).data(), blob->byteSize(), blob->buffer().as<char*>());
+        std::copy_n(_network->getOutputData(outputName), blob->byteSize(), blob->buffer().as<char*>());
         ++outputIt;
     }
     _logger.debug("EmulatorExecutor::pull() finished");
@@ -0,0 +1,63 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "emulator_network.hpp"
+
+#include <emu/manager.hpp>
+#include <file_utils.h>
+
+namespace ie = InferenceEngine;
+
+namespace vpux {
+
+namespace {
+
+class EmulatorManagerNetwork final : public IEmulatorNetwork {
+public:
+    EmulatorManagerNetwork(const void* networkModel, const Config& config)
+            : _manager(ie::getIELibraryPath() + "/npu_emulator", vpux::stringifyEnum(config.get<LOG_LEVEL>()).data(),
+                       config.get<DEVICE_ID>()) {
+        _manager.reset(networkModel);
+    }
+
+    std::vector<std::string> getInputNames() const override {
+        std::vector<std::string> names;
+        for (const auto& name : _manager.getNetworkInputs()) {
+            names.emplace_back(name);
+        }
+        return names;
+    }
+
+    std::vector<std::string> getOutputNames() const override {
+        std::vector<std::string> names;
+        for (const auto& name : _manager.getNetworkOutputs()) {
+            names.emplace_back(name);
+        }
+        return names;
+    }
+
+    void populate(const std::string& inputName, const void* data) override {
+        _manager.populate(inputName, data);
+    }
+
+    void run() override {
+        _manager.run();
+    }
+
+    const char* getOutputData(const std::string& outputName) const override {
+        return reinterpret_cast<const char*>(_manager.data(outputName).data());
+    }
+
+private:
+    mutable mv::emu::Manager _manager;
+};
+
+}  // namespace
+
+IEmulatorNetwork::Ptr createEmulatorNetwork(const void* networkModel, const Config& config) {
+    return std::make_unique<EmulatorManagerNetwork>(networkModel, config);
+}
+
+}  // namespace vpux
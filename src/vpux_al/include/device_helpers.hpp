@@ -7,6 +7,8 @@
 
 #include <cstdint>
 #include <map>
+#include <string>
+#include <vector>
 
 #include "vpux_private_config.hpp"
 
@@ -23,4 +25,10 @@ InferenceEngine::VPUXConfigParams::VPUXPlatform getPlatformByDeviceName(const st
 InferenceEngine::VPUXConfigParams::VPUXPlatform getPlatformByEMUDeviceName(const std::string& deviceName);
 // TODO Remove after removing deprecated device names from VPUAL backend
 bool isDeviceNameVpualDeprecated(const std::string& deviceName);
+// Returns the available device the name refers to, or an empty string. A name with an index ("3720.1") must match
+// exactly, any other name (platform only, deprecated format) refers to the first available device
+std::string resolveDeviceName(const std::string& deviceName, const std::vector<std::string>& availableNames);
+// Returns the available devices of the platform, e.g. "3720.0" and "3720.1" for "3720"
+std::vector<std::string> getPlatformDeviceNames(const std::string& platformName,
+                                                const std::vector<std::string>& availableNames);
 }  // namespace utils
@@ -20,6 +20,7 @@
 #include <openvino/runtime/properties.hpp>
 
 #include "vpux/utils/IE/config.hpp"
+#include "vpux/utils/plugin/inference_scheduler.hpp"
 
 #include "vpux_compiler.hpp"
 
@@ -172,6 +173,13 @@ public:
     using Ptr = std::shared_ptr<Executor>;
     using CPtr = std::shared_ptr<const Executor>;
 
+    /**
+     * @brief Returns true if the host copy of the compiled network is not used anymore once the executor is created
+     */
+    virtual bool isCompiledNetworkReleasable() const {
+        return false;
+    }
+
     virtual ~Executor() = default;
 };
 
@@ -185,6 +193,25 @@ public:
     }
     virtual void InferAsync() = 0;
     virtual void GetResult() = 0;
+
+    /**
+     * @brief Synchronously runs this request together with other independent requests of the same executable network
+     * @details The default implementation runs the requests one by one. Backends may record all the inferences into
+     * one submission to amortize the host overhead, the results are identical to the individual runs. The default
+     * implementation starts at most getMaxInFlight requests at once. If an inference fails, the remaining requests
+     * are not started and the started ones are still waited for before the first error is rethrown.
+     * @note None of the requests may be running when the batch is started
+     */
+    virtual void InferBatch(const std::vector<Ptr>& others);
+
+    /**
+     * @brief Number of inferences the device of the request may run at once, 0 if unlimited
+     * @details A backend may hold the device slot from InferAsync till GetResult, so a batch starting more requests
+     * would wait for its own slots
+     */
+    virtual size_t getMaxInFlight() const {
+        return 0;
+    }
 };
 
 //------------------------------------------------------------------------------
@@ -204,6 +231,8 @@ public:
     virtual Uuid getUuid() const;
     virtual uint64_t getTotalMemSize() const;
     virtual uint32_t getDriverVersion() const;
+    /** @brief Time spent by the inferences of each priority waiting for the device on the host */
+    virtual std::map<ov::hint::Priority, QueueingDelay> getQueueingDelays() const;
 
     virtual IInferRequest::Ptr createInferRequest(const InferenceEngine::InputsDataMap& networkInputs,
                                                   const InferenceEngine::OutputsDataMap& networkOutputs,
@@ -270,6 +299,10 @@ public:
         return _impl->getDriverVersion();
     }
 
+    std::map<ov::hint::Priority, QueueingDelay> getQueueingDelays() const {
+        return _impl->getQueueingDelays();
+    }
+
     IInferRequest::Ptr createInferRequest(const InferenceEngine::InputsDataMap& networkInputs,
                                           const InferenceEngine::OutputsDataMap& networkOutputs,
                                           const Executor::Ptr& executor, const Config& config,
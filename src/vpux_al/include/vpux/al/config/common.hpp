@@ -148,6 +148,34 @@ struct CACHE_DIR final : OptionBase<CACHE_DIR, std::string> {
     }
 };
 
+//
+// CACHE_MAX_SIZE
+//
+
+struct CACHE_MAX_SIZE final : OptionBase<CACHE_MAX_SIZE, int64_t> {
+    static StringRef key() {
+        return ov::intel_vpux::cache_max_size.name();
+    }
+
+    static int64_t defaultValue() {
+        return 2LL * 1024 * 1024 * 1024;
+    }
+
+    static void validateValue(int64_t v) {
+        VPUX_THROW_UNLESS(v >= 0, "CACHE_MAX_SIZE can't be negative: {0}", v);
+    }
+
+#ifdef VPUX_DEVELOPER_BUILD
+    static StringRef envVar() {
+        return "IE_NPU_CACHE_MAX_SIZE";
+    }
+#endif
+
+    static bool isPublic() {
+        return false;
+    }
+};
+
 //
 // CACHING PROPERTIES
 //
@@ -145,6 +145,130 @@ struct CREATE_EXECUTOR final : OptionBase<CREATE_EXECUTOR, int64_t> {
     }
 };
 
+//
+// MULTI_DEVICE_EXECUTION
+//
+
+struct MULTI_DEVICE_EXECUTION final : OptionBase<MULTI_DEVICE_EXECUTION, bool> {
+    static StringRef key() {
+        return ov::intel_vpux::multi_device_execution.name();
+    }
+
+    static bool defaultValue() {
+        return false;
+    }
+
+#ifdef VPUX_DEVELOPER_BUILD
+    static StringRef envVar() {
+        return "IE_NPU_MULTI_DEVICE_EXECUTION";
+    }
+#endif
+
+    static bool isPublic() {
+        return false;
+    }
+
+    static OptionMode mode() {
+        return OptionMode::RunTime;
+    }
+};
+
+//
+// MAX_INFLIGHT_INFERENCES
+//
+
+struct MAX_INFLIGHT_INFERENCES final : OptionBase<MAX_INFLIGHT_INFERENCES, int64_t> {
+    static StringRef key() {
+        return ov::intel_vpux::max_inflight_inferences.name();
+    }
+
+    static int64_t defaultValue() {
+        return 0;
+    }
+
+    static void validateValue(int64_t v) {
+        VPUX_THROW_UNLESS(v >= 0, "MAX_INFLIGHT_INFERENCES can't be negative: {0}", v);
+    }
+
+#ifdef VPUX_DEVELOPER_BUILD
+    static StringRef envVar() {
+        return "IE_NPU_MAX_INFLIGHT_INFERENCES";
+    }
+#endif
+
+    static bool isPublic() {
+        return false;
+    }
+
+    static OptionMode mode() {
+        return OptionMode::RunTime;
+    }
+};
+
+//
+// DYNAMIC_BATCH_SIZE
+//
+
+struct DYNAMIC_BATCH_SIZE final : OptionBase<DYNAMIC_BATCH_SIZE, int64_t> {
+    static StringRef key() {
+        return ov::intel_vpux::dynamic_batch_size.name();
+    }
+
+    static int64_t defaultValue() {
+        return 0;
+    }
+
+    static void validateValue(int64_t v) {
+        VPUX_THROW_UNLESS(v == 0 || v >= 2, "DYNAMIC_BATCH_SIZE must be 0 or at least 2: {0}", v);
+    }
+
+#ifdef VPUX_DEVELOPER_BUILD
+    static StringRef envVar() {
+        return "IE_NPU_DYNAMIC_BATCH_SIZE";
+    }
+#endif
+
+    static bool isPublic() {
+        return false;
+    }
+
+    static OptionMode mode() {
+        return OptionMode::RunTime;
+    }
+};
+
+//
+// DYNAMIC_BATCH_TIMEOUT
+//
+
+struct DYNAMIC_BATCH_TIMEOUT final : OptionBase<DYNAMIC_BATCH_TIMEOUT, int64_t> {
+    static StringRef key() {
+        return ov::intel_vpux::dynamic_batch_timeout.name();
+    }
+
+    static int64_t defaultValue() {
+        return 1000;
+    }
+
+    static void validateValue(int64_t v) {
+        VPUX_THROW_UNLESS(v >= 0, "DYNAMIC_BATCH_TIMEOUT can't be negative: {0}", v);
+    }
+
+#ifdef VPUX_DEVELOPER_BUILD
+    static StringRef envVar() {
+        return "IE_NPU_DYNAMIC_BATCH_TIMEOUT";
+    }
+#endif
+
+    static bool isPublic() {
+        return false;
+    }
+
+    static OptionMode mode() {
+        return OptionMode::RunTime;
+    }
+};
+
 //
 // NUM_STREAMS
 //
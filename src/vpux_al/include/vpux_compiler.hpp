@@ -6,7 +6,10 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <set>
+#include <vector>
 
 #include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
 #include <ie_icnn_network.hpp>
@@ -119,6 +122,12 @@ public:
      */
     virtual int getNumStreams() const = 0;
 
+    /**
+     * @brief Frees the host copy of the compiled model, getCompiledNetwork() returns an empty blob afterwards
+     */
+    virtual void releaseCompiledNetwork() {
+    }
+
     virtual ~INetworkDescription() = default;
 };
 
@@ -133,6 +142,7 @@ class NetworkDescription final {
 public:
     using Ptr = std::shared_ptr<NetworkDescription>;
     using CPtr = std::shared_ptr<const NetworkDescription>;
+    using BlobSource = std::function<std::vector<char>()>;
 
     NetworkDescription(INetworkDescription::Ptr impl, const std::shared_ptr<void>& so = {});
     NetworkDescription(const NetworkDescription&) = default;
@@ -177,8 +187,23 @@ public:
         return _impl->getNumStreams();
     }
 
+    /**
+     * @brief Frees the host copy of the compiled model
+     * @param source reads the same compiled model again, it is used by readCompiledNetwork() afterwards
+     */
+    void releaseCompiledNetwork(BlobSource source);
+
+    /**
+     * @brief Returns a copy of the compiled model, which is read from the original source if it was released
+     * @details Throws if the compiled model read from the source differs from the released one in size or checksum
+     */
+    std::vector<char> readCompiledNetwork() const;
+
 private:
     INetworkDescription::Ptr _impl;
+    BlobSource _blobSource;
+    std::size_t _releasedSize = 0;
+    std::uint64_t _releasedChecksum = 0;
 
     // Keep pointer to `_so` to avoid shared library unloading prior destruction of the `_impl` object.
     std::shared_ptr<void> _so;
@@ -270,8 +295,9 @@ public:
         return _impl->query(model, config);
     }
 
-    std::shared_ptr<vpux::NetworkDescription> parse(const std::vector<char>& network, const Config& config) {
-        return std::make_shared<NetworkDescription>(_impl->parse(network, config, ""), _impl);
+    std::shared_ptr<vpux::NetworkDescription> parse(const std::vector<char>& network, const Config& config,
+                                                    const std::string& netName = "") {
+        return std::make_shared<NetworkDescription>(_impl->parse(network, config, netName), _impl);
     }
 
     std::shared_ptr<vpux::NetworkDescription> parse(const std::string& filename, const Config& config) {
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <map>
 #include <openvino/runtime/properties.hpp>
 #include <string>
 #include <vpux/utils/core/error.hpp>
@@ -377,5 +378,66 @@ static constexpr ov::Property<ElfCompilerBackend> use_elf_compiler_backend{"NPU_
  */
 static constexpr ov::Property<int64_t> create_executor{"NPU_CREATE_EXECUTOR"};
 
+/**
+ * @brief [Only for VPUX Plugin]
+ * Type: integer, default is 2 GB
+ * Maximum total size in bytes of the compiled models kept by the plugin in the CACHE_DIR directory.
+ * The least recently used models are removed when the limit is exceeded. 0 disables the limit.
+ */
+static constexpr ov::Property<int64_t> cache_max_size{"NPU_CACHE_MAX_SIZE"};
+
+/**
+ * @brief [Only for VPUX Plugin]
+ * Type: bool, default is false
+ * When enabled, the network is loaded to all devices of the compilation platform
+ * and every new infer request is assigned to the device with the fewest live requests
+ */
+static constexpr ov::Property<bool> multi_device_execution{"NPU_MULTI_DEVICE_EXECUTION"};
+
+/**
+ * @brief [Only for VPUX Plugin]
+ * Type: integer, default is 0
+ * Maximum number of inferences of all networks in flight on the same Level Zero device. Inferences above the limit
+ * wait on the host: HIGH priority ones go first, MEDIUM and LOW priority ones share the device 4:1.
+ * The device uses the smallest non-zero value among the loaded networks. 0 disables the limit.
+ */
+static constexpr ov::Property<int64_t> max_inflight_inferences{"NPU_MAX_INFLIGHT_INFERENCES"};
+
+/**
+ * @brief [Only for VPUX Plugin]
+ * Type: std::map<std::string, uint64_t>
+ * Read-only property to get the time spent by the inferences waiting for the device on the host, per priority:
+ * "<PRIORITY>_COUNT", "<PRIORITY>_TOTAL_US" and "<PRIORITY>_MAX_US" for LOW, MEDIUM and HIGH priorities.
+ */
+static constexpr ov::Property<std::map<std::string, uint64_t>, ov::PropertyMutability::RO> queueing_delays{
+        "NPU_QUEUEING_DELAYS"};
+
+/**
+ * @brief [Only for VPUX Plugin]
+ * Type: integer, default is 0
+ * With the THROUGHPUT performance hint, a variant of the model with this batch size is compiled along with the
+ * batch 1 one. Asynchronous batch 1 requests started within DYNAMIC_BATCH_TIMEOUT are run together by the batched
+ * variant, a request left alone is run by the batch 1 model. If the batched variant can't be used (e.g. stateful or
+ * imported models), the requests started together are submitted to the device at once. 0 disables the dynamic
+ * batching.
+ */
+static constexpr ov::Property<int64_t> dynamic_batch_size{"NPU_DYNAMIC_BATCH_SIZE"};
+
+/**
+ * @brief [Only for VPUX Plugin]
+ * Type: integer, default is 1000
+ * Time in microseconds the first request of a dynamic batch waits for the other ones
+ */
+static constexpr ov::Property<int64_t> dynamic_batch_timeout{"NPU_DYNAMIC_BATCH_TIMEOUT"};
+
+/**
+ * @brief [Only for VPUX Plugin]
+ * Type: std::map<std::string, uint64_t>
+ * Read-only property of the executable network to get the dynamic batching statistics: "BATCHES", "BATCHED_REQUESTS",
+ * "SINGLE_REQUESTS", "ADDED_LATENCY_TOTAL_US", "ADDED_LATENCY_MAX_US" and "THROUGHPUT_FPS".
+ */
+static constexpr ov::Property<std::map<std::string, uint64_t>, ov::PropertyMutability::RO> dynamic_batching_stats{
+        "NPU_DYNAMIC_BATCHING_STATS"};
+
 }  // namespace intel_vpux
 }  // namespace ov
@@ -20,6 +20,7 @@ void vpux::registerCommonOptions(OptionsDesc& desc) {
     desc.add<PLATFORM>();
     desc.add<DEVICE_ID>();
     desc.add<CACHE_DIR>();
+    desc.add<CACHE_MAX_SIZE>();
 }
 
 //
@@ -20,6 +20,10 @@ void vpux::registerRunTimeOptions(OptionsDesc& desc) {
     desc.add<PROFILING_OUTPUT_FILE>();
     desc.add<MODEL_PRIORITY>();
     desc.add<CREATE_EXECUTOR>();
+    desc.add<MULTI_DEVICE_EXECUTION>();
+    desc.add<MAX_INFLIGHT_INFERENCES>();
+    desc.add<DYNAMIC_BATCH_SIZE>();
+    desc.add<DYNAMIC_BATCH_TIMEOUT>();
     desc.add<NUM_STREAMS>();
 }
 
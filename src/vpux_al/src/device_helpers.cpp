@@ -4,7 +4,9 @@
 //
 
 #include <device_helpers.hpp>
+#include <algorithm>
 #include <iostream>
+#include <iterator>
 
 const static std::map<uint32_t, InferenceEngine::VPUXConfigParams::VPUXPlatform> platformIdMap = {
         {0, InferenceEngine::VPUXConfigParams::VPUXPlatform::VPU3700},  // VPU30XX
@@ -164,3 +166,23 @@ bool utils::isDeviceNameVpualDeprecated(const std::string& deviceName) {
 
     return false;
 }
+
+std::string utils::resolveDeviceName(const std::string& deviceName, const std::vector<std::string>& availableNames) {
+    if (std::find(availableNames.begin(), availableNames.end(), deviceName) != availableNames.end()) {
+        return deviceName;
+    }
+    if (deviceName.find('.') != std::string::npos || availableNames.empty()) {
+        return {};
+    }
+    return availableNames.front();
+}
+
+std::vector<std::string> utils::getPlatformDeviceNames(const std::string& platformName,
+                                                       const std::vector<std::string>& availableNames) {
+    std::vector<std::string> platformNames;
+    std::copy_if(availableNames.begin(), availableNames.end(), std::back_inserter(platformNames),
+                 [&](const std::string& name) {
+                     return name.substr(0, name.rfind('.')) == platformName;
+                 });
+    return platformNames;
+}
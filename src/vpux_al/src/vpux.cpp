@@ -5,6 +5,7 @@
 
 #include "vpux.hpp"
 
+#include <exception>
 #include <memory>
 #include <openvino/util/shared_object.hpp>
 
@@ -92,6 +93,51 @@ void* Allocator::wrapRemoteMemory(const ie::ParamMap&) noexcept {
     std::cerr << "Wrapping remote memory not implemented" << std::endl;
     return nullptr;
 }
+
+void IInferRequest::InferBatch(const std::vector<IInferRequest::Ptr>& others) {
+    std::vector<IInferRequest*> requests = {this};
+    for (const auto& request : others) {
+        requests.push_back(request.get());
+    }
+
+    const auto maxInFlight = getMaxInFlight();
+    const auto window = maxInFlight != 0 ? maxInFlight : requests.size();
+
+    // Every started inference is waited for, even if the batch fails, so none of the requests is left running
+    size_t numStarted = 0;
+    size_t numFinished = 0;
+    std::exception_ptr error;
+    const auto finishNext = [&]() {
+        try {
+            requests[numFinished]->GetResult();
+        } catch (...) {
+            if (error == nullptr) {
+                error = std::current_exception();
+            }
+        }
+        ++numFinished;
+    };
+
+    while (numStarted < requests.size() && error == nullptr) {
+        if (numStarted - numFinished == window) {
+            finishNext();
+            continue;
+        }
+        try {
+            requests[numStarted]->InferAsync();
+            ++numStarted;
+        } catch (...) {
+            error = std::current_exception();
+        }
+    }
+    while (numFinished < numStarted) {
+        finishNext();
+    }
+    if (error != nullptr) {
+        std::rethrow_exception(error);
+    }
+}
+
 std::shared_ptr<Allocator> IDevice::getAllocator(const ie::ParamMap&) const {
     IE_THROW() << "Not supported";
 }
@@ -108,4 +154,8 @@ uint32_t IDevice::getDriverVersion() const {
     IE_THROW() << "Get VPU driver version is not supported with this backend";
 }
 
+std::map<ov::hint::Priority, QueueingDelay> IDevice::getQueueingDelays() const {
+    IE_THROW() << "Get queueing delays is not supported with this backend";
+}
+
 }  // namespace vpux
@@ -14,7 +14,9 @@
 #include <file_utils.h>
 #include <openvino/util/shared_object.hpp>
 
+#include <cstdint>
 #include <fstream>
+#include <utility>
 
 #ifdef OPENVINO_STATIC_LIBRARY
 
@@ -39,6 +41,36 @@ vpux::NetworkDescription::NetworkDescription(INetworkDescription::Ptr impl, cons
     }
 }
 
+// FNV-1a, it only detects the compiled model files modified after the import
+static std::uint64_t checksum(const std::vector<char>& data) {
+    std::uint64_t result = 14695981039346656037ull;
+    for (const char c : data) {
+        result = (result ^ static_cast<std::uint8_t>(c)) * 1099511628211ull;
+    }
+    return result;
+}
+
+void vpux::NetworkDescription::releaseCompiledNetwork(BlobSource source) {
+    const auto& compiledNetwork = _impl->getCompiledNetwork();
+    _releasedSize = compiledNetwork.size();
+    _releasedChecksum = checksum(compiledNetwork);
+    _blobSource = std::move(source);
+    _impl->releaseCompiledNetwork();
+}
+
+std::vector<char> vpux::NetworkDescription::readCompiledNetwork() const {
+    if (!_blobSource) {
+        return _impl->getCompiledNetwork();
+    }
+
+    auto compiledNetwork = _blobSource();
+    if (compiledNetwork.size() != _releasedSize || checksum(compiledNetwork) != _releasedChecksum) {
+        IE_THROW() << "Compiled network read from the source differs from the imported one (" << compiledNetwork.size()
+                   << " bytes instead of " << _releasedSize << "), it was modified after the import";
+    }
+    return compiledNetwork;
+}
+
 static std::string extractFileName(const std::string& fullPath) {
     const size_t lastSlashIndex = fullPath.find_last_of("/\\");
     return fullPath.substr(lastSlashIndex + 1);
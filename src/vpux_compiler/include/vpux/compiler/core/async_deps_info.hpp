@@ -18,6 +18,14 @@
 
 namespace vpux {
 
+//
+// AsyncDepsInfo
+//
+// The analysis indexes 'async.execute' operations in IR order. A pass may mark it as preserved
+// if it keeps the dependencies in sync with the IR (addDependency/optimizeDepsMap + updateTokenDependencies)
+// and neither reorders nor inserts 'async.execute' operations.
+//
+
 class AsyncDepsInfo final {
 public:
     explicit AsyncDepsInfo(mlir::func::FuncOp func);
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "vpux/compiler/utils/passes.hpp"
+#include "vpux/compiler/utils/rewriter.hpp"
 
 #include "vpux/utils/core/logger.hpp"
 
@@ -19,6 +20,8 @@ namespace vpux {
 //
 
 std::unique_ptr<mlir::Pass> createMoveDeclarationsToTopPass(Logger log = Logger::global());
+std::unique_ptr<mlir::Pass> createIncrementalCanonicalizerPass(
+        const mlir::GreedyRewriteConfig& config = getDefaultGreedyRewriteConfig(), Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createPrintDotPass(StringRef fileName = {}, StringRef startAfter = {},
                                                StringRef stopBefore = {}, bool printConst = false,
                                                bool printDeclarations = false);
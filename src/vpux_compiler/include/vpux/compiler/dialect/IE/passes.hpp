@@ -64,7 +64,7 @@ void buildAdjustLayoutPipeline(mlir::OpPassManager& pm, const AdjustLayoutOption
 
 std::unique_ptr<mlir::Pass> createAdjustLayoutsPass(const bool seOpsEnabled = false, Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createOptimizeReordersPass(const bool seOpsEnabled = false, Logger log = Logger::global());
-std::unique_ptr<mlir::Pass> createUniquifyOpsPass(Logger log = Logger::global());
+std::unique_ptr<mlir::Pass> createUniquifyOpsPass(const bool canonicalize = false, Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createRemoveIdentityPoolPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createConvertToMemPermutePass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createLegalizeNDMemPermutePass(Logger log = Logger::global());
@@ -266,6 +266,10 @@ std::unique_ptr<mlir::Pass> createHandleLargePadsPass(Logger log = Logger::globa
 std::unique_ptr<mlir::Pass> createNormalizeL2FusionPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createConvertMemPermuteToPoolPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createLogOpOptimizationsPass();
+std::unique_ptr<mlir::Pass> createAddDebugOutputsPass(StringRef layerNames = "", Logger log = Logger::global());
+std::unique_ptr<mlir::Pass> createOutlinePartitionsPass(int64_t numPartitions = 1, int64_t minPartitionSize = 64,
+                                                        Logger log = Logger::global());
+std::unique_ptr<mlir::Pass> createInlinePartitionsPass(Logger log = Logger::global());
 
 //
 // Generic Optimizations
@@ -180,16 +180,17 @@ mlir::LogicalResult areDistributionModesCompatible(DistributionMode sourceMode,
 mlir::LogicalResult areDistributionNumClustersCompatible(mlir::IntegerAttr sourceNumClusters,
                                                          mlir::IntegerAttr targetNumClusters);
 mlir::LogicalResult areDistributionElementTypesCompatible(mlir::Type inType, mlir::Type outType);
-SmallVector<Shape> getPerClusterComputeShapes(ShapeRef shapeRef, DistributedTensorAttr distributionAttr);
-SmallVector<Shape> getPerClusterComputeShapeOffsets(ShapeRef shapeRef, DistributedTensorAttr distributionAttr);
-SmallVector<Shape> getPerClusterMemoryShapes(ShapeRef shapeRef, DistributedTensorAttr distributionAttr);
-SmallVector<Shape> getPerClusterMemoryShapeOffsets(ShapeRef shapeRef, DistributedTensorAttr distributionAttr);
+ArrayRef<Shape> getPerClusterComputeShapes(ShapeRef shapeRef, DistributedTensorAttr distributionAttr);
+ArrayRef<Shape> getPerClusterComputeShapeOffsets(ShapeRef shapeRef, DistributedTensorAttr distributionAttr);
+ArrayRef<Shape> getPerClusterMemoryShapes(ShapeRef shapeRef, DistributedTensorAttr distributionAttr);
+ArrayRef<Shape> getPerClusterMemoryShapeOffsets(ShapeRef shapeRef, DistributedTensorAttr distributionAttr);
 SmallVector<PadInfo> getPerClusterPadding(DistributedTensorAttr distributionAttr, PadInfo kernelPadding);
 SmallVector<StridedShape> getPerClusterMemoryStridedShapes(ShapeRef shape, StridesRef strides, DimsOrder dimsOrder,
                                                            DistributionModeAttr mode, ArrayRef<Shape> memoryShapes);
 int64_t getDistributedTilingAxis(ArrayRef<int64_t> tilingScheme);
 bool isDistributedAttrWithExplicitShapesAndOffsets(DistributedTensorAttr distributionAttr);
 SmallVector<Shape> arrayAttrToVecOfShapes(mlir::ArrayAttr arr);
+ArrayRef<Shape> getCachedShapes(mlir::ArrayAttr arr);
 
 bool isSegmentedOverH(VPU::DistributedTensorAttr distAttr);
 bool isSegmentedOverC(VPU::DistributedTensorAttr distAttr);
@@ -80,6 +80,11 @@ struct TilingOptions : mlir::PassPipelineOptions<TilingOptions> {
 
     BoolOption enableVerticalFusion{*this, "vertical-fusion", llvm::cl::desc("Enable vertical fusion feature"),
                                     llvm::cl::init(false)};
+
+    BoolOption enableVFGlobalPartitioning{
+            *this, "vertical-fusion-global-partitioning",
+            llvm::cl::desc("Choose vertical fusion region boundaries by global partitioning of VF chains"),
+            llvm::cl::init(false)};
     // Extended Tiling options - Incremental Pipeline
     BoolOption readStrategyFromJson{*this, "read-strategy-from-json",
                                     llvm::cl::desc("Read the multiclustering and tiling strategy from a JSON file"),
@@ -94,6 +99,11 @@ struct TilingOptions : mlir::PassPipelineOptions<TilingOptions> {
             llvm::cl::desc("Enable DistributedTensorAttr with explicit per cluster memory/compute shapes & offsets"),
             llvm::cl::init(false)};
 
+    StrOption profiledCostsFile{
+            *this, "profiled-costs-file",
+            llvm::cl::desc("Profiling report of a previous run, measured layer costs override VPUNN estimates"),
+            llvm::cl::init("")};
+
     TilingOptions() = default;
 
     template <
@@ -102,9 +112,11 @@ struct TilingOptions : mlir::PassPipelineOptions<TilingOptions> {
     explicit TilingOptions(const OtherOptions& options) {
         enablePrefetchTiling = options.enablePrefetchTiling;
         enableVerticalFusion = options.enableVerticalFusion;
+        enableVFGlobalPartitioning = options.enableVFGlobalPartitioning;
         readStrategyFromJson = options.readStrategyFromJson;
         writeStrategyToJson = options.writeStrategyToJson;
         enableExplicitDistributedTensorAttr = options.enableExplicitDistributedTensorAttr;
+        profiledCostsFile = options.profiledCostsFile;
     }
 };
 
@@ -131,6 +143,8 @@ std::unique_ptr<mlir::Pass> createManualStrategyUtilsPass(bool writeStrategyToJS
                                                           bool readStrategyFromJSON = false,
                                                           StringRef readStrategyFileLocation = "strategy_in.json",
                                                           Logger log = Logger::global());
+std::unique_ptr<mlir::Pass> createApplyProfiledCostsPass(StringRef profiledCostsFile = "",
+                                                         Logger log = Logger::global());
 
 std::unique_ptr<mlir::Pass> createResolvePWLPostOpsPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createDetectionOutputDecompositionPass(Logger log = Logger::global());
@@ -170,7 +184,8 @@ std::unique_ptr<mlir::Pass> createTilingStrategyAssignmentPass(bool enablePrefet
 std::unique_ptr<mlir::Pass> createApplyTilingPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createTileOverHForVFPass(bool enablePrefetchTiling = true, Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createWrapVerticalFusionRegionPass(Logger log = Logger::global());
-std::unique_ptr<mlir::Pass> createMergeVfSubgraphsPass(Logger log = Logger::global());
+std::unique_ptr<mlir::Pass> createMergeVfSubgraphsPass(bool enableGlobalPartitioning = false,
+                                                       Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createVfTilingPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createUnrollUnusedVerticalFusionRegionPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createRollBackTilingStrategyPass(bool enablePrefetchTiling = true,
@@ -0,0 +1,48 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include "vpux/compiler/core/attributes/shape.hpp"
+
+#include "vpux/utils/core/array_ref.hpp"
+#include "vpux/utils/core/func_ref.hpp"
+#include "vpux/utils/core/small_vector.hpp"
+
+#include <mlir/IR/Attributes.h>
+
+#include <llvm/Support/RWMutex.h>
+
+#include <map>
+#include <tuple>
+
+namespace vpux {
+namespace VPU {
+
+//
+// PerClusterLayoutCache
+//
+
+// Per-cluster shapes and offsets of the distributed types depend only on the full shape and the distribution
+// attribute, so they are computed once per context. The explicit shapes and offsets attached to the distribution
+// are parsed once as well. The cache is owned by the VPU dialect and is thread-safe.
+// The returned arrays are valid as long as the context is alive, so the callers keep the views instead of copies.
+class PerClusterLayoutCache final {
+public:
+    enum class Kind { ComputeShapes, ComputeShapeOffsets, MemoryShapes, MemoryShapeOffsets, ExplicitShapes };
+
+    ArrayRef<Shape> getOrCompute(Kind kind, ShapeRef shape, mlir::Attribute distribution,
+                                 FuncRef<SmallVector<Shape>()> compute);
+
+private:
+    using Key = std::tuple<Kind, const void*, SmallVector<int64_t>>;
+
+    // std::map never moves its nodes, so the views to the cached arrays are stable
+    std::map<Key, SmallVector<Shape>> _layouts;
+    llvm::sys::SmartRWMutex<true> _mutex;
+};
+
+}  // namespace VPU
+}  // namespace vpux
@@ -0,0 +1,38 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include "vpux/compiler/dialect/VPU/attributes.hpp"
+
+#include "vpux/utils/core/optional.hpp"
+#include "vpux/utils/core/string_ref.hpp"
+
+#include <llvm/ADT/StringMap.h>
+#include <mlir/IR/Operation.h>
+
+namespace vpux {
+namespace VPU {
+
+// Records the measured cost of the operation, it is set by ApplyProfiledCosts pass:
+//   profiledCost = {strategy = #VPU.multi_cluster_strategy<...>, cycles = N : i64}
+constexpr StringLiteral profiledCostAttrName = "profiledCost";
+
+// Execution time in nanoseconds of the compute tasks (DPU, SW, UPA) of each layer, collected from
+// a profiling report in trace events format. Layers are identified by the original layer name,
+// which is the task name up to the first LOCATION_ORIGIN_SEPARATOR.
+llvm::StringMap<int64_t> parseProfiledLayerDurations(StringRef traceEvents);
+llvm::StringMap<int64_t> readProfiledLayerDurations(StringRef fileName);
+
+// The original layer name of the operation, it matches the names of the layers in the profiling report
+std::string getProfiledLayerName(mlir::Location loc);
+
+void setProfiledCost(mlir::Operation* op, VPU::MultiClusterStrategy strategy, int64_t cycles);
+
+// Returns the measured cost in cycles if the operation was profiled with the same strategy
+Optional<double> getProfiledCost(mlir::Operation* op, VPU::MultiClusterStrategy strategy);
+
+}  // namespace VPU
+}  // namespace vpux
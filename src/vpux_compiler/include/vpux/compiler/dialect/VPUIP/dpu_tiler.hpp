@@ -13,6 +13,7 @@
 
 #include <vpu_cost_model.h>
 
+#include <limits>
 #include <set>
 #include <tuple>
 
@@ -65,8 +66,11 @@ private:
     VPU::MPEMode _mpeMode;
 };
 
+// In case the lower bound of the split cost exceeds costLimit, the evaluation stops early
+// and the returned value is that lower bound, which is still greater than costLimit
 int64_t computeSplitCost(const WorkloadSplit& split, const WorkloadCostParams& params,
-                         const std::shared_ptr<VPUNN::VPUCostModel>& costModel, Logger log = Logger::global());
+                         const std::shared_ptr<VPUNN::VPUCostModel>& costModel, Logger log = Logger::global(),
+                         int64_t costLimit = std::numeric_limits<int64_t>::max());
 VPUNN::Operation getOperationType(VPUIP::NCETaskType taskType);
 
 }  // namespace VPUIP
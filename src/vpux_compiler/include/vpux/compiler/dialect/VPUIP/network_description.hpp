@@ -27,6 +27,10 @@ public:
         return _compiledNetwork.size();
     }
 
+    void releaseCompiledNetwork() final {
+        std::vector<char>().swap(_compiledNetwork);
+    }
+
     const std::string& getName() const final {
         return _name;
     }
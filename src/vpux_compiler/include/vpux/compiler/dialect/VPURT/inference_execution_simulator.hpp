@@ -20,6 +20,11 @@ struct TaskConfig {
     SmallVector<int64_t> virtBarrierUpdates;
     int64_t cycleCost = -1;
     int64_t cycleStart = -1;
+    // Cycles the executor was free but the task waited for its barriers
+    int64_t barrierStallCycles = 0;
+    // Task whose end determined the start of this one, either the previous task
+    // on the same executor or the last producer of the latest released wait barrier
+    VPURT::TaskOp dependency = nullptr;
 
     TaskConfig(VPURT::TaskOp taskOp, SmallVector<int64_t>& virtBarrierWaitVec,
                SmallVector<int64_t>& virtBarrierUpdateVec, int64_t cost);
@@ -33,6 +38,7 @@ class BarrierConfig {
 private:
     size_t _producerCount = 0;
     size_t _lastCycleUpdate = 0;
+    VPURT::TaskOp _lastProducer = nullptr;
 
 public:
     bool isReleased() {
@@ -43,11 +49,20 @@ public:
         _producerCount++;
     }
 
-    void decrementAtCycle(size_t cycle) {
+    void decrementAtCycle(size_t cycle, VPURT::TaskOp producer = nullptr) {
+        if (cycle >= _lastCycleUpdate) {
+            _lastProducer = producer;
+        }
         _lastCycleUpdate = std::max(_lastCycleUpdate, cycle);
         _producerCount--;
     }
 
+    // Producer which released the barrier
+    VPURT::TaskOp getLastProducer() {
+        VPUX_THROW_UNLESS(_producerCount == 0, "Barrier was not yet released");
+        return _lastProducer;
+    }
+
     size_t getReleaseCycle() {
         VPUX_THROW_UNLESS(_producerCount == 0, "Barrier was not yet released");
         return _lastCycleUpdate;
@@ -69,6 +84,12 @@ public:
     void updateCyclesInIR();
     int64_t getTaskCycleCost(VPURT::TaskOp taskOp);
 
+    const std::map<VPURT::TaskQueueType, SmallVector<TaskConfig>>& getQueueTasks() const;
+    // Number of executors serving the queue, larger than 1 if tasks are dispatched to them only at inference
+    int64_t getNumOfExecutors(VPURT::TaskQueueType queueType) const;
+    // Chain of dependent tasks from the start of the inference to the task which ends last
+    SmallVector<TaskConfig> getCriticalPath();
+
 private:
     void parseFunc();
 
@@ -91,5 +112,12 @@ private:
     std::set<std::string> _layersWithInvalidCost;
 };
 
+// Helper function used by logger to create clear string about executor instance
+// that a given task has executed on. Examples:
+// - DMA_NN[port = 0, channel = DDR]
+// - NCE[cluster = 0]
+// - SHAVE_ACT[cluster = 0]
+std::string getTaskQueueInfoString(VPURT::TaskQueueType taskType, VPURT::TaskOp taskOp);
+
 }  // namespace VPURT
 }  // namespace vpux
@@ -33,7 +33,8 @@ std::unique_ptr<mlir::Pass> createReduceExceedingActiveCountBarriersPass(Logger
 std::unique_ptr<mlir::Pass> createAssignPhysicalBarriersPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createBarrierSimulationPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createInferenceExecutionAnalysisPass(
-        std::string compileSchedTraceFileName = "compileTimeScheduleTrace.json", Logger log = Logger::global());
+        std::string compileSchedTraceFileName = "compileTimeScheduleTrace.json", std::string reportFileName = "",
+        int64_t reportTopLayers = 10, Logger log = Logger::global());
 
 //
 // Registration
@@ -0,0 +1,28 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include "vpux/compiler/dialect/VPU/json.hpp"
+#include "vpux/compiler/dialect/VPURT/inference_execution_simulator.hpp"
+
+namespace vpux {
+namespace VPURT {
+
+// Kind of data moved by a DMA task, classified by the source and destination buffers
+enum class DMATransferKind { Prefetch, SpillWrite, SpillRead, Other };
+
+DMATransferKind getDMATransferKind(VPURT::TaskOp taskOp);
+
+// Builds machine-readable analysis of the schedule simulated by InferenceExecutionSimulator:
+//  - "critical_path": chain of dependent tasks which defines the inference latency;
+//  - "executors": busy, idle and barrier stall cycles of each DPU cluster, SHAVE and DMA port/channel queue;
+//  - "dma": bytes moved by prefetches of constants and by spills between CMX and DDR;
+//  - "top_layers": topNLayers layers contributing the most cycles to the critical path.
+// All durations are in DPU cycles, the frequency allows translation to time units.
+VPU::Json createScheduleAnalysisReport(InferenceExecutionSimulator& infSim, double freqInMHz, size_t topNLayers);
+
+}  // namespace VPURT
+}  // namespace vpux
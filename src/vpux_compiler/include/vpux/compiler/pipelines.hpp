@@ -26,6 +26,11 @@ mlir::Optional<VPU::MemoryKind> getMemKind(StringRef) {
     return KIND;
 }
 
+constexpr StringLiteral CONSTANT_FOLDING_DESCRIPTION =
+        "Fold constants at the end of the pipeline. When disabled, constants keep their base content with "
+        "transformations and are folded one by one during export, so the folded weights are never interned in the "
+        "context, which reduces peak memory usage for models with large weights";
+
 //
 // ReferenceSWMode
 //
@@ -50,6 +55,9 @@ struct ReferenceSWOptions : mlir::PassPipelineOptions<T> {
                                       llvm::cl::desc("Enable storage element pointer operations"),
                                       llvm::cl::init(false)};
 
+    BoolOption enableConstantFolding{*this, "constant-folding", llvm::cl::desc(CONSTANT_FOLDING_DESCRIPTION),
+                                     llvm::cl::init(false)};
+
     bool enableForceZMajorConcat = false;
     bool enableSwapTransposeWithFQ = false;
     bool enableAlignScales = false;
@@ -127,6 +135,10 @@ struct ReferenceHWOptions : mlir::PassPipelineOptions<T> {
                                     llvm::cl::init(true)};
     BoolOption enableVerticalFusion{*this, "vertical-fusion", llvm::cl::desc("Enable vertical fusion feature"),
                                     llvm::cl::init(true)};
+    BoolOption enableVFGlobalPartitioning{
+            *this, "vertical-fusion-global-partitioning",
+            llvm::cl::desc("Choose vertical fusion region boundaries by global partitioning of VF chains"),
+            llvm::cl::init(false)};
 
     BoolOption enableOptimizeCopies{*this, "optimize-copies", llvm::cl::desc("Enable optimize-copies pass"),
                                     llvm::cl::init(true)};
@@ -197,6 +209,14 @@ struct ReferenceHWOptions : mlir::PassPipelineOptions<T> {
 
     BoolOption enableSMPipeline{*this, "enable-SM-Pipeline", llvm::cl::desc("Enable Strategy Manager pipeline"),
                                 llvm::cl::init(false)};
+
+    StrOption profiledCostsFile{
+            *this, "profiled-costs-file",
+            llvm::cl::desc("Profiling report of a previous run, measured layer costs override VPUNN estimates"),
+            llvm::cl::init("")};
+
+    BoolOption enableConstantFolding{*this, "constant-folding", llvm::cl::desc(CONSTANT_FOLDING_DESCRIPTION),
+                                     llvm::cl::init(false)};
 };
 
 struct ReferenceHWOptionsBase final : public ReferenceHWOptions<ReferenceHWOptionsBase> {};
@@ -307,6 +327,10 @@ struct DefaultHWOptions : mlir::PassPipelineOptions<T> {
                                     llvm::cl::init(true)};
     BoolOption enableVerticalFusion{*this, "vertical-fusion", llvm::cl::desc("Enable vertical fusion feature"),
                                     llvm::cl::init(true)};
+    BoolOption enableVFGlobalPartitioning{
+            *this, "vertical-fusion-global-partitioning",
+            llvm::cl::desc("Choose vertical fusion region boundaries by global partitioning of VF chains"),
+            llvm::cl::init(false)};
 
     BoolOption enableConstantFusion{*this, "constant-fusion", llvm::cl::desc("Enable constant fusion"),
                                     llvm::cl::init(true)};
@@ -337,6 +361,11 @@ struct DefaultHWOptions : mlir::PassPipelineOptions<T> {
     BoolOption enableSMPipeline{*this, "enable-SM-Pipeline", llvm::cl::desc("Enable Strategy Manager pipeline"),
                                 llvm::cl::init(false)};
 
+    StrOption profiledCostsFile{
+            *this, "profiled-costs-file",
+            llvm::cl::desc("Profiling report of a previous run, measured layer costs override VPUNN estimates"),
+            llvm::cl::init("")};
+
     BoolOption enableScheduleTrace{*this, "enable-schedule-trace",
                                    llvm::cl::desc("Enable compile time schedule analysis and trace"),
                                    llvm::cl::init(false)};
@@ -345,9 +374,27 @@ struct DefaultHWOptions : mlir::PassPipelineOptions<T> {
                                 llvm::cl::desc("Compile time schedule JSON trace file name"),
                                 llvm::cl::init("compileTimeScheduleTrace.json")};
 
+    StrOption scheduleReportFile{
+            *this, "schedule-report-file-name",
+            llvm::cl::desc("Compile time schedule analysis report JSON file name, the report is not created if empty"),
+            llvm::cl::init("")};
+
     BoolOption logOpOptimizations{*this, "log-op-optimizations",
                                   llvm::cl::desc("Log potential operation optimizations that can be done"),
                                   llvm::cl::init(false)};
+
+    BoolOption enableConstantFolding{*this, "constant-folding", llvm::cl::desc(CONSTANT_FOLDING_DESCRIPTION),
+                                     llvm::cl::init(false)};
+
+    StrOption debugOutputs{*this, "debug-outputs",
+                           llvm::cl::desc("Comma separated list of the layers to expose as extra network outputs"),
+                           llvm::cl::init("")};
+
+    IntOption numberOfIEPartitions{
+            *this, "ie-partitions",
+            llvm::cl::desc("Number of functions the IE dialect part of the network is split into to be compiled "
+                           "concurrently"),
+            llvm::cl::init(1)};
 };
 
 struct DefaultHWOptionsBase final : public DefaultHWOptions<DefaultHWOptionsBase> {};
@@ -0,0 +1,79 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include "vpux/utils/core/logger.hpp"
+#include "vpux/utils/core/small_vector.hpp"
+#include "vpux/utils/core/string_ref.hpp"
+
+#include <mlir/Dialect/Func/IR/FuncOps.h>
+#include <mlir/IR/Operation.h>
+#include <mlir/Pass/AnalysisManager.h>
+#include <mlir/Rewrite/FrozenRewritePatternSet.h>
+#include <mlir/Transforms/GreedyPatternRewriteDriver.h>
+
+#include <llvm/ADT/DenseMap.h>
+#include <llvm/ADT/StringMap.h>
+
+namespace vpux {
+
+//
+// IncrementalRewriteInfo
+//
+
+// Snapshots of a function taken after the pattern sets applied to it converged, one per pattern set.
+// A snapshot keeps an exact description of every operation: name, attributes, operands, result types and the number
+// of uses of each result. The operations whose description differs from the snapshot were changed since the patterns
+// converged and are the only ones the patterns need to visit again.
+//
+// Every snapshot entry is checked against the IR before it is used, so the analysis stays valid whatever the passes
+// in between preserve. The MLIR invalidation would drop it after each pass which is not aware of it, that is almost
+// every pass of the pipeline.
+class IncrementalRewriteInfo final {
+public:
+    using OpDesc = SmallVector<uintptr_t, 8>;
+    using Snapshot = llvm::DenseMap<mlir::Operation*, OpDesc>;
+
+public:
+    explicit IncrementalRewriteInfo(mlir::Operation*) {
+    }
+
+    bool isInvalidated(const mlir::AnalysisManager::PreservedAnalyses&) const {
+        return false;
+    }
+
+public:
+    // Returns nullptr if the pattern set has not converged on the function yet
+    Snapshot* getSnapshot(StringRef patternSetName);
+
+    void capture(StringRef patternSetName, mlir::func::FuncOp func);
+    void reset(StringRef patternSetName);
+
+private:
+    llvm::StringMap<Snapshot> _snapshots;
+};
+
+//
+// applyPatternsToChangedOps
+//
+
+// Applies the patterns greedily as `applyPatternsAndFoldGreedily` does, but seeds the worklist only with the
+// operations changed since the same pattern set converged on the function last time, together with their neighbours
+// within two def-use edges. The neighbours of the rewritten operations are visited by the greedy driver as usual.
+//
+// The pattern set must be identified by the same unique name in all passes which use it. Only the patterns which
+// match a local neighbourhood of the root operation are suitable, the same assumption the greedy driver makes when
+// it revisits the neighbours of rewritten operations only.
+//
+// Returns failure if the patterns did not converge. `isSkipped` is set when there were no changed operations, so the
+// IR was left untouched.
+mlir::LogicalResult applyPatternsToChangedOps(mlir::func::FuncOp func, StringRef patternSetName,
+                                              IncrementalRewriteInfo& info,
+                                              const mlir::FrozenRewritePatternSet& patterns,
+                                              const mlir::GreedyRewriteConfig& config, Logger log,
+                                              bool* isSkipped = nullptr);
+
+}  // namespace vpux
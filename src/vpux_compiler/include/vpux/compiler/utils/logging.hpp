@@ -16,6 +16,10 @@ namespace vpux {
 void addLogging(mlir::MLIRContext& ctx, Logger log);
 void addLogging(mlir::PassManager& pm, Logger log);
 
+// Reports the resident memory of the process after each pass, including the peak reached while it was running.
+// The peak is shared by all passes which run concurrently on different functions.
+void addMemoryReport(mlir::PassManager& pm, Logger log);
+
 class OpBuilderLogger final : public mlir::OpBuilder::Listener {
 public:
     explicit OpBuilderLogger(Logger log): _log(log) {
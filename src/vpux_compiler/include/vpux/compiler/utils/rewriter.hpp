@@ -43,6 +43,13 @@ mlir::LogicalResult convertFunc(mlir::func::FuncOp funcOp, ArrayRef<mlir::Type>
 
 mlir::GreedyRewriteConfig getDefaultGreedyRewriteConfig();
 
+//
+// populateCanonicalizationPatterns
+//
+
+// The same patterns as the upstream canonicalizer applies: the ones of all loaded dialects and registered operations
+void populateCanonicalizationPatterns(mlir::RewritePatternSet& patterns, mlir::MLIRContext* ctx);
+
 //
 // appendLoc
 //
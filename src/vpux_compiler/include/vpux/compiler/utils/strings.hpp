@@ -16,4 +16,7 @@ namespace vpux {
 
 std::string stringifyLocation(mlir::Location location);
 
+// Name of the original layer, which is the first name of the location
+std::string getLayerName(mlir::Location location);
+
 }  // namespace vpux
@@ -21,7 +21,7 @@ void vpux::arch30xx::buildLowerIE2VPUPipeline30XX(mlir::OpPassManager& pm, Logge
 
     pm.addPass(vpux::arch30xx::createConvertIEToVPUNCEPass(log));
     pm.addPass(createConvertLayers2VPUPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 }
 
 //
@@ -39,7 +39,7 @@ void vpux::arch30xx::buildLowerVPU2VPUIP30XXPipeline(mlir::OpPassManager& pm, Lo
 
     pm.addPass(createConvertVPUNCEToVPUIPPass(log));
     pm.addPass(createConvertNCEClusterTilingToVPUIPPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 }
 
 //
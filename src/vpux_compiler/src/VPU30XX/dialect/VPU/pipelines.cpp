@@ -18,6 +18,9 @@ void vpux::VPU::arch30xx::buildIncrementalPipeline(mlir::OpPassManager& pm, cons
     StringRef writeStrategyFileLocation = "strategy_out.json";
     StringRef readStrategyFileLocation = "strategy_in.json";
 
+    if (!options.profiledCostsFile.empty()) {
+        pm.addPass(VPU::createApplyProfiledCostsPass(options.profiledCostsFile, log));
+    }
     pm.addPass(VPU::createMultiClusterStrategyAssignmentPass(log));
     pm.addPass(VPU::createManualStrategyUtilsPass(options.writeStrategyToJson, writeStrategyFileLocation,
                                                   options.readStrategyFromJson, readStrategyFileLocation, log));
@@ -38,7 +38,7 @@ void vpux::buildReferenceSWModePipeline(mlir::OpPassManager& pm, const Reference
     pm.addPass(IE::createNormalizeL2FusionPass(log));
     pm.addPass(IE::createMatMulInputsTo2dPass(log));
     pm.addPass(IE::createConvertMatMulToConvPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     IE::buildAdjustPrecisionPipeline(pm, log);
 
@@ -46,24 +46,24 @@ void vpux::buildReferenceSWModePipeline(mlir::OpPassManager& pm, const Reference
     pm.addPass(IE::createResolveStridedSlicePass(log));
     pm.addPass(IE::createConvertNceOpsTo4DPass(log));
     pm.addPass(IE::createConvertShapeTo4DPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     pm.addPass(IE::createConvertGRNToNormalizeL2Pass(log));
     IE::buildAdjustForVPUPipeline(pm, IE::AdjustForVPUOptions(options), log);
     pm.addPass(IE::arch30xx::createConvertTile2PerAxisTilePass(log));
 
     pm.addPass(IE::createSplitFakeQuantPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     pm.addPass(IE::createDequantizeConstPass(log));
     if (options.enableMergeFakeQuant) {
         pm.addPass(IE::createMergeFakeQuantPass(log));
     }
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     IE::buildAdjustLayoutPipeline(pm, IE::AdjustLayoutOptions(options), log);
     pm.addPass(IE::createConvertAssignReadValueToReturnsAndInputs(log));
 
     pm.addPass(IE::createConvertToMemPermutePass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     // Lowering to VPU
     pm.addPass(createConvertLayers2VPUPass(log));
@@ -77,18 +77,18 @@ void vpux::buildReferenceSWModePipeline(mlir::OpPassManager& pm, const Reference
 
     pm.addPass(createConvertSWLayers2VPUIPUPAPass(log));
     pm.addPass(createConvertLayers2VPUIPPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     // Lowering to VPUIP
     pm.addPass(createConvertLayers2VPUIPPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     // Level 2 : Abstract RunTime
 
     pm.addPass(VPUIP::createSetMemorySpacePass(getMemKind<VPU::MemoryKind::DDR>, log));
 
     pm.addPass(VPUIP::createCopyOpTilingPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     VPUIP::buildAsyncSchedulingPipeline(pm, log);
 
@@ -115,7 +115,9 @@ void vpux::buildReferenceSWModePipeline(mlir::OpPassManager& pm, const Reference
     pm.addPass(VPURT::createAssignPhysicalBarriersPass(log));
     pm.addPass(VPURT::createBarrierSimulationPass(log));
     pm.addPass(VPUIP::createDumpStatisticsOfTaskOpsPass(false, log));
-    pm.addPass(Const::createConstantFoldingPass());
+    if (options.enableConstantFolding) {
+        pm.addPass(Const::createConstantFoldingPass());
+    }
 }
 
 //
@@ -131,7 +133,7 @@ void vpux::buildReferenceHWModePipeline(mlir::OpPassManager& pm, const Reference
     pm.addPass(IE::createNormalizeL2FusionPass(log));
     pm.addPass(IE::createMatMulInputsTo2dPass(log));
     pm.addPass(IE::createConvertMatMulToConvPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     IE::buildAdjustPrecisionPipeline(pm, log);
 
@@ -153,13 +155,13 @@ void vpux::buildReferenceHWModePipeline(mlir::OpPassManager& pm, const Reference
     pm.addPass(IE::createAdaptShapesForScaleShiftPass(log));
     pm.addPass(IE::createResolveStridedSlicePass(log));
     pm.addPass(IE::createConvertShapeTo4DPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     pm.addPass(IE::createSwapOperationsPass(log));
     pm.addPass(IE::createSwapPadLayerPass(log));
     pm.addPass(IE::createConvertSubtractToAddPass(log));
     pm.addPass(IE::createConvertToScaleShiftPass(log));
     pm.addPass(IE::createConvertGRNToNormalizeL2Pass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     pm.addPass(IE::createResolveScatterUpdateByTransposePass(log));
     pm.addPass(IE::createConvertGroupConvToConvPass(log));
     pm.addPass(IE::createSwapOperationsPass(log));
@@ -174,7 +176,7 @@ void vpux::buildReferenceHWModePipeline(mlir::OpPassManager& pm, const Reference
     if (options.enableSplitConvWithMultipleFQ) {
         pm.addPass(IE::createSplitConvWithMultipleFQPass(log));
     }
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     if (options.enableHandleLargeStrides) {
         pm.addPass(IE::createHandleLargeStridesPass(log));
@@ -185,7 +187,7 @@ void vpux::buildReferenceHWModePipeline(mlir::OpPassManager& pm, const Reference
     if (options.enableHandleLargePads) {
         pm.addPass(IE::createHandleLargePadsPass(log));
     }
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     if (options.enableOptimizeScaleShiftToDWConv) {
         IE::buildScaleShiftProcessingPipeline(pm, log);
     }
@@ -216,14 +218,14 @@ void vpux::buildReferenceHWModePipeline(mlir::OpPassManager& pm, const Reference
     if (options.enableExpandActivationChannels) {
         pm.addPass(IE::arch30xx::createExpandActivationChannelsPass(
                 /*seOpsEnabled=*/isOptionEnabled(options.enableSEPtrsOperations), log));
-        pm.addPass(mlir::createCanonicalizerPass(grc));
+        pm.addPass(createIncrementalCanonicalizerPass(grc));
 
         if (options.enableOptimizeSliceExpand) {
             pm.addPass(IE::arch30xx::createOptimizeSliceExpandPass(log));
         }
 
         pm.addPass(IE::createAdjustInputShapeForEltwisePass(log));
-        pm.addPass(mlir::createCanonicalizerPass(grc));
+        pm.addPass(createIncrementalCanonicalizerPass(grc));
         if (options.enableOptimizeSliceExpand) {
             pm.addPass(IE::arch30xx::createOptimizeSliceExpandPass(log));
         }
@@ -231,15 +233,15 @@ void vpux::buildReferenceHWModePipeline(mlir::OpPassManager& pm, const Reference
         if (options.enableOptimizeReorders) {
             pm.addPass(IE::createOptimizeReordersPass(/*seOpsEnabled=*/isOptionEnabled(options.enableSEPtrsOperations),
                                                       log));
-            pm.addPass(IE::createUniquifyOpsPass(log));
+            pm.addPass(IE::createUniquifyOpsPass(/*canonicalize=*/false, log));
             pm.addPass(IE::createPropagateAffineReshapePass(log));
             pm.addPass(IE::createUniquifyBranchesPass(log));
         }
     }
 
     pm.addPass(IE::createConvertToMemPermutePass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     pm.addPass(IE::createMovePermutePostEltwisePass(log));
 
@@ -268,10 +270,10 @@ void vpux::buildReferenceHWModePipeline(mlir::OpPassManager& pm, const Reference
 
     pm.addPass(VPU::createOptimizeConcatPass(log));
     pm.addPass(VPU::createAdjustMemorySpacePass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     pm.addPass(VPU::createCMXConcatPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     pm.addPass(VPU::createSplitNCEOpsOntoWorkloadsPass(log));
     pm.addPass(VPU::createResolveEltwiseWithZTiledWorkloadsPass(log));
@@ -279,7 +281,7 @@ void vpux::buildReferenceHWModePipeline(mlir::OpPassManager& pm, const Reference
     // Lowering to VPUIP
     vpux::arch30xx::buildLowerVPU2VPUIP30XXPipeline(pm, log);
     pm.addPass(VPUIP::createConvertExpandPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     pm.addPass(VPUIP::createConvertEltwiseToInPlacePass(log));
 
@@ -309,7 +311,7 @@ void vpux::buildReferenceHWModePipeline(mlir::OpPassManager& pm, const Reference
         pm.addPass(VPUIP::createUngroupSparseBuffersPass(log));
     }
 
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     if (options.enableConstantFusion) {
         pm.addPass(VPUIP::createFuseConstantsPass(log));
@@ -395,7 +397,9 @@ void vpux::buildReferenceHWModePipeline(mlir::OpPassManager& pm, const Reference
     pm.addPass(VPURT::createAssignPhysicalBarriersPass(log));
     pm.addPass(VPURT::createBarrierSimulationPass(log));
     pm.addPass(VPUIP::createDumpStatisticsOfTaskOpsPass(false, log));
-    pm.addPass(Const::createConstantFoldingPass());
+    if (options.enableConstantFolding) {
+        pm.addPass(Const::createConstantFoldingPass());
+    }
 }
 
 //
@@ -414,7 +418,7 @@ void vpux::buildShaveCodeGenPipeline30XX(mlir::OpPassManager& pm, Logger log) {
     pm.addPass(IE::createNormalizeL2FusionPass(log));
     pm.addPass(IE::createMatMulInputsTo2dPass(log));
     pm.addPass(IE::createConvertMatMulToConvPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     const DefaultHWOptions30XX options;  // TODO: takeout (normally)
 
@@ -439,14 +443,14 @@ void vpux::buildShaveCodeGenPipeline30XX(mlir::OpPassManager& pm, Logger log) {
     pm.addPass(IE::createAdaptShapesForScaleShiftPass(log));
     pm.addPass(IE::createResolveStridedSlicePass(log));
     pm.addPass(IE::createConvertShapeTo4DPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     pm.addPass(IE::createSwapOperationsPass(log));
     pm.addPass(IE::createSwapPadLayerPass(log));
     pm.addPass(IE::createConvertSubtractToAddPass(log));
     pm.addPass(IE::createConvertToScaleShiftPass(log));
     pm.addPass(IE::createBroadcastInputForAddPass(log));
     pm.addPass(IE::createConvertGRNToNormalizeL2Pass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     pm.addPass(IE::createResolveScatterUpdateByTransposePass(log));
     pm.addPass(IE::createConvertGroupConvToConvPass(log));
     pm.addPass(IE::createSwapOperationsPass(log));
@@ -461,7 +465,7 @@ void vpux::buildShaveCodeGenPipeline30XX(mlir::OpPassManager& pm, Logger log) {
     if (options.enableSplitConvWithMultipleFQ) {
         pm.addPass(IE::createSplitConvWithMultipleFQPass(log));
     }
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     if (options.enableHandleLargeStrides) {
         pm.addPass(IE::createHandleLargeStridesPass(log));
@@ -469,7 +473,7 @@ void vpux::buildShaveCodeGenPipeline30XX(mlir::OpPassManager& pm, Logger log) {
     if (options.enableHandleAsymmetricStrides) {
         pm.addPass(IE::createHandleAsymmetricStridesPass(log));
     }
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     if (options.enableOptimizeScaleShiftToDWConv) {
         IE::buildScaleShiftProcessingPipeline(pm, log);
     }
@@ -502,14 +506,14 @@ void vpux::buildShaveCodeGenPipeline30XX(mlir::OpPassManager& pm, Logger log) {
     if (options.enableExpandActivationChannels) {
         pm.addPass(IE::arch30xx::createExpandActivationChannelsPass(
                 /*seOpsEnabled=*/isOptionEnabled(options.enableSEPtrsOperations), log));
-        pm.addPass(mlir::createCanonicalizerPass(grc));
+        pm.addPass(createIncrementalCanonicalizerPass(grc));
 
         if (options.enableOptimizeSliceExpand) {
             pm.addPass(IE::arch30xx::createOptimizeSliceExpandPass(log));
         }
 
         pm.addPass(IE::createAdjustInputShapeForEltwisePass(log));
-        pm.addPass(mlir::createCanonicalizerPass(grc));
+        pm.addPass(createIncrementalCanonicalizerPass(grc));
         if (options.enableOptimizeSliceExpand) {
             pm.addPass(IE::arch30xx::createOptimizeSliceExpandPass(log));
         }
@@ -517,18 +521,18 @@ void vpux::buildShaveCodeGenPipeline30XX(mlir::OpPassManager& pm, Logger log) {
         if (options.enableOptimizeReorders) {
             pm.addPass(IE::createOptimizeReordersPass(/*seOpsEnabled=*/isOptionEnabled(options.enableSEPtrsOperations),
                                                       log));
-            pm.addPass(IE::createUniquifyOpsPass(log));
+            pm.addPass(IE::createUniquifyOpsPass(/*canonicalize=*/false, log));
             pm.addPass(IE::createPropagateAffineReshapePass(log));
             pm.addPass(IE::createUniquifyBranchesPass(log));
         }
     }
 
     pm.addPass(IE::createSwapOperationsPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     pm.addPass(IE::createConvertToMemPermutePass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     pm.addPass(IE::createMovePermutePostEltwisePass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     // Here it ends the code added from buildDefaultHWModePipeline().
 
     // Here we add new code
@@ -557,7 +561,7 @@ void vpux::buildDefaultHWModePipeline(mlir::OpPassManager& pm, const DefaultHWOp
     pm.addPass(IE::createNormalizeL2FusionPass(log));
     pm.addPass(IE::createMatMulInputsTo2dPass(log));
     pm.addPass(IE::createConvertMatMulToConvPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     IE::buildAdjustPrecisionPipeline(pm, log);
 
@@ -579,14 +583,14 @@ void vpux::buildDefaultHWModePipeline(mlir::OpPassManager& pm, const DefaultHWOp
     pm.addPass(IE::createAdaptShapesForScaleShiftPass(log));
     pm.addPass(IE::createResolveStridedSlicePass(log));
     pm.addPass(IE::createConvertShapeTo4DPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     pm.addPass(IE::createSwapOperationsPass(log));
     pm.addPass(IE::createSwapPadLayerPass(log));
     pm.addPass(IE::createConvertSubtractToAddPass(log));
     pm.addPass(IE::createConvertToScaleShiftPass(log));
     pm.addPass(IE::createBroadcastInputForAddPass(log));
     pm.addPass(IE::createConvertGRNToNormalizeL2Pass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     // E#79878: Solve eltwise single layer test failure.
     // SwapOperations pass may generate non-4D AddOp.
     // If AddOp appears here means that it cannot be fused into NCE task.
@@ -607,7 +611,7 @@ void vpux::buildDefaultHWModePipeline(mlir::OpPassManager& pm, const DefaultHWOp
     if (options.enableSplitConvWithMultipleFQ) {
         pm.addPass(IE::createSplitConvWithMultipleFQPass(log));
     }
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     if (options.enableHandleLargeStrides) {
         pm.addPass(IE::createHandleLargeStridesPass(log));
@@ -618,7 +622,7 @@ void vpux::buildDefaultHWModePipeline(mlir::OpPassManager& pm, const DefaultHWOp
     if (options.enableHandleLargePads) {
         pm.addPass(IE::createHandleLargePadsPass(log));
     }
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     if (options.enableOptimizeScaleShiftToDWConv) {
         IE::buildScaleShiftProcessingPipeline(pm, log);
     }
@@ -648,10 +652,13 @@ void vpux::buildDefaultHWModePipeline(mlir::OpPassManager& pm, const DefaultHWOp
     IE::buildAdjustLayoutPipeline(pm, IE::AdjustLayoutOptions(options), log);
     pm.addPass(IE::createConvertAssignReadValueToReturnsAndInputs(log));
 
+    // The layouts are fixed at this point, so the function passes below can process the partitions concurrently
+    pm.addPass(IE::createOutlinePartitionsPass(options.numberOfIEPartitions, /*minPartitionSize=*/64, log));
+
     if (options.enableExpandActivationChannels) {
         pm.addPass(IE::arch30xx::createExpandActivationChannelsPass(
                 /*seOpsEnabled=*/isOptionEnabled(options.enableSEPtrsOperations), log));
-        pm.addPass(mlir::createCanonicalizerPass(grc));
+        pm.addPass(createIncrementalCanonicalizerPass(grc));
 
         if (options.enableOptimizeSliceExpand) {
             pm.addPass(IE::arch30xx::createOptimizeSliceExpandPass(log));
@@ -659,7 +666,7 @@ void vpux::buildDefaultHWModePipeline(mlir::OpPassManager& pm, const DefaultHWOp
 
         pm.addPass(IE::createAdjustConvolutionInputShapePass(log));
         pm.addPass(IE::createAdjustInputShapeForEltwisePass(log));
-        pm.addPass(mlir::createCanonicalizerPass(grc));
+        pm.addPass(createIncrementalCanonicalizerPass(grc));
         if (options.enableOptimizeSliceExpand) {
             pm.addPass(IE::arch30xx::createOptimizeSliceExpandPass(log));
         }
@@ -667,26 +674,29 @@ void vpux::buildDefaultHWModePipeline(mlir::OpPassManager& pm, const DefaultHWOp
         if (options.enableOptimizeReorders) {
             pm.addPass(IE::createOptimizeReordersPass(/*seOpsEnabled=*/isOptionEnabled(options.enableSEPtrsOperations),
                                                       log));
-            pm.addPass(IE::createUniquifyOpsPass(log));
+            pm.addPass(IE::createUniquifyOpsPass(/*canonicalize=*/false, log));
             pm.addPass(IE::createPropagateAffineReshapePass(log));
             pm.addPass(IE::createUniquifyBranchesPass(log));
         }
     }
 
     pm.addPass(IE::createSwapOperationsPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     pm.addPass(IE::createConvertToMemPermutePass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     pm.addPass(IE::createMovePermutePostEltwisePass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     pm.addPass(IE::createPropagateMemPermuteThroughAddPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
-    pm.addPass(IE::createUniquifyOpsPass(log));
+    pm.addPass(IE::createUniquifyOpsPass(/*canonicalize=*/true, log));
     pm.addPass(IE::createRemoveIdentityPoolPass(log));
     pm.addPass(IE::createConvertExpandToConvPass(log));
+    pm.addPass(IE::createInlinePartitionsPass(log));
     if (options.logOpOptimizations) {
         pm.addPass(IE::createLogOpOptimizationsPass());
     }
+    if (!options.debugOutputs.empty()) {
+        pm.addPass(IE::createAddDebugOutputsPass(options.debugOutputs, log));
+    }
 
     // Lowering to VPU
     vpux::arch30xx::buildLowerIE2VPUPipeline30XX(pm, log);
@@ -713,27 +723,27 @@ void vpux::buildDefaultHWModePipeline(mlir::OpPassManager& pm, const DefaultHWOp
 
     pm.addPass(VPU::createOptimizeConcatPass(log));
     pm.addPass(VPU::createAdjustMemorySpacePass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     pm.addPass(VPU::createCMXConcatPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     pm.addPass(VPU::createSplitNCEOpsOntoWorkloadsPass(log));
     pm.addPass(VPU::createResolveEltwiseWithZTiledWorkloadsPass(log));
 
     // Lowering to VPUIP
     vpux::arch30xx::buildLowerVPU2VPUIP30XXPipeline(pm, log);
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     pm.addPass(VPUIP::createConvertExpandPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     pm.addPass(VPUIP::createConvertEltwiseToInPlacePass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     // Level 2 : Abstract RunTime
 
     pm.addPass(VPUIP::createSetMemorySpacePass(getMemKind<VPU::MemoryKind::DDR>, log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     if (options.enableOptimizeCopies) {
         pm.addPass(VPUIP::createMovePureViewOpBeforeCopyPass(log));
@@ -760,7 +770,7 @@ void vpux::buildDefaultHWModePipeline(mlir::OpPassManager& pm, const DefaultHWOp
         pm.addPass(VPUIP::createUngroupSparseBuffersPass(log));
     }
 
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     if (options.enableConstantFusion) {
         pm.addPass(VPUIP::createFuseConstantsPass(log));
@@ -849,10 +859,14 @@ void vpux::buildDefaultHWModePipeline(mlir::OpPassManager& pm, const DefaultHWOp
     pm.addPass(VPURT::createAssignPhysicalBarriersPass(log));
     pm.addPass(VPURT::createBarrierSimulationPass(log));
 
-    if (options.enableScheduleTrace) {
-        pm.addPass(VPURT::createInferenceExecutionAnalysisPass(options.scheduleTraceFile, log));
+    if (options.enableScheduleTrace || !options.scheduleReportFile.empty()) {
+        const std::string scheduleTraceFile = options.enableScheduleTrace ? options.scheduleTraceFile : "";
+        pm.addPass(VPURT::createInferenceExecutionAnalysisPass(scheduleTraceFile, options.scheduleReportFile,
+                                                               /*reportTopLayers=*/10, log));
     }
 
     pm.addPass(VPUIP::createDumpStatisticsOfTaskOpsPass(false, log));
-    pm.addPass(Const::createConstantFoldingPass());
+    if (options.enableConstantFolding) {
+        pm.addPass(Const::createConstantFoldingPass());
+    }
 }
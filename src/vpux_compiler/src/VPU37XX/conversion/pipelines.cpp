@@ -25,7 +25,7 @@ void vpux::arch37xx::buildLowerIE2VPUPipeline37XX(mlir::OpPassManager& pm,
 
     pm.addPass(vpux::arch37xx::createConvertIEToVPUNCEPass(options.useNCEPermute, log));
     pm.addPass(createConvertLayers2VPUPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 }
 
 //
@@ -43,7 +43,7 @@ void vpux::arch37xx::buildLowerVPU2VPUIP37XXPipeline(mlir::OpPassManager& pm, Lo
 
     pm.addPass(createConvertVPUNCEToVPUIPPass(log));
     pm.addPass(createConvertNCEClusterTilingToVPUIPPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 }
 
 //
@@ -4,6 +4,7 @@
 //
 
 #include "vpux/compiler/pipelines.hpp"
+#include "vpux/compiler/core/passes.hpp"
 #include "vpux/compiler/VPU37XX/dialect/IE/passes.hpp"
 #include "vpux/compiler/utils/rewriter.hpp"
 
@@ -18,27 +19,26 @@ void vpux::IE::arch37xx::buildOptimizeActivationsPipeline(mlir::OpPassManager& p
     pm.addPass(IE::createSwapOperationsPass(log));
     pm.addPass(IE::arch37xx::createInsertIdentityPoolBeforeOpPass(log));
     pm.addPass(IE::createFusePostOpsPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 }
 
 void vpux::IE::arch37xx::buildMemPermuteProcessingPipeline(mlir::OpPassManager& pm, Logger log) {
     const auto grc = getDefaultGreedyRewriteConfig();
 
     pm.addPass(IE::createConvertToMemPermutePass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     pm.addPass(IE::createMovePermutePostEltwisePass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     pm.addPass(IE::createLegalizeNDMemPermutePass(log));
     pm.addPass(IE::createPropagateMemPermuteThroughSoftMaxPass(log));
     pm.addPass(IE::createPropagateMemPermuteBeforeOpPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     pm.addPass(IE::createPropagateMemPermuteThroughAddPass(log));
     pm.addPass(IE::createAdjustMemPermuteAroundOpPass(log));
     pm.addPass(IE::arch37xx::createInsertIdentityPoolBeforeOpPass(log));
     pm.addPass(IE::createFuseMemPermutePass(log));
     pm.addPass(IE::createConvertMemPermuteToPoolPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
-    pm.addPass(IE::createUniquifyOpsPass(log));
+    pm.addPass(IE::createUniquifyOpsPass(/*canonicalize=*/true, log));
 }
 
 //
@@ -15,6 +15,9 @@ using namespace vpux;
 
 void vpux::VPU::arch37xx::buildIncrementalPipeline(mlir::OpPassManager& pm, const VPU::TilingOptions& options,
                                                    Logger log) {
+    if (!options.profiledCostsFile.empty()) {
+        pm.addPass(VPU::createApplyProfiledCostsPass(options.profiledCostsFile, log));
+    }
     pm.addPass(VPU::createMultiClusterStrategyAssignmentPass(log));
 
     // manual strategy debug configuration
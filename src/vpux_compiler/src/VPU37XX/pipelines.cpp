@@ -39,24 +39,24 @@ void vpux::buildReferenceSWModePipeline(mlir::OpPassManager& pm, const Reference
     pm.addPass(IE::createResolveStridedSlicePass(log));
     pm.addPass(IE::createConvertNceOpsTo4DPass(log));
     pm.addPass(IE::createConvertShapeTo4DPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     pm.addPass(IE::createConvertGRNToNormalizeL2Pass(log));
     pm.addPass(IE::createResolveScatterUpdateByTransposePass(log));
     IE::buildAdjustForVPUPipeline(pm, IE::AdjustForVPUOptions(options), log);
 
     pm.addPass(IE::createSplitFakeQuantPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     pm.addPass(IE::createDequantizeConstPass(log));
     if (options.enableMergeFakeQuant) {
         pm.addPass(IE::createMergeFakeQuantPass(log));
     }
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     IE::buildAdjustLayoutPipeline(pm, IE::AdjustLayoutOptions(options), log);
     pm.addPass(IE::createConvertAssignReadValueToReturnsAndInputs(log));
 
     pm.addPass(IE::createConvertToMemPermutePass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     // Lowering to VPU
     pm.addPass(createConvertLayers2VPUPass(log));
@@ -75,20 +75,20 @@ void vpux::buildReferenceSWModePipeline(mlir::OpPassManager& pm, const Reference
 
     pm.addPass(createConvertSWLayers2VPUIPSWKernelPass(log));
     pm.addPass(createConvertLayers2VPUIPPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     pm.addPass(createConvertSWLayers2VPUIPSWKernelPass(log));
 
     // Lowering to VPUIP
     pm.addPass(createConvertLayers2VPUIPPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     // Level 2 : Abstract RunTime
 
     pm.addPass(VPUIP::createSetMemorySpacePass(getMemKind<VPU::MemoryKind::DDR>, log));
 
     pm.addPass(VPUIP::createCopyOpTilingPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     VPUIP::buildAsyncSchedulingPipeline(pm, log);
 
@@ -115,7 +115,9 @@ void vpux::buildReferenceSWModePipeline(mlir::OpPassManager& pm, const Reference
     pm.addPass(VPURT::createAssignPhysicalBarriersPass(log));
     pm.addPass(VPURT::createBarrierSimulationPass(log));
     pm.addPass(VPUIP::createDumpStatisticsOfTaskOpsPass(false, log));
-    pm.addPass(Const::createConstantFoldingPass());
+    if (options.enableConstantFolding) {
+        pm.addPass(Const::createConstantFoldingPass());
+    }
 }
 
 //
@@ -143,13 +145,13 @@ void vpux::buildReferenceHWModePipeline(mlir::OpPassManager& pm, const Reference
     pm.addPass(IE::createAdaptShapesForScaleShiftPass(log));
     pm.addPass(IE::createResolveStridedSlicePass(log));
     pm.addPass(IE::createConvertShapeTo4DPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     pm.addPass(IE::createSwapOperationsPass(log));
     pm.addPass(IE::createSwapPadLayerPass(log));
     pm.addPass(IE::createConvertSubtractToAddPass(log));
     pm.addPass(IE::createConvertToScaleShiftPass(log));
     pm.addPass(IE::createConvertGRNToNormalizeL2Pass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     pm.addPass(IE::createResolveScatterUpdateByTransposePass(log));
     pm.addPass(IE::createConvertGroupConvToConvPass(log));
     pm.addPass(IE::createSwapOperationsPass(log));
@@ -162,7 +164,7 @@ void vpux::buildReferenceHWModePipeline(mlir::OpPassManager& pm, const Reference
     if (options.enableSplitConvWithMultipleFQ) {
         pm.addPass(IE::createSplitConvWithMultipleFQPass(log));
     }
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     if (options.enableHandleLargeStrides) {
         pm.addPass(IE::createHandleLargeStridesPass(log));
@@ -173,7 +175,7 @@ void vpux::buildReferenceHWModePipeline(mlir::OpPassManager& pm, const Reference
     if (options.enableHandleLargePads) {
         pm.addPass(IE::createHandleLargePadsPass(log));
     }
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     if (options.enableOptimizeScaleShiftToDWConv) {
         IE::buildScaleShiftProcessingPipeline(pm, log);
     }
@@ -211,14 +213,14 @@ void vpux::buildReferenceHWModePipeline(mlir::OpPassManager& pm, const Reference
         pm.addPass(IE::createAdjustGroupConvShapePass(log));
         pm.addPass(IE::arch37xx::createExpandActivationChannelsPass(
                 /*seOpsEnabled=*/isOptionEnabled(options.enableSEPtrsOperations), log));
-        pm.addPass(mlir::createCanonicalizerPass(grc));
+        pm.addPass(createIncrementalCanonicalizerPass(grc));
 
         if (options.enableOptimizeSliceExpand) {
             pm.addPass(IE::arch37xx::createOptimizeSliceExpandPass(log));
         }
 
         pm.addPass(IE::createAdjustInputShapeForEltwisePass(log));
-        pm.addPass(mlir::createCanonicalizerPass(grc));
+        pm.addPass(createIncrementalCanonicalizerPass(grc));
         if (options.enableOptimizeSliceExpand) {
             pm.addPass(IE::arch37xx::createOptimizeSliceExpandPass(log));
         }
@@ -226,7 +228,7 @@ void vpux::buildReferenceHWModePipeline(mlir::OpPassManager& pm, const Reference
         if (options.enableOptimizeReorders) {
             pm.addPass(IE::createOptimizeReordersPass(/*seOpsEnabled=*/isOptionEnabled(options.enableSEPtrsOperations),
                                                       log));
-            pm.addPass(IE::createUniquifyOpsPass(log));
+            pm.addPass(IE::createUniquifyOpsPass(/*canonicalize=*/false, log));
             pm.addPass(IE::createPropagateAffineReshapePass(log));
             pm.addPass(IE::createUniquifyBranchesPass(log));
         }
@@ -238,9 +240,9 @@ void vpux::buildReferenceHWModePipeline(mlir::OpPassManager& pm, const Reference
     }
 
     pm.addPass(IE::createConvertToMemPermutePass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     pm.addPass(IE::createLegalizeNDMemPermutePass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     pm.addPass(IE::createMovePermutePostEltwisePass(log));
 
@@ -277,10 +279,10 @@ void vpux::buildReferenceHWModePipeline(mlir::OpPassManager& pm, const Reference
 
     pm.addPass(VPU::createOptimizeConcatPass(log));
     pm.addPass(VPU::createAdjustMemorySpacePass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     pm.addPass(VPU::createCMXConcatPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     pm.addPass(VPU::createSplitNCEOpsOntoWorkloadsPass(log));
     pm.addPass(VPU::createCorrectNCEWorkloadsPass(log));
@@ -293,7 +295,7 @@ void vpux::buildReferenceHWModePipeline(mlir::OpPassManager& pm, const Reference
         pm.addPass(VPUIP::createWrapWithPermuteAsNNDMAPass(log));
     }
     pm.addPass(VPUIP::createConvertExpandPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     pm.addPass(VPUIP::createConvertEltwiseToInPlacePass(log));
 
@@ -325,7 +327,7 @@ void vpux::buildReferenceHWModePipeline(mlir::OpPassManager& pm, const Reference
         pm.addPass(VPUIP::createUngroupSparseBuffersPass(log));
     }
 
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     pm.addPass(VPUIP::createConvWeightsCompressionPass(log));
 
     if (VPU::isActSparsityEnabled(options.enableActivationSparsity)) {
@@ -425,7 +427,9 @@ void vpux::buildReferenceHWModePipeline(mlir::OpPassManager& pm, const Reference
     pm.addPass(VPURT::createBarrierSimulationPass(log));
 
     pm.addPass(VPUIP::createDumpStatisticsOfTaskOpsPass(options.enableCompressWeightsBTC, log));
-    pm.addPass(Const::createConstantFoldingPass());
+    if (options.enableConstantFolding) {
+        pm.addPass(Const::createConstantFoldingPass());
+    }
 }
 
 //
@@ -460,14 +464,14 @@ void vpux::buildShaveCodeGenPipeline37XX(mlir::OpPassManager& pm, Logger log) {
     pm.addPass(IE::createAdaptShapesForScaleShiftPass(log));
     pm.addPass(IE::createResolveStridedSlicePass(log));
     pm.addPass(IE::createConvertShapeTo4DPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     pm.addPass(IE::createSwapOperationsPass(log));
     pm.addPass(IE::createSwapPadLayerPass(log));
     pm.addPass(IE::createConvertSubtractToAddPass(log));
     pm.addPass(IE::createConvertToScaleShiftPass(log));
     pm.addPass(IE::createBroadcastInputForAddPass(log));
     pm.addPass(IE::createConvertGRNToNormalizeL2Pass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     pm.addPass(IE::createResolveScatterUpdateByTransposePass(log));
     pm.addPass(IE::createConvertGroupConvToConvPass(log));
     pm.addPass(IE::createSwapOperationsPass(log));
@@ -480,7 +484,7 @@ void vpux::buildShaveCodeGenPipeline37XX(mlir::OpPassManager& pm, Logger log) {
     if (options.enableSplitConvWithMultipleFQ) {
         pm.addPass(IE::createSplitConvWithMultipleFQPass(log));
     }
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     if (options.enableHandleLargeStrides) {
         pm.addPass(IE::createHandleLargeStridesPass(log));
@@ -488,7 +492,7 @@ void vpux::buildShaveCodeGenPipeline37XX(mlir::OpPassManager& pm, Logger log) {
     if (options.enableHandleAsymmetricStrides) {
         pm.addPass(IE::createHandleAsymmetricStridesPass(log));
     }
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     if (options.enableOptimizeScaleShiftToDWConv) {
         IE::buildScaleShiftProcessingPipeline(pm, log);
     }
@@ -519,14 +523,14 @@ void vpux::buildShaveCodeGenPipeline37XX(mlir::OpPassManager& pm, Logger log) {
         pm.addPass(IE::createAdjustGroupConvShapePass(log));
         pm.addPass(IE::arch37xx::createExpandActivationChannelsPass(
                 /*seOpsEnabled=*/isOptionEnabled(options.enableSEPtrsOperations), log));
-        pm.addPass(mlir::createCanonicalizerPass(grc));
+        pm.addPass(createIncrementalCanonicalizerPass(grc));
 
         if (options.enableOptimizeSliceExpand) {
             pm.addPass(IE::arch37xx::createOptimizeSliceExpandPass(log));
         }
 
         pm.addPass(IE::createAdjustInputShapeForEltwisePass(log));
-        pm.addPass(mlir::createCanonicalizerPass(grc));
+        pm.addPass(createIncrementalCanonicalizerPass(grc));
         if (options.enableOptimizeSliceExpand) {
             pm.addPass(IE::arch37xx::createOptimizeSliceExpandPass(log));
         }
@@ -534,7 +538,7 @@ void vpux::buildShaveCodeGenPipeline37XX(mlir::OpPassManager& pm, Logger log) {
         if (options.enableOptimizeReorders) {
             pm.addPass(IE::createOptimizeReordersPass(/*seOpsEnabled=*/isOptionEnabled(options.enableSEPtrsOperations),
                                                       log));
-            pm.addPass(IE::createUniquifyOpsPass(log));
+            pm.addPass(IE::createUniquifyOpsPass(/*canonicalize=*/false, log));
             pm.addPass(IE::createPropagateAffineReshapePass(log));
             pm.addPass(IE::createUniquifyBranchesPass(log));
         }
@@ -546,13 +550,13 @@ void vpux::buildShaveCodeGenPipeline37XX(mlir::OpPassManager& pm, Logger log) {
     }
 
     pm.addPass(IE::createSwapOperationsPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     pm.addPass(IE::createConvertToMemPermutePass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     pm.addPass(IE::createMovePermutePostEltwisePass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     pm.addPass(IE::createLegalizeNDMemPermutePass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     // Here it ends the code added from buildDefaultHWModePipeline().
 
     // Here we add new code
@@ -595,14 +599,14 @@ void vpux::buildDefaultHWModePipeline(mlir::OpPassManager& pm, const DefaultHWOp
     pm.addPass(IE::createAdaptShapesForScaleShiftPass(log));
     pm.addPass(IE::createResolveStridedSlicePass(log));
     pm.addPass(IE::createConvertShapeTo4DPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     pm.addPass(IE::createSwapOperationsPass(log));
     pm.addPass(IE::createSwapPadLayerPass(log));
     pm.addPass(IE::createConvertSubtractToAddPass(log));
     pm.addPass(IE::createConvertToScaleShiftPass(log));
     pm.addPass(IE::createBroadcastInputForAddPass(log));
     pm.addPass(IE::createConvertGRNToNormalizeL2Pass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     // E#79878: Solve eltwise single layer test failure.
     // SwapOperations pass may generate non-4D AddOp.
     // If AddOp appears here means that it cannot be fused into NCE task.
@@ -621,7 +625,7 @@ void vpux::buildDefaultHWModePipeline(mlir::OpPassManager& pm, const DefaultHWOp
     if (options.enableSplitConvWithMultipleFQ) {
         pm.addPass(IE::createSplitConvWithMultipleFQPass(log));
     }
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     if (options.enableHandleLargeStrides) {
         pm.addPass(IE::createHandleLargeStridesPass(log));
@@ -632,7 +636,7 @@ void vpux::buildDefaultHWModePipeline(mlir::OpPassManager& pm, const DefaultHWOp
     if (options.enableHandleLargePads) {
         pm.addPass(IE::createHandleLargePadsPass(log));
     }
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     if (options.enableOptimizeScaleShiftToDWConv) {
         IE::buildScaleShiftProcessingPipeline(pm, log);
     }
@@ -662,6 +666,9 @@ void vpux::buildDefaultHWModePipeline(mlir::OpPassManager& pm, const DefaultHWOp
     IE::buildAdjustLayoutPipeline(pm, IE::AdjustLayoutOptions(options), log);
     pm.addPass(IE::createConvertAssignReadValueToReturnsAndInputs(log));
 
+    // The layouts are fixed at this point, so the function passes below can process the partitions concurrently
+    pm.addPass(IE::createOutlinePartitionsPass(options.numberOfIEPartitions, /*minPartitionSize=*/64, log));
+
     if (options.enableFusePermuteQuantize) {
         pm.addPass(IE::createFusePermuteQuantizePass(false, log));
         pm.addPass(IE::createConvertReorderToPermuteQuantizePass(log));
@@ -671,7 +678,7 @@ void vpux::buildDefaultHWModePipeline(mlir::OpPassManager& pm, const DefaultHWOp
         pm.addPass(IE::createAdjustGroupConvShapePass(log));
         pm.addPass(IE::arch37xx::createExpandActivationChannelsPass(
                 /*seOpsEnabled=*/isOptionEnabled(options.enableSEPtrsOperations), log));
-        pm.addPass(mlir::createCanonicalizerPass(grc));
+        pm.addPass(createIncrementalCanonicalizerPass(grc));
 
         if (options.enableOptimizeSliceExpand) {
             pm.addPass(IE::arch37xx::createOptimizeSliceExpandPass(log));
@@ -679,7 +686,7 @@ void vpux::buildDefaultHWModePipeline(mlir::OpPassManager& pm, const DefaultHWOp
 
         pm.addPass(IE::createAdjustConvolutionInputShapePass(log));
         pm.addPass(IE::createAdjustInputShapeForEltwisePass(log));
-        pm.addPass(mlir::createCanonicalizerPass(grc));
+        pm.addPass(createIncrementalCanonicalizerPass(grc));
         if (options.enableOptimizeSliceExpand) {
             pm.addPass(IE::arch37xx::createOptimizeSliceExpandPass(log));
         }
@@ -687,7 +694,7 @@ void vpux::buildDefaultHWModePipeline(mlir::OpPassManager& pm, const DefaultHWOp
         if (options.enableOptimizeReorders) {
             pm.addPass(IE::createOptimizeReordersPass(/*seOpsEnabled=*/isOptionEnabled(options.enableSEPtrsOperations),
                                                       log));
-            pm.addPass(IE::createUniquifyOpsPass(log));
+            pm.addPass(IE::createUniquifyOpsPass(/*canonicalize=*/false, log));
             pm.addPass(IE::createPropagateAffineReshapePass(log));
             pm.addPass(IE::createUniquifyBranchesPass(log));
         }
@@ -699,7 +706,7 @@ void vpux::buildDefaultHWModePipeline(mlir::OpPassManager& pm, const DefaultHWOp
     }
 
     pm.addPass(IE::createSwapOperationsPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     IE::arch37xx::buildMemPermuteProcessingPipeline(pm, log);
     pm.addPass(IE::createRemoveViewLikeOpsChainPass(log));
@@ -707,17 +714,21 @@ void vpux::buildDefaultHWModePipeline(mlir::OpPassManager& pm, const DefaultHWOp
     if (options.enableExpandActivationChannels) {
         pm.addPass(IE::createExpandActivationWidthPass(log));
         pm.addPass(IE::createAdjustInputShapeForEltwisePass(log));
-        pm.addPass(mlir::createCanonicalizerPass(grc));
+        pm.addPass(createIncrementalCanonicalizerPass(grc));
         if (options.enableOptimizeSliceExpand) {
             pm.addPass(IE::arch37xx::createOptimizeSliceExpandPass(log));
         }
         pm.addPass(IE::createPropagateAffineReshapePass(log));
-        pm.addPass(mlir::createCanonicalizerPass(grc));
+        pm.addPass(createIncrementalCanonicalizerPass(grc));
     }
     pm.addPass(IE::createConvertExpandToConvPass(log));
+    pm.addPass(IE::createInlinePartitionsPass(log));
     if (options.logOpOptimizations) {
         pm.addPass(IE::createLogOpOptimizationsPass());
     }
+    if (!options.debugOutputs.empty()) {
+        pm.addPass(IE::createAddDebugOutputsPass(options.debugOutputs, log));
+    }
 
     // Lowering to VPU
     vpux::arch37xx::buildLowerIE2VPUPipeline37XX(pm, vpux::arch37xx::PermuteQuantOptions(options), log);
@@ -753,10 +764,10 @@ void vpux::buildDefaultHWModePipeline(mlir::OpPassManager& pm, const DefaultHWOp
 
     pm.addPass(VPU::createOptimizeConcatPass(log));
     pm.addPass(VPU::createAdjustMemorySpacePass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     pm.addPass(VPU::createCMXConcatPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     pm.addPass(VPU::createSplitNCEOpsOntoWorkloadsPass(log));
     pm.addPass(VPU::createCorrectNCEWorkloadsPass(log));
@@ -765,20 +776,20 @@ void vpux::buildDefaultHWModePipeline(mlir::OpPassManager& pm, const DefaultHWOp
     // Lowering to VPUIP
     vpux::arch37xx::buildLowerVPU2VPUIP37XXPipeline(pm, log);
     pm.addPass(VPUIP::createTileActShaveKernelTaskPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     if (options.enableOpsAsDMA) {
         pm.addPass(VPUIP::createWrapWithPermuteAsNNDMAPass(log));
     }
     pm.addPass(VPUIP::createConvertExpandPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     pm.addPass(VPUIP::createConvertEltwiseToInPlacePass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     // Level 2 : Abstract RunTime
 
     pm.addPass(VPUIP::createSetMemorySpacePass(getMemKind<VPU::MemoryKind::DDR>, log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     if (options.enableOptimizeCopies) {
         pm.addPass(VPUIP::createMovePureViewOpBeforeCopyPass(log));
@@ -810,7 +821,7 @@ void vpux::buildDefaultHWModePipeline(mlir::OpPassManager& pm, const DefaultHWOp
         pm.addPass(VPUIP::createUngroupSparseBuffersPass(log));
     }
 
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     pm.addPass(VPUIP::createConvWeightsCompressionPass(log));
 
     if (VPU::isActSparsityEnabled(options.enableActivationSparsity)) {
@@ -912,10 +923,14 @@ void vpux::buildDefaultHWModePipeline(mlir::OpPassManager& pm, const DefaultHWOp
     pm.addPass(VPURT::createAssignPhysicalBarriersPass(log));
     pm.addPass(VPURT::createBarrierSimulationPass(log));
 
-    if (options.enableScheduleTrace) {
-        pm.addPass(VPURT::createInferenceExecutionAnalysisPass(options.scheduleTraceFile, log));
+    if (options.enableScheduleTrace || !options.scheduleReportFile.empty()) {
+        const std::string scheduleTraceFile = options.enableScheduleTrace ? options.scheduleTraceFile : "";
+        pm.addPass(VPURT::createInferenceExecutionAnalysisPass(scheduleTraceFile, options.scheduleReportFile,
+                                                               /*reportTopLayers=*/10, log));
     }
 
     pm.addPass(VPUIP::createDumpStatisticsOfTaskOpsPass(options.enableCompressWeightsBTC, log));
-    pm.addPass(Const::createConstantFoldingPass());
+    if (options.enableConstantFolding) {
+        pm.addPass(Const::createConstantFoldingPass());
+    }
 }
@@ -31,6 +31,7 @@
 #include "vpux/utils/IE/itt.hpp"
 #include "vpux/utils/core/error.hpp"
 #include "vpux/utils/core/optional.hpp"
+#include "vpux/utils/core/process_memory.hpp"
 
 #include <mlir/IR/Dialect.h>
 #include <mlir/IR/MLIRContext.h>
@@ -90,6 +91,9 @@ public:
     void setup(mlir::DefaultTimingManager& tm) const;
     void setup(mlir::PassManager& pm) const;
 
+    // Reports the resident memory after a compilation stage which is not a pass
+    void reportMemory(StringRef stage) const;
+
     bool useSharedConstants() const {
         return _crashReproducerFile.empty() && _irPrintingFilter.empty();
     }
@@ -107,6 +111,7 @@ private:
     bool _printFullConstant = false;
     bool _printDebugInfo = false;
     std::string _printDotOptions;
+    bool _printPassMemory = false;
 
     llvm::raw_ostream* _timingStream = nullptr;
 
@@ -129,6 +134,8 @@ DeveloperConfig::DeveloperConfig(Logger log): _log(log) {
     parseEnv("IE_NPU_PRINT_DEBUG_INFO", _printDebugInfo);
 
     parseEnv("IE_NPU_PRINT_DOT", _printDotOptions);
+
+    parseEnv("IE_NPU_PRINT_PASS_MEMORY", _printPassMemory);
 #endif  // defined(VPUX_DEVELOPER_BUILD) || !defined(NDEBUG)
 
     if (_log.isActive(LogLevel::Info)) {
@@ -241,6 +248,19 @@ void DeveloperConfig::setup(mlir::PassManager& pm) const {
     if (!_printDotOptions.empty()) {
         addDotPrinter(pm, _printDotOptions);
     }
+
+    // Memory usage
+
+    if (_printPassMemory) {
+        addMemoryReport(pm, Logger("pass-memory", LogLevel::Info));
+    }
+}
+
+void DeveloperConfig::reportMemory(StringRef stage) const {
+    if (_printPassMemory) {
+        Logger("pass-memory", LogLevel::Info)
+                .info("{0} : RSS {1} KB, peak RSS {2} KB", stage, getCurrentRSS(), getPeakRSS());
+    }
 }
 
 /**
@@ -689,6 +709,7 @@ std::shared_ptr<INetworkDescription> vpux::CompilerImpl::compile(std::shared_ptr
     OV_ITT_TASK_NEXT(COMPILER_IMPLEMENTATION, "exportNetwork");
     const std::shared_ptr<INetworkDescription>& networkDescription =
             exportNetwork(module.get(), rootTiming, log, model, config);
+    devConf.reportMemory("exportNetwork");
     OV_ITT_TASK_SKIP(COMPILER_IMPLEMENTATION);
 
     return networkDescription;
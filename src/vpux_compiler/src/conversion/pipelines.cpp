@@ -22,7 +22,7 @@ void vpux::buildLowerIE2IERTPipeline(mlir::OpPassManager& pm, Logger log) {
     pm.addPass(createBufferizeIEPass(log));
     pm.addPass(createBufferizeFuncAndReturnPass(log));
     pm.addPass(createAddBuffersForNetResults(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 }
 
 //
@@ -8,11 +8,22 @@
 #include "vpux/compiler/dialect/VPUIP/utils.hpp"
 #include "vpux/compiler/utils/attributes.hpp"
 #include "vpux/utils/core/range.hpp"
+#include "vpux/utils/core/trace_recorder.hpp"
 
 #include <llvm/ADT/SetOperations.h>
 
 using namespace vpux;
 
+namespace {
+
+// The barrier maps are updated per task, these events record the updates without formatting them
+VPUX_TRACE_EVENT(addConsumerEvent, "BarrierInfo", "add_consumer", "task,barrier");
+VPUX_TRACE_EVENT(addProducerEvent, "BarrierInfo", "add_producer", "task,barrier");
+VPUX_TRACE_EVENT(addTaskOpEvent, "BarrierInfo", "add_task_op", "task");
+VPUX_TRACE_EVENT(resetBarrierEvent, "BarrierInfo", "reset_barrier", "barrier");
+
+}  // namespace
+
 //
 // Constructor
 //
@@ -350,6 +361,7 @@ void vpux::BarrierInfo::buildBarrierMaps(mlir::func::FuncOp func) {
 void vpux::BarrierInfo::addConsumer(VPURT::DeclareVirtualBarrierOp barrierOp, size_t taskInd) {
     const auto barrierInd = getIndex(barrierOp);
     _log.trace("Add consumer '{0}' for barrier '{1}'", taskInd, barrierInd);
+    addConsumerEvent.record(taskInd, barrierInd);
     _barrierConsumerMap[barrierInd].insert(taskInd);
     _taskWaitBarriers[taskInd].insert(barrierInd);
 }
@@ -372,6 +384,7 @@ void vpux::BarrierInfo::addConsumers(size_t barrierInd, const TaskSet& taskInds)
 void vpux::BarrierInfo::addProducer(VPURT::DeclareVirtualBarrierOp barrierOp, size_t taskInd) {
     const auto barrierInd = getIndex(barrierOp);
     _log.trace("Add producer '{0}' for barrier '{1}'", taskInd, barrierInd);
+    addProducerEvent.record(taskInd, barrierInd);
     _barrierProducerMap[barrierInd].insert(taskInd);
     _taskUpdateBarriers[taskInd].insert(barrierInd);
 }
@@ -418,6 +431,7 @@ void vpux::BarrierInfo::removeConsumers(VPURT::DeclareVirtualBarrierOp barrierOp
 void vpux::BarrierInfo::addTaskOp(VPURT::TaskOp taskOp) {
     const auto taskInd = getIndex(taskOp);
     _log.trace("Found 'TaskOp' Operation '{0}'", taskInd);
+    addTaskOpEvent.record(taskInd);
 
     for (const auto& bar : taskOp.getWaitBarriers()) {
         // Note: can also be VPURT::ConfigureBarrierOp
@@ -516,6 +530,7 @@ void vpux::BarrierInfo::resetBarrier(VPURT::DeclareVirtualBarrierOp barrierOp) {
 
 void vpux::BarrierInfo::resetBarrier(size_t barrierInd) {
     _log.trace("Reset barrier '{0}'", barrierInd);
+    resetBarrierEvent.record(barrierInd);
 
     for (auto taskInd : _barrierProducerMap[barrierInd]) {
         _taskUpdateBarriers[static_cast<size_t>(taskInd)].erase(barrierInd);
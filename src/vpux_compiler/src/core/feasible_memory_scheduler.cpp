@@ -11,10 +11,24 @@
 #include "vpux/compiler/utils/strings.hpp"
 
 #include "vpux/utils/core/range.hpp"
+#include "vpux/utils/core/trace_recorder.hpp"
 
 using namespace vpux;
 using operationIdxType = FeasibleMemoryScheduler::operationIdxType;
 
+namespace {
+
+// Events of the scheduling loop, they are recorded per operation without formatting them
+VPUX_TRACE_EVENT(readyDataOpEvent, "FeasibleMemoryScheduler", "ready_data_op", "op");
+VPUX_TRACE_EVENT(readyNonComputeChainOpEvent, "FeasibleMemoryScheduler", "ready_non_compute_chain_op", "op");
+VPUX_TRACE_EVENT(readyComputeOpEvent, "FeasibleMemoryScheduler", "ready_compute_op", "op");
+VPUX_TRACE_EVENT(unscheduleOpEvent, "FeasibleMemoryScheduler", "unschedule_op", "op");
+VPUX_TRACE_EVENT(scheduleInputOpEvent, "FeasibleMemoryScheduler", "schedule_input_op", "op,cycle");
+VPUX_TRACE_EVENT(schedulePrefetchOpEvent, "FeasibleMemoryScheduler", "schedule_prefetch_op", "op,cycle");
+VPUX_TRACE_EVENT(scheduleSpilledOpEvent, "FeasibleMemoryScheduler", "schedule_spilled_op", "op,cycle");
+
+}  // namespace
+
 //
 // Feasible Memory Scheduler
 //
@@ -447,6 +461,7 @@ void FeasibleMemoryScheduler::distributeReadyOps(llvm::ArrayRef<operationIdxType
                               "Operation already in the ready data list '{0}'", readyOpIdx);
             _readyDataOps.insert(readyOpIdx);
             _log.trace("Add to ready data ops '{0}'", readyOpIdx);
+            readyDataOpEvent.record(readyOpIdx);
             const auto newReadyOps = reduceInDegreeOfAdjacentOperations(readyOpIdx);
             distributeReadyOps(newReadyOps);
         } else if (isNonComputeChainOp(readyOpIdx)) {
@@ -454,11 +469,13 @@ void FeasibleMemoryScheduler::distributeReadyOps(llvm::ArrayRef<operationIdxType
                               "Operation already in non compute chain op list '{0}'", readyOpIdx);
             _nonComputeChainOps.insert(readyOpIdx);
             _log.trace("Non compute chain op ready '{0}'", readyOpIdx);
+            readyNonComputeChainOpEvent.record(readyOpIdx);
         } else {
             VPUX_THROW_UNLESS(_readyComputeOps.find(readyOpIdx) == _readyComputeOps.end(),
                               "Operation already in ready compute list '{0}'", readyOpIdx);
             _readyComputeOps.insert(readyOpIdx);
             _log.trace("Add to ready compute ops '{0}'", readyOpIdx);
+            readyComputeOpEvent.record(readyOpIdx);
         }
     }
     _log = _log.unnest();
@@ -472,6 +489,7 @@ void FeasibleMemoryScheduler::unscheduleAllCompletingOps() {
     for (auto& op : _cycleEndHeap) {
         auto opIdx = op.op_;
         _log.trace("Unscheduling '{0}'", opIdx);
+        unscheduleOpEvent.record(opIdx);
         unscheduleOp(op);
         if (!isDataOp(opIdx) && op.isOriginalOp()) {
             // propagate through original compute ops, generate new ready ops
@@ -688,6 +706,7 @@ size_t FeasibleMemoryScheduler::scheduleInputOpForComputeOp(operationIdxType inp
     auto scheduleOnExecutor = getCurrentCycleAndExecutorInstanceMask(inputIdx);
     auto scheduleCycle = std::max(scheduleOnExecutor.cycle, getEarliestComputeBeginCycle(inputIdx));
     _log.nest().trace("Scheduling input for compute op:'{0}' at cycle {1}", inputIdx, scheduleCycle);
+    scheduleInputOpEvent.record(inputIdx, scheduleCycle);
     _opOutputTable.insert(std::make_pair(inputIdx, OpOutputInfo(EOpState::ACTIVE, _outDegreeTable[inputIdx])));
     // update current cycle directly
     auto nextAvailibleCycle = scheduleCycle + operationCycleCost(inputIdx);
@@ -706,6 +725,7 @@ size_t FeasibleMemoryScheduler::schedulePrefetchOp(operationIdxType inputIdx) {
     auto scheduleOnExecutor = getCurrentCycleAndExecutorInstanceMask(inputIdx);
     auto scheduleCycle = std::max(scheduleOnExecutor.cycle, getEarliestComputeBeginCycle(inputIdx));
     _log.nest().trace("Scheduling prefetched data op:'{0}' at cycle {1}", inputIdx, scheduleCycle);
+    schedulePrefetchOpEvent.record(inputIdx, scheduleCycle);
     _opOutputTable.insert(std::make_pair(inputIdx, OpOutputInfo(EOpState::ACTIVE, _outDegreeTable[inputIdx])));
     // update current cycle directly
     auto nextAvailibleCycle = scheduleCycle + operationCycleCost(inputIdx);
@@ -720,6 +740,7 @@ size_t FeasibleMemoryScheduler::scheduleSpilledOpBuffer(operationIdxType inputId
     auto scheduleOnExecutor = getCurrentCycleAndExecutorInstanceMaskForSpill(*buffer);
     auto scheduleCycle = scheduleOnExecutor.cycle;
     _log.nest().trace("Scheduling spilled op:'{0}' at cycle {1}", inputIdx, scheduleCycle);
+    scheduleSpilledOpEvent.record(inputIdx, scheduleCycle);
     // also store the buffer spilled
     auto spilledReadBuffer = *buffer;
     // update current cycle directly
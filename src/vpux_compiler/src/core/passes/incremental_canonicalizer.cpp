@@ -0,0 +1,69 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/core/passes.hpp"
+
+#include "vpux/compiler/utils/incremental_rewriter.hpp"
+#include "vpux/compiler/utils/rewriter.hpp"
+
+using namespace vpux;
+
+namespace {
+
+//
+// IncrementalCanonicalizerPass
+//
+
+class IncrementalCanonicalizerPass final : public IncrementalCanonicalizerBase<IncrementalCanonicalizerPass> {
+public:
+    IncrementalCanonicalizerPass(const mlir::GreedyRewriteConfig& config, Logger log): _config(config) {
+        Base::initLogger(log, Base::getArgumentName());
+    }
+
+public:
+    mlir::LogicalResult initialize(mlir::MLIRContext* ctx) final;
+
+private:
+    void safeRunOnFunc() final;
+
+private:
+    mlir::GreedyRewriteConfig _config;
+    mlir::FrozenRewritePatternSet _patterns;
+};
+
+mlir::LogicalResult IncrementalCanonicalizerPass::initialize(mlir::MLIRContext* ctx) {
+    mlir::RewritePatternSet patterns(ctx);
+    populateCanonicalizationPatterns(patterns, ctx);
+
+    _patterns = mlir::FrozenRewritePatternSet(std::move(patterns));
+    return mlir::success();
+}
+
+void IncrementalCanonicalizerPass::safeRunOnFunc() {
+    auto func = getOperation();
+
+    auto& info = getAnalysis<IncrementalRewriteInfo>();
+
+    // As for the upstream canonicalizer, IR which is not converged is not an error, the next run continues from it
+    bool isSkipped = false;
+    std::ignore = applyPatternsToChangedOps(func, getArgumentName(), info, _patterns, _config, _log, &isSkipped);
+
+    if (isSkipped) {
+        markAllAnalysesPreserved();
+    } else {
+        markAnalysesPreserved<IncrementalRewriteInfo>();
+    }
+}
+
+}  // namespace
+
+//
+// createIncrementalCanonicalizerPass
+//
+
+std::unique_ptr<mlir::Pass> vpux::createIncrementalCanonicalizerPass(const mlir::GreedyRewriteConfig& config,
+                                                                     Logger log) {
+    return std::make_unique<IncrementalCanonicalizerPass>(config, log);
+}
@@ -4,6 +4,7 @@
 //
 
 #include "vpux/compiler/conversion.hpp"
+#include "vpux/compiler/core/passes.hpp"
 #include "vpux/compiler/dialect/EMU/passes.hpp"
 #include "vpux/compiler/utils/rewriter.hpp"
 
@@ -23,7 +24,7 @@ void vpux::EMU::buildAdjustForEMU(mlir::OpPassManager& pm, Logger log) {
     pm.addPass(createConvertVPUNCEToEMUPass(log));
     pm.addPass(EMU::createRemoveWeightsAlignmentPass(log));
     pm.addPass(EMU::createAddWeightsTableToEmuPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 }
 
 //
@@ -0,0 +1,172 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/dialect/IE/passes.hpp"
+
+#include "vpux/compiler/dialect/IE/ops.hpp"
+#include "vpux/compiler/dialect/const/ops.hpp"
+#include "vpux/compiler/utils/logging.hpp"
+#include "vpux/compiler/utils/strings.hpp"
+
+#include <mlir/Dialect/Quant/QuantTypes.h>
+
+#include <llvm/ADT/MapVector.h>
+
+#include <unordered_set>
+
+using namespace vpux;
+
+namespace {
+
+//
+// AddDebugOutputsPass
+//
+
+class AddDebugOutputsPass final : public IE::AddDebugOutputsBase<AddDebugOutputsPass> {
+public:
+    AddDebugOutputsPass(StringRef layerNames, Logger log): _layerNames(layerNames.str()) {
+        Base::initLogger(log, Base::getArgumentName());
+    }
+
+    mlir::LogicalResult initialize(mlir::MLIRContext* ctx) final;
+
+private:
+    void safeRunOnModule() final;
+
+private:
+    std::string _layerNames;
+};
+
+mlir::LogicalResult AddDebugOutputsPass::initialize(mlir::MLIRContext* ctx) {
+    if (mlir::failed(Base::initialize(ctx))) {
+        return mlir::failure();
+    }
+
+    // When this parameter has a value, it probably comes from LIT test.
+    // Override the default
+    if (layerNames.hasValue()) {
+        _layerNames = layerNames.getValue();
+    }
+
+    return mlir::success();
+}
+
+//
+// safeRunOnModule
+//
+
+void AddDebugOutputsPass::safeRunOnModule() {
+    SmallVector<StringRef> requestedLayers;
+    StringRef(_layerNames).split(requestedLayers, ',', /*MaxSplit=*/-1, /*KeepEmpty=*/false);
+    if (requestedLayers.empty()) {
+        return;
+    }
+
+    auto module = getOperation();
+    auto* ctx = module.getContext();
+
+    IE::CNNNetworkOp netInfo;
+    mlir::func::FuncOp mainFunc;
+    IE::CNNNetworkOp::getFromModule(module, netInfo, mainFunc);
+
+    llvm::MapVector<StringRef, SmallVector<mlir::Operation*>> layerOps;
+    for (auto layerName : requestedLayers) {
+        layerOps.insert({layerName, {}});
+    }
+
+    for (auto& op : mainFunc.getOps()) {
+        if (op.getNumResults() == 0 || mlir::isa<Const::DeclareOp, mlir::func::ReturnOp>(op)) {
+            continue;
+        }
+
+        const auto layerName = getLayerName(op.getLoc());
+        const auto it = layerOps.find(layerName);
+        if (it != layerOps.end()) {
+            it->second.push_back(&op);
+        }
+    }
+
+    auto retOps = to_small_vector(mainFunc.getOps<mlir::func::ReturnOp>());
+    VPUX_THROW_UNLESS(retOps.size() == 1,
+                      "Can't have more than one 'mlir::func::ReturnOp' Operation in main function, got '{0}'",
+                      retOps.size());
+    auto mainRetOp = retOps.front();
+
+    std::unordered_set<std::string> outputNames;
+    for (auto outputInfo : netInfo.getOutputsDataInfo()) {
+        outputNames.insert(outputInfo.name().str());
+    }
+
+    OpBuilderLogger builderLog(_log.nest());
+    auto outputsInfoBuilder = mlir::OpBuilder::atBlockEnd(&netInfo.getOutputsInfo().front(), &builderLog);
+
+    SmallVector<mlir::Type> newResultTypes(mainFunc.getFunctionType().getResults());
+
+    for (const auto& p : layerOps) {
+        const auto layerName = p.first;
+        const auto& ops = p.second;
+
+        if (ops.empty()) {
+            _log.warning("Layer '{0}' was removed or merged into another layer, it has no debug output", layerName);
+            continue;
+        }
+        if (ops.size() > 1) {
+            _log.warning("Layer '{0}' was decomposed into {1} operations, it has no debug output", layerName,
+                         ops.size());
+            continue;
+        }
+
+        auto* op = ops.front();
+        if (auto postOpIface = mlir::dyn_cast<IE::LayerWithPostOpInterface>(op)) {
+            if (const auto postOp = postOpIface.getPostOp()) {
+                _log.warning("Layer '{0}' was fused with post-operation '{1}', it has no debug output", layerName,
+                             postOp.value());
+                continue;
+            }
+        }
+
+        for (auto result : op->getResults()) {
+            const auto outputName = op->getNumResults() == 1
+                                            ? layerName.str()
+                                            : printToString("{0}.{1}", layerName, result.getResultNumber());
+
+            const auto isNetOutput = llvm::any_of(result.getUsers(), [&](mlir::Operation* user) {
+                return user == mainRetOp.getOperation();
+            });
+            if (isNetOutput || outputNames.count(outputName) != 0) {
+                _log.trace("Result '{0}' is already a network output", outputName);
+                continue;
+            }
+
+            const auto resultType = result.getType().cast<vpux::NDTypeInterface>();
+            if (resultType.getElementType().isa<mlir::quant::QuantizedType>()) {
+                _log.warning("Result '{0}' has quantized type '{1}', it has no debug output", outputName, resultType);
+                continue;
+            }
+
+            _log.trace("Add debug output '{0}' for '{1}' at '{2}'", outputName, op->getName(), op->getLoc());
+
+            const auto outputNameAttr = mlir::StringAttr::get(ctx, outputName);
+            outputsInfoBuilder.create<IE::DataInfoOp>(mlir::UnknownLoc::get(ctx), outputNameAttr,
+                                                      mlir::TypeAttr::get(resultType),
+                                                      /*profilingSectionsCount=*/0);
+            mainRetOp.operandsMutable().append(result);
+            newResultTypes.push_back(resultType);
+            outputNames.insert(outputName);
+        }
+    }
+
+    mainFunc.setType(mlir::FunctionType::get(ctx, mainFunc.getFunctionType().getInputs(), newResultTypes));
+}
+
+}  // namespace
+
+//
+// createAddDebugOutputsPass
+//
+
+std::unique_ptr<mlir::Pass> vpux::IE::createAddDebugOutputsPass(StringRef layerNames, Logger log) {
+    return std::make_unique<AddDebugOutputsPass>(layerNames, log);
+}
@@ -0,0 +1,109 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/dialect/IE/passes.hpp"
+
+#include "vpux/compiler/dialect/IE/ops.hpp"
+#include "vpux/compiler/dialect/const/ops.hpp"
+
+#include <mlir/IR/SymbolTable.h>
+
+using namespace vpux;
+
+namespace {
+
+//
+// InlinePartitionsPass
+//
+
+class InlinePartitionsPass final : public IE::InlinePartitionsBase<InlinePartitionsPass> {
+public:
+    explicit InlinePartitionsPass(Logger log) {
+        Base::initLogger(log, Base::getArgumentName());
+    }
+
+private:
+    void safeRunOnModule() final;
+};
+
+//
+// safeRunOnModule
+//
+
+void InlinePartitionsPass::safeRunOnModule() {
+    auto module = getOperation();
+
+    IE::CNNNetworkOp netInfo;
+    mlir::func::FuncOp mainFunc;
+    IE::CNNNetworkOp::getFromModule(module, netInfo, mainFunc);
+
+    auto& mainBlock = mainFunc.getBody().front();
+
+    // The same constant might be cloned into several partitions
+    mlir::DenseMap<std::pair<mlir::Type, mlir::Attribute>, Const::DeclareOp> constants;
+    const auto mergeConstant = [&](Const::DeclareOp constOp) {
+        const auto key = std::make_pair(constOp.output().getType(), mlir::Attribute(constOp.getContentAttr()));
+        const auto it = constants.find(key);
+        if (it == constants.end()) {
+            constants.insert({key, constOp});
+            return;
+        }
+
+        auto origConstOp = it->second;
+        if (!origConstOp->isBeforeInBlock(constOp)) {
+            origConstOp->moveBefore(constOp);
+        }
+
+        constOp.replaceAllUsesWith(origConstOp.output());
+        constOp.erase();
+    };
+
+    for (auto constOp : llvm::make_early_inc_range(mainFunc.getOps<Const::DeclareOp>())) {
+        mergeConstant(constOp);
+    }
+
+    for (auto callOp : llvm::make_early_inc_range(mainFunc.getOps<mlir::func::CallOp>())) {
+        auto partFunc = module.lookupSymbol<mlir::func::FuncOp>(callOp.getCalleeAttr());
+        if (partFunc == nullptr || partFunc.isExternal() || !partFunc.isPrivate()) {
+            continue;
+        }
+
+        VPUX_THROW_UNLESS(partFunc.getBody().hasOneBlock(), "Function '{0}' must have a single block",
+                          partFunc.getName());
+
+        _log.trace("Inline '{0}' into '{1}'", partFunc.getName(), mainFunc.getName());
+
+        auto& partBlock = partFunc.getBody().front();
+        for (const auto& p : zip(partBlock.getArguments(), callOp.getOperands())) {
+            std::get<0>(p).replaceAllUsesWith(std::get<1>(p));
+        }
+
+        auto retOp = mlir::cast<mlir::func::ReturnOp>(partBlock.getTerminator());
+        callOp.replaceAllUsesWith(retOp.getOperands());
+        retOp.erase();
+
+        auto partConstants = to_small_vector(partBlock.getOps<Const::DeclareOp>());
+        mainBlock.getOperations().splice(callOp->getIterator(), partBlock.getOperations());
+        callOp.erase();
+
+        for (auto constOp : partConstants) {
+            mergeConstant(constOp);
+        }
+
+        if (mlir::SymbolTable::symbolKnownUseEmpty(partFunc, module)) {
+            partFunc.erase();
+        }
+    }
+}
+
+}  // namespace
+
+//
+// createInlinePartitionsPass
+//
+
+std::unique_ptr<mlir::Pass> vpux::IE::createInlinePartitionsPass(Logger log) {
+    return std::make_unique<InlinePartitionsPass>(log);
+}
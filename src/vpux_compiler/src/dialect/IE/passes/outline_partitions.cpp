@@ -0,0 +1,265 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/dialect/IE/passes.hpp"
+
+#include "vpux/compiler/dialect/IE/ops.hpp"
+#include "vpux/compiler/dialect/const/ops.hpp"
+#include "vpux/compiler/utils/logging.hpp"
+
+#include "vpux/utils/core/checked_cast.hpp"
+#include "vpux/utils/core/range.hpp"
+
+#include <llvm/ADT/DenseSet.h>
+#include <llvm/ADT/SetVector.h>
+
+#include <algorithm>
+#include <cstdlib>
+
+using namespace vpux;
+
+namespace {
+
+// The number of values defined by the operations before the i-th one and used by the i-th operation or after it
+SmallVector<size_t> getLiveValuesCount(ArrayRef<mlir::Operation*> ops) {
+    mlir::DenseMap<mlir::Operation*, size_t> opIndex;
+    for (const auto ind : irange(ops.size())) {
+        opIndex.insert({ops[ind], ind});
+    }
+
+    SmallVector<int64_t> delta(ops.size() + 2, 0);
+    for (const auto ind : irange(ops.size())) {
+        for (auto result : ops[ind]->getResults()) {
+            size_t lastUse = ind;
+            for (auto* user : result.getUsers()) {
+                // The users out of the list are the return operation
+                const auto it = opIndex.find(user);
+                lastUse = std::max(lastUse, it != opIndex.end() ? it->second : ops.size());
+            }
+
+            if (lastUse > ind) {
+                ++delta[ind + 1];
+                --delta[lastUse + 1];
+            }
+        }
+    }
+
+    SmallVector<size_t> liveCount(ops.size() + 1, 0);
+    int64_t curCount = 0;
+    for (const auto ind : irange(ops.size() + 1)) {
+        curCount += delta[ind];
+        liveCount[ind] = checked_cast<size_t>(curCount);
+    }
+
+    return liveCount;
+}
+
+// Returns the index of the first operation of each partition
+SmallVector<size_t> selectPartitionStarts(ArrayRef<mlir::Operation*> ops, size_t numPartitions) {
+    const auto liveCount = getLiveValuesCount(ops);
+    const auto window = std::max<size_t>(ops.size() / (4 * numPartitions), 1);
+
+    SmallVector<size_t> starts = {0};
+    for (size_t part = 1; part < numPartitions; ++part) {
+        const auto target = part * ops.size() / numPartitions;
+        const auto first = std::max(target - std::min(target, window), starts.back() + 1);
+        const auto last = std::min(target + window, ops.size() - 1);
+
+        auto best = std::clamp(target, first, last);
+        for (auto cut = first; cut <= last; ++cut) {
+            const auto isLessLive = liveCount[cut] < liveCount[best];
+            const auto isCloser = liveCount[cut] == liveCount[best] &&
+                                  std::abs(checked_cast<int64_t>(cut) - checked_cast<int64_t>(target)) <
+                                          std::abs(checked_cast<int64_t>(best) - checked_cast<int64_t>(target));
+            if (isLessLive || isCloser) {
+                best = cut;
+            }
+        }
+
+        starts.push_back(best);
+    }
+
+    return starts;
+}
+
+//
+// OutlinePartitionsPass
+//
+
+class OutlinePartitionsPass final : public IE::OutlinePartitionsBase<OutlinePartitionsPass> {
+public:
+    OutlinePartitionsPass(int64_t numPartitions, int64_t minPartitionSize, Logger log)
+            : _numPartitions(numPartitions), _minPartitionSize(minPartitionSize) {
+        Base::initLogger(log, Base::getArgumentName());
+    }
+
+    mlir::LogicalResult initialize(mlir::MLIRContext* ctx) final;
+
+private:
+    void safeRunOnModule() final;
+
+    void outlinePartition(mlir::func::FuncOp mainFunc, ArrayRef<mlir::Operation*> partOps, StringRef partName);
+
+private:
+    int64_t _numPartitions;
+    int64_t _minPartitionSize;
+};
+
+mlir::LogicalResult OutlinePartitionsPass::initialize(mlir::MLIRContext* ctx) {
+    if (mlir::failed(Base::initialize(ctx))) {
+        return mlir::failure();
+    }
+
+    // When this parameter has a value, it probably comes from LIT test.
+    // Override the default
+    if (numPartitions.hasValue()) {
+        _numPartitions = numPartitions.getValue();
+    }
+    if (minPartitionSize.hasValue()) {
+        _minPartitionSize = minPartitionSize.getValue();
+    }
+
+    return mlir::success();
+}
+
+void OutlinePartitionsPass::outlinePartition(mlir::func::FuncOp mainFunc, ArrayRef<mlir::Operation*> partOps,
+                                             StringRef partName) {
+    const llvm::DenseSet<mlir::Operation*> partSet(partOps.begin(), partOps.end());
+    const auto isInPartition = [&](mlir::OpOperand& use) {
+        return partSet.contains(use.getOwner());
+    };
+
+    llvm::SetVector<mlir::Value> inputs;
+    llvm::SetVector<mlir::Operation*> constants;
+    SmallVector<mlir::Value> outputs;
+
+    for (auto* op : partOps) {
+        for (auto operand : op->getOperands()) {
+            auto* producer = operand.getDefiningOp();
+            if (producer != nullptr && partSet.contains(producer)) {
+                continue;
+            }
+
+            // Constants are cloned, so the patterns which match constant operands still see them
+            if (mlir::isa_and_nonnull<Const::DeclareOp>(producer)) {
+                constants.insert(producer);
+            } else {
+                inputs.insert(operand);
+            }
+        }
+
+        for (auto result : op->getResults()) {
+            if (llvm::any_of(result.getUsers(), [&](mlir::Operation* user) {
+                    return !partSet.contains(user);
+                })) {
+                outputs.push_back(result);
+            }
+        }
+    }
+
+    _log.trace("Outline '{0}' with {1} operations, {2} inputs and {3} outputs", partName, partOps.size(),
+               inputs.size(), outputs.size());
+
+    auto* ctx = mainFunc.getContext();
+    OpBuilderLogger builderLog(_log.nest());
+    mlir::OpBuilder builder(mainFunc, &builderLog);
+
+    const auto partType = mlir::FunctionType::get(ctx, mlir::TypeRange(mlir::ValueRange(inputs.getArrayRef())),
+                                                  mlir::TypeRange(mlir::ValueRange(outputs)));
+
+    auto partFunc = builder.create<mlir::func::FuncOp>(mainFunc.getLoc(), partName, partType);
+    partFunc.setPrivate();
+    auto* partBlock = partFunc.addEntryBlock();
+
+    builder.setInsertionPoint(partOps.front());
+    auto callOp = builder.create<mlir::func::CallOp>(partOps.front()->getLoc(), partFunc, inputs.getArrayRef());
+    for (const auto ind : irange(outputs.size())) {
+        outputs[ind].replaceUsesWithIf(callOp.getResult(checked_cast<unsigned>(ind)), [&](mlir::OpOperand& use) {
+            return !isInPartition(use);
+        });
+    }
+
+    auto partBuilder = mlir::OpBuilder::atBlockEnd(partBlock, &builderLog);
+    for (auto* constOp : constants) {
+        auto* newConstOp = partBuilder.clone(*constOp);
+        constOp->getResult(0).replaceUsesWithIf(newConstOp->getResult(0), isInPartition);
+    }
+
+    for (auto* op : partOps) {
+        op->moveBefore(partBlock, partBlock->end());
+    }
+
+    for (const auto ind : irange(inputs.size())) {
+        inputs[ind].replaceUsesWithIf(partBlock->getArgument(checked_cast<unsigned>(ind)), isInPartition);
+    }
+
+    partBuilder.setInsertionPointToEnd(partBlock);
+    partBuilder.create<mlir::func::ReturnOp>(mainFunc.getLoc(), outputs);
+}
+
+//
+// safeRunOnModule
+//
+
+void OutlinePartitionsPass::safeRunOnModule() {
+    if (_numPartitions <= 1) {
+        return;
+    }
+    VPUX_THROW_UNLESS(_minPartitionSize > 0, "Minimal partition size must be positive, got '{0}'", _minPartitionSize);
+
+    auto module = getOperation();
+
+    IE::CNNNetworkOp netInfo;
+    mlir::func::FuncOp mainFunc;
+    IE::CNNNetworkOp::getFromModule(module, netInfo, mainFunc);
+
+    SmallVector<mlir::Operation*> ops;
+    for (auto& op : mainFunc.getOps()) {
+        if (mlir::isa<Const::DeclareOp, mlir::func::ReturnOp>(op)) {
+            continue;
+        }
+
+        if (op.getNumRegions() != 0) {
+            _log.trace("Operation '{0}' at '{1}' has regions, the main function is not split", op.getName(),
+                       op.getLoc());
+            return;
+        }
+
+        ops.push_back(&op);
+    }
+
+    const auto numPartitions =
+            std::min(checked_cast<size_t>(_numPartitions), ops.size() / checked_cast<size_t>(_minPartitionSize));
+    if (numPartitions <= 1) {
+        _log.trace("The main function has only {0} operations, it is not split", ops.size());
+        return;
+    }
+
+    auto starts = selectPartitionStarts(ops, numPartitions);
+    starts.push_back(ops.size());
+
+    for (const auto part : irange(numPartitions)) {
+        const auto partOps = makeArrayRef(ops).slice(starts[part], starts[part + 1] - starts[part]);
+        const auto partName = printToString("{0}_part{1}", mainFunc.getName(), part);
+        outlinePartition(mainFunc, partOps, partName);
+    }
+
+    for (auto constOp : llvm::make_early_inc_range(mainFunc.getOps<Const::DeclareOp>())) {
+        if (constOp->use_empty()) {
+            constOp.erase();
+        }
+    }
+}
+
+}  // namespace
+
+//
+// createOutlinePartitionsPass
+//
+
+std::unique_ptr<mlir::Pass> vpux::IE::createOutlinePartitionsPass(int64_t numPartitions, int64_t minPartitionSize,
+                                                                   Logger log) {
+    return std::make_unique<OutlinePartitionsPass>(numPartitions, minPartitionSize, log);
+}
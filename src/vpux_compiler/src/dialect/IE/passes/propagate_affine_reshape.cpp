@@ -7,6 +7,7 @@
 
 #include "vpux/compiler/utils/attributes_utils.hpp"
 #include "vpux/compiler/utils/error.hpp"
+#include "vpux/compiler/utils/incremental_rewriter.hpp"
 #include "vpux/compiler/utils/rewriter.hpp"
 
 #include <mlir/IR/BlockAndValueMapping.h>
@@ -605,9 +606,14 @@ void PropagateAffineReshape::safeRunOnFunc() {
     patterns.add<MoveThroughGelu>(&ctx, _log);
     IE::ReshapeOp::getCanonicalizationPatterns(patterns, &ctx);
 
-    if (mlir::failed(mlir::applyPatternsAndFoldGreedily(func, std::move(patterns), getDefaultGreedyRewriteConfig()))) {
+    auto& info = getAnalysis<IncrementalRewriteInfo>();
+    if (mlir::failed(applyPatternsToChangedOps(func, getArgumentName(), info, std::move(patterns),
+                                               getDefaultGreedyRewriteConfig(), _log))) {
         signalPassFailure();
+        return;
     }
+
+    markAnalysesPreserved<IncrementalRewriteInfo>();
 }
 
 }  // namespace
@@ -7,6 +7,7 @@
 
 #include "vpux/compiler/dialect/IE/utils/permute_infer.hpp"
 #include "vpux/compiler/utils/error.hpp"
+#include "vpux/compiler/utils/incremental_rewriter.hpp"
 #include "vpux/compiler/utils/rewriter.hpp"
 
 #include <mlir/IR/BlockAndValueMapping.h>
@@ -488,9 +489,14 @@ void UniquifyBranches::safeRunOnFunc() {
     patterns.add<MoveAffineReshapeBeforeSlice>(&ctx, _log);
     patterns.add<MoveMemPermuteBeforeSlice>(&ctx, _log);
 
-    if (mlir::failed(mlir::applyPatternsAndFoldGreedily(func, std::move(patterns), getDefaultGreedyRewriteConfig()))) {
+    auto& info = getAnalysis<IncrementalRewriteInfo>();
+    if (mlir::failed(applyPatternsToChangedOps(func, getArgumentName(), info, std::move(patterns),
+                                               getDefaultGreedyRewriteConfig(), _log))) {
         signalPassFailure();
+        return;
     }
+
+    markAnalysesPreserved<IncrementalRewriteInfo>();
 }
 
 }  // namespace
@@ -7,6 +7,7 @@
 
 #include "vpux/compiler/dialect/IE/ops.hpp"
 #include "vpux/compiler/utils/attributes.hpp"
+#include "vpux/compiler/utils/incremental_rewriter.hpp"
 #include "vpux/compiler/utils/rewriter.hpp"
 #include "vpux/compiler/utils/types.hpp"
 
@@ -161,36 +162,69 @@ bool RemoveDuplicatingCommutativeEltwise<ConcreteOp>::isDuplicatedOperation(Conc
 
 class UniquifyOpsPass final : public IE::UniquifyOpsBase<UniquifyOpsPass> {
 public:
-    explicit UniquifyOpsPass(Logger log) {
+    UniquifyOpsPass(const bool canonicalize, Logger log): _canonicalize(canonicalize) {
         Base::initLogger(log, Base::getArgumentName());
     }
 
+    mlir::LogicalResult initialize(mlir::MLIRContext* ctx) final;
+
 private:
     void safeRunOnFunc() final;
+
+private:
+    bool _canonicalize;
+    std::string _patternSetName;
+    mlir::FrozenRewritePatternSet _patterns;
 };
 
-void UniquifyOpsPass::safeRunOnFunc() {
-    auto& ctx = getContext();
-
-    mlir::RewritePatternSet patterns(&ctx);
-    patterns.add<RemoveDuplicatingGeneric<IE::ExpandOp>>(&ctx, _log);
-    patterns.add<RemoveDuplicatingGeneric<IE::ReorderOp>>(&ctx, _log);
-    patterns.add<RemoveDuplicatingGeneric<IE::PermuteCastOp>>(&ctx, _log);
-    patterns.add<RemoveDuplicatingGeneric<IE::ShapeCastOp>>(&ctx, _log);
-    patterns.add<RemoveDuplicatingGeneric<IE::QuantizeCastOp>>(&ctx, _log);
-    patterns.add<RemoveDuplicatingCommutativeEltwise<IE::AddOp>>(&ctx, _log);
-    patterns.add<RemoveDuplicatingCommutativeEltwise<IE::AndOp>>(&ctx, _log);
-    patterns.add<RemoveDuplicatingGeneric<IE::ReshapeOp>>(&ctx, _log);
-    patterns.add<RemoveDuplicatingGeneric<IE::LayoutCastOp>>(&ctx, _log);
-    patterns.add<RemoveDuplicatingGeneric<IE::MemPermuteOp>>(&ctx, _log);
-    patterns.add<RemoveDuplicatingGeneric<IE::AffineReshapeOp>>(&ctx, _log);
-    patterns.add<RemoveDuplicatingGeneric<IE::PermuteQuantizeOp>>(&ctx, _log);
-    patterns.add<RemoveDuplicatingConcat>(&ctx, _log);
+mlir::LogicalResult UniquifyOpsPass::initialize(mlir::MLIRContext* ctx) {
+    if (mlir::failed(Base::initialize(ctx))) {
+        return mlir::failure();
+    }
+
+    // When this parameter has a value, it probably comes from LIT test.
+    // Override the default
+    if (canonicalize.hasValue()) {
+        _canonicalize = canonicalize.getValue();
+    }
 
+    mlir::RewritePatternSet patterns(ctx);
+    patterns.add<RemoveDuplicatingGeneric<IE::ExpandOp>>(ctx, _log);
+    patterns.add<RemoveDuplicatingGeneric<IE::ReorderOp>>(ctx, _log);
+    patterns.add<RemoveDuplicatingGeneric<IE::PermuteCastOp>>(ctx, _log);
+    patterns.add<RemoveDuplicatingGeneric<IE::ShapeCastOp>>(ctx, _log);
+    patterns.add<RemoveDuplicatingGeneric<IE::QuantizeCastOp>>(ctx, _log);
+    patterns.add<RemoveDuplicatingCommutativeEltwise<IE::AddOp>>(ctx, _log);
+    patterns.add<RemoveDuplicatingCommutativeEltwise<IE::AndOp>>(ctx, _log);
+    patterns.add<RemoveDuplicatingGeneric<IE::ReshapeOp>>(ctx, _log);
+    patterns.add<RemoveDuplicatingGeneric<IE::LayoutCastOp>>(ctx, _log);
+    patterns.add<RemoveDuplicatingGeneric<IE::MemPermuteOp>>(ctx, _log);
+    patterns.add<RemoveDuplicatingGeneric<IE::AffineReshapeOp>>(ctx, _log);
+    patterns.add<RemoveDuplicatingGeneric<IE::PermuteQuantizeOp>>(ctx, _log);
+    patterns.add<RemoveDuplicatingConcat>(ctx, _log);
+
+    // The fused set converges to another fixed point, so it is tracked separately from the plain one
+    _patternSetName = getArgumentName().str();
+    if (_canonicalize) {
+        populateCanonicalizationPatterns(patterns, ctx);
+        _patternSetName += "+canonicalize";
+    }
+
+    _patterns = mlir::FrozenRewritePatternSet(std::move(patterns));
+    return mlir::success();
+}
+
+void UniquifyOpsPass::safeRunOnFunc() {
     auto func = getOperation();
-    if (mlir::failed(mlir::applyPatternsAndFoldGreedily(func, std::move(patterns), getDefaultGreedyRewriteConfig()))) {
+
+    auto& info = getAnalysis<IncrementalRewriteInfo>();
+    if (mlir::failed(applyPatternsToChangedOps(func, _patternSetName, info, _patterns, getDefaultGreedyRewriteConfig(),
+                                               _log))) {
         signalPassFailure();
+        return;
     }
+
+    markAnalysesPreserved<IncrementalRewriteInfo>();
 }
 
 }  // namespace
@@ -199,6 +233,6 @@ void UniquifyOpsPass::safeRunOnFunc() {
 // createUniquifyOpsPass
 //
 
-std::unique_ptr<mlir::Pass> vpux::IE::createUniquifyOpsPass(Logger log) {
-    return std::make_unique<UniquifyOpsPass>(log);
+std::unique_ptr<mlir::Pass> vpux::IE::createUniquifyOpsPass(const bool canonicalize, Logger log) {
+    return std::make_unique<UniquifyOpsPass>(canonicalize, log);
 }
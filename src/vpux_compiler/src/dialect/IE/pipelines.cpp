@@ -4,6 +4,7 @@
 //
 
 #include "vpux/compiler/pipelines.hpp"
+#include "vpux/compiler/core/passes.hpp"
 #include "vpux/compiler/dialect/IE/passes.hpp"
 #include "vpux/compiler/utils/rewriter.hpp"
 
@@ -23,7 +24,7 @@ void vpux::IE::buildAdjustPrecisionPipeline(mlir::OpPassManager& pm, Logger log)
     pm.addPass(IE::createConvertPrecisionToI32Pass(log));
     pm.addPass(IE::createUseUserPrecisionPass(log));
     pm.addPass(IE::createAdjustSoftwareOpsPrecisionPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 }
 
 //
@@ -43,12 +44,12 @@ void vpux::IE::buildAdjustLayoutPipeline(mlir::OpPassManager& pm, const AdjustLa
     pm.addPass(IE::createSwapTransposeConcatPass(log));
     pm.addPass(IE::createTransposeToPermuteCastPass(log));
     pm.addPass(IE::createAdjustLayoutsPass(/*seOpsEnabled=*/isOptionEnabled(options.enableSEPtrsOperations), log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     if (options.enableOptimizeReorders) {
         pm.addPass(
                 IE::createOptimizeReordersPass(/*seOpsEnabled=*/isOptionEnabled(options.enableSEPtrsOperations), log));
-        pm.addPass(IE::createUniquifyOpsPass(log));
+        pm.addPass(IE::createUniquifyOpsPass(/*canonicalize=*/false, log));
         pm.addPass(IE::createUniquifyBranchesPass(log));
         pm.addPass(IE::createPropagateReorderToNCEPass(log));
         pm.addPass(IE::createFuseReordersPass(log));
@@ -82,11 +83,11 @@ void vpux::IE::buildAdjustForVPUPipeline(mlir::OpPassManager& pm, const AdjustFo
     pm.addPass(IE::createConvertDepth2SpaceLayerPass(log));
     pm.addPass(IE::createConvertSpace2DepthLayerPass(log));
     pm.addPass(IE::createConvertGatherToSlicePass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     pm.addPass(IE::createSwapMaxPoolWithActivation(log));
     pm.addPass(IE::createFusePostOpsPass(log));
     pm.addPass(IE::createOptimizeConcatSlicePass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 }
 
 //
@@ -106,7 +107,7 @@ void vpux::IE::buildLowPrecisionPipeline(mlir::OpPassManager& pm, const LowPreci
     pm.addPass(IE::createSplitFakeQuantPass(log));
     pm.addPass(IE::createFuseConvertWithQuantizePass(log));
     if (options.enablePropagateQuantDequant) {
-        pm.addPass(mlir::createCanonicalizerPass(grc));
+        pm.addPass(createIncrementalCanonicalizerPass(grc));
         pm.addPass(IE::createPropagateQuantizeDequantizePass(log));
     }
     if (options.enableSwapTransposeWithFQ) {
@@ -120,12 +121,12 @@ void vpux::IE::buildLowPrecisionPipeline(mlir::OpPassManager& pm, const LowPreci
         pm.addPass(IE::createRemoveQuantDequantSeqPass(log));
     }
     pm.addPass(IE::createConvertWeightsToU8Pass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     pm.addPass(IE::createDequantizeConstPass(log));
     pm.addPass(IE::createConvertQuantizeOpsToNceOpsPass(log));
     pm.addPass(IE::createMergeFakeQuantPass(log));
     pm.addPass(IE::createSwapQuantCastAndClampPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 }
 
 void vpux::IE::buildInitialTransformationsPipeline(mlir::OpPassManager& pm, const TransformOptions& options,
@@ -138,7 +139,7 @@ void vpux::IE::buildInitialTransformationsPipeline(mlir::OpPassManager& pm, cons
     pm.addPass(IE::createMatMulInputsTo2dPass(log));
     pm.addPass(IE::createPropagateOpThroughBatchConcatPass(log));
     pm.addPass(IE::createConvertMatMulToConvPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 
     if (options.enableConvertFCToConv) {
         pm.addPass(IE::createConvertFCToConvPass(log));
@@ -152,7 +153,7 @@ void vpux::IE::buildScaleShiftProcessingPipeline(mlir::OpPassManager& pm, Logger
     pm.addPass(IE::createConvertBroadcastToTilePass(log));
     pm.addPass(IE::createConvertScaleShiftToDWPass(log));
 
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 }
 
 void vpux::IE::buildOperationConversionPipeline(mlir::OpPassManager& pm, Logger log) {
@@ -162,7 +163,7 @@ void vpux::IE::buildOperationConversionPipeline(mlir::OpPassManager& pm, Logger
     pm.addPass(IE::createConvertReduceToPoolingPass(log));
     pm.addPass(IE::createConvertSquaredDiffToSubAndPowerPass(log));
     pm.addPass(IE::createConvertPowerToMultPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 }
 
 //
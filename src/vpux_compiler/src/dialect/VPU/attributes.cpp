@@ -10,6 +10,7 @@
 #include "vpux/compiler/dialect/IE/attributes.hpp"
 #include "vpux/compiler/dialect/IE/ops.hpp"
 #include "vpux/compiler/dialect/IE/utils/resources.hpp"
+#include "vpux/compiler/dialect/VPU/dialect.hpp"
 #include "vpux/compiler/dialect/VPUIP/utils.hpp"
 #include "vpux/compiler/utils/analysis.hpp"
 #include "vpux/compiler/utils/attributes.hpp"
@@ -914,7 +915,16 @@ SmallVector<DimRange> getOverlappedInputTileDimRanges(ArrayRef<int64_t> shape, A
     return inputTileDimRanges;
 }
 
-SmallVector<Shape> vpux::VPU::getPerClusterComputeShapes(ShapeRef shapeRef, DistributedTensorAttr distributionAttr) {
+//
+// Per-cluster layouts
+//
+
+// The layouts are computed once for each pair of shape and distribution, see PerClusterLayoutCache
+namespace vpux {
+namespace VPU {
+namespace {
+
+SmallVector<Shape> computePerClusterComputeShapes(ShapeRef shapeRef, DistributedTensorAttr distributionAttr) {
     auto shape = to_small_vector(shapeRef.raw());
     const auto distributionMode = distributionAttr.getMode().getValue();
 
@@ -943,7 +953,7 @@ SmallVector<Shape> vpux::VPU::getPerClusterComputeShapes(ShapeRef shapeRef, Dist
 
     if (VPU::bitEnumContains(distributionMode, VPU::DistributionMode::OVERLAPPED)) {
         if (distributionAttr.getEqualMemoryAndComputeView() != nullptr) {
-            return getPerClusterMemoryShapes(shapeRef, distributionAttr);
+            return to_small_vector(getPerClusterMemoryShapes(shapeRef, distributionAttr));
         }
 
         return getComputeSplitIntoSegments();
@@ -959,8 +969,7 @@ SmallVector<Shape> vpux::VPU::getPerClusterComputeShapes(ShapeRef shapeRef, Dist
     VPUX_THROW("Cannot get per cluster memory shapes. Unsupported distribution: {0}", distributionAttr);
 }
 
-SmallVector<Shape> vpux::VPU::getPerClusterComputeShapeOffsets(ShapeRef shapeRef,
-                                                               DistributedTensorAttr distributionAttr) {
+SmallVector<Shape> computePerClusterComputeShapeOffsets(ShapeRef shapeRef, DistributedTensorAttr distributionAttr) {
     const auto shape = to_small_vector(shapeRef.raw());
     const auto distributionMode = distributionAttr.getMode().getValue();
 
@@ -987,7 +996,7 @@ SmallVector<Shape> vpux::VPU::getPerClusterComputeShapeOffsets(ShapeRef shapeRef
 
     if (VPU::bitEnumContains(distributionMode, VPU::DistributionMode::OVERLAPPED)) {
         if (distributionAttr.getEqualMemoryAndComputeView() != nullptr) {
-            return getPerClusterMemoryShapeOffsets(shapeRef, distributionAttr);
+            return to_small_vector(getPerClusterMemoryShapeOffsets(shapeRef, distributionAttr));
         }
 
         return getOffsetsForSegments(tiledComputeShapeOffsets);
@@ -1001,7 +1010,7 @@ SmallVector<Shape> vpux::VPU::getPerClusterComputeShapeOffsets(ShapeRef shapeRef
     VPUX_THROW("Cannot get per cluster memory shapes. Unsupported distribution: {0}", distributionAttr);
 }
 
-SmallVector<Shape> vpux::VPU::getPerClusterMemoryShapes(ShapeRef shapeRef, DistributedTensorAttr distributionAttr) {
+SmallVector<Shape> computePerClusterMemoryShapes(ShapeRef shapeRef, DistributedTensorAttr distributionAttr) {
     auto shape = to_small_vector(shapeRef.raw());
     const auto distributionMode = distributionAttr.getMode().getValue();
 
@@ -1053,8 +1062,7 @@ SmallVector<Shape> vpux::VPU::getPerClusterMemoryShapes(ShapeRef shapeRef, Distr
     VPUX_THROW("Cannot get per cluster memory shapes. Unsupported distribution: {0}", distributionAttr);
 }
 
-SmallVector<Shape> vpux::VPU::getPerClusterMemoryShapeOffsets(ShapeRef shapeRef,
-                                                              DistributedTensorAttr distributionAttr) {
+SmallVector<Shape> computePerClusterMemoryShapeOffsets(ShapeRef shapeRef, DistributedTensorAttr distributionAttr) {
     const auto shape = to_small_vector(shapeRef.raw());
     const auto distributionMode = distributionAttr.getMode().getValue();
 
@@ -1104,6 +1112,41 @@ SmallVector<Shape> vpux::VPU::getPerClusterMemoryShapeOffsets(ShapeRef shapeRef,
     VPUX_THROW("Cannot get per cluster memory shapes. Unsupported distribution: {0}", distributionAttr);
 }
 
+ArrayRef<Shape> getCachedPerClusterLayout(PerClusterLayoutCache::Kind kind, ShapeRef shapeRef,
+                                          DistributedTensorAttr distributionAttr,
+                                          FuncRef<SmallVector<Shape>(ShapeRef, DistributedTensorAttr)> compute) {
+    auto* dialect = distributionAttr.getContext()->getLoadedDialect<VPUDialect>();
+    VPUX_THROW_WHEN(dialect == nullptr, "VPU dialect is not loaded");
+    return dialect->getPerClusterLayoutCache().getOrCompute(kind, shapeRef, distributionAttr, [&]() {
+        return compute(shapeRef, distributionAttr);
+    });
+}
+
+}  // namespace
+}  // namespace VPU
+}  // namespace vpux
+
+ArrayRef<Shape> vpux::VPU::getPerClusterComputeShapes(ShapeRef shapeRef, DistributedTensorAttr distributionAttr) {
+    return getCachedPerClusterLayout(PerClusterLayoutCache::Kind::ComputeShapes, shapeRef, distributionAttr,
+                                     computePerClusterComputeShapes);
+}
+
+ArrayRef<Shape> vpux::VPU::getPerClusterComputeShapeOffsets(ShapeRef shapeRef,
+                                                            DistributedTensorAttr distributionAttr) {
+    return getCachedPerClusterLayout(PerClusterLayoutCache::Kind::ComputeShapeOffsets, shapeRef, distributionAttr,
+                                     computePerClusterComputeShapeOffsets);
+}
+
+ArrayRef<Shape> vpux::VPU::getPerClusterMemoryShapes(ShapeRef shapeRef, DistributedTensorAttr distributionAttr) {
+    return getCachedPerClusterLayout(PerClusterLayoutCache::Kind::MemoryShapes, shapeRef, distributionAttr,
+                                     computePerClusterMemoryShapes);
+}
+
+ArrayRef<Shape> vpux::VPU::getPerClusterMemoryShapeOffsets(ShapeRef shapeRef, DistributedTensorAttr distributionAttr) {
+    return getCachedPerClusterLayout(PerClusterLayoutCache::Kind::MemoryShapeOffsets, shapeRef, distributionAttr,
+                                     computePerClusterMemoryShapeOffsets);
+}
+
 SmallVector<PadInfo> vpux::VPU::getPerClusterPadding(DistributedTensorAttr distributionAttr, PadInfo kernelPadding) {
     const auto mode = distributionAttr.getMode().getValue();
     VPUX_THROW_UNLESS(mode == VPU::DistributionMode::OVERLAPPED,
@@ -1177,6 +1220,17 @@ SmallVector<Shape> vpux::VPU::arrayAttrToVecOfShapes(mlir::ArrayAttr arr) {
     return shapesVec;
 }
 
+ArrayRef<Shape> vpux::VPU::getCachedShapes(mlir::ArrayAttr arr) {
+    auto* dialect = arr.getContext()->getLoadedDialect<VPU::VPUDialect>();
+    VPUX_THROW_WHEN(dialect == nullptr, "VPU dialect is not loaded");
+
+    // The explicit shapes are attributes on their own, so the array attribute identifies them
+    auto& cache = dialect->getPerClusterLayoutCache();
+    return cache.getOrCompute(VPU::PerClusterLayoutCache::Kind::ExplicitShapes, ShapeRef(), arr, [&]() {
+        return arrayAttrToVecOfShapes(arr);
+    });
+}
+
 bool vpux::VPU::isSegmentedOverH(VPU::DistributedTensorAttr distAttr) {
     if (distAttr.getMode().getValue() != VPU::DistributionMode::SEGMENTED) {
         return false;
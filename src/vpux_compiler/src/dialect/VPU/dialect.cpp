@@ -21,6 +21,8 @@ void vpux::VPU::VPUDialect::initialize() {
 
     registerAttributes();
     registerTypes();
+
+    _perClusterLayoutCache = std::make_unique<PerClusterLayoutCache>();
 }
 
 //
@@ -6,11 +6,18 @@
 #include "vpux/compiler/dialect/VPU/layer_vpunn_cost.hpp"
 #include <llvm/ADT/TypeSwitch.h>
 #include "vpux/compiler/core/cost_model_utils.hpp"
+#include "vpux/compiler/dialect/VPU/utils/profiled_cost_utils.hpp"
 
 using namespace vpux;
 using namespace VPU;
 
 StrategyCost LayerVPUNNCost::getStrategyCost(mlir::Operation* operation, const VPUNNCostParameters& parameters) const {
+    if (const auto profiledCost = getProfiledCost(operation, parameters._strategy)) {
+        _log.trace("Using measured cost {0} for {1} with strategy {2}", profiledCost.getValue(), operation->getLoc(),
+                   parameters._strategy);
+        return static_cast<StrategyCost>(profiledCost.getValue());
+    }
+
     if (auto nceOp = mlir::dyn_cast<VPU::NCEOpInterface>(operation)) {
         return getNCELayerCost(nceOp, parameters);
     } else if (auto swOp = mlir::dyn_cast<VPU::SWOpInterface>(operation)) {
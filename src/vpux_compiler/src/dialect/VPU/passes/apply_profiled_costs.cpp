@@ -0,0 +1,162 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/dialect/VPU/passes.hpp"
+
+#include "vpux/compiler/dialect/IE/utils/resources.hpp"
+#include "vpux/compiler/dialect/VPU/mc_strategy_getter_factory.hpp"
+#include "vpux/compiler/dialect/VPU/strategy_manager.hpp"
+#include "vpux/compiler/dialect/VPU/utils/multi_cluster_strategy_utils.hpp"
+#include "vpux/compiler/dialect/VPU/utils/profiled_cost_utils.hpp"
+#include "vpux/compiler/utils/logging.hpp"
+
+using namespace vpux;
+using namespace VPU;
+
+namespace {
+
+//
+// ApplyProfiledCostsPass
+//
+
+class ApplyProfiledCostsPass final : public ApplyProfiledCostsBase<ApplyProfiledCostsPass> {
+public:
+    ApplyProfiledCostsPass(StringRef profiledCostsFile, Logger log): _profiledCostsFile(profiledCostsFile.str()) {
+        Base::initLogger(log, Base::getArgumentName());
+    }
+
+    mlir::LogicalResult initialize(mlir::MLIRContext* ctx) final;
+
+private:
+    void safeRunOnFunc() final;
+
+    Optional<VPU::MultiClusterStrategy> getProfiledStrategy(VPU::ClusteredOpInterface clusteredOp,
+                                                            ArrayRef<VPU::MultiClusterStrategy> strategies,
+                                                            const LayerCostModel& costModel) const;
+
+    std::string _profiledCostsFile;
+    llvm::StringMap<int64_t> _layerDurations;
+};
+
+mlir::LogicalResult ApplyProfiledCostsPass::initialize(mlir::MLIRContext* ctx) {
+    if (mlir::failed(Base::initialize(ctx))) {
+        return mlir::failure();
+    }
+    if (profiledCostsFile.hasValue()) {
+        _profiledCostsFile = profiledCostsFile.getValue();
+    }
+    if (_profiledCostsFile.empty()) {
+        return mlir::success();
+    }
+
+    _layerDurations = readProfiledLayerDurations(_profiledCostsFile);
+    _log.trace("Read {0} profiled layers from '{1}'", _layerDurations.size(), _profiledCostsFile);
+    return mlir::success();
+}
+
+// The profiled model was compiled with the same IR, so the layer was executed either with the strategy
+// which is already assigned or with the one VPUNN considers the best
+Optional<VPU::MultiClusterStrategy> ApplyProfiledCostsPass::getProfiledStrategy(
+        VPU::ClusteredOpInterface clusteredOp, ArrayRef<VPU::MultiClusterStrategy> strategies,
+        const LayerCostModel& costModel) const {
+    if (auto strategy = clusteredOp.getMultiClusterStrategy()) {
+        return strategy;
+    }
+
+    Optional<VPU::MultiClusterStrategy> bestStrategy;
+    auto bestCost = LayerCostModel::COST_MAX;
+    for (auto strategy : strategies) {
+        if (!clusteredOp.checkStrategyCompatibility(strategy) ||
+            !isStrategyCompatibleShape(clusteredOp, getShape(clusteredOp->getResult(0)), strategy, _log)) {
+            continue;
+        }
+
+        const auto cost = costModel.getLayerCost(clusteredOp, strategy);
+        if (cost < bestCost) {
+            bestCost = cost;
+            bestStrategy = strategy;
+        }
+    }
+    return bestStrategy;
+}
+
+//
+// safeRunOnFunc
+//
+
+void ApplyProfiledCostsPass::safeRunOnFunc() {
+    if (_layerDurations.empty()) {
+        _log.trace("No profiled layers, skipping pass");
+        return;
+    }
+
+    auto func = getOperation();
+    auto module = func->getParentOfType<mlir::ModuleOp>();
+    const auto arch = VPU::getArch(module);
+
+    const auto numClusters = IE::getAvailableExecutor(module, VPU::ExecutorKind::NCE).count();
+    if (numClusters <= 1) {
+        _log.trace("Multi-cluster strategies are not used, skipping pass");
+        return;
+    }
+
+    SmallVector<VPU::MultiClusterStrategy> strategies;
+    createMCStrategyGetter(arch, numClusters)->getMCStrategies(strategies);
+
+    LayerStrategyCheckerFactory::instance().registerClusteredOpStrategy(func, _log);
+    LayerCostModel costModel(func, _log.nest());
+
+    llvm::StringMap<SmallVector<VPU::ClusteredOpInterface>> layerOps;
+    func->walk([&](VPU::ClusteredOpInterface clusteredOp) {
+        if (!mlir::isa<VPU::NCEOpInterface, VPU::SWOpInterface>(clusteredOp.getOperation())) {
+            return;
+        }
+        layerOps[getProfiledLayerName(clusteredOp->getLoc())].push_back(clusteredOp);
+    });
+
+    // Measured time is in nanoseconds, frequency is in MHz
+    const auto cyclesPerNs = static_cast<double>(VPU::getDpuFrequency(arch)) / 1000.0;
+
+    size_t numApplied = 0;
+    for (auto& layer : layerOps) {
+        const auto duration = _layerDurations.find(layer.first());
+        if (duration == _layerDurations.end()) {
+            continue;
+        }
+        if (layer.second.size() != 1) {
+            _log.trace("Layer '{0}' is split into {1} operations, keeping VPUNN cost", layer.first(),
+                       layer.second.size());
+            continue;
+        }
+
+        auto clusteredOp = layer.second.front();
+        clusteredOp->removeAttr(profiledCostAttrName);
+
+        const auto strategy = getProfiledStrategy(clusteredOp, strategies, costModel);
+        if (!strategy.hasValue()) {
+            _log.trace("No compatible strategy for layer '{0}', keeping VPUNN cost", layer.first());
+            continue;
+        }
+
+        const auto cycles = std::llround(duration->second * cyclesPerNs);
+        _log.trace("Layer '{0}' with strategy {1} : VPUNN cost {2}, measured cost {3}", layer.first(),
+                   strategy.getValue(), costModel.getLayerCost(clusteredOp, strategy.getValue()), cycles);
+
+        setProfiledCost(clusteredOp, strategy.getValue(), cycles);
+        ++numApplied;
+    }
+
+    _log.info("Applied measured costs to {0} of {1} profiled layers", numApplied, _layerDurations.size());
+}
+
+}  // namespace
+
+//
+// createApplyProfiledCostsPass
+//
+
+std::unique_ptr<mlir::Pass> vpux::VPU::createApplyProfiledCostsPass(StringRef profiledCostsFile, Logger log) {
+    return std::make_unique<ApplyProfiledCostsPass>(profiledCostsFile, log);
+}
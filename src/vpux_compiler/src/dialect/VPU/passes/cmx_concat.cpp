@@ -47,8 +47,7 @@ bool areDistributedTypesConcatenable(VPU::DistributedTensorType firstType, VPU::
         return false;
     }
 
-    const auto areInOutShapesOffsetsCompatible = [&](const SmallVector<Shape>& lhs,
-                                                     const SmallVector<Shape>& rhs) -> bool {
+    const auto areInOutShapesOffsetsCompatible = [&](ArrayRef<Shape> lhs, ArrayRef<Shape> rhs) -> bool {
         for (const auto& pair : zip(lhs, rhs)) {
             const auto shapesOffsetsLhs = std::get<0>(pair);
             const auto shapesOffsetsRhs = std::get<1>(pair);
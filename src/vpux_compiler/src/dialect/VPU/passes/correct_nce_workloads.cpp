@@ -299,7 +299,7 @@ SmallVector<Shape> getPerClusterOffsetsCorrection(VPU::NCEOpInterface nceOp) {
 
     // TODO: E#73931
     // PermuteQuantize output will always have memory and compute equal for now.
-    return distributedOut.getPerClusterMemoryShapeOffsets();
+    return to_small_vector(distributedOut.getPerClusterMemoryShapeOffsets());
 }
 
 // Splits the workload channels so that they are composed out of the values in the `supportedChannels` array, if it is
@@ -4,6 +4,7 @@
 //
 
 #include <vpux/compiler/dialect/VPU/utils/tile_utils.hpp>
+#include "vpux/compiler/dialect/VPU/layer_vpunn_cost.hpp"
 #include "vpux/compiler/dialect/VPU/passes.hpp"
 #include "vpux/compiler/dialect/VPU/utils/multi_cluster_strategy_utils.hpp"
 #include "vpux/compiler/dialect/VPU/utils/vertical_fusion_utils.hpp"
@@ -18,6 +19,7 @@
 
 #include "vpux/utils/core/func_ref.hpp"
 #include "vpux/utils/core/numeric.hpp"
+#include "vpux/utils/core/range.hpp"
 
 #include <mlir/Pass/PassManager.h>
 
@@ -27,32 +29,45 @@ using namespace VPU;
 namespace {
 
 //
-// MergeVFRegionRewriter
+// VFRegionMerger
 //
 
-class MergeVFRegionRewriter final : public mlir::OpRewritePattern<VPU::VerticalFusionOp> {
+// Checks and merges neighbouring VF regions, shared by the greedy rewriter and the global partitioning
+class VFRegionMerger final {
 public:
-    MergeVFRegionRewriter(mlir::MLIRContext* ctx, Logger log)
-            : mlir::OpRewritePattern<VPU::VerticalFusionOp>(ctx), _log(log) {
+    explicit VFRegionMerger(Logger log): _log(log) {
     }
 
-    mlir::LogicalResult matchAndRewrite(VPU::VerticalFusionOp origOp, mlir::PatternRewriter& rewriter) const final;
-
-private:
     bool checkVFCostFunction(VPU::VerticalFusionOp newBlock, VPU::VerticalFusionOp parentVFOp) const;
     bool waitOtherUsers(VPU::VerticalFusionOp newBlock, VPU::VerticalFusionOp parentVFOp) const;
     mlir::ArrayAttr getVFTilingInfo(VPU::VerticalFusionOp newBlock, VPU::VerticalFusionOp parentVFOp) const;
-    void fuseBlocks(mlir::PatternRewriter& rewriter, VPU::VerticalFusionOp vfOp, VPU::VerticalFusionOp prevOp,
-                    mlir::ArrayAttr tilingInfo) const;
+    VPU::VerticalFusionOp fuseBlocks(mlir::RewriterBase& rewriter, VPU::VerticalFusionOp vfOp,
+                                     VPU::VerticalFusionOp prevOp, mlir::ArrayAttr tilingInfo) const;
+    bool isValidVFInput(mlir::Value operand) const;
+
+private:
     bool checkTiling(TilingStorage& tilingRegions, VPU::VerticalFusionOp currentOp, VPU::VerticalFusionOp prevOp) const;
     bool adjustTiling(SmallVector<int64_t>& tilingInfo, VPU::VerticalFusionOp currentOp,
                       VPU::VerticalFusionOp prevOp) const;
-    bool isValidVFInput(mlir::Value operand) const;
+
     Logger _log;
 };
 
-bool MergeVFRegionRewriter::adjustTiling(SmallVector<int64_t>& tilingInfo, VPU::VerticalFusionOp currentOp,
-                                         VPU::VerticalFusionOp prevOp) const {
+// marks the region which must not be merged with its producers,
+// since global partitioning has chosen a boundary there
+constexpr StringLiteral VF_PARTITION_BOUNDARY = "VPU.vf_partition_boundary";
+
+// max number of regions in the chain which might be merged together by global partitioning
+constexpr size_t VF_PARTITION_LOOKAHEAD = 8;
+
+bool hasVFTiling(VPU::VerticalFusionOp vfOp) {
+    return llvm::any_of(parseIntArrayAttr<int64_t>(vfOp.tilingStrategy()), [](auto i) {
+        return i != 1;
+    });
+}
+
+bool VFRegionMerger::adjustTiling(SmallVector<int64_t>& tilingInfo, VPU::VerticalFusionOp currentOp,
+                                  VPU::VerticalFusionOp prevOp) const {
     auto maxTiledAxis = std::max_element(tilingInfo.begin(), tilingInfo.end());
 
     if (maxTiledAxis == tilingInfo.end()) {
@@ -88,8 +103,8 @@ bool MergeVFRegionRewriter::adjustTiling(SmallVector<int64_t>& tilingInfo, VPU::
     return false;
 }
 
-bool MergeVFRegionRewriter::checkTiling(TilingStorage& tilingRegions, VPU::VerticalFusionOp currentOp,
-                                        VPU::VerticalFusionOp prevOp) const {
+bool VFRegionMerger::checkTiling(TilingStorage& tilingRegions, VPU::VerticalFusionOp currentOp,
+                                 VPU::VerticalFusionOp prevOp) const {
     for (auto& op : currentOp.getOperands() | indexed) {
         const auto operand = op.value();
         const auto index = op.index();
@@ -128,7 +143,7 @@ Byte getRequiredWeightsMemory(ArrayRef<VPU::VerticalFusionOpInterface> ops) {
  3. All multicluster strategies are same for both blocks if there are any
  4. Required CMX memory by constant weights shouldn't exceed the size of the whole memory
 */
-bool MergeVFRegionRewriter::checkVFCostFunction(VPU::VerticalFusionOp prevOp, VPU::VerticalFusionOp currentOp) const {
+bool VFRegionMerger::checkVFCostFunction(VPU::VerticalFusionOp prevOp, VPU::VerticalFusionOp currentOp) const {
     const auto prevBlock = prevOp.getBody();
     const auto parentVFOp = currentOp.getBody();
 
@@ -216,7 +231,7 @@ bool MergeVFRegionRewriter::checkVFCostFunction(VPU::VerticalFusionOp prevOp, VP
  As soon as we don't have logic right now for excluding operations or break subgraph
  check in advance that all users or previous block will be merged to current one
 */
-bool MergeVFRegionRewriter::waitOtherUsers(VPU::VerticalFusionOp prevOp, VPU::VerticalFusionOp currentOp) const {
+bool VFRegionMerger::waitOtherUsers(VPU::VerticalFusionOp prevOp, VPU::VerticalFusionOp currentOp) const {
     if (prevOp->hasOneUse()) {
         return true;
     }
@@ -248,8 +263,7 @@ bool MergeVFRegionRewriter::waitOtherUsers(VPU::VerticalFusionOp prevOp, VPU::Ve
  3. Restore tiles for previous block starting from operations which are operands of current block
  4. In case some operations doesn't fit in CMX, try to increase number of tiles by the limit
 */
-mlir::ArrayAttr MergeVFRegionRewriter::getVFTilingInfo(VPU::VerticalFusionOp prevOp,
-                                                       VPU::VerticalFusionOp currentOp) const {
+mlir::ArrayAttr VFRegionMerger::getVFTilingInfo(VPU::VerticalFusionOp prevOp, VPU::VerticalFusionOp currentOp) const {
     const auto currentTiling = parseIntArrayAttr<int64_t>(currentOp.tilingStrategy());
     const auto prevTiling = parseIntArrayAttr<int64_t>(prevOp.tilingStrategy());
 
@@ -280,8 +294,8 @@ mlir::ArrayAttr MergeVFRegionRewriter::getVFTilingInfo(VPU::VerticalFusionOp pre
     return getIntArrayAttr(currentOp.getContext(), tilingArray);
 }
 
-void MergeVFRegionRewriter::fuseBlocks(mlir::PatternRewriter& rewriter, VPU::VerticalFusionOp vfOp,
-                                       VPU::VerticalFusionOp prevOp, mlir::ArrayAttr tilingInfo) const {
+VPU::VerticalFusionOp VFRegionMerger::fuseBlocks(mlir::RewriterBase& rewriter, VPU::VerticalFusionOp vfOp,
+                                                 VPU::VerticalFusionOp prevOp, mlir::ArrayAttr tilingInfo) const {
     SmallVector<size_t> argNumLastOp;
     SmallVector<size_t> argNumCurrentOp;
     mlir::DenseMap<size_t, size_t> opArgMapper;
@@ -366,13 +380,21 @@ void MergeVFRegionRewriter::fuseBlocks(mlir::PatternRewriter& rewriter, VPU::Ver
         }
     }
 
+    rewriter.setInsertionPoint(vfOp);
     auto newVFOp = rewriter.create<VPU::VerticalFusionOp>(vfOp.getLoc(), vfOp->getResultTypes(), newOperands,
                                                           bodyBuilder, tilingInfo);
 
+    // keep the boundary chosen by global partitioning in front of the merged region
+    if (prevOp->hasAttr(VF_PARTITION_BOUNDARY)) {
+        newVFOp->setAttr(VF_PARTITION_BOUNDARY, mlir::UnitAttr::get(newVFOp.getContext()));
+    }
+
     rewriter.replaceOp(vfOp, newVFOp.getResult(0));
+
+    return newVFOp;
 }
 
-bool MergeVFRegionRewriter::isValidVFInput(mlir::Value operand) const {
+bool VFRegionMerger::isValidVFInput(mlir::Value operand) const {
     if (operand.isa<mlir::BlockArgument>()) {
         return true;
     }
@@ -402,14 +424,32 @@ bool MergeVFRegionRewriter::isValidVFInput(mlir::Value operand) const {
     return false;
 }
 
+//
+// MergeVFRegionRewriter
+//
+
+class MergeVFRegionRewriter final : public mlir::OpRewritePattern<VPU::VerticalFusionOp> {
+public:
+    MergeVFRegionRewriter(mlir::MLIRContext* ctx, Logger log)
+            : mlir::OpRewritePattern<VPU::VerticalFusionOp>(ctx), _merger(log), _log(log) {
+    }
+
+    mlir::LogicalResult matchAndRewrite(VPU::VerticalFusionOp origOp, mlir::PatternRewriter& rewriter) const final;
+
+private:
+    VFRegionMerger _merger;
+    Logger _log;
+};
+
 mlir::LogicalResult MergeVFRegionRewriter::matchAndRewrite(VPU::VerticalFusionOp vfOp,
                                                            mlir::PatternRewriter& rewriter) const {
     _log.trace("Vertical fusion region {0}", vfOp);
-    const auto hasTiling = llvm::any_of(parseIntArrayAttr<int64_t>(vfOp.tilingStrategy()), [](auto i) {
-        return i != 1;
-    });
+    if (!hasVFTiling(vfOp)) {
+        return mlir::failure();
+    }
 
-    if (!hasTiling) {
+    if (vfOp->hasAttr(VF_PARTITION_BOUNDARY)) {
+        _log.trace("Region starts after a boundary chosen by global partitioning");
         return mlir::failure();
     }
 
@@ -420,7 +460,7 @@ mlir::LogicalResult MergeVFRegionRewriter::matchAndRewrite(VPU::VerticalFusionOp
         parentVFOp = operand.getDefiningOp<VPU::VerticalFusionOp>();
 
         if (parentVFOp == nullptr) {
-            if (isValidVFInput(operand)) {
+            if (_merger.isValidVFInput(operand)) {
                 continue;
             }
 
@@ -428,20 +468,20 @@ mlir::LogicalResult MergeVFRegionRewriter::matchAndRewrite(VPU::VerticalFusionOp
         }
 
         _log.trace("Analize vf region {0}", parentVFOp);
-        if (!checkVFCostFunction(parentVFOp, vfOp)) {
+        if (!_merger.checkVFCostFunction(parentVFOp, vfOp)) {
             return mlir::failure();
         }
         const bool allInOldBlock = llvm::all_of(parentVFOp->getUsers(), [&](auto user) {
             return user == vfOp;
         });
         if (!allInOldBlock) {
-            if (waitOtherUsers(parentVFOp, vfOp)) {
+            if (_merger.waitOtherUsers(parentVFOp, vfOp)) {
                 continue;
             }
             return mlir::failure();
         }
 
-        tilingInfo = getVFTilingInfo(parentVFOp, vfOp);
+        tilingInfo = _merger.getVFTilingInfo(parentVFOp, vfOp);
         if (tilingInfo == nullptr) {
             return mlir::failure();
         }
@@ -456,25 +496,298 @@ mlir::LogicalResult MergeVFRegionRewriter::matchAndRewrite(VPU::VerticalFusionOp
     }
 
     _log.trace("Merge regions {0} - {1}", vfOp, vfBlock);
-    fuseBlocks(rewriter, vfOp, vfBlock, tilingInfo);
+    _merger.fuseBlocks(rewriter, vfOp, vfBlock, tilingInfo);
 
     return mlir::success();
 }
 
+//
+// VFRegionPartitioner
+//
+
+/*
+ Global partitioning of linear chains of VF regions.
+ Chain is a sequence of VF regions where each region is the only user of the previous one
+ and the previous one is the only VF producer of the next one.
+ For each chain, dynamic programming picks the region boundaries minimizing the estimated latency:
+ 1. Cost of the region is the sum of VPUNN costs of its operations tiled as after merging
+ 2. Each boundary inside the chain adds the DMA cost of spilling the activation to DDR and reading it back
+ Candidate regions are evaluated on temporary copies of the chain, only the chosen partition is applied.
+*/
+class VFRegionPartitioner final {
+public:
+    VFRegionPartitioner(mlir::func::FuncOp func, Logger log)
+            : _merger(log), _costModel(func, log), _arch(VPU::getArch(func)), _log(log) {
+    }
+
+    void partition(mlir::func::FuncOp func);
+
+private:
+    using Chain = SmallVector<VPU::VerticalFusionOp>;
+
+    SmallVector<Chain> collectChains(mlir::func::FuncOp func) const;
+    bool canExtendChain(VPU::VerticalFusionOp prevOp, VPU::VerticalFusionOp nextOp) const;
+    SmallVector<double> estimateRegions(ArrayRef<VPU::VerticalFusionOp> chain, size_t start);
+    double getRegionCost(VPU::VerticalFusionOp vfOp) const;
+    double getSpillCost(VPU::VerticalFusionOp vfOp) const;
+    void partitionChain(ArrayRef<VPU::VerticalFusionOp> chain);
+    void mergeRegion(ArrayRef<VPU::VerticalFusionOp> region, bool isBoundary);
+
+    VFRegionMerger _merger;
+    LayerVPUNNCost _costModel;
+    VPU::ArchKind _arch;
+    Logger _log;
+
+    double _totalCost = 0.0;
+    double _totalGreedyCost = 0.0;
+};
+
+bool VFRegionPartitioner::canExtendChain(VPU::VerticalFusionOp prevOp, VPU::VerticalFusionOp nextOp) const {
+    if (!prevOp->hasOneUse() || !hasVFTiling(nextOp)) {
+        return false;
+    }
+
+    return llvm::all_of(nextOp->getOperands(), [&](mlir::Value operand) {
+        const auto parentVFOp = operand.getDefiningOp<VPU::VerticalFusionOp>();
+        return parentVFOp != nullptr ? parentVFOp == prevOp : _merger.isValidVFInput(operand);
+    });
+}
+
+SmallVector<VFRegionPartitioner::Chain> VFRegionPartitioner::collectChains(mlir::func::FuncOp func) const {
+    SmallVector<Chain> chains;
+    mlir::DenseSet<mlir::Operation*> visited;
+
+    for (auto vfOp : func.getOps<VPU::VerticalFusionOp>()) {
+        if (visited.contains(vfOp)) {
+            continue;
+        }
+
+        Chain chain{vfOp};
+        visited.insert(vfOp);
+
+        auto current = vfOp;
+        while (current->hasOneUse()) {
+            auto next = mlir::dyn_cast<VPU::VerticalFusionOp>(*current->getUsers().begin());
+            if (next == nullptr || visited.contains(next) || !canExtendChain(current, next)) {
+                break;
+            }
+
+            chain.push_back(next);
+            visited.insert(next);
+            current = next;
+        }
+
+        if (chain.size() > 1) {
+            chains.push_back(std::move(chain));
+        }
+    }
+
+    return chains;
+}
+
+double VFRegionPartitioner::getRegionCost(VPU::VerticalFusionOp vfOp) const {
+    const auto tilingStrategy = parseIntArrayAttr<int64_t>(vfOp.tilingStrategy());
+    auto opStorage = std::make_unique<TilingOperationStorage>();
+    if (mlir::failed(calculateTilingRegions(vfOp, tilingStrategy, _log, opStorage))) {
+        return static_cast<double>(VPU::INVALID_COST_BASE);
+    }
+
+    double regionCost = 0.0;
+    for (auto& op : vfOp.getBody()->without_terminator()) {
+        auto strategy = VPU::MultiClusterStrategy::Clustering;
+        if (auto clusteredOp = mlir::dyn_cast<VPU::ClusteredOpInterface>(op)) {
+            strategy = clusteredOp.getMultiClusterStrategy().value_or(strategy);
+        }
+
+        OutputTiling outTiles;
+        for (const auto& opTiling : opStorage->gatherValue(&op)) {
+            outTiles.push_back(opTiling.second);
+        }
+
+        const auto opCost = _costModel.getStrategyCost(&op, VPUNNCostParameters(strategy, outTiles));
+        if (opCost >= VPU::INVALID_COST_BASE) {
+            _log.trace("Invalid VPUNN cost for {0}", op.getLoc());
+            return static_cast<double>(VPU::INVALID_COST_BASE);
+        }
+
+        regionCost += opCost;
+    }
+
+    return regionCost;
+}
+
+double VFRegionPartitioner::getSpillCost(VPU::VerticalFusionOp vfOp) const {
+    const auto outputType = vfOp->getResult(0).getType().cast<vpux::NDTypeInterface>();
+    return 2.0 * static_cast<double>(outputType.getTotalAllocSize().count()) / VPU::getDMABandwidth(_arch);
+}
+
+// returns costs of regions chain[start..start + i], stops at the first region which can't be built
+SmallVector<double> VFRegionPartitioner::estimateRegions(ArrayRef<VPU::VerticalFusionOp> chain, size_t start) {
+    const auto end = std::min(chain.size(), start + VF_PARTITION_LOOKAHEAD);
+
+    mlir::OpBuilder builder(chain[end - 1]);
+    mlir::BlockAndValueMapping mapper;
+    SmallVector<VPU::VerticalFusionOp> clones;
+    for (auto index : irange(start, end)) {
+        clones.push_back(mlir::cast<VPU::VerticalFusionOp>(builder.clone(*chain[index].getOperation(), mapper)));
+    }
+
+    mlir::IRRewriter rewriter(builder);
+    SmallVector<double> costs{getRegionCost(clones.front())};
+
+    auto merged = clones.front();
+    size_t next = 1;
+    for (; next < clones.size(); ++next) {
+        if (!_merger.checkVFCostFunction(merged, clones[next])) {
+            break;
+        }
+
+        const auto tilingInfo = _merger.getVFTilingInfo(merged, clones[next]);
+        if (tilingInfo == nullptr) {
+            break;
+        }
+
+        auto newOp = _merger.fuseBlocks(rewriter, clones[next], merged, tilingInfo);
+        rewriter.eraseOp(merged);
+        merged = newOp;
+
+        costs.push_back(getRegionCost(merged));
+    }
+
+    // the rest of temporary regions use the merged one, so remove them first
+    for (auto index : irange(next, clones.size()) | reversed) {
+        rewriter.eraseOp(clones[index]);
+    }
+    rewriter.eraseOp(merged);
+
+    return costs;
+}
+
+void VFRegionPartitioner::mergeRegion(ArrayRef<VPU::VerticalFusionOp> region, bool isBoundary) {
+    mlir::IRRewriter rewriter(region.front().getContext());
+
+    auto merged = region.front();
+    for (auto vfOp : region.drop_front()) {
+        const auto tilingInfo =
+                _merger.checkVFCostFunction(merged, vfOp) ? _merger.getVFTilingInfo(merged, vfOp) : nullptr;
+        if (tilingInfo == nullptr) {
+            _log.trace("Region {0} chosen by global partitioning can't be merged with {1}", merged->getLoc(),
+                       vfOp->getLoc());
+            if (isBoundary) {
+                merged->setAttr(VF_PARTITION_BOUNDARY, mlir::UnitAttr::get(merged.getContext()));
+            }
+            merged = vfOp;
+            isBoundary = true;
+            continue;
+        }
+
+        auto newOp = _merger.fuseBlocks(rewriter, vfOp, merged, tilingInfo);
+        rewriter.eraseOp(merged);
+        merged = newOp;
+    }
+
+    if (isBoundary) {
+        merged->setAttr(VF_PARTITION_BOUNDARY, mlir::UnitAttr::get(merged.getContext()));
+    }
+}
+
+void VFRegionPartitioner::partitionChain(ArrayRef<VPU::VerticalFusionOp> chain) {
+    const auto numOps = chain.size();
+
+    // regionCosts[start][length - 1] - estimated cost of region chain[start..start + length)
+    SmallVector<SmallVector<double>> regionCosts;
+    SmallVector<double> spillCosts;
+    for (auto index : irange(numOps)) {
+        regionCosts.push_back(estimateRegions(chain, index));
+        spillCosts.push_back(index + 1 < numOps ? getSpillCost(chain[index]) : 0.0);
+    }
+
+    // bestCost[end] - minimal cost of chain[0..end), bestStart[end] - start of its last region
+    SmallVector<double> bestCost(numOps + 1, std::numeric_limits<double>::max());
+    SmallVector<size_t> bestStart(numOps + 1, 0);
+    bestCost[0] = 0.0;
+    for (auto end : irange<size_t>(1, numOps + 1)) {
+        for (auto start : irange<size_t>(0, end)) {
+            const auto length = end - start;
+            if (length > regionCosts[start].size()) {
+                continue;
+            }
+
+            const auto cost = bestCost[start] + regionCosts[start][length - 1] + spillCosts[end - 1];
+            if (cost < bestCost[end]) {
+                bestCost[end] = cost;
+                bestStart[end] = start;
+            }
+        }
+    }
+
+    // Approximation of the greedy merging for the log only, it isn't used to choose the partition.
+    // Each region is extended from the start of the chain as long as the merge checks allow it,
+    // while the rewriter visits regions in the worklist order and may also stop at users outside of the chain,
+    // so the actual greedy partition can differ from this one
+    double greedyCost = 0.0;
+    for (size_t start = 0; start < numOps;) {
+        const auto length = regionCosts[start].size();
+        greedyCost += regionCosts[start][length - 1] + spillCosts[start + length - 1];
+        start += length;
+    }
+
+    _log.trace("Chain of {0} regions starting at {1}: estimated cost {2}, approximate greedy cost {3}", numOps,
+               chain.front()->getLoc(), bestCost[numOps], greedyCost);
+    _totalCost += bestCost[numOps];
+    _totalGreedyCost += greedyCost;
+
+    SmallVector<std::pair<size_t, size_t>> regions;
+    for (auto end = numOps; end > 0; end = bestStart[end]) {
+        regions.emplace_back(bestStart[end], end);
+    }
+
+    for (const auto& region : regions | reversed) {
+        mergeRegion(chain.slice(region.first, region.second - region.first), region.first != 0);
+    }
+}
+
+void VFRegionPartitioner::partition(mlir::func::FuncOp func) {
+    for (const auto& chain : collectChains(func)) {
+        partitionChain(chain);
+    }
+
+    if (_totalGreedyCost > 0.0) {
+        _log.info("VF global partitioning estimated latency {0} cycles, approximate greedy merging {1} cycles "
+                  "({2:F2}%)",
+                  _totalCost, _totalGreedyCost, 100.0 * (_totalGreedyCost - _totalCost) / _totalGreedyCost);
+    }
+}
+
 //
 // MergeVfSubgraphsPass
 //
 
 class MergeVfSubgraphsPass final : public MergeVfSubgraphsBase<MergeVfSubgraphsPass> {
 public:
-    explicit MergeVfSubgraphsPass(Logger log) {
+    explicit MergeVfSubgraphsPass(bool enableGlobalPartitioning, Logger log)
+            : _enableGlobalPartitioning(enableGlobalPartitioning) {
         Base::initLogger(log, Base::getArgumentName());
     }
 
+    mlir::LogicalResult initialize(mlir::MLIRContext* ctx) final;
+
 private:
     void safeRunOnFunc() final;
+    bool _enableGlobalPartitioning = false;
 };
 
+mlir::LogicalResult MergeVfSubgraphsPass::initialize(mlir::MLIRContext* ctx) {
+    if (mlir::failed(Base::initialize(ctx))) {
+        return mlir::failure();
+    }
+    if (partitioningMode.hasValue()) {
+        _log.trace("Overloading C++ createMergeVfSubgraphsPass argument by MLIR variable");
+        _enableGlobalPartitioning = partitioningMode.getValue() == "GLOBAL";
+    }
+    return mlir::success();
+}
+
 //
 // safeRunOnModule
 //
@@ -483,12 +796,21 @@ void MergeVfSubgraphsPass::safeRunOnFunc() {
     auto& ctx = getContext();
     auto func = getOperation();
 
+    if (_enableGlobalPartitioning) {
+        VFRegionPartitioner partitioner(func, _log);
+        partitioner.partition(func);
+    }
+
     mlir::RewritePatternSet patterns(&ctx);
     patterns.add<MergeVFRegionRewriter>(&ctx, _log);
 
     if (mlir::failed(mlir::applyPatternsAndFoldGreedily(func, std::move(patterns), getDefaultGreedyRewriteConfig()))) {
         signalPassFailure();
     }
+
+    func->walk([](VPU::VerticalFusionOp vfOp) {
+        vfOp->removeAttr(VF_PARTITION_BOUNDARY);
+    });
 }
 
 }  // namespace
@@ -497,6 +819,6 @@ void MergeVfSubgraphsPass::safeRunOnFunc() {
 // createMergeVfSubgraphsPass
 //
 
-std::unique_ptr<mlir::Pass> VPU::createMergeVfSubgraphsPass(Logger log) {
-    return std::make_unique<MergeVfSubgraphsPass>(log);
+std::unique_ptr<mlir::Pass> VPU::createMergeVfSubgraphsPass(bool enableGlobalPartitioning, Logger log) {
+    return std::make_unique<MergeVfSubgraphsPass>(enableGlobalPartitioning, log);
 }
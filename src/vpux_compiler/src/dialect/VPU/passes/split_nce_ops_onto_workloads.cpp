@@ -19,10 +19,15 @@
 
 #include "vpux/utils/core/enums.hpp"
 
-#include <mlir/Transforms/GreedyPatternRewriteDriver.h>
+#include <mlir/IR/Threading.h>
 
+#include <llvm/ADT/Hashing.h>
 #include <llvm/ADT/TypeSwitch.h>
 
+#include <exception>
+#include <map>
+#include <unordered_map>
+
 using namespace vpux;
 using namespace VPU;
 
@@ -124,10 +129,68 @@ const EnumMap<VPU::ArchKind, GetMpeModeCb> mpeMap = {
 };
 
 //
-// generateWorkloads
+// WorkloadSplitProblem
+//
+
+// All the information the choice of workloads depends on.
+// NCE operations with identical problems get identical workloads, so each unique problem is solved once.
+struct WorkloadSplitProblem final {
+    VPUIP::WorkloadCostParams costParams;
+    VPU::MPEMode mpeMode;
+    bool isTileOverZSupported;
+    bool isMixedPrecision;
+    bool requiresEqualZ;
+    // for workloads in sub tensors, offsets need to be from original full output tensor
+    Shape subTensorOffset;
+};
+
+llvm::hash_code hashShape(ShapeRef shape) {
+    return llvm::hash_combine_range(shape.begin(), shape.end());
+}
+
+llvm::hash_code hashProblem(const WorkloadSplitProblem& problem) {
+    const auto& params = problem.costParams;
+    return llvm::hash_combine(
+            params.nceTaskType, params.inDataType, params.outDataType, params.arch, hashShape(params.fullInputShape),
+            hashShape(params.inputShape), hashShape(params.outputShape), params.padInfo.left, params.padInfo.right,
+            params.padInfo.top, params.padInfo.bottom, params.numDPU, params.numTiles,
+            llvm::hash_combine_range(params.kernelSize.begin(), params.kernelSize.end()),
+            llvm::hash_combine_range(params.kernelStride.begin(), params.kernelStride.end()),
+            params.isWeightsSparsityEnabled, params.layerStrategy,
+            params.ppeTask.getAsOpaquePointer(), problem.mpeMode, problem.isTileOverZSupported,
+            problem.isMixedPrecision, problem.requiresEqualZ, hashShape(problem.subTensorOffset));
+}
+
+bool isSameProblem(const WorkloadSplitProblem& lhs, const WorkloadSplitProblem& rhs) {
+    const auto& lhsParams = lhs.costParams;
+    const auto& rhsParams = rhs.costParams;
+    return lhsParams.nceTaskType == rhsParams.nceTaskType && lhsParams.inDataType == rhsParams.inDataType &&
+           lhsParams.outDataType == rhsParams.outDataType && lhsParams.arch == rhsParams.arch &&
+           lhsParams.fullInputShape == rhsParams.fullInputShape && lhsParams.inputShape == rhsParams.inputShape &&
+           lhsParams.outputShape == rhsParams.outputShape && lhsParams.padInfo == rhsParams.padInfo &&
+           lhsParams.numDPU == rhsParams.numDPU && lhsParams.numTiles == rhsParams.numTiles &&
+           lhsParams.kernelSize == rhsParams.kernelSize && lhsParams.kernelStride == rhsParams.kernelStride &&
+           lhsParams.isWeightsSparsityEnabled == rhsParams.isWeightsSparsityEnabled &&
+           lhsParams.weightsSparsityRatio == rhsParams.weightsSparsityRatio &&
+           lhsParams.layerStrategy == rhsParams.layerStrategy && lhsParams.ppeTask == rhsParams.ppeTask &&
+           lhs.mpeMode == rhs.mpeMode && lhs.isTileOverZSupported == rhs.isTileOverZSupported &&
+           lhs.isMixedPrecision == rhs.isMixedPrecision && lhs.requiresEqualZ == rhs.requiresEqualZ &&
+           lhs.subTensorOffset == rhs.subTensorOffset;
+}
+
+//
+// WorkloadSplitSolution
+//
+
+struct WorkloadSplitSolution final {
+    VPUIP::WorkloadSplit split;
+    int64_t cost = 0;
+};
+
+//
+// generateSplitPool
 //
 
-// for workloads in sub tensors, offsets need to be from original full output tensor
 void addSubTensorOffset(TileInfo& tileInfo, ShapeRef tensorOffset) {
     VPUX_THROW_WHEN(tileInfo.offsets.size() != tensorOffset.size(),
                     "Invalid size for TileInfo.offset {0} and sub tensor offset {1}", tileInfo.offsets.size(),
@@ -139,188 +202,135 @@ void addSubTensorOffset(TileInfo& tileInfo, ShapeRef tensorOffset) {
     }
 }
 
-void generateWorkloads(mlir::OpBuilder& builder, VPU::NCEOpInterface origOp,
-                       const VPUIP::WorkloadCostParams& costParams, VPU::MPEMode mpeMode, bool isTileOverZSupported,
-                       const std::shared_ptr<VPUNN::VPUCostModel>& costModel, Logger log,
-                       mlir::IntegerAttr clusterId = nullptr, ShapeRef subTensorOffset = {}) {
-    VPUIP::DpuTiler dpuTiler(costParams.outputShape, mpeMode);
+std::vector<VPUIP::WorkloadSplit> generateSplitPool(const WorkloadSplitProblem& problem) {
+    const auto& costParams = problem.costParams;
+    VPUIP::DpuTiler dpuTiler(costParams.outputShape, problem.mpeMode);
 
     VPUIP::WorkloadSplitPool splitPoolSet;
 
-    auto inElemType = origOp->getOperand(0).getType().cast<vpux::NDTypeInterface>().getElementType();
-    auto outElemType = origOp->getResult(0).getType().cast<vpux::NDTypeInterface>().getElementType();
-
-    if (costParams.arch == VPU::ArchKind::VPUX30XX &&
-        isMixedPrecisionSupportedForVPUX30XX(inElemType, outElemType, origOp.getOperation())) {
+    if (costParams.arch == VPU::ArchKind::VPUX30XX && problem.isMixedPrecision) {
         dpuTiler.tileOverHWMixedPrecision(splitPoolSet);
     } else {
         dpuTiler.tileOverH(costParams.numDPU, splitPoolSet);
 
-        // Invariants that produce sparse activations must have the same number of channels across the variants
-        const auto requiresEqualZ = (origOp->getResult(0).getType().dyn_cast<VPU::SparseTensorType>() != nullptr);
-
         const auto splitNumPool = costParams.arch == VPU::ArchKind::VPUX37XX
                                           ? dpuTiler.generateSplitNumberPool(costParams.numDPU, 1)
                                           : dpuTiler.generateSplitNumberPool(costParams.numDPU, MAX_SPLIT_NUMBER);
 
         for (const auto& splitNum : splitNumPool) {
             dpuTiler.tileOverHW(splitNum, VPUIP::SplitDimension::SPLIT_OVER_HW, splitPoolSet);
-            if (isTileOverZSupported) {
-                dpuTiler.tileOverZ(splitNum, splitPoolSet, requiresEqualZ);
+            if (problem.isTileOverZSupported) {
+                dpuTiler.tileOverZ(splitNum, splitPoolSet, problem.requiresEqualZ);
             }
         }
     }
 
-    // select workload with minimum cost
     auto splitPool = to_std_vector(splitPoolSet);
     VPUX_THROW_WHEN(splitPool.empty(), "Workload split pool is empty");
 
-    std::vector<int64_t> splitPoolCosts(splitPool.size(), 0);
-    for (const auto ind : irange(splitPool.size())) {
-        auto& curSplit = splitPool[ind];
-
-        if (clusterId != nullptr) {
+    if (!problem.subTensorOffset.empty()) {
+        for (auto& curSplit : splitPool) {
             for (auto& wl : curSplit) {
-                auto& outTile = std::get<0>(wl);
-                addSubTensorOffset(outTile, subTensorOffset);
+                addSubTensorOffset(std::get<0>(wl), problem.subTensorOffset);
             }
         }
-
-        splitPoolCosts[ind] = VPUIP::computeSplitCost(curSplit, costParams, costModel, log);
-    }
-
-    const auto bestSplitInd = std::min_element(splitPoolCosts.begin(), splitPoolCosts.end()) - splitPoolCosts.begin();
-    if (splitPoolCosts[bestSplitInd] >= VPU::INVALID_COST_BASE) {
-        log.setName("GenerateWorkloads");
-        log.warning("An INVALID_COST is caught for bestSplit when calling VPUNN. You can enable `verboseLog` flag to "
-                    "check debug info in `computeSplitCost` function and report to E#83609 if necessary");
-        log.nest().warning("bestSplit cost value: {0}", splitPoolCosts[bestSplitInd]);
     }
-    const auto& bestSplit = splitPool[bestSplitInd];
 
-    origOp->setAttr(DPUCost, getIntAttr(origOp->getContext(), splitPoolCosts[bestSplitInd]));
-
-    const auto kernel = origOp.getKernelSizeVal();
-    const auto strides = origOp.getStridesVal();
+    return splitPool;
+}
 
-    for (const auto& wl : bestSplit) {
-        const auto& outTile = std::get<0>(wl);
-        const auto mpeMode = std::get<1>(wl);
+//
+// solveSplitProblem
+//
 
-        const auto padsTileConf =
-                backInferPadsTile(outTile, costParams.fullInputShape, costParams.padInfo, kernel, strides);
-        auto tilePad = VPU::getPaddingAttr(builder.getContext(), padsTileConf);
+// select workload with minimum cost
+// the candidates which can't beat the best one found so far are dropped as soon as their cost lower bound exceeds it,
+// the candidates are visited in the pool order, so the first of equal-cost splits is chosen as before
+WorkloadSplitSolution solveSplitProblem(const WorkloadSplitProblem& problem,
+                                        const std::shared_ptr<VPUNN::VPUCostModel>& costModel, Logger log) {
+    auto splitPool = generateSplitPool(problem);
 
-        origOp.addWorkload(builder, origOp.getLoc(), outTile.offsets, outTile.shape, tilePad, mpeMode, clusterId);
+    size_t bestSplitInd = 0;
+    auto bestSplitCost = std::numeric_limits<int64_t>::max();
+    for (const auto ind : irange(splitPool.size())) {
+        const auto splitCost = VPUIP::computeSplitCost(splitPool[ind], problem.costParams, costModel, log,
+                                                       /*costLimit=*/bestSplitCost);
+        if (splitCost < bestSplitCost) {
+            bestSplitCost = splitCost;
+            bestSplitInd = ind;
+        }
     }
+
+    return {std::move(splitPool[bestSplitInd]), bestSplitCost};
 }
 
 //
-// splitOntoWorkloads
+// getThreadCostModel
 //
 
-void splitOntoWorkloads(mlir::OpBuilder& builder, VPU::NCEOpInterface origOp, VPUIP::WorkloadCostParams& costParams,
-                        VPU::MPEMode mpeMode, bool isTileOverZSupported,
-                        const std::shared_ptr<VPUNN::VPUCostModel>& costModel, Logger log) {
-    if (auto clusterOp = mlir::dyn_cast<VPU::NCEClusterTilingOp>(origOp->getParentOp())) {
-        const auto outputs = clusterOp->getResults();
-        VPUX_THROW_UNLESS(outputs.size() == 1, "Wrong outputs size: {0}", outputs.size());
-
-        const auto output = *outputs.begin();
+// VPUNN cost model keeps inner state during evaluation, so each thread uses its own instance.
+// Instances are kept for the next runs of the pass, as loading the model costs much more than the evaluation.
+std::shared_ptr<VPUNN::VPUCostModel> getThreadCostModel(VPU::ArchKind arch) {
+    thread_local std::map<VPU::ArchKind, std::shared_ptr<VPUNN::VPUCostModel>> costModels;
 
-        auto getDistributedTensor = [](const mlir::Value value) -> VPU::DistributedTensorType {
-            if (auto sparseTensor = value.getType().dyn_cast<VPU::SparseTensorType>()) {
-                return sparseTensor.getData().dyn_cast<VPU::DistributedTensorType>();
-            }
-            return value.getType().dyn_cast<VPU::DistributedTensorType>();
-        };
-
-        auto distributedOutputType = getDistributedTensor(output);
-        VPUX_THROW_WHEN(distributedOutputType == nullptr, "Wrong output type {0} for NCEClusterTilingOp",
-                        output.getType());
-
-        const auto outputSubTensorShapes = distributedOutputType.getPerClusterComputeShapes();
-        auto outputSubTensorOffsets = distributedOutputType.getPerClusterComputeShapeOffsets();
-        VPUX_THROW_WHEN(outputSubTensorShapes.size() != outputSubTensorOffsets.size(),
-                        "sub tensor size:{0} not equal to offset size:{1}", outputSubTensorShapes.size(),
-                        outputSubTensorOffsets.size());
-
-        const auto inputs = clusterOp->getOperands();
-        VPUX_THROW_UNLESS(inputs.size() >= 1, "Wrong inputs size: {0}", inputs.size());
-
-        const auto input = *inputs.begin();
-        auto distributedInputType = getDistributedTensor(input);
-        VPUX_THROW_WHEN(distributedInputType == nullptr, "Wrong input type {0} for NCEClusterTilingOp",
-                        input.getType());
-
-        const auto inputSubTensorShapes = distributedInputType.getPerClusterMemoryShapes();
-        VPUX_THROW_WHEN(outputSubTensorShapes.size() != inputSubTensorShapes.size(),
-                        "output tensor size:{0} not equal to input tensor size:{1}", outputSubTensorShapes.size(),
-                        inputSubTensorShapes.size());
-
-        // ----
-        // In the case of an non broadcasted SOK, outputSubTensorOffsets don't need to be applied
-        const auto distributionAttr = distributedOutputType.getDistribution();
-
-        if (distributionAttr.getMode().getValue() == VPU::DistributionMode::SEGMENTED) {
-            const auto numTiles = parseIntArrayAttr<int64_t>(distributionAttr.getNumTiles());
-            const auto totalTiles = std::accumulate(numTiles.begin(), numTiles.end(), static_cast<int64_t>(1),
-                                                    std::multiplies<int64_t>());
-
-            if (numTiles[Dims4D::Act::C.ind()] > 1 && totalTiles == numTiles[Dims4D::Act::C.ind()]) {
-                for (auto& shapeOffset : outputSubTensorOffsets) {
-                    std::fill(shapeOffset.begin(), shapeOffset.end(), 0);
-                }
-            }
-        }
-        // ----
-
-        for (size_t clusterId = 0; clusterId < outputSubTensorShapes.size(); clusterId++) {
-            auto clusterIdAttr = getIntAttr(origOp->getContext(), clusterId);
-            // Update workload params for per tile
-            costParams.inputShape = inputSubTensorShapes[clusterId];
-            costParams.outputShape = outputSubTensorShapes[clusterId];
-            costParams.numTiles = distributionAttr.getNumClusters().getInt();
-
-            if (costParams.arch == VPU::ArchKind::VPUX37XX &&
-                mlir::isa<VPU::NCEConvolutionOp, VPU::NCECompressConvolutionOp, VPU::NCEInterpolateOp>(origOp)) {
-                mpeMode = getMpeModeForVPUX37XXConv(outputSubTensorShapes[clusterId]);
-            }
-            generateWorkloads(builder, origOp, costParams, mpeMode, isTileOverZSupported, costModel, log, clusterIdAttr,
-                              outputSubTensorOffsets[clusterId]);
-        }
-    } else {
-        generateWorkloads(builder, origOp, costParams, mpeMode, isTileOverZSupported, costModel, log);
+    auto& costModel = costModels[arch];
+    if (costModel == nullptr) {
+        costModel = VPU::createCostModel(arch);
     }
+    return costModel;
 }
 
 //
-// GenericNCERewrite
+// WorkloadSplitCollector
 //
 
-class GenericNCERewrite final : public mlir::OpInterfaceRewritePattern<VPU::NCEOpInterface> {
+// Gathers the split problems of all NCE operations, solves unique ones and assigns workloads to the operations
+class WorkloadSplitCollector final {
 public:
-    GenericNCERewrite(mlir::MLIRContext* ctx, int64_t numDPU, VPU::ArchKind arch,
-                      std::shared_ptr<VPUNN::VPUCostModel> costModel, Logger log)
-            : mlir::OpInterfaceRewritePattern<VPU::NCEOpInterface>(ctx),
-              _numDPU(numDPU),
-              _arch(arch),
-              _costModel(std::move(costModel)),
-              _log(log) {
+    WorkloadSplitCollector(VPU::ArchKind arch, int64_t numDPU, Logger log): _arch(arch), _numDPU(numDPU), _log(log) {
     }
 
-public:
-    mlir::LogicalResult matchAndRewrite(VPU::NCEOpInterface origOp, mlir::PatternRewriter& rewriter) const final;
+    void addOperation(VPU::NCEOpInterface nceOp);
+    void solve(mlir::MLIRContext* ctx);
+    void assignWorkloads(mlir::OpBuilder& builder);
 
 private:
-    int64_t _numDPU;
+    void addProblem(VPU::NCEOpInterface nceOp, WorkloadSplitProblem&& problem, mlir::IntegerAttr clusterId);
+
+    struct OperationSplit final {
+        VPU::NCEOpInterface nceOp;
+        mlir::IntegerAttr clusterId;
+        size_t problemInd;
+    };
+
     VPU::ArchKind _arch;
-    std::shared_ptr<VPUNN::VPUCostModel> _costModel;
+    int64_t _numDPU;
     Logger _log;
+
+    SmallVector<OperationSplit> _operationSplits;
+    std::vector<WorkloadSplitProblem> _problems;
+    std::vector<WorkloadSplitSolution> _solutions;
+    std::unordered_map<size_t, SmallVector<size_t>> _problemsByHash;
 };
 
-mlir::LogicalResult GenericNCERewrite::matchAndRewrite(VPU::NCEOpInterface nceOp,
-                                                       mlir::PatternRewriter& rewriter) const {
+void WorkloadSplitCollector::addProblem(VPU::NCEOpInterface nceOp, WorkloadSplitProblem&& problem,
+                                        mlir::IntegerAttr clusterId) {
+    auto& bucket = _problemsByHash[hashProblem(problem)];
+    const auto sameProblem = llvm::find_if(bucket, [&](size_t ind) {
+        return isSameProblem(_problems[ind], problem);
+    });
+
+    if (sameProblem != bucket.end()) {
+        _operationSplits.push_back({nceOp, clusterId, *sameProblem});
+        return;
+    }
+
+    bucket.push_back(_problems.size());
+    _operationSplits.push_back({nceOp, clusterId, _problems.size()});
+    _problems.push_back(std::move(problem));
+}
+
+void WorkloadSplitCollector::addOperation(VPU::NCEOpInterface nceOp) {
     const auto inputType = nceOp->getOperand(0).getType().cast<NDTypeInterface>();
     const auto outputType = nceOp->getResult(0).getType().cast<NDTypeInterface>();
 
@@ -330,9 +340,9 @@ mlir::LogicalResult GenericNCERewrite::matchAndRewrite(VPU::NCEOpInterface nceOp
     const auto outputShape = outputType.getShape();
 
     const auto mpeByType = mpeMap.at(_arch);
-    const auto mpeMode = mpeByType(inElemType, outElemType, nceOp, outputShape);
+    auto mpeMode = mpeByType(inElemType, outElemType, nceOp, outputShape);
 
-    auto params = VPU::getWorkloadCostParam(nceOp, _arch, _numDPU);
+    auto costParams = VPU::getWorkloadCostParam(nceOp, _arch, _numDPU);
 
     bool isTileOverZSupported = mpeMode == VPU::MPEMode::VECTOR;
     if (mlir::isa<VPU::NCEConvolutionOp>(nceOp.getOperation())) {
@@ -343,11 +353,143 @@ mlir::LogicalResult GenericNCERewrite::matchAndRewrite(VPU::NCEOpInterface nceOp
         isTileOverZSupported = false;
     }
 
-    rewriter.updateRootInPlace(nceOp, [&]() {
-        splitOntoWorkloads(rewriter, nceOp, params, mpeMode, isTileOverZSupported, _costModel, _log);
+    const auto isMixedPrecision = isMixedPrecisionSupportedForVPUX30XX(inElemType, outElemType, nceOp.getOperation());
+
+    // Invariants that produce sparse activations must have the same number of channels across the variants
+    const auto requiresEqualZ = (nceOp->getResult(0).getType().dyn_cast<VPU::SparseTensorType>() != nullptr);
+
+    auto clusterOp = mlir::dyn_cast<VPU::NCEClusterTilingOp>(nceOp->getParentOp());
+    if (clusterOp == nullptr) {
+        addProblem(nceOp, {costParams, mpeMode, isTileOverZSupported, isMixedPrecision, requiresEqualZ, Shape()},
+                   nullptr);
+        return;
+    }
+
+    const auto outputs = clusterOp->getResults();
+    VPUX_THROW_UNLESS(outputs.size() == 1, "Wrong outputs size: {0}", outputs.size());
+
+    const auto output = *outputs.begin();
+
+    auto getDistributedTensor = [](const mlir::Value value) -> VPU::DistributedTensorType {
+        if (auto sparseTensor = value.getType().dyn_cast<VPU::SparseTensorType>()) {
+            return sparseTensor.getData().dyn_cast<VPU::DistributedTensorType>();
+        }
+        return value.getType().dyn_cast<VPU::DistributedTensorType>();
+    };
+
+    auto distributedOutputType = getDistributedTensor(output);
+    VPUX_THROW_WHEN(distributedOutputType == nullptr, "Wrong output type {0} for NCEClusterTilingOp",
+                    output.getType());
+
+    const auto outputSubTensorShapes = distributedOutputType.getPerClusterComputeShapes();
+    auto outputSubTensorOffsets = to_small_vector(distributedOutputType.getPerClusterComputeShapeOffsets());
+    VPUX_THROW_WHEN(outputSubTensorShapes.size() != outputSubTensorOffsets.size(),
+                    "sub tensor size:{0} not equal to offset size:{1}", outputSubTensorShapes.size(),
+                    outputSubTensorOffsets.size());
+
+    const auto inputs = clusterOp->getOperands();
+    VPUX_THROW_UNLESS(inputs.size() >= 1, "Wrong inputs size: {0}", inputs.size());
+
+    const auto input = *inputs.begin();
+    auto distributedInputType = getDistributedTensor(input);
+    VPUX_THROW_WHEN(distributedInputType == nullptr, "Wrong input type {0} for NCEClusterTilingOp", input.getType());
+
+    const auto inputSubTensorShapes = distributedInputType.getPerClusterMemoryShapes();
+    VPUX_THROW_WHEN(outputSubTensorShapes.size() != inputSubTensorShapes.size(),
+                    "output tensor size:{0} not equal to input tensor size:{1}", outputSubTensorShapes.size(),
+                    inputSubTensorShapes.size());
+
+    // ----
+    // In the case of an non broadcasted SOK, outputSubTensorOffsets don't need to be applied
+    const auto distributionAttr = distributedOutputType.getDistribution();
+
+    if (distributionAttr.getMode().getValue() == VPU::DistributionMode::SEGMENTED) {
+        const auto numTiles = parseIntArrayAttr<int64_t>(distributionAttr.getNumTiles());
+        const auto totalTiles = std::accumulate(numTiles.begin(), numTiles.end(), static_cast<int64_t>(1),
+                                                std::multiplies<int64_t>());
+
+        if (numTiles[Dims4D::Act::C.ind()] > 1 && totalTiles == numTiles[Dims4D::Act::C.ind()]) {
+            for (auto& shapeOffset : outputSubTensorOffsets) {
+                std::fill(shapeOffset.begin(), shapeOffset.end(), 0);
+            }
+        }
+    }
+    // ----
+
+    for (size_t clusterId = 0; clusterId < outputSubTensorShapes.size(); clusterId++) {
+        auto clusterIdAttr = getIntAttr(nceOp->getContext(), clusterId);
+        // Update workload params for per tile
+        costParams.inputShape = inputSubTensorShapes[clusterId];
+        costParams.outputShape = outputSubTensorShapes[clusterId];
+        costParams.numTiles = distributionAttr.getNumClusters().getInt();
+
+        if (costParams.arch == VPU::ArchKind::VPUX37XX &&
+            mlir::isa<VPU::NCEConvolutionOp, VPU::NCECompressConvolutionOp, VPU::NCEInterpolateOp>(nceOp)) {
+            mpeMode = getMpeModeForVPUX37XXConv(outputSubTensorShapes[clusterId]);
+        }
+
+        addProblem(nceOp,
+                   {costParams, mpeMode, isTileOverZSupported, isMixedPrecision, requiresEqualZ,
+                    outputSubTensorOffsets[clusterId]},
+                   clusterIdAttr);
+    }
+}
+
+void WorkloadSplitCollector::solve(mlir::MLIRContext* ctx) {
+    _log.trace("Solve {0} unique workload split problems for {1} operation splits", _problems.size(),
+               _operationSplits.size());
+
+    _solutions.resize(_problems.size());
+    SmallVector<std::exception_ptr> errors(_problems.size());
+
+    mlir::parallelFor(ctx, 0, _problems.size(), [&](size_t ind) {
+        // parallelFor does not propagate exceptions, they are kept to be rethrown on the calling thread
+        try {
+            _solutions[ind] = solveSplitProblem(_problems[ind], getThreadCostModel(_arch), _log);
+        } catch (...) {
+            errors[ind] = std::current_exception();
+        }
     });
 
-    return mlir::success();
+    // Workloads are assigned only if all the problems are solved
+    for (const auto& error : errors) {
+        if (error != nullptr) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+void WorkloadSplitCollector::assignWorkloads(mlir::OpBuilder& builder) {
+    for (const auto& operationSplit : _operationSplits) {
+        auto origOp = operationSplit.nceOp;
+        const auto& problem = _problems[operationSplit.problemInd];
+        const auto& solution = _solutions[operationSplit.problemInd];
+
+        if (solution.cost >= VPU::INVALID_COST_BASE) {
+            auto log = _log;
+            log.setName("GenerateWorkloads");
+            log.warning("An INVALID_COST is caught for bestSplit when calling VPUNN. You can enable `verboseLog` "
+                        "flag to check debug info in `computeSplitCost` function and report to E#83609 if necessary");
+            log.nest().warning("bestSplit cost value: {0}", solution.cost);
+        }
+
+        origOp->setAttr(DPUCost, getIntAttr(origOp->getContext(), solution.cost));
+
+        const auto kernel = origOp.getKernelSizeVal();
+        const auto strides = origOp.getStridesVal();
+
+        for (const auto& wl : solution.split) {
+            const auto& outTile = std::get<0>(wl);
+            const auto mpeMode = std::get<1>(wl);
+
+            const auto padsTileConf = backInferPadsTile(outTile, problem.costParams.fullInputShape,
+                                                        problem.costParams.padInfo, kernel, strides);
+            auto tilePad = VPU::getPaddingAttr(builder.getContext(), padsTileConf);
+
+            origOp.addWorkload(builder, origOp.getLoc(), outTile.offsets, outTile.shape, tilePad, mpeMode,
+                               operationSplit.clusterId);
+        }
+    }
 }
 
 //
@@ -384,26 +526,17 @@ void SplitNCEOpsOntoWorkloadsPass::safeRunOnFunc() {
 
     const auto numDPUs = dpuExec.count();
 
-    const auto costModel = VPU::createCostModel(arch);
-
-    mlir::ConversionTarget target(ctx);
-    target.markUnknownOpDynamicallyLegal([&](mlir::Operation* op) {
-        if (auto swOp = mlir::dyn_cast<VPU::SWOpInterface>(op)) {
-            return true;
+    WorkloadSplitCollector collector(arch, numDPUs, _log);
+    func->walk([&](VPU::NCEOpInterface nceOp) {
+        if (nceOp.workloads().empty()) {
+            collector.addOperation(nceOp);
         }
-        if (auto nceOp = mlir::dyn_cast<VPU::NCEOpInterface>(op)) {
-            return !nceOp.workloads().empty();
-        }
-        return true;
     });
-    target.addLegalOp<VPU::DPUWorkloadOp>();
 
-    mlir::RewritePatternSet patterns(&ctx);
-    patterns.add<GenericNCERewrite>(&ctx, numDPUs, arch, costModel, _log);
+    collector.solve(&ctx);
 
-    if (mlir::failed(mlir::applyPartialConversion(func, target, std::move(patterns)))) {
-        signalPassFailure();
-    }
+    mlir::OpBuilder builder(&ctx);
+    collector.assignWorkloads(builder);
 }
 
 }  // namespace
@@ -7,6 +7,7 @@
 #include "vpux/compiler/dialect/VPU/utils/const_utils.hpp"
 #include "vpux/compiler/dialect/VPU/utils/distributed_tensor_utils.hpp"
 #include "vpux/compiler/dialect/VPU/utils/generate_tiling.hpp"
+#include "vpux/compiler/dialect/VPU/utils/profiled_cost_utils.hpp"
 #include "vpux/utils/core/numeric.hpp"
 
 #include <llvm/ADT/TypeSwitch.h>
@@ -689,6 +690,14 @@ double LayerCostModel::getSWLayerCost(VPU::SWOpInterface swOp, VPU::MultiCluster
 /// @details Time-cost includes an extra input spilling cost to be more accurate
 double LayerCostModel::getLayerCost(VPU::ClusteredOpInterface clusteredOp, VPU::MultiClusterStrategy strategy,
                                     bool useTimeBasedCost) const {
+    if (useTimeBasedCost) {
+        if (const auto profiledCost = getProfiledCost(clusteredOp, strategy)) {
+            _log.trace("Using measured cost {0} for {1} with strategy {2}", profiledCost.getValue(),
+                       clusteredOp->getLoc(), strategy);
+            return profiledCost.getValue();
+        }
+    }
+
     if (auto nceOp = mlir::dyn_cast<VPU::NCEOpInterface>(clusteredOp.getOperation())) {
         return getNCELayerCost(nceOp, strategy, useTimeBasedCost);
     } else if (auto swOp = mlir::dyn_cast<VPU::SWOpInterface>(clusteredOp.getOperation())) {
@@ -0,0 +1,33 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/dialect/VPU/per_cluster_layout_cache.hpp"
+
+using namespace vpux;
+
+//
+// PerClusterLayoutCache
+//
+
+ArrayRef<Shape> VPU::PerClusterLayoutCache::getOrCompute(Kind kind, ShapeRef shape, mlir::Attribute distribution,
+                                                         FuncRef<SmallVector<Shape>()> compute) {
+    Key key(kind, distribution.getAsOpaquePointer(), to_small_vector(shape.raw()));
+
+    {
+        llvm::sys::SmartScopedReader<true> lock(_mutex);
+        const auto it = _layouts.find(key);
+        if (it != _layouts.end()) {
+            return it->second;
+        }
+    }
+
+    // The computation may query the cache for other kinds of layouts, so it is done without the lock
+    auto layout = compute();
+
+    llvm::sys::SmartScopedWriter<true> lock(_mutex);
+    // Another thread might have stored the same layout in the meantime, it is kept as is
+    const auto it = _layouts.emplace(std::move(key), std::move(layout)).first;
+    return it->second;
+}
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: Apache 2.0
 //
 
+#include "vpux/compiler/core/passes.hpp"
 #include "vpux/compiler/dialect/VPU/passes.hpp"
 #include "vpux/compiler/utils/rewriter.hpp"
 
@@ -80,7 +81,7 @@ void vpux::VPU::buildActivationSparsityPipeline(mlir::OpPassManager& pm, const V
     pm.addPass(VPU::createFuseSparsityOpsPass(/*fuseSparsify=*/true, log));
     pm.addPass(VPU::createOptimizeSparsityOpsPass(profileCallback, log));
     pm.addPass(VPU::createAddSparsityMapToSparseActivationsPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 }
 
 //
@@ -125,7 +126,7 @@ void vpux::VPU::buildTilingPipeline(mlir::OpPassManager& pm, const VPU::TilingOp
         VPU::buildVFPipeline(pm, options, log);
     }
     pm.addPass(VPU::createApplyTilingPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
 }
 
 //
@@ -135,7 +136,7 @@ void vpux::VPU::buildTilingPipeline(mlir::OpPassManager& pm, const VPU::TilingOp
 void vpux::VPU::buildVFPipeline(mlir::OpPassManager& pm, const VPU::TilingOptions& options, Logger log) {
     pm.addPass(VPU::createTileOverHForVFPass(options.enablePrefetchTiling, log));
     pm.addPass(VPU::createWrapVerticalFusionRegionPass(log));
-    pm.addPass(VPU::createMergeVfSubgraphsPass(log));
+    pm.addPass(VPU::createMergeVfSubgraphsPass(options.enableVFGlobalPartitioning, log));
     pm.addPass(VPU::createUnrollUnusedVerticalFusionRegionPass(log));
     pm.addPass(VPU::createRollBackTilingStrategyPass(options.enablePrefetchTiling, log));
     pm.addPass(VPU::createAdjustVFTilingStrategyPass(log));
@@ -146,6 +147,9 @@ void vpux::VPU::buildSMPipeline(mlir::OpPassManager& pm, const VPU::TilingOption
     // TO DO - SM Assignment Optimization Pass
     // Keep enableSMpipleline Option - false till SM pipeline is built
 
+    if (!options.profiledCostsFile.empty()) {
+        pm.addPass(VPU::createApplyProfiledCostsPass(options.profiledCostsFile, log));
+    }
     pm.addPass(VPU::createStrategyManagerImplPass(options.enablePrefetchTiling, log));
     if (options.enableVerticalFusion) {
         VPU::buildVFPipeline(pm, options, log);
@@ -289,26 +289,26 @@ mlir::RankedTensorType VPU::DistributedTensorType::getCompactType() const {
 //  uniform segmentation for 4 clusters, a tensor of shape [1, 64, 22, 16]
 //  will have the following compute distribution across clusters:
 //  [1 64 6 16] [1 64 6 16] [1 64 5 16] [1 64 5 16]
-SmallVector<Shape> VPU::DistributedTensorType::getPerClusterComputeShapes() const {
+ArrayRef<Shape> VPU::DistributedTensorType::getPerClusterComputeShapes() const {
     auto distribution = getDistribution();
     if (distribution.getComputeShapes() == nullptr) {
         return VPU::getPerClusterComputeShapes(getShape(), distribution);
     }
 
-    return VPU::arrayAttrToVecOfShapes(distribution.getComputeShapes());
+    return VPU::getCachedShapes(distribution.getComputeShapes());
 }
 
 // @brief Retrieve the offsets for each compute shape with regards to full tensor shape.
 // @warning An important thing to consider with regards to compute offsets,
 // is that modes like SEGMENTED and OVERLAPPED take precedence over
 // DUPLICATED and MULTICASTED.
-SmallVector<Shape> VPU::DistributedTensorType::getPerClusterComputeShapeOffsets() const {
+ArrayRef<Shape> VPU::DistributedTensorType::getPerClusterComputeShapeOffsets() const {
     auto distribution = getDistribution();
     if (distribution.getComputeOffsets() == nullptr) {
         return VPU::getPerClusterComputeShapeOffsets(getShape(), distribution);
     }
 
-    return VPU::arrayAttrToVecOfShapes(distribution.getComputeOffsets());
+    return VPU::getCachedShapes(distribution.getComputeOffsets());
 }
 
 // @brief Retrieve the array of memory shapes.
@@ -324,26 +324,26 @@ SmallVector<Shape> VPU::DistributedTensorType::getPerClusterComputeShapeOffsets(
 //  uniform segmentation across 4 clusters, a tensor of shape [1, 64, 22, 16]
 //  will have the following memory distribution across clusters:
 //  [1 64 7 16] [1 64 8 16] [1 64 7 16] [1 64 6 16]
-SmallVector<Shape> VPU::DistributedTensorType::getPerClusterMemoryShapes() const {
+ArrayRef<Shape> VPU::DistributedTensorType::getPerClusterMemoryShapes() const {
     auto distribution = getDistribution();
     if (distribution.getMemoryShapes() == nullptr) {
         return VPU::getPerClusterMemoryShapes(getShape(), distribution);
     }
 
-    return VPU::arrayAttrToVecOfShapes(distribution.getMemoryShapes());
+    return VPU::getCachedShapes(distribution.getMemoryShapes());
 }
 
 // @brief Retrieve the array of memory buffer offsets with regards to the full buffer.
 // @warning An important thing to consider with regards to memory shape offsets,
 //  is that modes like DUPLICATED and MULTICASTED take precedence over
 //  SEGMENTED and OVERLAPPED.
-SmallVector<Shape> VPU::DistributedTensorType::getPerClusterMemoryShapeOffsets() const {
+ArrayRef<Shape> VPU::DistributedTensorType::getPerClusterMemoryShapeOffsets() const {
     auto distribution = getDistribution();
     if (distribution.getMemoryOffsets() == nullptr) {
         return VPU::getPerClusterMemoryShapeOffsets(getShape(), distribution);
     }
 
-    return VPU::arrayAttrToVecOfShapes(distribution.getMemoryOffsets());
+    return VPU::getCachedShapes(distribution.getMemoryOffsets());
 }
 
 // @brief Get largest compact compute shape
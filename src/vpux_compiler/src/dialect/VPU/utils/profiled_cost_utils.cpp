@@ -0,0 +1,138 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/dialect/VPU/utils/profiled_cost_utils.hpp"
+#include "vpux/compiler/core/profiling.hpp"
+#include "vpux/compiler/dialect/VPU/json.hpp"
+#include "vpux/compiler/utils/attributes.hpp"
+#include "vpux/compiler/utils/strings.hpp"
+
+#include "vpux/utils/core/error.hpp"
+
+#include <llvm/Support/MemoryBuffer.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace vpux {
+namespace VPU {
+
+namespace {
+
+constexpr StringLiteral strategyKey = "strategy";
+constexpr StringLiteral cyclesKey = "cycles";
+
+bool isComputeTaskCategory(StringRef category) {
+    return category == "DPU" || category == "SW" || category == "UPA";
+}
+
+// The original layer name is the first component of the task name, everything after the first
+// LOCATION_ORIGIN_SEPARATOR is added by the compiler. getLayerName() applies the same rule to the locations.
+StringRef getOriginalLayerName(StringRef taskName) {
+    return taskName.take_until([](char c) {
+        return c == LOCATION_ORIGIN_SEPARATOR;
+    });
+}
+
+}  // namespace
+
+llvm::StringMap<int64_t> parseProfiledLayerDurations(StringRef traceEvents) {
+    const auto json = Json::parse(traceEvents.begin(), traceEvents.end(), nullptr, /*allow_exceptions=*/false);
+    VPUX_THROW_WHEN(json.is_discarded(), "Profiling report is not a valid JSON");
+
+    const auto events = json.find("traceEvents");
+    VPUX_THROW_WHEN(events == json.end() || !events->is_array(), "Profiling report has no 'traceEvents' array");
+
+    // Tasks of the same layer may run in parallel on several clusters or be split into tiles,
+    // so the layer duration is the span from the start of its first task to the end of its last one
+    struct Span final {
+        double start;
+        double end;
+    };
+    llvm::StringMap<Span> spans;
+
+    for (const auto& event : *events) {
+        if (!event.contains("cat") || !event.contains("ts") || !event.contains("dur")) {
+            continue;
+        }
+
+        const auto& category = event.at("cat");
+        VPUX_THROW_UNLESS(category.is_string(), "Profiling report has an event with a non-string category");
+        if (!isComputeTaskCategory(category.get<std::string>())) {
+            continue;
+        }
+
+        const auto name = event.find("name");
+        VPUX_THROW_WHEN(name == event.end() || !name->is_string(), "Profiling report has a '{0}' task without a name",
+                        category.get<std::string>());
+        const auto taskName = name->get<std::string>();
+
+        const auto& ts = event.at("ts");
+        const auto& dur = event.at("dur");
+        VPUX_THROW_UNLESS(ts.is_number() && dur.is_number(), "Task '{0}' of the profiling report has malformed timing",
+                          taskName);
+
+        const auto layerName = getOriginalLayerName(taskName);
+
+        // Trace event timestamps are in microseconds
+        const auto start = ts.get<double>();
+        const auto end = start + dur.get<double>();
+
+        const auto inserted = spans.try_emplace(layerName, Span{start, end});
+        if (!inserted.second) {
+            auto& span = inserted.first->second;
+            span.start = std::min(span.start, start);
+            span.end = std::max(span.end, end);
+        }
+    }
+
+    llvm::StringMap<int64_t> durations;
+    for (const auto& span : spans) {
+        durations[span.first()] = std::llround((span.second.end - span.second.start) * 1000.0);
+    }
+    return durations;
+}
+
+llvm::StringMap<int64_t> readProfiledLayerDurations(StringRef fileName) {
+    VPUX_THROW_WHEN(fileName.empty(), "Profiling report file name was not provided");
+
+    auto buffer = llvm::MemoryBuffer::getFile(fileName);
+    VPUX_THROW_UNLESS(buffer, "Failed to open profiling report '{0}' : {1}", fileName, buffer.getError().message());
+
+    return parseProfiledLayerDurations(buffer.get()->getBuffer());
+}
+
+std::string getProfiledLayerName(mlir::Location loc) {
+    return getLayerName(loc);
+}
+
+void setProfiledCost(mlir::Operation* op, VPU::MultiClusterStrategy strategy, int64_t cycles) {
+    auto* ctx = op->getContext();
+    const SmallVector<mlir::NamedAttribute> fields = {
+            mlir::NamedAttribute(mlir::StringAttr::get(ctx, strategyKey),
+                                 VPU::MultiClusterStrategyAttr::get(ctx, strategy)),
+            mlir::NamedAttribute(mlir::StringAttr::get(ctx, cyclesKey), getIntAttr(ctx, cycles))};
+    op->setAttr(profiledCostAttrName, mlir::DictionaryAttr::get(ctx, fields));
+}
+
+Optional<double> getProfiledCost(mlir::Operation* op, VPU::MultiClusterStrategy strategy) {
+    const auto profiledCost = op->getAttrOfType<mlir::DictionaryAttr>(profiledCostAttrName);
+    if (profiledCost == nullptr) {
+        return None;
+    }
+
+    const auto profiledStrategy = profiledCost.getAs<VPU::MultiClusterStrategyAttr>(strategyKey);
+    const auto cycles = profiledCost.getAs<mlir::IntegerAttr>(cyclesKey);
+    VPUX_THROW_WHEN(profiledStrategy == nullptr || cycles == nullptr, "Malformed '{0}' attribute at {1}",
+                    profiledCostAttrName, op->getLoc());
+
+    if (profiledStrategy.getValue() != strategy) {
+        return None;
+    }
+    return static_cast<double>(cycles.getInt());
+}
+
+}  // namespace VPU
+}  // namespace vpux
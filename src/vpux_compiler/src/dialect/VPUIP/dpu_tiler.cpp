@@ -286,7 +286,8 @@ void vpux::VPUIP::DpuTiler::tileOverHWMixedPrecision(WorkloadSplitPool& splitPoo
 }
 
 int64_t vpux::VPUIP::computeSplitCost(const WorkloadSplit& split, const WorkloadCostParams& params,
-                                      const std::shared_ptr<VPUNN::VPUCostModel>& costModel, Logger log) {
+                                      const std::shared_ptr<VPUNN::VPUCostModel>& costModel, Logger log,
+                                      int64_t costLimit) {
     std::vector<int64_t> workloadCost;
     workloadCost.reserve(split.size());
 
@@ -294,6 +295,10 @@ int64_t vpux::VPUIP::computeSplitCost(const WorkloadSplit& split, const Workload
     const bool verboseLog = false;  // enable it to debug error code details for each workload
     std::string vpunnInputCheckInfo;
 
+    // DPU schedule can't be shorter than its longest workload or than the even distribution of all workloads
+    int64_t maxWorkloadCost = 0;
+    int64_t totalWorkloadCost = 0;
+
     for (const auto& wl : split) {
         const auto vpunnWorkload = VPU::getDPUWorkload(params, wl);
         auto wlCost = VPU::checkAndReturnCost(costModel->DPU(vpunnWorkload, vpunnInputCheckInfo), log, !verboseLog);
@@ -302,6 +307,14 @@ int64_t vpux::VPUIP::computeSplitCost(const WorkloadSplit& split, const Workload
                         vpunnInputCheckInfo);
         }
         workloadCost.push_back(static_cast<int64_t>(wlCost));
+
+        maxWorkloadCost = std::max(maxWorkloadCost, static_cast<int64_t>(wlCost));
+        totalWorkloadCost += static_cast<int64_t>(wlCost);
+
+        const auto costLowerBound = std::max(maxWorkloadCost, totalWorkloadCost / params.numDPU);
+        if (costLowerBound > costLimit) {
+            return costLowerBound;
+        }
     }
 
     return VPUNN::dpu_schedule(params.numDPU, workloadCost, RUNTIME_OVERHEAD_PER_WORKLOAD);
@@ -55,6 +55,9 @@ using namespace vpux;
 
 namespace {
 
+// Upper bound of the folded constants size kept in memory during serialization
+constexpr Byte CONST_FOLDING_BATCH_SIZE = 256_MB;
+
 bool isProfilingEnabled(IE::CNNNetworkOp netOp) {
     auto profilingOutputsInfo = netOp.getProfilingOutputsDataInfo();
     VPUX_THROW_WHEN(profilingOutputsInfo.size() > 1, "Unexpected number of profiling outputs (expected 1, got {0})",
@@ -499,45 +502,57 @@ void extendBinaryDataWithProfilingSchema(VPUIP::BlobWriter& writer, IE::CNNNetwo
 }
 
 SmallVector<VPUIP::BlobWriter::BinaryData> serializeBinaryData(VPUIP::BlobWriter& writer, mlir::func::FuncOp netFunc,
-                                                               IE::CNNNetworkOp netOp, mlir::TimingScope& rootTiming,
-                                                               Logger log) {
+                                                               mlir::TimingScope& rootTiming, Logger log) {
     auto scopeTiming = rootTiming.nest("Serialize binary data");
 
     auto constOps = to_small_vector(netFunc.getOps<Const::DeclareOp>());
-    size_t opsToSerializeCount = constOps.size();
-    if (isProfilingEnabled(netOp)) {
-        ++opsToSerializeCount;
-    }
 
-    SmallVector<std::vector<uint64_t>> bufs(opsToSerializeCount);
+    SmallVector<VPUIP::BlobWriter::BinaryData> binaryData(constOps.size());
 
-    loop_1d(LoopExecPolicy::Parallel, checked_cast<int64_t>(constOps.size()), [&](int64_t ind) {
-        const auto attr = constOps[static_cast<size_t>(ind)].getContentAttr();
+    // Constants are folded in parallel in batches of limited total size and each batch is released once it is
+    // written to the blob, so folded contents of all constants are never kept in memory at the same time
+    size_t batchBegin = 0;
+    while (batchBegin < constOps.size()) {
+        size_t batchEnd = batchBegin;
+        Byte batchSize(0);
+        while (batchEnd < constOps.size() && (batchEnd == batchBegin || batchSize < CONST_FOLDING_BATCH_SIZE)) {
+            batchSize += constOps[batchEnd].getType().cast<vpux::NDTypeInterface>().getTotalAllocSize();
+            ++batchEnd;
+        }
 
-        const auto type = attr.getType();
-        const auto content = attr.fold();
+        SmallVector<std::vector<uint64_t>> bufs(batchEnd - batchBegin);
 
-        const auto totalByteSize = type.cast<vpux::NDTypeInterface>().getTotalAllocSize();
-        bufs[static_cast<size_t>(ind)].resize(
-                alignValUp(static_cast<size_t>(totalByteSize.count()), sizeof(uint64_t)) / sizeof(uint64_t), 0);
+        loop_1d(LoopExecPolicy::Parallel, checked_cast<int64_t>(bufs.size()), [&](int64_t ind) {
+            const auto attr = constOps[batchBegin + static_cast<size_t>(ind)].getContentAttr();
 
-        const auto buf = makeMutableArrayRef(reinterpret_cast<char*>(bufs[static_cast<size_t>(ind)].data()),
-                                             totalByteSize.count());
-        content.copyTo(buf);
-    });
+            const auto type = attr.getType();
+            const auto content = attr.fold();
 
-    SmallVector<VPUIP::BlobWriter::BinaryData> binaryData(constOps.size());
+            const auto totalByteSize = type.cast<vpux::NDTypeInterface>().getTotalAllocSize();
+            bufs[static_cast<size_t>(ind)].resize(
+                    alignValUp(static_cast<size_t>(totalByteSize.count()), sizeof(uint64_t)) / sizeof(uint64_t), 0);
+
+            const auto buf = makeMutableArrayRef(reinterpret_cast<char*>(bufs[static_cast<size_t>(ind)].data()),
+                                                 totalByteSize.count());
+            content.copyTo(buf);
+        });
+
+        for (auto constTensorInd : irange(batchBegin, batchEnd)) {
+            auto constOp = constOps[constTensorInd];
+            auto& content = bufs[constTensorInd - batchBegin];
 
-    for (auto constTensorInd : irange(constOps.size())) {
-        auto constOp = constOps[constTensorInd];
-        const auto& content = bufs[constTensorInd];
+            log.trace("Got constant at '{0}' with type '{1}'", constOp->getLoc(), constOp.getType());
 
-        log.trace("Got constant at '{0}' with type '{1}'", constOp->getLoc(), constOp.getType());
+            binaryData[constTensorInd] =
+                    writer.createBinaryData(content, constOp.getType().cast<vpux::NDTypeInterface>());
 
-        binaryData[constTensorInd] = writer.createBinaryData(content, constOp.getType().cast<vpux::NDTypeInterface>());
+            writer.createTensorRef(constOp.getOutput(), printToString("constant-{0}", constTensorInd),
+                                   VPURT::BufferSection::Constant, checked_cast<uint32_t>(constTensorInd), 0);
+
+            std::vector<uint64_t>().swap(content);
+        }
 
-        writer.createTensorRef(constOp.getOutput(), printToString("constant-{0}", constTensorInd),
-                               VPURT::BufferSection::Constant, checked_cast<uint32_t>(constTensorInd), 0);
+        batchBegin = batchEnd;
     }
 
     return binaryData;
@@ -657,7 +672,7 @@ flatbuffers::DetachedBuffer vpux::VPUIP::exportToBlob(mlir::ModuleOp module, mli
                                             results, log);
 
     serializeTensorDecls(writer, netFunc, rootTiming);
-    auto binaryData = serializeBinaryData(writer, netFunc, netOp, rootTiming, log);
+    auto binaryData = serializeBinaryData(writer, netFunc, rootTiming, log);
     if (isProfilingEnabled(netOp)) {
         extendBinaryDataWithProfilingSchema(writer, netOp, netFunc, binaryData, log);
     }
@@ -91,6 +91,8 @@ void MoveWaitResultToAsyncBlockArgsPass::safeRunOnFunc() {
 
     auto& depsInfo = getAnalysis<AsyncDepsInfo>();
     depsInfo.updateTokenDependencies();
+
+    markAnalysesPreserved<AsyncDepsInfo>();
 }
 
 }  // namespace
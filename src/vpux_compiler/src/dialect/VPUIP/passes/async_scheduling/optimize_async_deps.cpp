@@ -29,6 +29,8 @@ void OptimizeAsyncDepsPass::safeRunOnFunc() {
     auto& depsInfo = getAnalysis<AsyncDepsInfo>();
     depsInfo.optimizeDepsMap();
     depsInfo.updateTokenDependencies();
+
+    markAnalysesPreserved<AsyncDepsInfo>();
 }
 
 }  // namespace
@@ -145,6 +145,9 @@ void CalculateAsyncRegionCycleCostPass::safeRunOnFunc() {
         // store cycle cost for async.execute
         asyncExec->setAttr(cycleCostAttrName, getIntAttr(asyncExec->getContext(), cycleCost));
     });
+
+    // Only cycle cost attributes are updated
+    markAllAnalysesPreserved();
 }
 
 }  // namespace
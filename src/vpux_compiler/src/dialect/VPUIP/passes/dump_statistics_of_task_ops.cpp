@@ -587,6 +587,8 @@ void DumpStatisticsOfTaskOpsPass::safeRunOnFunc() {
     }
     _log.info("Const swizzling statistics:");
     constSwizzlingCounter.printStatistics(_log);
+
+    markAllAnalysesPreserved();
 }
 
 }  // namespace
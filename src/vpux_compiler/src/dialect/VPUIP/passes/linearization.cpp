@@ -46,6 +46,8 @@ void LinearizationPass::safeRunOnModule() {
     }
 
     depsInfo.updateTokenDependencies();
+
+    markAnalysesPreserved<AsyncDepsInfo>();
 }
 
 }  // namespace
@@ -83,6 +83,9 @@ void MaximizeUPACyclesPass::safeRunOnFunc() {
         // calculate UPA cycles
         recalculateUPACycles(func, depsInfo, asyncExec);
     });
+
+    // Only cycle attributes are updated
+    markAllAnalysesPreserved();
 }
 
 }  // namespace
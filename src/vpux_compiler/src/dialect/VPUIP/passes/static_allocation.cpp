@@ -387,7 +387,11 @@ void StaticAllocationPass::safeRunOnModule() {
     if (mlir::failed(mlir::applyPartialConversion(module, target, std::move(patterns)))) {
         _log.error("Failed to replace Alloc/Dealloc Operations");
         signalPassFailure();
+        return;
     }
+
+    // Only allocations were replaced, dependencies are kept in sync by runLinearScan
+    markAnalysesPreserved<AsyncDepsInfo>();
 }
 
 }  // namespace
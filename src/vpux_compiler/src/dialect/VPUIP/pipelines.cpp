@@ -34,7 +34,7 @@ void vpux::VPUIP::buildHardwareAdaptationPipeline(mlir::OpPassManager& pm, Logge
     pm.addPass(VPUIP::createConvertAllocationsToDeclarationsPass(log));
     pm.addPass(VPUIP::createConvertViewOpsToDeclarationsPass(log));
     pm.addPass(VPUIP::createConvertAsyncOpsToTasksPass(log));
-    pm.addPass(mlir::createCanonicalizerPass(grc));
+    pm.addPass(createIncrementalCanonicalizerPass(grc));
     pm.addPass(createMoveDeclarationsToTopPass(log));
 }
 
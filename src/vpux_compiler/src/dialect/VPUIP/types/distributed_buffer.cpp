@@ -359,7 +359,7 @@ mlir::MemRefType VPUIP::DistributedBufferType::getCompactType() const {
 
 namespace {
 
-Shape* getLargestShapeIt(SmallVector<Shape>& shapes) {
+const Shape* getLargestShapeIt(ArrayRef<Shape> shapes) {
     return std::max_element(shapes.begin(), shapes.end(), [](ShapeRef a, ShapeRef b) {
         return details::calcTotalShapeSize(a.raw()) < details::calcTotalShapeSize(b.raw());
     });
@@ -387,26 +387,26 @@ StridedShape* getLargestStridedShapeIt(SmallVector<StridedShape>& stridedShapes)
 // while the allocated shape is [1, 64, 4, 4] (because of duplicated)
 // information which is needed for scheduler and strategy manager,
 // in order to estimate memory
-SmallVector<Shape> VPUIP::DistributedBufferType::getPerClusterComputeShapes() const {
+ArrayRef<Shape> VPUIP::DistributedBufferType::getPerClusterComputeShapes() const {
     auto distribution = getDistribution();
     if (distribution.getComputeShapes() == nullptr) {
         return VPU::getPerClusterComputeShapes(getShape(), distribution);
     }
 
-    return VPU::arrayAttrToVecOfShapes(distribution.getComputeShapes());
+    return VPU::getCachedShapes(distribution.getComputeShapes());
 }
 
 // @brief Retrieve the array of compute buffer offsets with regards to the full buffer.
 // @warning An important thing to consider with regards to compute shapes,
 // is that modes like SEGMENTED and OVERLAPPED take precedence over
 // DUPLICATED and MULTICASTED.
-SmallVector<Shape> VPUIP::DistributedBufferType::getPerClusterComputeShapeOffsets() const {
+ArrayRef<Shape> VPUIP::DistributedBufferType::getPerClusterComputeShapeOffsets() const {
     auto distribution = getDistribution();
     if (distribution.getComputeOffsets() == nullptr) {
         return VPU::getPerClusterComputeShapeOffsets(getShape(), distribution);
     }
 
-    return VPU::arrayAttrToVecOfShapes(distribution.getComputeOffsets());
+    return VPU::getCachedShapes(distribution.getComputeOffsets());
 }
 
 // @brief Retrieve the array of memory shapes.
@@ -418,26 +418,26 @@ SmallVector<Shape> VPUIP::DistributedBufferType::getPerClusterComputeShapeOffset
 //  [1, 64, 4, 4], which is the allocated shape (because of duplicated)
 //  information which is needed for scheduler and strategy manager,
 //  in order to estimate memory
-SmallVector<Shape> VPUIP::DistributedBufferType::getPerClusterMemoryShapes() const {
+ArrayRef<Shape> VPUIP::DistributedBufferType::getPerClusterMemoryShapes() const {
     auto distribution = getDistribution();
     if (distribution.getMemoryShapes() == nullptr) {
         return VPU::getPerClusterMemoryShapes(getShape(), distribution);
     }
 
-    return VPU::arrayAttrToVecOfShapes(distribution.getMemoryShapes());
+    return VPU::getCachedShapes(distribution.getMemoryShapes());
 }
 
 // @brief Retrieve the array of memory buffer offsets with regards to the full buffer.
 // @warning An important thing to consider with regards to compute shapes,
 //  is that modes like DUPLICATED and MULTICASTED take precedence over
 //  SEGMENTED and OVERLAPPED.
-SmallVector<Shape> VPUIP::DistributedBufferType::getPerClusterMemoryShapeOffsets() const {
+ArrayRef<Shape> VPUIP::DistributedBufferType::getPerClusterMemoryShapeOffsets() const {
     auto distribution = getDistribution();
     if (distribution.getMemoryOffsets() == nullptr) {
         return VPU::getPerClusterMemoryShapeOffsets(getShape(), distribution);
     }
 
-    return VPU::arrayAttrToVecOfShapes(distribution.getMemoryOffsets());
+    return VPU::getCachedShapes(distribution.getMemoryOffsets());
 }
 
 // @brief Get largest compact compute shape
@@ -445,8 +445,7 @@ SmallVector<Shape> VPUIP::DistributedBufferType::getPerClusterMemoryShapeOffsets
 // because it does not retrieve the true allocate shape in cases
 // of broadcasting.
 Shape VPUIP::DistributedBufferType::getLargestCompactShape() const {
-    auto tiledComputeShapes = getPerClusterComputeShapes();
-    return *getLargestShapeIt(tiledComputeShapes);
+    return *getLargestShapeIt(getPerClusterComputeShapes());
 }
 
 // @brief Get the compact compute shape for a specific cluster
@@ -37,12 +37,9 @@ int64_t getQueueId(VPURT::TaskOp taskOp) {
     return 0;
 }
 
-// Helper function used by logger to create clear string about executor instance
-// that a given task has executed on. Examples:
-// - DMA_NN[port = 0, channel = DDR]
-// - NCE[cluster = 0]
-// - SHAVE_ACT[cluster = 0]
-std::string getTaskQueueInfoString(VPURT::TaskQueueType taskType, VPURT::TaskOp taskOp) {
+}  // namespace
+
+std::string vpux::VPURT::getTaskQueueInfoString(VPURT::TaskQueueType taskType, VPURT::TaskOp taskOp) {
     std::string infoStr = stringifyEnum(taskType.type).data();
 
     auto* op = taskOp.getInnerTaskOp();
@@ -62,8 +59,6 @@ std::string getTaskQueueInfoString(VPURT::TaskQueueType taskType, VPURT::TaskOp
     return infoStr;
 }
 
-}  // namespace
-
 vpux::VPURT::TaskConfig::TaskConfig(VPURT::TaskOp op, SmallVector<int64_t>& virtBarrierWaitVec,
                                     SmallVector<int64_t>& virtBarrierUpdateVec, int64_t cost)
         : taskOp(op), virtBarrierWaits(virtBarrierWaitVec), virtBarrierUpdates(virtBarrierUpdateVec), cycleCost(cost) {
@@ -192,6 +187,7 @@ public:
         VPUX_THROW_UNLESS(numOfRuntimeDispatchedExecutors > 0,
                           "Number of executors need to be larger then 0, got '{0}'", numOfRuntimeDispatchedExecutors);
         _cycle.resize(numOfRuntimeDispatchedExecutors);
+        _lastTask.resize(numOfRuntimeDispatchedExecutors);
     }
 
     size_t getCurrentTaskIdx() {
@@ -204,12 +200,19 @@ public:
         return *std::min_element(_cycle.begin(), _cycle.end());
     }
 
-    void progressQueueToCycle(size_t newCycle) {
+    // Task which was the last to execute on the executor that is free first
+    VPURT::TaskOp getLastTask() {
+        auto cycleItr = std::min_element(_cycle.begin(), _cycle.end());
+        return _lastTask[std::distance(_cycle.begin(), cycleItr)];
+    }
+
+    void progressQueueToCycle(size_t newCycle, VPURT::TaskOp task) {
         // Once task from a queue gets executed update cycle state of a queue
         // and increment task index
         auto cycleItr = std::min_element(_cycle.begin(), _cycle.end());
         VPUX_THROW_WHEN(newCycle < *cycleItr, "New cycle '{0}' is smaller then exisitng '{1}'", newCycle, *cycleItr);
         *cycleItr = newCycle;
+        _lastTask[std::distance(_cycle.begin(), cycleItr)] = task;
         _taskIdx++;
     }
 
@@ -220,6 +223,8 @@ private:
     // executors of the same type that are not assigned or distinguishable by compiler
     // and are dispatched at runtime.
     SmallVector<size_t> _cycle;
+    // Last task executed by each executor
+    SmallVector<VPURT::TaskOp> _lastTask;
 
     // Index of next tast to be executed on given queue
     size_t _taskIdx;
@@ -259,7 +264,9 @@ void vpux::VPURT::InferenceExecutionSimulator::runSim() {
             auto cost = queueTasks[index].cycleCost;
 
             bool waitingForDependency = false;
-            size_t cycleBegin = queueStateMap[queueType].getCycle();
+            const size_t queueCycle = queueStateMap[queueType].getCycle();
+            size_t cycleBegin = queueCycle;
+            auto dependency = queueStateMap[queueType].getLastTask();
 
             // Check all wait barrierss. If all are satisified task can be executed
             // CycleBegin value needs to take into account at what cycle last barrier
@@ -269,7 +276,11 @@ void vpux::VPURT::InferenceExecutionSimulator::runSim() {
                     waitingForDependency = true;
                     break;
                 }
-                cycleBegin = std::max(cycleBegin, _virtBarriers[waitVirtBarrierId].getReleaseCycle());
+                const auto releaseCycle = _virtBarriers[waitVirtBarrierId].getReleaseCycle();
+                if (releaseCycle > cycleBegin) {
+                    cycleBegin = releaseCycle;
+                    dependency = _virtBarriers[waitVirtBarrierId].getLastProducer();
+                }
             }
 
             if (waitingForDependency) {
@@ -289,15 +300,17 @@ void vpux::VPURT::InferenceExecutionSimulator::runSim() {
                 VPUX_THROW_WHEN(_virtBarriers[updateVirtBarrierId].isReleased(), "Barrier {0} was already released",
                                 updateVirtBarrierId);
 
-                _virtBarriers[updateVirtBarrierId].decrementAtCycle(cycleEnd);
+                _virtBarriers[updateVirtBarrierId].decrementAtCycle(cycleEnd, queueTasks[index].taskOp);
 
                 _log.nest().trace("Decrement virt barrier {0}{1}", updateVirtBarrierId,
                                   _virtBarriers[updateVirtBarrierId].isReleased() ? " - barrier released" : "");
             }
 
             // Task has executed on this queue. Update queue state with new cycle
-            queueStateMap[queueType].progressQueueToCycle(cycleEnd);
+            queueStateMap[queueType].progressQueueToCycle(cycleEnd, queueTasks[index].taskOp);
             queueTasks[index].cycleStart = cycleBegin;
+            queueTasks[index].barrierStallCycles = cycleBegin - queueCycle;
+            queueTasks[index].dependency = dependency;
             progressed = true;
         }
     }
@@ -380,3 +393,44 @@ void vpux::VPURT::InferenceExecutionSimulator::updateCyclesInIR() {
         }
     }
 }
+
+const std::map<VPURT::TaskQueueType, SmallVector<VPURT::TaskConfig>>&
+vpux::VPURT::InferenceExecutionSimulator::getQueueTasks() const {
+    return _queueTasksMap;
+}
+
+int64_t vpux::VPURT::InferenceExecutionSimulator::getNumOfExecutors(VPURT::TaskQueueType queueType) const {
+    const auto numOfExecutors = _numOfExecutorQueuesForWhichAssignmentIsAtInference.find(queueType.type);
+    if (numOfExecutors == _numOfExecutorQueuesForWhichAssignmentIsAtInference.end()) {
+        return 1;
+    }
+    return numOfExecutors->second;
+}
+
+SmallVector<VPURT::TaskConfig> vpux::VPURT::InferenceExecutionSimulator::getCriticalPath() {
+    VPUX_THROW_WHEN(_queueTasksMap.empty(), "Queue task map not initialized");
+
+    DenseMap<mlir::Operation*, const TaskConfig*> taskConfigs;
+    const TaskConfig* lastTask = nullptr;
+    for (auto& queueTypeTasks : _queueTasksMap) {
+        for (auto& task : queueTypeTasks.second) {
+            VPUX_THROW_WHEN(task.cycleStart < 0, "Simulation was not run for task '{0}'", task.taskOp->getLoc());
+            taskConfigs[task.taskOp.getOperation()] = &task;
+            if (lastTask == nullptr ||
+                task.cycleStart + task.cycleCost > lastTask->cycleStart + lastTask->cycleCost) {
+                lastTask = &task;
+            }
+        }
+    }
+
+    SmallVector<TaskConfig> criticalPath;
+    for (auto task = lastTask; task != nullptr;) {
+        criticalPath.push_back(*task);
+        if (!task->dependency) {
+            break;
+        }
+        task = taskConfigs.lookup(task->dependency.getOperation());
+    }
+    std::reverse(criticalPath.begin(), criticalPath.end());
+    return criticalPath;
+}
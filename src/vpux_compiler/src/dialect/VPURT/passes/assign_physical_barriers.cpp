@@ -66,6 +66,8 @@ void AssignPhysicalBarriersPass::safeRunOnFunc() {
 
     auto& barrierSim = getAnalysis<VPURT::BarrierSimulator>();
     if (!barrierSim.isDynamicBarriers()) {
+        // Nothing to assign, the simulator can be reused by the following barrier simulation
+        markAllAnalysesPreserved();
         return;
     }
 
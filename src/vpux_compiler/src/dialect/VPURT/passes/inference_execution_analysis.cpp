@@ -9,6 +9,7 @@
 #include "vpux/compiler/dialect/VPUIP/utils.hpp"
 #include "vpux/compiler/dialect/VPURT/inference_execution_simulator.hpp"
 #include "vpux/compiler/dialect/VPURT/passes.hpp"
+#include "vpux/compiler/dialect/VPURT/schedule_analysis_report.hpp"
 #include "vpux/compiler/dialect/VPURT/task.hpp"
 #include "vpux/compiler/utils/dma.hpp"
 #include "vpux/compiler/utils/strings.hpp"
@@ -89,16 +90,38 @@ void createScheduleTraceEventFile(const SmallVector<VPURT::TaskConfig>& tasksCyc
 class InferenceExecutionAnalysisPass final :
         public VPURT::InferenceExecutionAnalysisBase<InferenceExecutionAnalysisPass> {
 public:
-    explicit InferenceExecutionAnalysisPass(const std::string& compileSchedTraceFileName, Logger log)
-            : _compileSchedTraceFileName(compileSchedTraceFileName) {
+    InferenceExecutionAnalysisPass(const std::string& compileSchedTraceFileName, const std::string& reportFileName,
+                                   int64_t reportTopLayers, Logger log)
+            : _compileSchedTraceFileName(compileSchedTraceFileName),
+              _reportFileName(reportFileName),
+              _reportTopLayers(reportTopLayers) {
         Base::initLogger(log, Base::getArgumentName());
     }
 
+    mlir::LogicalResult initialize(mlir::MLIRContext* ctx) final;
+
 private:
     void safeRunOnFunc() final;
     std::string _compileSchedTraceFileName;
+    std::string _reportFileName;
+    int64_t _reportTopLayers;
 };
 
+mlir::LogicalResult InferenceExecutionAnalysisPass::initialize(mlir::MLIRContext* ctx) {
+    if (mlir::failed(Base::initialize(ctx))) {
+        return mlir::failure();
+    }
+    if (reportFileName.hasValue()) {
+        _reportFileName = reportFileName.getValue();
+    }
+    if (reportTopLayers.hasValue()) {
+        _reportTopLayers = reportTopLayers.getValue();
+    }
+    VPUX_THROW_WHEN(_reportTopLayers < 0, "Invalid number of layers in the report '{0}'", _reportTopLayers);
+
+    return mlir::success();
+}
+
 void InferenceExecutionAnalysisPass::safeRunOnFunc() {
     auto funcOp = getOperation();
     auto moduleOp = funcOp->getParentOfType<mlir::ModuleOp>();
@@ -130,9 +153,22 @@ void InferenceExecutionAnalysisPass::safeRunOnFunc() {
         }
     }
 
-    VPUX_THROW_WHEN(_compileSchedTraceFileName.empty(), "Empty compile time schedule trace file");
+    VPUX_THROW_WHEN(_compileSchedTraceFileName.empty() && _reportFileName.empty(),
+                    "Neither compile time schedule trace nor analysis report file is provided");
+
+    if (!_compileSchedTraceFileName.empty()) {
+        createScheduleTraceEventFile(tasksCycleConfig, freqInMHz, _compileSchedTraceFileName, _log);
+    }
 
-    createScheduleTraceEventFile(tasksCycleConfig, freqInMHz, _compileSchedTraceFileName, _log);
+    if (!_reportFileName.empty()) {
+        std::ofstream reportStream(_reportFileName);
+        VPUX_THROW_UNLESS(reportStream.good(), "File for schedule analysis report not created correctly");
+
+        const auto report =
+                VPURT::createScheduleAnalysisReport(infSim, freqInMHz, checked_cast<size_t>(_reportTopLayers));
+        reportStream << report.dump(4) << std::endl;
+        _log.trace("Schedule analysis report was written to '{0}'", _reportFileName);
+    }
 }
 
 }  // namespace
@@ -142,6 +178,8 @@ void InferenceExecutionAnalysisPass::safeRunOnFunc() {
 //
 
 std::unique_ptr<mlir::Pass> vpux::VPURT::createInferenceExecutionAnalysisPass(std::string compileSchedTraceFileName,
-                                                                              Logger log) {
-    return std::make_unique<InferenceExecutionAnalysisPass>(compileSchedTraceFileName, log);
+                                                                              std::string reportFileName,
+                                                                              int64_t reportTopLayers, Logger log) {
+    return std::make_unique<InferenceExecutionAnalysisPass>(compileSchedTraceFileName, reportFileName,
+                                                            reportTopLayers, log);
 }
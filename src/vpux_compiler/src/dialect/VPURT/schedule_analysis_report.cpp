@@ -0,0 +1,200 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/dialect/VPURT/schedule_analysis_report.hpp"
+#include "vpux/compiler/core/profiling.hpp"
+#include "vpux/compiler/dialect/VPUIP/ops.hpp"
+#include "vpux/compiler/dialect/VPURT/ops.hpp"
+#include "vpux/compiler/dialect/const/ops.hpp"
+#include "vpux/compiler/utils/strings.hpp"
+
+#include <llvm/ADT/StringMap.h>
+
+#include <algorithm>
+#include <tuple>
+
+using namespace vpux;
+
+namespace {
+
+double convertCyclesToMicroSeconds(int64_t cycles, double freqInMHz) {
+    return static_cast<double>(cycles) / freqInMHz;
+}
+
+bool isInSection(mlir::Value buffer, VPURT::BufferSection section) {
+    auto declareBufferOp = buffer.getDefiningOp<VPURT::DeclareBufferOp>();
+    return declareBufferOp != nullptr && declareBufferOp.getSection() == section;
+}
+
+std::string getTaskName(VPURT::TaskOp taskOp) {
+    return stringifyLocation(taskOp.getInnerTaskOp()->getLoc());
+}
+
+// Tasks of the same layer differ only by the suffix after the last LOCATION_ORIGIN_SEPARATOR
+std::string getLayerName(VPURT::TaskOp taskOp) {
+    const auto name = getTaskName(taskOp);
+    return name.substr(0, name.rfind(LOCATION_ORIGIN_SEPARATOR));
+}
+
+StringLiteral stringifyTransferKind(VPURT::DMATransferKind kind) {
+    switch (kind) {
+    case VPURT::DMATransferKind::Prefetch:
+        return "prefetch";
+    case VPURT::DMATransferKind::SpillWrite:
+        return "spill_write";
+    case VPURT::DMATransferKind::SpillRead:
+        return "spill_read";
+    default:
+        return "other";
+    }
+}
+
+struct LayerContribution final {
+    int64_t criticalPathCycles = 0;
+    int64_t totalCycles = 0;
+    size_t numTasks = 0;
+};
+
+}  // namespace
+
+VPURT::DMATransferKind vpux::VPURT::getDMATransferKind(VPURT::TaskOp taskOp) {
+    auto* op = taskOp.getInnerTaskOp();
+    auto dmaLayer = mlir::dyn_cast<VPUIP::LayerOpInterface>(op);
+    VPUX_THROW_UNLESS(mlir::isa<VPUIP::DMATypeOpInterface>(op) && dmaLayer != nullptr, "Task '{0}' is not a DMA",
+                      taskOp->getLoc());
+
+    const auto input = dmaLayer.getInputs()[0];
+    const auto output = dmaLayer.getOutputs()[0];
+
+    if (input.getDefiningOp<Const::DeclareOp>() != nullptr || isInSection(input, VPURT::BufferSection::Constant)) {
+        return DMATransferKind::Prefetch;
+    }
+
+    const auto inputMemKind = input.getType().cast<vpux::NDTypeInterface>().getMemoryKind();
+    const auto outputMemKind = output.getType().cast<vpux::NDTypeInterface>().getMemoryKind();
+    if (inputMemKind == VPU::MemoryKind::CMX_NN && isInSection(output, VPURT::BufferSection::DDR)) {
+        return DMATransferKind::SpillWrite;
+    }
+    if (isInSection(input, VPURT::BufferSection::DDR) && outputMemKind == VPU::MemoryKind::CMX_NN) {
+        return DMATransferKind::SpillRead;
+    }
+    return DMATransferKind::Other;
+}
+
+VPU::Json vpux::VPURT::createScheduleAnalysisReport(InferenceExecutionSimulator& infSim, double freqInMHz,
+                                                     size_t topNLayers) {
+    VPUX_THROW_WHEN(freqInMHz <= 0, "Invalid frequency '{0}'", freqInMHz);
+
+    const auto latency = infSim.getInferenceLatencyInCycles();
+    const auto criticalPath = infSim.getCriticalPath();
+
+    DenseMap<mlir::Operation*, std::string> taskExecutors;
+    llvm::StringMap<LayerContribution> layers;
+    std::map<std::string, int64_t> dmaBytes;
+    for (auto kind : {DMATransferKind::Prefetch, DMATransferKind::SpillWrite, DMATransferKind::SpillRead,
+                      DMATransferKind::Other}) {
+        dmaBytes[stringifyTransferKind(kind).str()] = 0;
+    }
+
+    size_t numTasks = 0;
+    int64_t totalBarrierStallCycles = 0;
+    auto executors = VPU::Json::array();
+    for (const auto& queueTypeTasks : infSim.getQueueTasks()) {
+        const auto& queueType = queueTypeTasks.first;
+        const auto& queueTasks = queueTypeTasks.second;
+        if (queueTasks.empty()) {
+            continue;
+        }
+
+        const auto executorName = VPURT::getTaskQueueInfoString(queueType, queueTasks.front().taskOp);
+        const auto numExecutors = infSim.getNumOfExecutors(queueType);
+
+        int64_t busyCycles = 0;
+        int64_t barrierStallCycles = 0;
+        for (const auto& task : queueTasks) {
+            busyCycles += task.cycleCost;
+            barrierStallCycles += task.barrierStallCycles;
+            taskExecutors[task.taskOp.getOperation()] = executorName;
+
+            auto& layer = layers[getLayerName(task.taskOp)];
+            layer.totalCycles += task.cycleCost;
+            ++layer.numTasks;
+
+            if (queueType.type == VPU::ExecutorKind::DMA_NN) {
+                auto dmaLayer = mlir::cast<VPUIP::LayerOpInterface>(task.taskOp.getInnerTaskOp());
+                const auto size = dmaLayer.getOutputs()[0].getType().cast<vpux::NDTypeInterface>().getTotalAllocSize();
+                dmaBytes[stringifyTransferKind(getDMATransferKind(task.taskOp)).str()] += size.count();
+            }
+        }
+        numTasks += queueTasks.size();
+        totalBarrierStallCycles += barrierStallCycles;
+
+        // Executors dispatched at inference share the queue, each of them is available during the whole inference
+        const auto availableCycles = latency * numExecutors;
+
+        VPU::Json executor;
+        executor["name"] = executorName;
+        executor["executors"] = numExecutors;
+        executor["tasks"] = queueTasks.size();
+        executor["busy_cycles"] = busyCycles;
+        executor["idle_cycles"] = availableCycles - busyCycles;
+        executor["barrier_stall_cycles"] = barrierStallCycles;
+        executor["utilization"] = availableCycles == 0 ? 0.0 : static_cast<double>(busyCycles) / availableCycles;
+        executors.push_back(executor);
+    }
+
+    auto criticalPathTasks = VPU::Json::array();
+    for (const auto& task : criticalPath) {
+        layers[getLayerName(task.taskOp)].criticalPathCycles += task.cycleCost;
+
+        VPU::Json pathTask;
+        pathTask["name"] = getTaskName(task.taskOp);
+        pathTask["executor"] = taskExecutors.lookup(task.taskOp.getOperation());
+        pathTask["cycle_begin"] = task.cycleStart;
+        pathTask["cycle_end"] = task.cycleStart + task.cycleCost;
+        pathTask["barrier_stall_cycles"] = task.barrierStallCycles;
+        criticalPathTasks.push_back(pathTask);
+    }
+
+    std::vector<std::pair<std::string, LayerContribution>> sortedLayers;
+    for (const auto& layer : layers) {
+        sortedLayers.emplace_back(layer.first().str(), layer.second);
+    }
+    std::sort(sortedLayers.begin(), sortedLayers.end(), [](const auto& lhs, const auto& rhs) {
+        return std::make_tuple(-lhs.second.criticalPathCycles, -lhs.second.totalCycles, lhs.first) <
+               std::make_tuple(-rhs.second.criticalPathCycles, -rhs.second.totalCycles, rhs.first);
+    });
+    sortedLayers.resize(std::min(sortedLayers.size(), topNLayers));
+
+    auto topLayers = VPU::Json::array();
+    for (const auto& layer : sortedLayers) {
+        VPU::Json topLayer;
+        topLayer["name"] = layer.first;
+        topLayer["critical_path_cycles"] = layer.second.criticalPathCycles;
+        topLayer["total_cycles"] = layer.second.totalCycles;
+        topLayer["tasks"] = layer.second.numTasks;
+        topLayers.push_back(topLayer);
+    }
+
+    VPU::Json dma;
+    for (const auto& bytes : dmaBytes) {
+        dma[bytes.first + "_bytes"] = bytes.second;
+    }
+    dma["spill_bytes"] = dmaBytes[stringifyTransferKind(DMATransferKind::SpillWrite).str()] +
+                         dmaBytes[stringifyTransferKind(DMATransferKind::SpillRead).str()];
+
+    VPU::Json report;
+    report["summary"] = {{"latency_cycles", latency},
+                         {"latency_us", convertCyclesToMicroSeconds(latency, freqInMHz)},
+                         {"frequency_mhz", freqInMHz},
+                         {"tasks", numTasks},
+                         {"tasks_with_invalid_cost", infSim.getNumberfOfTasksWithInvalidCost()},
+                         {"barrier_stall_cycles", totalBarrierStallCycles}};
+    report["critical_path"] = {{"cycles", latency}, {"tasks", criticalPathTasks}};
+    report["executors"] = executors;
+    report["dma"] = dma;
+    report["top_layers"] = topLayers;
+    return report;
+}
@@ -111,9 +111,8 @@ void vpux::Const::DeclareOp::serialize(elf::writer::BinaryDataSection<uint8_t>&
 //
 
 size_t vpux::Const::DeclareOp::getBinarySize() {
-    vpux::Const::Content cnt = getContent();
-
-    return cnt.getType().getTotalAllocSize().count();
+    // Folded content has the type of the content attribute, so there is no need to fold it here
+    return getContentAttr().getType().cast<vpux::NDTypeInterface>().getTotalAllocSize().count();
 }
 
 //
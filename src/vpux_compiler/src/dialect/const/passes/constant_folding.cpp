@@ -9,11 +9,15 @@
 #include "vpux/compiler/utils/error.hpp"
 #include "vpux/compiler/utils/types.hpp"
 #include "vpux/utils/core/numeric.hpp"
+#include "vpux/utils/core/range.hpp"
 
 #include <mlir/IR/DialectImplementation.h>
+#include <mlir/IR/Threading.h>
 #include <mlir/Pass/PassManager.h>
 #include <mlir/Transforms/GreedyPatternRewriteDriver.h>
 
+#include <exception>
+
 using namespace vpux;
 
 namespace {
@@ -32,37 +36,64 @@ private:
     void safeRunOnFunc() final;
 };
 
+mlir::DenseElementsAttr foldContent(Const::DeclareOp origOp) {
+    const auto content = origOp.getContent();
+    const auto contentType = content.getType();
+    const auto contentElemType = contentType.getElementType();
+
+    const auto bufSize = checked_cast<size_t>(contentType.getTotalAllocSize().count());
+    std::vector<char> tempBuf(bufSize);
+    content.copyTo(makeMutableArrayRef(tempBuf.data(), bufSize));
+
+    auto rankedTensorType = contentType.cast<mlir::RankedTensorType>();
+
+    if (auto qtype = contentElemType.dyn_cast<mlir::quant::QuantizedType>()) {
+        rankedTensorType = contentType.changeElemType(normalizeQuantStorageType(qtype)).cast<mlir::RankedTensorType>();
+    }
+
+    return mlir::DenseElementsAttr::getFromRawBuffer(rankedTensorType, tempBuf);
+}
+
 void ConstantFoldingPass::safeRunOnFunc() {
     auto func = getOperation();
 
+    SmallVector<Const::DeclareOp> constOps;
     func.walk([&](Const::DeclareOp origOp) {
         _log.trace("Folding constant at location '{0}'", origOp.getLoc());
+        constOps.push_back(origOp);
+    });
 
-        mlir::OpBuilder builder(origOp);
-
-        const auto content = origOp.getContent();
-        const auto contentType = content.getType();
-        const auto contentElemType = contentType.getElementType();
-
-        const auto bufSize = checked_cast<size_t>(contentType.getTotalAllocSize().count());
-        std::vector<char> tempBuf(bufSize);
-        content.copyTo(makeMutableArrayRef(tempBuf.data(), bufSize));
-
-        auto rankedTensorType = contentType.cast<mlir::RankedTensorType>();
+    // Transformations of different constants are independent and attributes are uniqued by the context in a
+    // thread-safe way, so only the IR modification has to be done sequentially
+    SmallVector<mlir::DenseElementsAttr> foldedAttrs(constOps.size());
+    SmallVector<std::exception_ptr> errors(constOps.size());
+    mlir::parallelFor(&getContext(), 0, constOps.size(), [&](size_t ind) {
+        // parallelFor does not propagate exceptions, they are kept to be rethrown on the calling thread
+        try {
+            foldedAttrs[ind] = foldContent(constOps[ind]);
+        } catch (...) {
+            errors[ind] = std::current_exception();
+        }
+    });
 
-        if (auto qtype = contentElemType.dyn_cast<mlir::quant::QuantizedType>()) {
-            rankedTensorType =
-                    contentType.changeElemType(normalizeQuantStorageType(qtype)).cast<mlir::RankedTensorType>();
+    // The IR is modified only if all the constants are folded
+    for (auto ind : irange(constOps.size())) {
+        if (errors[ind] != nullptr) {
+            _log.error("Failed to fold constant at location '{0}'", constOps[ind].getLoc());
+            std::rethrow_exception(errors[ind]);
         }
+    }
 
-        const auto denseAttr = mlir::DenseElementsAttr::getFromRawBuffer(rankedTensorType, tempBuf);
+    for (auto ind : irange(constOps.size())) {
+        auto origOp = constOps[ind];
 
-        const auto newOp =
-                builder.create<Const::DeclareOp>(origOp.getLoc(), origOp.getType(), Const::ContentAttr::get(denseAttr));
+        mlir::OpBuilder builder(origOp);
+        const auto newOp = builder.create<Const::DeclareOp>(origOp.getLoc(), origOp.getType(),
+                                                            Const::ContentAttr::get(foldedAttrs[ind]));
         origOp.replaceAllUsesWith(newOp);
 
         origOp.erase();
-    });
+    }
 }
 
 }  // namespace
@@ -0,0 +1,161 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/utils/incremental_rewriter.hpp"
+
+#include <llvm/ADT/DenseSet.h>
+
+using namespace vpux;
+
+namespace {
+
+// Everything a local pattern might check in the operation itself: names, attributes and types are uniqued in the
+// context and never released, so their pointers identify them exactly.
+// Operands are compared as values, since a pattern only cares whether the operand is still produced by the same
+// result; the producer itself is described by its own entry. The number of uses is included so that the producer
+// is considered changed when a user is added or erased, which covers the patterns matching sibling users.
+IncrementalRewriteInfo::OpDesc describeOp(mlir::Operation* op) {
+    IncrementalRewriteInfo::OpDesc desc;
+    desc.reserve(3 + op->getNumOperands() + 2 * op->getNumResults());
+
+    desc.push_back(reinterpret_cast<uintptr_t>(op->getName().getAsOpaquePointer()));
+    desc.push_back(reinterpret_cast<uintptr_t>(op->getAttrDictionary().getAsOpaquePointer()));
+    desc.push_back(op->getNumOperands());
+
+    for (auto operand : op->getOperands()) {
+        desc.push_back(reinterpret_cast<uintptr_t>(operand.getAsOpaquePointer()));
+    }
+    for (auto result : op->getResults()) {
+        desc.push_back(reinterpret_cast<uintptr_t>(result.getType().getAsOpaquePointer()));
+        desc.push_back(static_cast<uintptr_t>(std::distance(result.use_begin(), result.use_end())));
+    }
+
+    return desc;
+}
+
+}  // namespace
+
+//
+// IncrementalRewriteInfo
+//
+
+IncrementalRewriteInfo::Snapshot* vpux::IncrementalRewriteInfo::getSnapshot(StringRef patternSetName) {
+    const auto it = _snapshots.find(patternSetName);
+    return it != _snapshots.end() ? &it->second : nullptr;
+}
+
+void vpux::IncrementalRewriteInfo::capture(StringRef patternSetName, mlir::func::FuncOp func) {
+    auto& snapshot = _snapshots[patternSetName];
+    snapshot.clear();
+
+    func->walk([&](mlir::Operation* op) {
+        if (op != func.getOperation()) {
+            snapshot.insert({op, describeOp(op)});
+        }
+    });
+}
+
+void vpux::IncrementalRewriteInfo::reset(StringRef patternSetName) {
+    _snapshots.erase(patternSetName);
+}
+
+//
+// applyPatternsToChangedOps
+//
+
+mlir::LogicalResult vpux::applyPatternsToChangedOps(mlir::func::FuncOp func, StringRef patternSetName,
+                                                    IncrementalRewriteInfo& info,
+                                                    const mlir::FrozenRewritePatternSet& patterns,
+                                                    const mlir::GreedyRewriteConfig& config, Logger log,
+                                                    bool* isSkipped) {
+    if (isSkipped != nullptr) {
+        *isSkipped = false;
+    }
+
+    const auto finalize = [&](mlir::LogicalResult converged) {
+        // The IR which is not converged might be changed by the next run even without any modifications in between
+        if (mlir::succeeded(converged)) {
+            info.capture(patternSetName, func);
+        } else {
+            info.reset(patternSetName);
+        }
+        return converged;
+    };
+
+    const auto* snapshot = info.getSnapshot(patternSetName);
+    if (snapshot == nullptr) {
+        log.trace("Apply '{0}' patterns to all operations of '{1}'", patternSetName, func.getName());
+        return finalize(mlir::applyPatternsAndFoldGreedily(func, patterns, config));
+    }
+
+    llvm::DenseSet<mlir::Operation*> dirtyOps;
+    SmallVector<mlir::Operation*> frontier;
+    size_t numOps = 0;
+
+    func->walk([&](mlir::Operation* op) {
+        if (op == func.getOperation()) {
+            return;
+        }
+
+        ++numOps;
+
+        const auto it = snapshot->find(op);
+        if (it == snapshot->end() || it->second != describeOp(op)) {
+            dirtyOps.insert(op);
+            frontier.push_back(op);
+        }
+    });
+
+    if (dirtyOps.empty()) {
+        log.trace("'{0}' was not changed since '{1}' patterns converged on it", func.getName(), patternSetName);
+        if (isSkipped != nullptr) {
+            *isSkipped = true;
+        }
+        return mlir::success();
+    }
+
+    // Patterns look at the producers of the root operation operands and at the users of its results,
+    // so the changes are propagated to the operations they might enable or disable
+    constexpr size_t NEIGHBOURHOOD_DEPTH = 2;
+    for (size_t depth = 0; depth < NEIGHBOURHOOD_DEPTH && !frontier.empty(); ++depth) {
+        SmallVector<mlir::Operation*> nextFrontier;
+        const auto markDirty = [&](mlir::Operation* op) {
+            if (op != nullptr && op != func.getOperation() && dirtyOps.insert(op).second) {
+                nextFrontier.push_back(op);
+            }
+        };
+
+        for (auto* op : frontier) {
+            for (auto operand : op->getOperands()) {
+                markDirty(operand.getDefiningOp());
+            }
+            for (auto* user : op->getUsers()) {
+                markDirty(user);
+            }
+            markDirty(op->getParentOp());
+        }
+
+        frontier = std::move(nextFrontier);
+    }
+
+    if (dirtyOps.size() == numOps) {
+        log.trace("Apply '{0}' patterns to all operations of '{1}'", patternSetName, func.getName());
+        return finalize(mlir::applyPatternsAndFoldGreedily(func, patterns, config));
+    }
+
+    SmallVector<mlir::Operation*> worklist;
+    worklist.reserve(dirtyOps.size());
+    func->walk<mlir::WalkOrder::PreOrder>([&](mlir::Operation* op) {
+        if (dirtyOps.contains(op)) {
+            worklist.push_back(op);
+        }
+    });
+
+    log.trace("Apply '{0}' patterns to {1} of {2} operations of '{3}'", patternSetName, worklist.size(), numOps,
+              func.getName());
+
+    // The driver still adds the neighbours of the rewritten operations to the worklist, as for the whole function
+    return finalize(mlir::applyOpPatternsAndFold(worklist, patterns, mlir::GreedyRewriteStrictness::AnyOp));
+}
@@ -9,6 +9,12 @@
 #include <mlir/Pass/Pass.h>
 #include <mlir/Pass/PassInstrumentation.h>
 
+#include "vpux/utils/core/process_memory.hpp"
+
+#include <llvm/ADT/DenseMap.h>
+
+#include <mutex>
+
 using namespace vpux;
 
 //
@@ -97,6 +103,73 @@ void vpux::addLogging(mlir::PassManager& pm, Logger log) {
     pm.addInstrumentation(std::make_unique<PassLogging>(log));
 }
 
+//
+// PassMemoryReport
+//
+
+namespace {
+
+class PassMemoryReport final : public mlir::PassInstrumentation {
+public:
+    explicit PassMemoryReport(Logger log): _log(log) {
+    }
+
+    void runBeforePass(mlir::Pass* pass, mlir::Operation* op) final {
+        // Pass adaptors, which run nested pipelines, have no argument - the nested passes are reported instead
+        if (pass->getArgument().empty()) {
+            return;
+        }
+
+        const auto startPeakRSS = getPeakRSS();
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        _startPeakRSS[{pass, op}] = startPeakRSS;
+    }
+
+    void runAfterPass(mlir::Pass* pass, mlir::Operation* op) final {
+        report(pass, op);
+    }
+
+    void runAfterPassFailed(mlir::Pass* pass, mlir::Operation* op) final {
+        report(pass, op);
+    }
+
+private:
+    void report(mlir::Pass* pass, mlir::Operation* op) {
+        if (pass->getArgument().empty()) {
+            return;
+        }
+
+        const auto curRSS = getCurrentRSS();
+        const auto peakRSS = getPeakRSS();
+
+        int64_t startPeakRSS = peakRSS;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            const auto it = _startPeakRSS.find({pass, op});
+            if (it != _startPeakRSS.end()) {
+                startPeakRSS = it->second;
+                _startPeakRSS.erase(it);
+            }
+        }
+
+        _log.info("Pass {0} on Operation {1} : RSS {2} KB, peak RSS {3} KB (+{4} KB while running)",
+                  pass->getArgument(), op->getLoc(), curRSS, peakRSS, peakRSS - startPeakRSS);
+    }
+
+private:
+    Logger _log;
+
+    std::mutex _mutex;
+    llvm::DenseMap<std::pair<mlir::Pass*, mlir::Operation*>, int64_t> _startPeakRSS;
+};
+
+}  // namespace
+
+void vpux::addMemoryReport(mlir::PassManager& pm, Logger log) {
+    pm.addInstrumentation(std::make_unique<PassMemoryReport>(log));
+}
+
 //
 // OpBuilderLogger
 //
@@ -182,6 +182,19 @@ mlir::GreedyRewriteConfig vpux::getDefaultGreedyRewriteConfig() {
     return config;
 }
 
+//
+// populateCanonicalizationPatterns
+//
+
+void vpux::populateCanonicalizationPatterns(mlir::RewritePatternSet& patterns, mlir::MLIRContext* ctx) {
+    for (auto* dialect : ctx->getLoadedDialects()) {
+        dialect->getCanonicalizationPatterns(patterns);
+    }
+    for (auto op : ctx->getRegisteredOperations()) {
+        op.getCanonicalizationPatterns(patterns, ctx);
+    }
+}
+
 //
 // appendLoc
 //
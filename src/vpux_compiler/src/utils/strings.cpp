@@ -33,3 +33,18 @@ std::string vpux::stringifyLocation(mlir::Location location) {
 
     return ostr.str();
 }
+
+std::string vpux::getLayerName(mlir::Location location) {
+    std::string layerName;
+
+    location->walk([&](mlir::Location loc) {
+        if (const auto nameLoc = loc.dyn_cast<mlir::NameLoc>()) {
+            layerName = nameLoc.getName().str();
+            return mlir::WalkResult::interrupt();
+        }
+
+        return mlir::WalkResult::advance();
+    });
+
+    return layerName;
+}
@@ -12,6 +12,7 @@
 #include "vpux/utils/core/string_ref.hpp"
 #include "vpux_private_config.hpp"
 
+#include <mutex>
 #include <string>
 
 namespace vpux {
@@ -23,6 +24,7 @@ public:
 
     ExecutorImpl(InferenceEngine::VPUXConfigParams::VPUXPlatform platform, const NetworkDescription::Ptr& network,
                  const Config& config);
+    ~ExecutorImpl() override;
 
     NetworkDescription& getNetworkDesc() {
         return *_network.get();
@@ -41,6 +43,17 @@ public:
         std::string imdElfArg;
     };
 
+    bool isSessionMode() const {
+        return _sessionMode;
+    }
+
+    // Returns the directory holding the network blob shared by all infer requests of this executor.
+    // The directory is created and the blob is stored on the first call only.
+    StringRef getSessionDir();
+
+    // Returns the path to the network blob stored in the session directory.
+    std::string getSessionBlobPath();
+
 private:
     std::string getMoviToolsPath(const Config& config);
     std::string getSimicsPath(const Config& config);
@@ -57,6 +70,10 @@ private:
     InferenceManagerDemo _app;
 
     InferenceEngine::BlobMap _inputs;
+
+    bool _sessionMode = false;
+    SmallString _sessionDir;
+    std::once_flag _sessionOnceFlag;
 };
 
 }  // namespace IMD
@@ -16,7 +16,10 @@
 #include "vpux/utils/core/string_ref.hpp"
 #include "vpux_private_config.hpp"
 
+#include <llvm/Support/FileSystem.h>
+
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -44,6 +47,8 @@ public:
 
     void GetResult() override;
 
+    ~IMDInferRequest() override;
+
 private:
     SmallString createTempWorkDir();
     void storeNetworkBlob(StringRef workDir);
@@ -52,6 +57,11 @@ private:
     void readFromFile(const std::string& path, const InferenceEngine::MemoryBlob::Ptr& dataMemoryBlob);
     void loadNetworkOutputs(StringRef workDir, const InferenceEngine::BlobMap& outputs);
 
+    StringRef getSessionWorkDir(const InferenceEngine::BlobMap& inputs);
+    void mapSessionInputs(StringRef workDir, const InferenceEngine::BlobMap& inputs);
+    void copySessionInputs(const InferenceEngine::BlobMap& inputs);
+    void removeStaleOutputs(StringRef workDir);
+
     void pull(const InferenceEngine::BlobMap& inputs, InferenceEngine::BlobMap& outputs);
 
     const Executor::Ptr _executorPtr;
@@ -63,6 +73,11 @@ private:
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> _states{};
     std::once_flag _fillStatesOnceFlag;
     InferenceEngine::MemoryBlob::Ptr _rawProfilingData;
+
+    // Session mode state: the working directory lives as long as the request,
+    // the input files are mapped once and rewritten in place before each inference.
+    SmallString _sessionWorkDir;
+    std::vector<std::unique_ptr<llvm::sys::fs::mapped_file_region>> _sessionInputs;
 };
 
 LayerStatistics getLayerStatistics(const uint8_t* rawData, size_t dataSize, const std::vector<char>& blob);
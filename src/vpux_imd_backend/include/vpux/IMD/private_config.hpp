@@ -27,5 +27,8 @@ DECLARE_VPUX_IMD_CONFIG_VALUE(SIMULATOR);
 DECLARE_VPUX_IMD_CONFIG_VALUE(MOVI_DEBUG);
 DECLARE_VPUX_IMD_CONFIG_KEY(MV_RUN_TIMEOUT);
 
+// Keep the network blob and per-request working directories alive between inferences
+DECLARE_VPUX_IMD_CONFIG_KEY(SESSION_MODE);
+
 }  // namespace VPUXConfigParams
 }  // namespace InferenceEngine
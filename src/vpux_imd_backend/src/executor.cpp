@@ -244,6 +244,51 @@ void vpux::IMD::ExecutorImpl::parseAppConfig(VPUXPlatform platform, const Config
 
 vpux::IMD::ExecutorImpl::ExecutorImpl(VPUXPlatform platform, const NetworkDescription::Ptr& network,
                                       const Config& config)
-        : _network(network), _log("InferenceManagerDemo", config.get<LOG_LEVEL>()) {
+        : _network(network),
+          _log("InferenceManagerDemo", config.get<LOG_LEVEL>()),
+          _sessionMode(config.get<IMD::SESSION_MODE>()) {
     parseAppConfig(platform, config);
 }
+
+vpux::IMD::ExecutorImpl::~ExecutorImpl() {
+    if (_sessionDir.empty()) {
+        return;
+    }
+
+    _log.trace("Remove the session directory '{0}'...", _sessionDir);
+    const auto errc = llvm::sys::fs::remove_directories(_sessionDir);
+
+    if (errc) {
+        _log.error("Failed to remove session directory : {0}", errc.message());
+    }
+}
+
+//
+// Session
+//
+
+StringRef vpux::IMD::ExecutorImpl::getSessionDir() {
+    std::call_once(_sessionOnceFlag, [&]() {
+        _log.trace("Create the session directory...");
+
+        SmallString sessionDir;
+        const auto errc = llvm::sys::fs::createUniqueDirectory("vpux-IMD-session", sessionDir);
+        VPUX_THROW_WHEN(errc, "Failed to create session directory : {0}", errc.message());
+
+        const auto& compiledBlob = _network->getCompiledNetwork();
+        const auto blobPath = printToString("{0}/test.blob", sessionDir);
+        std::ofstream file(blobPath, std::ios::binary);
+        VPUX_THROW_UNLESS(file.is_open(), "Can't open file '{0}' for write", blobPath);
+        file.write(compiledBlob.data(), compiledBlob.size());
+        VPUX_THROW_UNLESS(file.good(), "Failed to write the network blob to '{0}'", blobPath);
+
+        _log.nest().trace("{0}", sessionDir);
+        _sessionDir = std::move(sessionDir);
+    });
+
+    return _sessionDir.str();
+}
+
+std::string vpux::IMD::ExecutorImpl::getSessionBlobPath() {
+    return printToString("{0}/test.blob", getSessionDir());
+}
@@ -5,8 +5,10 @@
 
 #include "vpux/IMD/infer_request.hpp"
 
+#include <algorithm>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -27,12 +29,15 @@
 #include "vpux/utils/IE/data_attributes_check.hpp"
 #include "vpux/utils/IE/itt.hpp"
 #include "vpux/utils/IE/prefix.hpp"
+#include "vpux/utils/core/array_ref.hpp"
 #include "vpux/utils/core/checked_cast.hpp"
 #include "vpux/utils/core/format.hpp"
 #include "vpux/utils/core/range.hpp"
 #include "vpux/utils/core/scope_exit.hpp"
 
 #include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Process.h>
 #include <llvm/Support/Program.h>
 
 namespace ie = InferenceEngine;
@@ -65,6 +70,13 @@ ie::Blob::Ptr allocateLocalBlob(const ie::TensorDesc& tensorDesc,
     blob->allocate();
     return blob;
 }
+
+// The application reads its inputs from the current working directory, which is a process-wide state.
+// Serialize the legacy launch path, so concurrent requests do not run in each other's directories.
+std::mutex& getCurrentPathMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
 }  // namespace
 
 SmallString IMD::IMDInferRequest::createTempWorkDir() {
@@ -127,24 +139,7 @@ void IMD::IMDInferRequest::storeNetworkInputs(StringRef workDir, const BlobMap&
 void IMD::IMDInferRequest::runApp(StringRef workDir) {
     _logger.trace("Run the application...");
 
-    SmallString curPath;
-    auto errc = llvm::sys::fs::current_path(curPath);
-    VPUX_THROW_WHEN(errc, "Failed to get current path : {0}", errc.message());
-
-    VPUX_SCOPE_EXIT {
-        _logger.nest().trace("Restore current working directory '{0}'...", curPath);
-        errc = llvm::sys::fs::set_current_path(curPath);
-
-        if (errc) {
-            _logger.error("Failed to restore current path : {0}", errc.message());
-        }
-    };
-
-    _logger.nest().trace("Change current working directory to the new temporary folder '{0}'...", workDir);
-    errc = llvm::sys::fs::set_current_path(workDir);
-    VPUX_THROW_WHEN(errc, "Failed to change current path : {0}", errc.message());
-
-    _logger.nest().trace("{0}", static_cast<ExecutorImpl*>(_executorPtr.get())->getApp().runArgs);
+    auto& app = static_cast<ExecutorImpl*>(_executorPtr.get())->getApp();
 
     const std::string emptyString = "";
     SmallVector<Optional<StringRef>> redirects = {
@@ -164,12 +159,50 @@ void IMD::IMDInferRequest::runApp(StringRef workDir) {
     }
 
     std::string errMsg;
-    const auto procErr = llvm::sys::ExecuteAndWait(
-            static_cast<ExecutorImpl*>(_executorPtr.get())->getApp().runProgram,
-            llvm::makeArrayRef(static_cast<ExecutorImpl*>(_executorPtr.get())->getApp().runArgs),
-            /*Env=*/None, llvm::makeArrayRef(redirects),
-            checked_cast<uint32_t>(static_cast<ExecutorImpl*>(_executorPtr.get())->getApp().timeoutSec),
-            /*MemoryLimit=*/0, &errMsg);
+    const auto execute = [&](StringRef program, ArrayRef<StringRef> args) {
+        _logger.nest().trace("{0}", args);
+
+        return llvm::sys::ExecuteAndWait(program, args, /*Env=*/None, llvm::makeArrayRef(redirects),
+                                         checked_cast<uint32_t>(app.timeoutSec),
+                                         /*MemoryLimit=*/0, &errMsg);
+    };
+
+#ifndef _WIN32
+    if (static_cast<ExecutorImpl*>(_executorPtr.get())->isSessionMode()) {
+        // Let the shell enter the working directory on behalf of the application,
+        // so the current path of this process stays untouched.
+        const auto shellPath = llvm::sys::findProgramByName("sh");
+        VPUX_THROW_UNLESS(shellPath, "Failed to locate shell : {0}", shellPath.getError().message());
+
+        SmallVector<StringRef> shellArgs = {"sh", "-c", "cd \"$0\" && exec \"$@\"", workDir};
+        shellArgs.append(app.runArgs.begin(), app.runArgs.end());
+
+        const auto procErr = execute(shellPath.get(), shellArgs);
+        VPUX_THROW_WHEN(procErr != 0, "Failed to run InferenceManagerDemo : {0}", errMsg);
+        return;
+    }
+#endif
+
+    std::lock_guard<std::mutex> lock(getCurrentPathMutex());
+
+    SmallString curPath;
+    auto errc = llvm::sys::fs::current_path(curPath);
+    VPUX_THROW_WHEN(errc, "Failed to get current path : {0}", errc.message());
+
+    VPUX_SCOPE_EXIT {
+        _logger.nest().trace("Restore current working directory '{0}'...", curPath);
+        errc = llvm::sys::fs::set_current_path(curPath);
+
+        if (errc) {
+            _logger.error("Failed to restore current path : {0}", errc.message());
+        }
+    };
+
+    _logger.nest().trace("Change current working directory to the new temporary folder '{0}'...", workDir);
+    errc = llvm::sys::fs::set_current_path(workDir);
+    VPUX_THROW_WHEN(errc, "Failed to change current path : {0}", errc.message());
+
+    const auto procErr = execute(app.runProgram, app.runArgs);
     VPUX_THROW_WHEN(procErr != 0, "Failed to run InferenceManagerDemo : {0}", errMsg);
 }
 
@@ -178,15 +211,15 @@ void IMD::IMDInferRequest::readFromFile(const std::string& path, const MemoryBlo
     const auto ptr = mem.as<char*>();
     VPUX_THROW_UNLESS(ptr != nullptr, "Blob was not allocated");
 
-    std::ifstream file(path, std::ios_base::binary | std::ios_base::ate);
-    VPUX_THROW_UNLESS(file.is_open(), "Can't open file '{0}' for reading", path);
+    // Large files are memory-mapped by the buffer, which saves an intermediate copy of the output
+    auto file = llvm::MemoryBuffer::getFile(path, /*IsText=*/false, /*RequiresNullTerminator=*/false);
+    VPUX_THROW_UNLESS(file, "Can't open file '{0}' for reading : {1}", path, file.getError().message());
 
-    const auto fileSize = static_cast<size_t>(file.tellg());
-    file.seekg(0, std::ios_base::beg);
+    const auto fileSize = file.get()->getBufferSize();
     VPUX_THROW_UNLESS(fileSize == dataMemoryBlob->byteSize(), "File '{0}' contains {1} bytes, but {2} expected", path,
                       fileSize, dataMemoryBlob->byteSize());
 
-    file.read(ptr, static_cast<std::streamsize>(dataMemoryBlob->byteSize()));
+    std::copy_n(file.get()->getBufferStart(), fileSize, ptr);
 }
 
 void IMD::IMDInferRequest::loadNetworkOutputs(StringRef workDir, const BlobMap& outputs) {
@@ -223,6 +256,107 @@ void IMD::IMDInferRequest::loadNetworkOutputs(StringRef workDir, const BlobMap&
     }
 }
 
+StringRef IMD::IMDInferRequest::getSessionWorkDir(const BlobMap& inputs) {
+    if (!_sessionWorkDir.empty()) {
+        return _sessionWorkDir.str();
+    }
+
+    auto executorPtr = static_cast<ExecutorImpl*>(_executorPtr.get());
+    const auto blobPath = executorPtr->getSessionBlobPath();
+
+    auto workDir = createTempWorkDir();
+
+    _logger.trace("Link the session network blob...");
+    const auto linkPath = printToString("{0}/test.blob", workDir);
+    auto errc = llvm::sys::fs::create_hard_link(blobPath, linkPath);
+    if (errc) {
+        _logger.nest().trace("Failed to create hard link : {0}, fall back to copy", errc.message());
+        errc = llvm::sys::fs::copy_file(blobPath, linkPath);
+        VPUX_THROW_WHEN(errc, "Failed to copy the network blob to '{0}' : {1}", linkPath, errc.message());
+    }
+
+    mapSessionInputs(workDir.str(), inputs);
+
+    _sessionWorkDir = std::move(workDir);
+    return _sessionWorkDir.str();
+}
+
+void IMD::IMDInferRequest::mapSessionInputs(StringRef workDir, const BlobMap& inputs) {
+    _logger.trace("Map the network inputs...");
+
+    const auto& networkDescriptor = static_cast<ExecutorImpl*>(_executorPtr.get())->getNetworkDesc();
+    const auto& deviceInputsInfo = networkDescriptor.getDeviceInputsInfo();
+
+    _sessionInputs.clear();
+    for (const auto& p : deviceInputsInfo | indexed) {
+        const auto& blobName = p.value().first;
+        const auto& inputData = inputs.at(blobName);
+        checkDataAttributesMatch(inputData->getTensorDesc(), p.value().second->getTensorDesc());
+
+        const auto byteSize = inputData->byteSize();
+        VPUX_THROW_WHEN(byteSize == 0, "Input '{0}' has zero size", blobName);
+
+        const auto inputFilePath = printToString("{0}/input-{1}.bin", workDir, p.index());
+
+        int fd = -1;
+        auto errc = llvm::sys::fs::openFileForReadWrite(inputFilePath, fd, llvm::sys::fs::CD_CreateAlways,
+                                                        llvm::sys::fs::OF_None);
+        VPUX_THROW_WHEN(errc, "Can't open file '{0}' for write : {1}", inputFilePath, errc.message());
+        VPUX_SCOPE_EXIT {
+            llvm::sys::Process::SafelyCloseFileDescriptor(fd);
+        };
+
+        errc = llvm::sys::fs::resize_file(fd, byteSize);
+        VPUX_THROW_WHEN(errc, "Can't resize file '{0}' : {1}", inputFilePath, errc.message());
+
+        auto region = std::make_unique<llvm::sys::fs::mapped_file_region>(
+                llvm::sys::fs::convertFDToNativeFile(fd), llvm::sys::fs::mapped_file_region::readwrite, byteSize,
+                /*offset=*/0, errc);
+        VPUX_THROW_WHEN(errc, "Can't map file '{0}' : {1}", inputFilePath, errc.message());
+
+        _sessionInputs.push_back(std::move(region));
+
+        _logger.nest().trace("{0} - {1}", blobName, inputFilePath);
+    }
+}
+
+void IMD::IMDInferRequest::copySessionInputs(const BlobMap& inputs) {
+    _logger.trace("Copy the network inputs to the mapped files...");
+
+    const auto& networkDescriptor = static_cast<ExecutorImpl*>(_executorPtr.get())->getNetworkDesc();
+    const auto& deviceInputsInfo = networkDescriptor.getDeviceInputsInfo();
+
+    for (const auto& p : deviceInputsInfo | indexed) {
+        const auto& blobName = p.value().first;
+        const auto& inputData = inputs.at(blobName);
+        auto& region = _sessionInputs[p.index()];
+
+        checkDataAttributesMatch(inputData->getTensorDesc(), p.value().second->getTensorDesc());
+
+        const auto& dataMemoryBlob = as<MemoryBlob>(inputData);
+        VPUX_THROW_UNLESS(dataMemoryBlob != nullptr, "Got non MemoryBlob");
+        VPUX_THROW_UNLESS(dataMemoryBlob->byteSize() == region->size(),
+                          "Input '{0}' contains {1} bytes, but {2} expected", blobName, dataMemoryBlob->byteSize(),
+                          region->size());
+
+        const auto mem = dataMemoryBlob->rmap();
+        const auto ptr = mem.as<const char*>();
+        VPUX_THROW_UNLESS(ptr != nullptr, "Blob was not allocated");
+
+        std::copy_n(ptr, region->size(), region->data());
+    }
+}
+
+void IMD::IMDInferRequest::removeStaleOutputs(StringRef workDir) {
+    const auto& networkDescriptor = static_cast<ExecutorImpl*>(_executorPtr.get())->getNetworkDesc();
+
+    // Do not let a failed run silently return the results of the previous one
+    for (auto ind : irange(networkDescriptor.getDeviceOutputsInfo().size())) {
+        llvm::sys::fs::remove(printToString("{0}/output-{1}.bin", workDir, ind));
+    }
+    llvm::sys::fs::remove(printToString("{0}/profiling-0.bin", workDir));
+}
+
 //------------------------------------------------------------------------------
 IMD::IMDInferRequest::IMDInferRequest(const ie::InputsDataMap& networkInputs, const ie::OutputsDataMap& networkOutputs,
                                       const Executor::Ptr& executor, const Config& config,
@@ -259,6 +393,21 @@ IMD::IMDInferRequest::IMDInferRequest(const ie::InputsDataMap& networkInputs, co
     }
 }
 
+IMD::IMDInferRequest::~IMDInferRequest() {
+    _sessionInputs.clear();
+
+    if (_sessionWorkDir.empty()) {
+        return;
+    }
+
+    _logger.trace("Remove the request working directory '{0}'...", _sessionWorkDir);
+    const auto errc = llvm::sys::fs::remove_directories(_sessionWorkDir);
+
+    if (errc) {
+        _logger.error("Failed to remove request working directory : {0}", errc.message());
+    }
+}
+
 void IMD::IMDInferRequest::pull(const BlobMap& inputs, BlobMap& outputs) {
     _logger.info("Run inference using InferenceManagerDemo application...");
     _logger = _logger.nest();
@@ -266,6 +415,16 @@ void IMD::IMDInferRequest::pull(const BlobMap& inputs, BlobMap& outputs) {
         _logger = _logger.unnest();
     };
 
+    if (static_cast<ExecutorImpl*>(_executorPtr.get())->isSessionMode()) {
+        const auto workDir = getSessionWorkDir(inputs);
+
+        removeStaleOutputs(workDir);
+        copySessionInputs(inputs);
+        runApp(workDir);
+        loadNetworkOutputs(workDir, outputs);
+        return;
+    }
+
     const auto workDir = createTempWorkDir();
     VPUX_SCOPE_EXIT {
         _logger.trace("Remove the temporary working directory '{0}'...", workDir);
@@ -7,24 +7,41 @@
 
 #include "cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp"
 #include "vpux.hpp"
+#include "vpux_dynamic_batcher.h"
+
+#include <memory>
 
 namespace vpux {
 
+class BatchCompletion;
+
 class AsyncInferRequest final : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
 public:
     using Ptr = std::shared_ptr<AsyncInferRequest>;
 
+    /**
+     * @param dynamicBatcher when set, the asynchronous inferences are run through it and may be batched with the
+     * inferences of other requests, the synchronous ones always run alone
+     */
     explicit AsyncInferRequest(const IInferRequest::Ptr& inferRequest,
                                const InferenceEngine::ITaskExecutor::Ptr& requestExecutor,
                                const InferenceEngine::ITaskExecutor::Ptr& getResultExecutor,
-                               const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor);
+                               const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor,
+                               const DynamicBatcher::Ptr& dynamicBatcher = nullptr);
     AsyncInferRequest(const AsyncInferRequest&) = delete;
     AsyncInferRequest& operator=(const AsyncInferRequest&) = delete;
     ~AsyncInferRequest();
 
+    inline const IInferRequest::Ptr& getSyncRequest() const {
+        return _inferRequest;
+    }
+
 private:
     IInferRequest::Ptr _inferRequest;
     InferenceEngine::ITaskExecutor::Ptr _getResultExecutor;
+    DynamicBatcher::Ptr _dynamicBatcher;
+    std::shared_ptr<BatchCompletion> _batchCompletion;
+    bool _isBatched = false;
 };
 
 }  // namespace vpux
@@ -27,6 +27,8 @@ public:
 
     std::shared_ptr<Device> getDevice(const std::string& specificName = "") const;
     std::shared_ptr<Device> getDevice(const InferenceEngine::ParamMap& paramMap) const;
+    /** @brief Returns all available devices of the platform, e.g. "3720.0", "3720.1" for "3720" */
+    std::vector<std::shared_ptr<Device>> getDevices(const std::string& platformName) const;
     std::vector<std::string> getAvailableDevicesNames() const;
     std::string getBackendName() const;
     void registerOptions(OptionsDesc& options) const;
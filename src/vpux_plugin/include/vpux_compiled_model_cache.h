@@ -0,0 +1,83 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+// System
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+// IE
+#include <ie_input_info.hpp>
+#include <openvino/core/model.hpp>
+
+// Plugin
+#include "vpux_compiler.hpp"
+
+#include "vpux/utils/IE/config.hpp"
+#include "vpux/utils/core/logger.hpp"
+
+namespace vpux {
+
+/**
+ * @brief Cache of the compiled models in a local directory (CACHE_DIR).
+ * @details Each entry is a compiled blob named after the key of the compilation:
+ * content hash of the serialized model, I/O metadata, compile-time options, platform and compiler version.
+ * Entries are written through a temporary file and renamed, so readers never observe partial blobs.
+ * Processes compiling the same model are serialized through a lock file, so the model is compiled only once.
+ * The total size of the cache is limited, least recently used entries are evicted first.
+ */
+class CompiledModelCache final {
+public:
+    CompiledModelCache(const std::string& cacheDir, int64_t maxSize, Logger log);
+
+    /**
+     * @brief Computes the key of the model compilation
+     * @param model the model to be compiled
+     * @param inputsInfo inputs metadata of the model, affects precision and layout of the compiled network inputs
+     * @param outputsInfo outputs metadata of the model
+     * @param isNewAPI whether the OpenVINO 2.0 API is used, defines which I/O metadata is used by the compiler
+     * @param config compilation config, the platform must be already resolved
+     */
+    static std::string computeKey(const std::shared_ptr<ov::Model>& model,
+                                  const InferenceEngine::InputsDataMap& inputsInfo,
+                                  const InferenceEngine::OutputsDataMap& outputsInfo, bool isNewAPI,
+                                  const Config& config);
+
+    /**
+     * @brief Computes the key of the model compilation by the given version of the compiler
+     */
+    static std::string computeKey(const std::shared_ptr<ov::Model>& model,
+                                  const InferenceEngine::InputsDataMap& inputsInfo,
+                                  const InferenceEngine::OutputsDataMap& outputsInfo, bool isNewAPI,
+                                  const Config& config, const std::string& compilerVersion);
+
+    using ParseCallback = std::function<NetworkDescription::Ptr(const std::vector<char>&)>;
+    using CompileCallback = std::function<NetworkDescription::Ptr()>;
+
+    /**
+     * @brief Returns the compiled network stored in the cache or compiles it and stores the result
+     * @param parse callback which parses the cached blob, throws if the blob is invalid
+     * @param compile callback which compiles the network on cache miss
+     */
+    NetworkDescription::Ptr getOrCompile(const std::string& key, const ParseCallback& parse,
+                                         const CompileCallback& compile);
+
+private:
+    std::string getBlobPath(const std::string& key) const;
+
+    NetworkDescription::Ptr load(const std::string& key, const ParseCallback& parse);
+    void store(const std::string& key, const std::vector<char>& blob);
+    void evict(const std::string& keepPath);
+
+private:
+    std::string _cacheDir;
+    int64_t _maxSize;
+    Logger _logger;
+};
+
+}  // namespace vpux
@@ -0,0 +1,96 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+// System
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+// IE
+#include <ie_blob.h>
+
+// Plugin
+#include "vpux.hpp"
+#include "vpux/utils/core/logger.hpp"
+#include "vpux/utils/plugin/request_coalescer.hpp"
+
+namespace vpux {
+
+namespace batching {
+
+/**
+ * @brief Checks that the blob of the batch 1 request is one slice of the batched blob
+ * @details Both must be memory blobs with the same precision and layout, the batched one being batchSize times larger
+ */
+bool isSlice(const InferenceEngine::Blob::Ptr& blob, const InferenceEngine::Blob::Ptr& batchedBlob, size_t batchSize);
+
+void copyToSlice(const InferenceEngine::Blob::Ptr& blob, const InferenceEngine::Blob::Ptr& batchedBlob, size_t slice);
+void copyFromSlice(const InferenceEngine::Blob::Ptr& batchedBlob, size_t slice, const InferenceEngine::Blob::Ptr& blob);
+
+}  // namespace batching
+
+/**
+ * @brief Runs batch 1 infer requests started close in time as one inference of the batched variant of the network
+ * @details The batched variant has the same inputs and outputs with the batch as the outermost dimension, so each
+ * request occupies a consecutive slice of the batched blobs. The slices not used by a partial batch keep stale data.
+ * Only the batched request is used by the batcher, one group at a time. A request left alone, or a group whose blobs
+ * do not match the batched ones (e.g. remote or compound blobs), is returned to the callers to be run by their own
+ * batch 1 pipelines.
+ * Without the batched variant, the requests of a group are passed to the submitter to be run together by the batch 1
+ * network, see IInferRequest::InferBatch.
+ */
+class DynamicBatcher final {
+public:
+    using Ptr = std::shared_ptr<DynamicBatcher>;
+    using BatchSubmitter = std::function<void(const std::vector<IInferRequest::Ptr>&)>;
+    using Completion = RequestCoalescer<IInferRequest::Ptr>::Completion;
+
+    DynamicBatcher(const IInferRequest::Ptr& batchedRequest, size_t batchSize, std::chrono::microseconds window,
+                   const std::vector<std::string>& inputNames, const std::vector<std::string>& outputNames,
+                   Logger log);
+    DynamicBatcher(BatchSubmitter submitBatch, size_t batchSize, std::chrono::microseconds window, Logger log);
+
+    DynamicBatcher(const DynamicBatcher&) = delete;
+    DynamicBatcher& operator=(const DynamicBatcher&) = delete;
+
+    /**
+     * @brief Queues the request without blocking
+     * @details `done` is called by the batcher threads once the outputs of the request are written by the batched
+     * inference, or with false if the request must be run alone. It must not throw.
+     * @note The request must not be used until `done` is called
+     */
+    void submit(const IInferRequest::Ptr& request, Completion done);
+
+    /**
+     * @brief Queues the request
+     * @return The future set to true once the outputs of the request are written by the batched inference, or to
+     * false if the request must be run alone
+     * @note The request must not be used until the future is ready
+     */
+    std::future<bool> submit(const IInferRequest::Ptr& request);
+
+    CoalescingStats getStats() const;
+
+private:
+    bool isBatchable(const std::vector<IInferRequest::Ptr>& requests) const;
+    bool runBatch(const std::vector<IInferRequest::Ptr>& requests);
+
+    IInferRequest::Ptr _batchedRequest;
+    BatchSubmitter _submitBatch;
+    const size_t _batchSize;
+    const std::vector<std::string> _inputNames;
+    const std::vector<std::string> _outputNames;
+    Logger _logger;
+
+    // Declared last, so its thread is joined before the batched request is released
+    RequestCoalescer<IInferRequest::Ptr> _coalescer;
+};
+
+}  // namespace vpux
@@ -6,7 +6,9 @@
 #pragma once
 
 // System
+#include <map>
 #include <memory>
+#include <mutex>
 #include <queue>
 #include <string>
 #include <vector>
@@ -17,6 +19,8 @@
 // Plugin
 #include "vpux.hpp"
 #include "vpux/utils/core/logger.hpp"
+#include "vpux_dynamic_batcher.h"
+#include "vpux_request_balancer.h"
 
 namespace vpux {
 
@@ -27,7 +31,7 @@ public:
     /**
      * @brief Executable network constructor
      * @param network InferenceEngine neural network object
-     * @param device pointer to device object
+     * @param devices devices to run inferences on, infer requests are distributed between them
      * @param config config object connecting configuration with which network is compiled
      * @param isNewAPI Set to "true" if the OpenVINO 2.0 API is being used or "false" in the 1.0 case.
      * The information is used for flagging the need of transferring I/O metadata information from the
@@ -38,19 +42,21 @@ public:
      * of ExecutableNetwork (i.e. until network is compiled) and after ExecutableNetwork is created,
      * all of the supplied properties are switched to read-only mode.
      */
-    explicit ExecutableNetwork(const InferenceEngine::CNNNetwork& network, const Device::Ptr& device,
+    explicit ExecutableNetwork(const InferenceEngine::CNNNetwork& network, const std::vector<Device::Ptr>& devices,
                                const Config& config, const bool& isNewAPI);
 
     /**
      * @brief Executable network constructor, imports network from file
      * @param networkModel input stream, to import network from
-     * @param device pointer to device object
+     * @param devices devices to run inferences on, infer requests are distributed between them
      * @param config config object connecting configuration with which network is imported
+     * @param blobSource reads the imported blob again, allows to release its host copy after the executors creation
      * @note properties supplied through config parameter, are mutable during the creation
      * of ExecutableNetwork (i.e. until network is compiled) and after ExecutableNetwork is created,
      * all of the supplied properties are switched to read-only mode.
      */
-    explicit ExecutableNetwork(std::istream& networkModel, const Device::Ptr& device, const Config& config);
+    explicit ExecutableNetwork(std::istream& networkModel, const std::vector<Device::Ptr>& devices,
+                               const Config& config, const NetworkDescription::BlobSource& blobSource = {});
 
     ExecutableNetwork(const ExecutableNetwork&) = delete;
     ExecutableNetwork(ExecutableNetwork&&) = delete;
@@ -63,6 +69,13 @@ public:
             const InferenceEngine::OutputsDataMap networkOutputs) override;
     InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
 
+    /**
+     * @brief Synchronously runs independent infer requests created by this network
+     * @details Requests created for the same device are submitted together, see IInferRequest::InferBatch.
+     * None of the requests may be running when the batch is started.
+     */
+    void InferBatch(const std::vector<InferenceEngine::IInferRequestInternal::Ptr>& requests);
+
     void Export(std::ostream& model) override;
     void Export(const std::string& modelFileName) override;
 
@@ -79,9 +92,16 @@ public:
     InferenceEngine::Parameter GetConfig(const std::string& name) const override;
 
 private:
-    explicit ExecutableNetwork(const Config& config, const Device::Ptr& device);
+    explicit ExecutableNetwork(const Config& config, const std::vector<Device::Ptr>& devices);
     Executor::Ptr createExecutor(const NetworkDescription::Ptr& network, const Config& config,
                                  const Device::Ptr& device);
+    void createExecutors();
+    void releaseCompiledNetwork(const NetworkDescription::BlobSource& blobSource);
+    NetworkDescription::Ptr compileBatchedNetwork(const InferenceEngine::CNNNetwork& orignet, bool isNewAPI);
+    void createDynamicBatcher();
+    void inferDeviceBatches(const std::vector<IInferRequest::Ptr>& requests);
+    uint32_t getOptimalNumberOfInferRequests(const Config& config) const;
+    std::map<std::string, uint64_t> getDynamicBatchingStats() const;
 
 private:
     void ConfigureStreamsExecutor(const std::string& networkName);
@@ -93,12 +113,18 @@ private:
 
     const Config _config;
     Logger _logger;
-    const Device::Ptr _device;
+    const std::vector<Device::Ptr> _devices;
     std::string _networkName;
 
     Compiler::Ptr _compiler = nullptr;
     NetworkDescription::Ptr _networkPtr = nullptr;
-    Executor::Ptr _executorPtr;
+    std::vector<Executor::Ptr> _executors;  //!< One executor per device, in the order of _devices
+    // Variant of the network with the DYNAMIC_BATCH_SIZE batch, the batcher is created with the first infer request.
+    // Without it, the batcher submits the grouped batch 1 requests together.
+    NetworkDescription::Ptr _batchedNetworkPtr = nullptr;
+    DynamicBatcher::Ptr _dynamicBatcher = nullptr;
+    std::once_flag _dynamicBatcherCreated;
+    InferRequestBalancer _requestBalancer;
     std::vector<std::string> _supportedMetrics;
     // properties map: {name -> [supported, mutable, eval function]}
     std::map<std::string,
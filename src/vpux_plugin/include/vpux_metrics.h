@@ -35,6 +35,7 @@ public:
     std::string GetBackendName() const;
     uint64_t GetDeviceTotalMemSize(const std::string& specifiedDeviceName) const;
     uint32_t GetDriverVersion(const std::string& specifiedDeviceName) const;
+    std::map<std::string, uint64_t> GetQueueingDelays(const std::string& specifiedDeviceName) const;
 
     std::vector<ov::PropertyName> GetCachingProperties() const;
 
@@ -72,9 +72,13 @@ public:
 
 private:
     InferenceEngine::IExecutableNetworkInternal::Ptr LoadExeNetwork(const InferenceEngine::CNNNetwork& network,
-                                                                    std::shared_ptr<Device>& device,
+                                                                    const std::vector<std::shared_ptr<Device>>& devices,
                                                                     const Config& networkConfig);
 
+    InferenceEngine::IExecutableNetworkInternal::Ptr ImportExeNetwork(
+            std::istream& networkModel, const std::map<std::string, std::string>& config,
+            const NetworkDescription::BlobSource& blobSource);
+
 private:
     std::shared_ptr<OptionsDesc> _options;
     Config _globalConfig;
@@ -0,0 +1,50 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+// System
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// IE
+#include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+
+namespace vpux {
+
+/**
+ * @brief Distributes the infer requests of an executable network between its devices
+ * @details Requests are bound to the device pipeline at creation, so the load is balanced by the number of live
+ * requests of each device. The destroyed requests are dropped on the next creation.
+ */
+class InferRequestBalancer final {
+public:
+    using RequestFactory = std::function<InferenceEngine::IInferRequestInternal::Ptr(size_t deviceIndex)>;
+
+    explicit InferRequestBalancer(size_t numDevices);
+
+    /**
+     * @brief Creates the request for the device with the fewest live requests
+     * @details The device is selected and the request is registered at once, so the requests created concurrently
+     * are spread between the devices too
+     */
+    InferenceEngine::IInferRequestInternal::Ptr createRequest(const RequestFactory& factory);
+
+    /// Returns the index of the device with the fewest live requests
+    size_t selectDevice();
+
+    /// Returns the index of the device the request was created for
+    size_t getDeviceIndex(const InferenceEngine::IInferRequestInternal::Ptr& request) const;
+
+private:
+    size_t selectDeviceImpl();
+
+    std::vector<std::vector<std::weak_ptr<InferenceEngine::IInferRequestInternal>>> _deviceRequests;
+    mutable std::mutex _mutex;
+};
+
+}  // namespace vpux
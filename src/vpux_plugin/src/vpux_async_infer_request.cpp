@@ -5,16 +5,92 @@
 
 #include "vpux_async_infer_request.h"
 
+#include <exception>
+#include <mutex>
+#include <utility>
+
+#include <threading/ie_itask_executor.hpp>
+
 namespace vpux {
 namespace ie = InferenceEngine;
 
+/**
+ * @brief Runs the pipeline stage once the dynamic batcher completes the request
+ * @details The stage is run by the thread which completes the request or by the one which schedules the stage,
+ * whichever comes last, so no thread of the network waits for the batch.
+ */
+class BatchCompletion final : public ie::ITaskExecutor {
+public:
+    void run(ie::Task task) override {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (!_completed) {
+            _task = std::move(task);
+            return;
+        }
+        _completed = false;
+        lock.unlock();
+        task();
+    }
+
+    // Called by the batcher threads
+    void complete(bool isBatched, std::exception_ptr error) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _isBatched = isBatched;
+        _error = error;
+        if (_task == nullptr) {
+            _completed = true;
+            return;
+        }
+        auto task = std::move(_task);
+        _task = nullptr;
+        lock.unlock();
+        task();
+    }
+
+    // Called by the stage, rethrows the error of the batch
+    bool isBatched() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_error != nullptr) {
+            std::rethrow_exception(std::exchange(_error, nullptr));
+        }
+        return _isBatched;
+    }
+
+private:
+    std::mutex _mutex;
+    ie::Task _task;
+    bool _completed = false;
+    bool _isBatched = false;
+    std::exception_ptr _error;
+};
+
 // clang-format off
 AsyncInferRequest::AsyncInferRequest(const IInferRequest::Ptr &inferRequest,
                                      const ie::ITaskExecutor::Ptr &requestExecutor,
                                      const ie::ITaskExecutor::Ptr &getResultExecutor,
-                                     const ie::ITaskExecutor::Ptr &callbackExecutor)
+                                     const ie::ITaskExecutor::Ptr &callbackExecutor,
+                                     const DynamicBatcher::Ptr &dynamicBatcher)
         : ie::AsyncInferRequestThreadSafeDefault(inferRequest, requestExecutor, callbackExecutor),
-          _inferRequest(inferRequest), _getResultExecutor(getResultExecutor) {
+          _inferRequest(inferRequest), _getResultExecutor(getResultExecutor), _dynamicBatcher(dynamicBatcher) {
+    if (_dynamicBatcher != nullptr) {
+        // Neither the submission nor the completion blocks an executor of the network, they are shared with the other
+        // requests to be batched. A request which is not batched goes through the same stages as without the batcher,
+        // so it runs concurrently with the batches and with the other requests.
+        _batchCompletion = std::make_shared<BatchCompletion>();
+        _pipeline = {
+                {_requestExecutor,   [this] {
+                    const auto completion = _batchCompletion;
+                    _dynamicBatcher->submit(_inferRequest, [completion](bool isBatched, std::exception_ptr error) {
+                        completion->complete(isBatched, error);
+                    });
+                }},
+                {_batchCompletion,   [this] { _isBatched = _batchCompletion->isBatched(); }},
+                {_requestExecutor,   [this] { if (!_isBatched) { _inferRequest->InferAsync(); } }},
+                {_getResultExecutor, [this] { if (!_isBatched) { _inferRequest->GetResult(); } }}
+        };
+        return;
+    }
+
     _pipeline = {
             {_requestExecutor,       [this] { _inferRequest->InferAsync(); }},
             {_getResultExecutor,     [this] { _inferRequest->GetResult(); }}
@@ -123,6 +123,16 @@ std::shared_ptr<Device> VPUXBackends::getDevice(const ie::ParamMap& paramMap) co
     return _backend->getDevice(paramMap);
 }
 
+std::vector<std::shared_ptr<Device>> VPUXBackends::getDevices(const std::string& platformName) const {
+    std::vector<std::shared_ptr<Device>> devices;
+    for (const auto& name : utils::getPlatformDeviceNames(platformName, getAvailableDevicesNames())) {
+        if (auto device = getDevice(name)) {
+            devices.push_back(std::move(device));
+        }
+    }
+    return devices;
+}
+
 std::vector<std::string> VPUXBackends::getAvailableDevicesNames() const {
     return _backend == nullptr ? std::vector<std::string>() : _backend->getDeviceNames();
 }
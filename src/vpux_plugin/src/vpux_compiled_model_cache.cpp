@@ -0,0 +1,342 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+// System
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+#include <streambuf>
+
+// IE
+#include <openvino/pass/manager.hpp>
+#include <openvino/pass/serialize.hpp>
+
+// LLVM
+#include <llvm/ADT/SmallString.h>
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/LockFileManager.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Path.h>
+#include <llvm/Support/Process.h>
+#include <llvm/Support/SHA1.h>
+#include <llvm/Support/raw_ostream.h>
+
+// Plugin
+#include "version.hpp"
+#include "vpux/al/config/common.hpp"
+#include "vpux/utils/IE/itt.hpp"
+#include "vpux/utils/core/error.hpp"
+#include "vpux_compiled_model_cache.h"
+
+namespace vpux {
+namespace ie = InferenceEngine;
+
+//------------------------------------------------------------------------------
+//      Helpers
+//------------------------------------------------------------------------------
+namespace {
+
+constexpr llvm::StringLiteral BLOB_PREFIX = "npu_";
+constexpr llvm::StringLiteral BLOB_EXTENSION = ".blob";
+constexpr llvm::StringLiteral TEMP_SUFFIX = ".tmp-";
+
+// Time to wait for another process compiling the same model, big models are compiled for several minutes
+constexpr unsigned LOCK_WAIT_SECONDS = 30 * 60;
+
+// Temporary files older than that are left by crashed processes
+constexpr auto STALE_TEMP_FILE_AGE = std::chrono::hours(1);
+
+// Feeds everything written to the stream into the hasher, so the serialized model is never kept in memory
+class HashingStreamBuf final : public std::streambuf {
+public:
+    explicit HashingStreamBuf(llvm::SHA1& hasher): _hasher(hasher) {
+    }
+
+protected:
+    int_type overflow(int_type ch) override {
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+            const auto byte = static_cast<uint8_t>(ch);
+            _hasher.update(llvm::ArrayRef<uint8_t>(&byte, 1));
+        }
+        return traits_type::not_eof(ch);
+    }
+
+    std::streamsize xsputn(const char* data, std::streamsize size) override {
+        _hasher.update(llvm::ArrayRef<uint8_t>(reinterpret_cast<const uint8_t*>(data), static_cast<size_t>(size)));
+        return size;
+    }
+
+private:
+    llvm::SHA1& _hasher;
+};
+
+void hashModel(const std::shared_ptr<ov::Model>& model, llvm::SHA1& hasher) {
+    llvm::SHA1 xmlHasher;
+    llvm::SHA1 binHasher;
+
+    HashingStreamBuf xmlBuf(xmlHasher);
+    HashingStreamBuf binBuf(binHasher);
+    std::ostream xmlStream(&xmlBuf);
+    std::ostream binStream(&binBuf);
+
+    ov::pass::Manager manager;
+    manager.register_pass<ov::pass::Serialize>(xmlStream, binStream);
+    manager.run_passes(model);
+
+    hasher.update(llvm::toHex(xmlHasher.final()));
+    hasher.update(llvm::toHex(binHasher.final()));
+}
+
+std::string printDims(const ie::SizeVector& dims) {
+    std::ostringstream stream;
+    for (const auto dim : dims) {
+        stream << dim << "x";
+    }
+    return stream.str();
+}
+
+// Options which don't affect the compiled blob
+bool isIgnoredOption(const std::string& key) {
+    return key == CACHE_DIR::key() || key == CACHE_MAX_SIZE::key() || key == LOG_LEVEL::key();
+}
+
+void touchFile(const std::string& path) {
+    int fd = -1;
+    if (llvm::sys::fs::openFileForReadWrite(path, fd, llvm::sys::fs::CD_OpenExisting, llvm::sys::fs::OF_None)) {
+        return;
+    }
+
+    const auto now = std::chrono::time_point_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now());
+    llvm::sys::fs::setLastAccessAndModificationTime(fd, now);
+    llvm::sys::Process::SafelyCloseFileDescriptor(fd);
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+//      CompiledModelCache
+//------------------------------------------------------------------------------
+CompiledModelCache::CompiledModelCache(const std::string& cacheDir, int64_t maxSize, Logger log)
+        : _cacheDir(cacheDir), _maxSize(maxSize), _logger(log.nest("CompiledModelCache", 0)) {
+    const auto err = llvm::sys::fs::create_directories(_cacheDir);
+    VPUX_THROW_WHEN(err, "Failed to create cache directory '{0}' : {1}", _cacheDir, err.message());
+}
+
+std::string CompiledModelCache::computeKey(const std::shared_ptr<ov::Model>& model, const ie::InputsDataMap& inputsInfo,
+                                           const ie::OutputsDataMap& outputsInfo, bool isNewAPI,
+                                           const Config& config) {
+    return computeKey(model, inputsInfo, outputsInfo, isNewAPI, config, VPUX_PLUGIN_VERSION);
+}
+
+std::string CompiledModelCache::computeKey(const std::shared_ptr<ov::Model>& model, const ie::InputsDataMap& inputsInfo,
+                                           const ie::OutputsDataMap& outputsInfo, bool isNewAPI, const Config& config,
+                                           const std::string& compilerVersion) {
+    OV_ITT_SCOPED_TASK(itt::domains::VPUXPlugin, "CompiledModelCache::computeKey");
+
+    llvm::SHA1 hasher;
+    hashModel(model, hasher);
+
+    std::ostringstream metadata;
+    metadata << "new_api=" << isNewAPI << ";";
+    for (const auto& input : inputsInfo) {
+        const auto& desc = input.second->getTensorDesc();
+        metadata << "in:" << input.first << ":" << desc.getPrecision() << ":" << desc.getLayout() << ":"
+                 << printDims(desc.getDims()) << ";";
+    }
+    for (const auto& output : outputsInfo) {
+        const auto& desc = output.second->getTensorDesc();
+        metadata << "out:" << output.first << ":" << desc.getPrecision() << ":" << desc.getLayout() << ":"
+                 << printDims(desc.getDims()) << ";";
+    }
+    hasher.update(metadata.str());
+
+    std::ostringstream options;
+    for (const auto& option : config.toMap(OptionMode::CompileTime)) {
+        if (!isIgnoredOption(option.first)) {
+            options << option.first << "=" << option.second << ";";
+        }
+    }
+    hasher.update(options.str());
+
+    hasher.update(compilerVersion);
+
+    return llvm::toHex(hasher.final(), /*LowerCase=*/true);
+}
+
+std::string CompiledModelCache::getBlobPath(const std::string& key) const {
+    llvm::SmallString<128> path(_cacheDir);
+    llvm::sys::path::append(path, BLOB_PREFIX.str() + key + BLOB_EXTENSION.str());
+    return path.str().str();
+}
+
+NetworkDescription::Ptr CompiledModelCache::getOrCompile(const std::string& key, const ParseCallback& parse,
+                                                         const CompileCallback& compile) {
+    if (auto network = load(key, parse)) {
+        return network;
+    }
+
+    const auto blobPath = getBlobPath(key);
+
+    llvm::LockFileManager lock(blobPath);
+    switch (lock.getState()) {
+    case llvm::LockFileManager::LFS_Owned: {
+        // The entry might be stored by another process between the lookup and the lock
+        if (auto network = load(key, parse)) {
+            return network;
+        }
+        break;
+    }
+    case llvm::LockFileManager::LFS_Shared: {
+        _logger.info("Model is being compiled by another process, waiting for '{0}'", blobPath);
+        if (lock.waitForUnlock(LOCK_WAIT_SECONDS) == llvm::LockFileManager::Res_Success) {
+            if (auto network = load(key, parse)) {
+                return network;
+            }
+        }
+        _logger.warning("Compiled model was not provided by another process, compiling it");
+        break;
+    }
+    case llvm::LockFileManager::LFS_Error:
+    default:
+        _logger.warning("Failed to lock cache entry '{0}' : {1}", blobPath, lock.getErrorMessage());
+        break;
+    }
+
+    auto network = compile();
+    store(key, network->getCompiledNetwork());
+    return network;
+}
+
+NetworkDescription::Ptr CompiledModelCache::load(const std::string& key, const ParseCallback& parse) {
+    OV_ITT_SCOPED_TASK(itt::domains::VPUXPlugin, "CompiledModelCache::load");
+
+    const auto blobPath = getBlobPath(key);
+
+    auto buffer = llvm::MemoryBuffer::getFile(blobPath);
+    if (!buffer) {
+        return nullptr;
+    }
+
+    const std::vector<char> blob(buffer.get()->getBufferStart(), buffer.get()->getBufferEnd());
+    buffer->reset();
+
+    try {
+        auto network = parse(blob);
+
+        // Modification time is used as the last use time for eviction
+        touchFile(blobPath);
+
+        _logger.info("Compiled model is loaded from '{0}'", blobPath);
+        return network;
+    } catch (const std::exception& ex) {
+        _logger.warning("Cache entry '{0}' is invalid and will be removed : {1}", blobPath, ex.what());
+        llvm::sys::fs::remove(blobPath);
+        return nullptr;
+    }
+}
+
+void CompiledModelCache::store(const std::string& key, const std::vector<char>& blob) {
+    OV_ITT_SCOPED_TASK(itt::domains::VPUXPlugin, "CompiledModelCache::store");
+
+    const auto blobPath = getBlobPath(key);
+
+    // Write to a temporary file and rename it, so other processes never read partially written blob
+    int fd = -1;
+    llvm::SmallString<128> tempPath;
+    if (const auto err = llvm::sys::fs::createUniqueFile(blobPath + TEMP_SUFFIX.str() + "%%%%%%%%", fd, tempPath)) {
+        _logger.warning("Failed to create temporary file for '{0}' : {1}", blobPath, err.message());
+        return;
+    }
+
+    {
+        llvm::raw_fd_ostream stream(fd, /*shouldClose=*/true);
+        stream.write(blob.data(), blob.size());
+        stream.close();
+
+        if (stream.has_error()) {
+            _logger.warning("Failed to write '{0}' : {1}", tempPath, stream.error().message());
+            stream.clear_error();
+            llvm::sys::fs::remove(tempPath);
+            return;
+        }
+    }
+
+    if (const auto err = llvm::sys::fs::rename(tempPath, blobPath)) {
+        _logger.warning("Failed to rename '{0}' to '{1}' : {2}", tempPath, blobPath, err.message());
+        llvm::sys::fs::remove(tempPath);
+        return;
+    }
+
+    _logger.info("Compiled model is stored to '{0}'", blobPath);
+
+    evict(blobPath);
+}
+
+void CompiledModelCache::evict(const std::string& keepPath) {
+    struct Entry final {
+        std::string path;
+        uint64_t size;
+        llvm::sys::TimePoint<> lastUse;
+    };
+
+    const auto now = std::chrono::system_clock::now();
+
+    std::vector<Entry> entries;
+    uint64_t totalSize = 0;
+
+    std::error_code err;
+    for (llvm::sys::fs::directory_iterator it(_cacheDir, err), end; it != end && !err; it.increment(err)) {
+        const auto& path = it->path();
+        const auto fileName = llvm::sys::path::filename(path);
+        if (!fileName.startswith(BLOB_PREFIX)) {
+            continue;
+        }
+
+        llvm::sys::fs::file_status status;
+        if (llvm::sys::fs::status(path, status)) {
+            continue;
+        }
+
+        if (fileName.contains(TEMP_SUFFIX)) {
+            if (now - status.getLastModificationTime() > STALE_TEMP_FILE_AGE) {
+                llvm::sys::fs::remove(path);
+            }
+            continue;
+        }
+
+        if (!fileName.endswith(BLOB_EXTENSION)) {
+            continue;
+        }
+
+        entries.push_back({path, status.getSize(), status.getLastModificationTime()});
+        totalSize += status.getSize();
+    }
+
+    if (_maxSize == 0 || totalSize <= static_cast<uint64_t>(_maxSize)) {
+        return;
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const Entry& lhs, const Entry& rhs) {
+        return lhs.lastUse < rhs.lastUse;
+    });
+
+    for (const auto& entry : entries) {
+        if (totalSize <= static_cast<uint64_t>(_maxSize)) {
+            break;
+        }
+        if (entry.path == keepPath) {
+            continue;
+        }
+
+        // Removal may fail if the entry is being read by another process, it will be evicted next time
+        if (!llvm::sys::fs::remove(entry.path)) {
+            _logger.debug("Evicted '{0}' from the cache", entry.path);
+            totalSize -= entry.size;
+        }
+    }
+}
+
+}  // namespace vpux
@@ -0,0 +1,132 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux_dynamic_batcher.h"
+
+// System
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+// IE
+#include <ie_blob.h>
+
+// Plugin
+#include "vpux/utils/IE/itt.hpp"
+
+namespace vpux {
+namespace ie = InferenceEngine;
+
+namespace batching {
+
+bool isSlice(const ie::Blob::Ptr& blob, const ie::Blob::Ptr& batchedBlob, size_t batchSize) {
+    if (ie::as<ie::MemoryBlob>(blob) == nullptr || ie::as<ie::MemoryBlob>(batchedBlob) == nullptr) {
+        return false;
+    }
+
+    const auto& desc = blob->getTensorDesc();
+    const auto& batchedDesc = batchedBlob->getTensorDesc();
+    return desc.getPrecision() == batchedDesc.getPrecision() && desc.getLayout() == batchedDesc.getLayout() &&
+           blob->byteSize() * batchSize == batchedBlob->byteSize();
+}
+
+void copyToSlice(const ie::Blob::Ptr& blob, const ie::Blob::Ptr& batchedBlob, size_t slice) {
+    const auto size = blob->byteSize();
+    const auto src = ie::as<ie::MemoryBlob>(blob)->rmap();
+    const auto dst = ie::as<ie::MemoryBlob>(batchedBlob)->wmap();
+    std::memcpy(dst.as<uint8_t*>() + slice * size, src.as<const uint8_t*>(), size);
+}
+
+void copyFromSlice(const ie::Blob::Ptr& batchedBlob, size_t slice, const ie::Blob::Ptr& blob) {
+    const auto size = blob->byteSize();
+    const auto src = ie::as<ie::MemoryBlob>(batchedBlob)->rmap();
+    const auto dst = ie::as<ie::MemoryBlob>(blob)->wmap();
+    std::memcpy(dst.as<uint8_t*>(), src.as<const uint8_t*>() + slice * size, size);
+}
+
+}  // namespace batching
+
+DynamicBatcher::DynamicBatcher(const IInferRequest::Ptr& batchedRequest, size_t batchSize,
+                               std::chrono::microseconds window, const std::vector<std::string>& inputNames,
+                               const std::vector<std::string>& outputNames, Logger log)
+        : _batchedRequest(batchedRequest),
+          _batchSize(batchSize),
+          _inputNames(inputNames),
+          _outputNames(outputNames),
+          _logger(log.nest("DynamicBatcher", 0)),
+          _coalescer(batchSize, window, [this](const std::vector<IInferRequest::Ptr>& requests) {
+              return runBatch(requests);
+          }) {
+    VPUX_THROW_WHEN(_batchedRequest == nullptr, "Batched infer request is not created");
+}
+
+DynamicBatcher::DynamicBatcher(BatchSubmitter submitBatch, size_t batchSize, std::chrono::microseconds window,
+                               Logger log)
+        : _submitBatch(std::move(submitBatch)),
+          _batchSize(batchSize),
+          _logger(log.nest("DynamicBatcher", 0)),
+          _coalescer(batchSize, window, [this](const std::vector<IInferRequest::Ptr>& requests) {
+              return runBatch(requests);
+          }) {
+    VPUX_THROW_WHEN(_submitBatch == nullptr, "Batch submitter is not set");
+}
+
+void DynamicBatcher::submit(const IInferRequest::Ptr& request, Completion done) {
+    _coalescer.submit(request, std::move(done));
+}
+
+std::future<bool> DynamicBatcher::submit(const IInferRequest::Ptr& request) {
+    return _coalescer.submit(request);
+}
+
+CoalescingStats DynamicBatcher::getStats() const {
+    return _coalescer.getStats();
+}
+
+bool DynamicBatcher::isBatchable(const std::vector<IInferRequest::Ptr>& requests) const {
+    const auto isSliceOfBatched = [&](const std::string& name) {
+        const auto batchedBlob = _batchedRequest->GetBlob(name);
+        return std::all_of(requests.begin(), requests.end(), [&](const IInferRequest::Ptr& request) {
+            return batching::isSlice(request->GetBlob(name), batchedBlob, _batchSize);
+        });
+    };
+    return std::all_of(_inputNames.begin(), _inputNames.end(), isSliceOfBatched) &&
+           std::all_of(_outputNames.begin(), _outputNames.end(), isSliceOfBatched);
+}
+
+bool DynamicBatcher::runBatch(const std::vector<IInferRequest::Ptr>& requests) {
+    OV_ITT_SCOPED_TASK(itt::domains::VPUXPlugin, "DynamicBatcher::runBatch");
+
+    if (_batchedRequest == nullptr) {
+        _submitBatch(requests);
+        return true;
+    }
+
+    if (!isBatchable(requests)) {
+        _logger.debug("Blobs of {0} requests do not match the batched network, they are run one by one",
+                      requests.size());
+        return false;
+    }
+
+    for (const auto& name : _inputNames) {
+        const auto batchedBlob = _batchedRequest->GetBlob(name);
+        for (size_t slice = 0; slice < requests.size(); ++slice) {
+            batching::copyToSlice(requests[slice]->GetBlob(name), batchedBlob, slice);
+        }
+    }
+
+    _batchedRequest->InferAsync();
+    _batchedRequest->GetResult();
+
+    for (const auto& name : _outputNames) {
+        const auto batchedBlob = _batchedRequest->GetBlob(name);
+        for (size_t slice = 0; slice < requests.size(); ++slice) {
+            batching::copyFromSlice(batchedBlob, slice, requests[slice]->GetBlob(name));
+        }
+    }
+    return true;
+}
+
+}  // namespace vpux
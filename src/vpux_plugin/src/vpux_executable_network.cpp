@@ -4,6 +4,7 @@
 //
 
 // System
+#include <algorithm>
 #include <fstream>
 
 #include <ie_icore.hpp>
@@ -20,6 +21,7 @@
 #include "vpux/utils/IE/itt.hpp"
 #include "vpux/utils/IE/prefix.hpp"
 #include "vpux_async_infer_request.h"
+#include "vpux_compiled_model_cache.h"
 #include "vpux_exceptions.h"
 #include "vpux_executable_network.h"
 
@@ -38,6 +40,17 @@ namespace ie = InferenceEngine;
 //      Helpers
 //------------------------------------------------------------------------------
 namespace {
+bool isCompiledModelCacheEnabled(const Config& config) {
+    // The driver compiler has its own cache
+    return !config.get<CACHE_DIR>().empty() &&
+           config.get<COMPILER_TYPE>() == cvtCompilerType(ov::intel_vpux::CompilerType::MLIR);
+}
+
+bool isDynamicBatchingEnabled(const Config& config) {
+    return config.get<DYNAMIC_BATCH_SIZE>() != 0 &&
+           config.get<PERFORMANCE_HINT>() == ov::hint::PerformanceMode::THROUGHPUT;
+}
+
 std::vector<InferenceEngine::Blob::Ptr> CreateBlobsForStates(const vpux::NetworkIOVector& networkStatesInfo) {
     std::vector<InferenceEngine::Blob::Ptr> states;
     for (auto& stateInfo : networkStatesInfo) {
@@ -56,21 +69,28 @@ std::vector<InferenceEngine::Blob::Ptr> CreateBlobsForStates(const vpux::Network
 //------------------------------------------------------------------------------
 //      Shared init ctor
 //------------------------------------------------------------------------------
-ExecutableNetwork::ExecutableNetwork(const Config& config, const Device::Ptr& device)
+ExecutableNetwork::ExecutableNetwork(const Config& config, const std::vector<Device::Ptr>& devices)
         : _config(config),
           _logger("ExecutableNetwork", config.get<LOG_LEVEL>()),
-          _device(device),
+          _devices(devices),
           _compiler(Compiler::create(config)),
+          _requestBalancer(devices.size()),
           _supportedMetrics({METRIC_KEY(NETWORK_NAME), METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
                              METRIC_KEY(SUPPORTED_CONFIG_KEYS), METRIC_KEY(SUPPORTED_METRICS)}) {
+    VPUX_THROW_WHEN(_devices.empty(), "ExecutableNetwork requires at least one device");
+    for (const auto& device : _devices) {
+        if (device != nullptr) {
+            _logger.debug("Network is loaded to device '{0}'", device->getName());
+        }
+    }
 }
 
 //------------------------------------------------------------------------------
 //      Load network
 //------------------------------------------------------------------------------
-ExecutableNetwork::ExecutableNetwork(const ie::CNNNetwork& orignet, const Device::Ptr& device, const Config& config,
-                                     const bool& isNewAPI)
-        : ExecutableNetwork(config, device) {
+ExecutableNetwork::ExecutableNetwork(const ie::CNNNetwork& orignet, const std::vector<Device::Ptr>& devices,
+                                     const Config& config, const bool& isNewAPI)
+        : ExecutableNetwork(config, devices) {
     OV_ITT_SCOPED_TASK(itt::domains::VPUXPlugin, "ExecutableNetwork::ExecutableNetwork[Load]");
     // FIXME: This is a copy-paste from kmb_executable_network.cpp
     // should be fixed after switching to VPUX completely
@@ -87,6 +107,20 @@ ExecutableNetwork::ExecutableNetwork(const ie::CNNNetwork& orignet, const Device
         ie::InputsDataMap inputMetadata = network.getInputsInfo();
         ie::OutputsDataMap outputMetadata = network.getOutputsInfo();
 
+        // The key is computed before the metadata is attached to the model, it is hashed separately
+        std::unique_ptr<CompiledModelCache> cache;
+        std::string cacheKey;
+        if (isCompiledModelCacheEnabled(_config)) {
+            try {
+                cache = std::make_unique<CompiledModelCache>(_config.get<CACHE_DIR>(), _config.get<CACHE_MAX_SIZE>(),
+                                                             _logger);
+                cacheKey = CompiledModelCache::computeKey(model, inputMetadata, outputMetadata, isNewAPI, _config);
+            } catch (const std::exception& ex) {
+                _logger.warning("Compiled model cache is disabled : {0}", ex.what());
+                cache.reset();
+            }
+        }
+
         // This shall be used later in the main compiler file in order to indicate the need of updating the I/O metadata
         // found within the "ov::Model" object
         model->set_rt_info(isNewAPI, "is_new_api");
@@ -96,7 +130,14 @@ ExecutableNetwork::ExecutableNetwork(const ie::CNNNetwork& orignet, const Device
         model->set_rt_info(outputMetadata, "output_metadata");
 
         try {
-            _networkPtr = _compiler->compile(model, network.getName(), _config);
+            const auto compile = [&]() {
+                return _compiler->compile(model, network.getName(), _config);
+            };
+            const auto parse = [&](const std::vector<char>& blob) {
+                return _compiler->parse(blob, _config, network.getName());
+            };
+
+            _networkPtr = cache != nullptr ? cache->getOrCompile(cacheKey, parse, compile) : compile();
         } catch (const std::exception& ex) {
             IE_THROW() << ex.what();
         } catch (...) {
@@ -110,6 +151,15 @@ ExecutableNetwork::ExecutableNetwork(const ie::CNNNetwork& orignet, const Device
 
     _networkStatesInfo = ExtractStatesFromInputsInfo();
 
+    if (isDynamicBatchingEnabled(_config)) {
+        OV_ITT_TASK_NEXT(EXECUTABLE_NETWORK_LOAD, "CompileBatched");
+        if (_networkStatesInfo.empty()) {
+            _batchedNetworkPtr = compileBatchedNetwork(orignet, isNewAPI);
+        } else {
+            _logger.info("Batched variant is not compiled for stateful networks, batches are run by the network");
+        }
+    }
+
     // TODO: Fix this WA for E#22783, E#25449
     // Precedence: 1st env var; 2nd config value;
     const bool configCreateExecutor = _config.get<CREATE_EXECUTOR>();
@@ -119,7 +169,7 @@ ExecutableNetwork::ExecutableNetwork(const ie::CNNNetwork& orignet, const Device
     OV_ITT_TASK_NEXT(EXECUTABLE_NETWORK_LOAD, "createExecutor");
     if (IE_NPU_CREATE_EXECUTOR) {
         _logger.info("Creating executor at Load Network step");
-        _executorPtr = createExecutor(_networkPtr, _config, device);
+        createExecutors();
         ConfigureStreamsExecutor(network.getName());
     } else {
         _logger.info("Executor will not be created at Load Network step");
@@ -163,8 +213,9 @@ InferenceEngine::OutputsDataMap ExecutableNetwork::BeautifyOutputsInfo() const {
 //------------------------------------------------------------------------------
 //      Import network
 //------------------------------------------------------------------------------
-ExecutableNetwork::ExecutableNetwork(std::istream& networkModel, const Device::Ptr& device, const Config& config)
-        : ExecutableNetwork(config, device) {
+ExecutableNetwork::ExecutableNetwork(std::istream& networkModel, const std::vector<Device::Ptr>& devices,
+                                     const Config& config, const NetworkDescription::BlobSource& blobSource)
+        : ExecutableNetwork(config, devices) {
     OV_ITT_SCOPED_TASK(itt::domains::VPUXPlugin, "ExecutableNetwork::ExecutableNetwork[Import]");
     try {
         OV_ITT_TASK_CHAIN(EXECUTABLE_NETWORK_IMPORT, itt::domains::VPUXPlugin,
@@ -172,8 +223,11 @@ ExecutableNetwork::ExecutableNetwork(std::istream& networkModel, const Device::P
         initializeProperties();
         const std::string networkName = "net" + std::to_string(loadBlobCounter);
         _networkPtr = _compiler->parse(networkModel, _config, networkName);
+        if (isDynamicBatchingEnabled(_config)) {
+            _logger.info("Batched variant is not available for imported networks, batches are run by the network");
+        }
         OV_ITT_TASK_NEXT(EXECUTABLE_NETWORK_IMPORT, "createExecutor");
-        _executorPtr = createExecutor(_networkPtr, _config, device);
+        createExecutors();
         OV_ITT_TASK_NEXT(EXECUTABLE_NETWORK_IMPORT, "setIn/Out");
         _networkStatesInfo = ExtractStatesFromInputsInfo();
         _networkInputs = BeautifyInputsInfo();
@@ -182,6 +236,10 @@ ExecutableNetwork::ExecutableNetwork(std::istream& networkModel, const Device::P
         setOutputs(helpers::ovRawNodesIntoOVNodes(_networkPtr->getOVResults(), true));
         OV_ITT_TASK_NEXT(EXECUTABLE_NETWORK_IMPORT, "ConfigureStreamsExecutor");
         ConfigureStreamsExecutor(networkName);
+        if (blobSource) {
+            OV_ITT_TASK_NEXT(EXECUTABLE_NETWORK_IMPORT, "releaseCompiledNetwork");
+            releaseCompiledNetwork(blobSource);
+        }
         OV_ITT_TASK_SKIP(EXECUTABLE_NETWORK_IMPORT);
     } catch (const std::exception& ex) {
         IE_THROW() << ex.what();
@@ -251,33 +309,30 @@ vpux::NetworkIOVector ExecutableNetwork::ExtractStatesFromInputsInfo() const {
 ie::IInferRequestInternal::Ptr ExecutableNetwork::CreateInferRequestImpl(const ie::InputsDataMap networkInputs,
                                                                          const ie::OutputsDataMap networkOutputs) {
     OV_ITT_SCOPED_TASK(itt::domains::VPUXPlugin, "ExecutableNetwork::CreateInferRequestImpl");
-    if (!_executorPtr) {
-        _executorPtr = createExecutor(_networkPtr, _config, _device);
+    if (_executors.empty()) {
+        createExecutors();
         ConfigureStreamsExecutor(_networkName);
     }
 
-    if (_executorPtr == nullptr) {
-        IE_THROW() << NO_EXECUTOR_FOR_INFERENCE;
-    }
-    const auto inferExecutor = _executorPtr;
-    const auto allocator = _device->getAllocator();
-    return _device->createInferRequest(networkInputs, networkOutputs, inferExecutor, _config, _networkName, _parameters,
-                                       _results, _networkStatesInfo, allocator);
+    return _requestBalancer.createRequest([&](size_t deviceIndex) {
+        const auto& device = _devices[deviceIndex];
+        const auto& inferExecutor = _executors[deviceIndex];
+        if (inferExecutor == nullptr) {
+            IE_THROW() << NO_EXECUTOR_FOR_INFERENCE;
+        }
+        const auto allocator = device->getAllocator();
+        return device->createInferRequest(networkInputs, networkOutputs, inferExecutor, _config, _networkName,
+                                          _parameters, _results, _networkStatesInfo, allocator);
+    });
 }
 
 InferenceEngine::IInferRequestInternal::Ptr ExecutableNetwork::CreateInferRequest() {
     OV_ITT_SCOPED_TASK(itt::domains::VPUXPlugin, "ExecutableNetwork::CreateInferRequest");
-    if (!_executorPtr) {
-        _executorPtr = createExecutor(_networkPtr, _config, _device);
+    if (_executors.empty()) {
+        createExecutors();
         ConfigureStreamsExecutor(_networkName);
     }
 
-    if (_executorPtr == nullptr) {
-        IE_THROW() << NO_EXECUTOR_FOR_INFERENCE;
-    }
-    const auto inferExecutor = _executorPtr;
-    const auto allocator = _device->getAllocator();
-
     // Since, states are implemented via additional network's inputs and outputs, it is
     // important for InferRequest to hold information about them in the
     // _networkInputs/_networkOutputs maps. These maps are used by OpenVINO as source of truth
@@ -293,8 +348,18 @@ InferenceEngine::IInferRequestInternal::Ptr ExecutableNetwork::CreateInferReques
         outputsInfo.insert({ASSIGN_PREFIX + stateInfo.first, stateInfo.second});
     }
 
-    auto syncRequestImpl = _device->createInferRequest(inputsInfo, outputsInfo, inferExecutor, _config, _networkName,
-                                                       _parameters, _results, _networkStatesInfo, allocator);
+    IInferRequest::Ptr syncRequestImpl;
+    _requestBalancer.createRequest([&](size_t deviceIndex) {
+        const auto& device = _devices[deviceIndex];
+        const auto& inferExecutor = _executors[deviceIndex];
+        if (inferExecutor == nullptr) {
+            IE_THROW() << NO_EXECUTOR_FOR_INFERENCE;
+        }
+        const auto allocator = device->getAllocator();
+        syncRequestImpl = device->createInferRequest(inputsInfo, outputsInfo, inferExecutor, _config, _networkName,
+                                                     _parameters, _results, _networkStatesInfo, allocator);
+        return syncRequestImpl;
+    });
     syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
 
     auto blobs = CreateBlobsForStates(_networkStatesInfo);
@@ -305,8 +370,14 @@ InferenceEngine::IInferRequestInternal::Ptr ExecutableNetwork::CreateInferReques
         ++index;
     }
 
+    if (isDynamicBatchingEnabled(_config)) {
+        std::call_once(_dynamicBatcherCreated, [this]() {
+            createDynamicBatcher();
+        });
+    }
+
     return std::make_shared<AsyncInferRequest>(syncRequestImpl, _taskExecutor, GetNextTaskExecutor(),
-                                               _callbackExecutor);
+                                               _callbackExecutor, std::atomic_load(&_dynamicBatcher));
 }
 
 //------------------------------------------------------------------------------
@@ -324,7 +395,7 @@ std::uint32_t hash(const std::vector<char>& data) {
 }  // namespace
 
 void ExecutableNetwork::Export(std::ostream& model) {
-    auto graphBlob = _networkPtr->getCompiledNetwork();
+    auto graphBlob = _networkPtr->readCompiledNetwork();
     model.write(graphBlob.data(), graphBlob.size());
     std::stringstream str;
     str << "Blob size: " << graphBlob.size() << ", hash: " << std::hex << hash(graphBlob);
@@ -416,13 +487,22 @@ void ExecutableNetwork::initializeProperties() {
              {true, ov::PropertyMutability::RO,
               [&](const Config& config) {
                   // value is allowed to be queried prior the network is compiled
-                  return static_cast<uint32_t>(getOptimalNumberOfInferRequestsInParallel(config));
+                  return getOptimalNumberOfInferRequests(config);
               }}},
             {ov::execution_devices.name(),
              {true, ov::PropertyMutability::RO,
               [&](const Config&) {
-                  VPUX_THROW_WHEN(_device == nullptr, "GetMetric: device is not initialized");
-                  return _device->getName();
+                  std::vector<std::string> deviceNames;
+                  for (const auto& device : _devices) {
+                      VPUX_THROW_WHEN(device == nullptr, "GetMetric: device is not initialized");
+                      deviceNames.push_back(device->getName());
+                  }
+                  return deviceNames;
+              }}},
+            {ov::intel_vpux::dynamic_batching_stats.name(),
+             {false, ov::PropertyMutability::RO,
+              [&](const Config&) {
+                  return getDynamicBatchingStats();
               }}}
             // from GetMetric
     };
@@ -448,7 +528,7 @@ ie::Parameter ExecutableNetwork::GetMetric(const std::string& name) const {
     } else if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
         // value is allowed to be queried prior the network is compiled
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS,
-                             static_cast<unsigned int>(getOptimalNumberOfInferRequestsInParallel(_config)));
+                             static_cast<unsigned int>(getOptimalNumberOfInferRequests(_config)));
     } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, _supportedMetrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
@@ -486,4 +566,167 @@ Executor::Ptr ExecutableNetwork::createExecutor(const NetworkDescription::Ptr& n
     return executor;
 }
 
+void ExecutableNetwork::createExecutors() {
+    _executors.clear();
+    for (const auto& device : _devices) {
+        _executors.push_back(createExecutor(_networkPtr, _config, device));
+    }
+}
+
+void ExecutableNetwork::releaseCompiledNetwork(const NetworkDescription::BlobSource& blobSource) {
+    const auto isReleasable = [](const Executor::Ptr& executor) {
+        return executor != nullptr && executor->isCompiledNetworkReleasable();
+    };
+    if (_executors.empty() || !std::all_of(_executors.begin(), _executors.end(), isReleasable)) {
+        return;
+    }
+
+    _logger.debug("Host copy of the compiled network is released");
+    _networkPtr->releaseCompiledNetwork(blobSource);
+}
+
+// The batch is added as the outermost dimension, the batches are run by the network itself if it can't be reshaped
+NetworkDescription::Ptr ExecutableNetwork::compileBatchedNetwork(const ie::CNNNetwork& orignet, bool isNewAPI) {
+    const auto batchSize = checked_cast<size_t>(_config.get<DYNAMIC_BATCH_SIZE>());
+    try {
+        ie::CNNNetwork network = ie::details::cloneNetwork(orignet);
+
+        auto shapes = network.getInputShapes();
+        for (auto& shape : shapes) {
+            if (shape.second.empty() || shape.second.front() != 1) {
+                _logger.warning("Batched variant is not compiled : input '{0}' is not batch 1", shape.first);
+                return nullptr;
+            }
+            shape.second.front() = batchSize;
+        }
+        network.reshape(shapes);
+
+        for (const auto& output : network.getOutputsInfo()) {
+            const auto& dims = output.second->getTensorDesc().getDims();
+            if (dims.empty() || dims.front() != batchSize) {
+                _logger.warning("Batched variant is not compiled : output '{0}' is not batched", output.first);
+                return nullptr;
+            }
+        }
+
+        const auto model = network.getFunction();
+        model->set_rt_info(isNewAPI, "is_new_api");
+        model->set_rt_info(network.getInputsInfo(), "input_metadata");
+        model->set_rt_info(network.getOutputsInfo(), "output_metadata");
+
+        _logger.info("Compiling the variant of the network with batch {0}", batchSize);
+        return _compiler->compile(model, network.getName() + "_batch" + std::to_string(batchSize), _config);
+    } catch (const std::exception& ex) {
+        _logger.warning("Batched variant is not compiled : {0}", ex.what());
+        return nullptr;
+    }
+}
+
+void ExecutableNetwork::createDynamicBatcher() {
+    const auto batchSize = checked_cast<size_t>(_config.get<DYNAMIC_BATCH_SIZE>());
+    const auto window = std::chrono::microseconds(_config.get<DYNAMIC_BATCH_TIMEOUT>());
+    const auto createSubmittingBatcher = [&]() {
+        const auto submitBatch = [this](const std::vector<IInferRequest::Ptr>& requests) {
+            inferDeviceBatches(requests);
+        };
+        std::atomic_store(&_dynamicBatcher, std::make_shared<DynamicBatcher>(submitBatch, batchSize, window, _logger));
+    };
+
+    const auto& device = _devices[_requestBalancer.selectDevice()];
+    if (_batchedNetworkPtr == nullptr || device == nullptr) {
+        createSubmittingBatcher();
+        return;
+    }
+
+    // Same precisions and layouts as the batch 1 requests have, so the batched request converts the data the same way
+    const auto withBatch = [&](const ie::DataPtr& data) {
+        const auto& desc = data->getTensorDesc();
+        auto dims = desc.getDims();
+        dims.front() = batchSize;
+        return std::make_shared<ie::Data>(data->getName(), ie::TensorDesc(desc.getPrecision(), dims, desc.getLayout()));
+    };
+
+    ie::InputsDataMap inputsInfo;
+    std::vector<std::string> inputNames;
+    for (const auto& input : _networkInputs) {
+        auto info = std::make_shared<ie::InputInfo>();
+        info->setInputData(withBatch(input.second->getInputData()));
+        inputsInfo.emplace(input.first, info);
+        inputNames.push_back(input.first);
+    }
+    ie::OutputsDataMap outputsInfo;
+    std::vector<std::string> outputNames;
+    for (const auto& output : _networkOutputs) {
+        outputsInfo.emplace(output.first, withBatch(output.second));
+        outputNames.push_back(output.first);
+    }
+
+    try {
+        const auto executor = device->createExecutor(_batchedNetworkPtr, _config);
+        const auto parameters = _parameters.empty()
+                                        ? OVNodes{}
+                                        : helpers::ovRawNodesIntoOVNodes(_batchedNetworkPtr->getOVParameters(), false);
+        const auto results =
+                _results.empty() ? OVNodes{} : helpers::ovRawNodesIntoOVNodes(_batchedNetworkPtr->getOVResults(), true);
+        const auto batchedRequest =
+                device->createInferRequest(inputsInfo, outputsInfo, executor, _config, _batchedNetworkPtr->getName(),
+                                           parameters, results, {}, device->getAllocator());
+
+        std::atomic_store(&_dynamicBatcher, std::make_shared<DynamicBatcher>(batchedRequest, batchSize, window,
+                                                                             inputNames, outputNames, _logger));
+    } catch (const std::exception& ex) {
+        _logger.warning("Batched variant can't be run, batches are run by the network : {0}", ex.what());
+        createSubmittingBatcher();
+    }
+}
+
+// Enough requests to fill the next batch while the previous one is running, if the requests are batched
+uint32_t ExecutableNetwork::getOptimalNumberOfInferRequests(const Config& config) const {
+    if (isDynamicBatchingEnabled(config)) {
+        return checked_cast<uint32_t>(2 * config.get<DYNAMIC_BATCH_SIZE>());
+    }
+    return checked_cast<uint32_t>(getOptimalNumberOfInferRequestsInParallel(config) *
+                                  checked_cast<int64_t>(_devices.size()));
+}
+
+std::map<std::string, uint64_t> ExecutableNetwork::getDynamicBatchingStats() const {
+    const auto dynamicBatcher = std::atomic_load(&_dynamicBatcher);
+    const auto stats = dynamicBatcher != nullptr ? dynamicBatcher->getStats() : CoalescingStats();
+    return {{"BATCHES", stats.batches},
+            {"BATCHED_REQUESTS", stats.batchedRequests},
+            {"SINGLE_REQUESTS", stats.singleRequests},
+            {"ADDED_LATENCY_TOTAL_US", stats.addedLatencyTotalUs},
+            {"ADDED_LATENCY_MAX_US", stats.addedLatencyMaxUs},
+            {"THROUGHPUT_FPS", stats.getThroughputFps()}};
+}
+
+void ExecutableNetwork::InferBatch(const std::vector<ie::IInferRequestInternal::Ptr>& requests) {
+    OV_ITT_SCOPED_TASK(itt::domains::VPUXPlugin, "ExecutableNetwork::InferBatch");
+
+    std::vector<IInferRequest::Ptr> syncRequests;
+    for (const auto& request : requests) {
+        const auto asyncRequest = std::dynamic_pointer_cast<AsyncInferRequest>(request);
+        VPUX_THROW_WHEN(asyncRequest == nullptr, "Infer request was not created by NPU plugin");
+        syncRequests.push_back(asyncRequest->getSyncRequest());
+    }
+    inferDeviceBatches(syncRequests);
+}
+
+// Only the requests bound to the same device pipeline can share a submission
+void ExecutableNetwork::inferDeviceBatches(const std::vector<IInferRequest::Ptr>& requests) {
+    std::vector<std::vector<IInferRequest::Ptr>> deviceBatches(_devices.size());
+    for (const auto& request : requests) {
+        deviceBatches[_requestBalancer.getDeviceIndex(request)].push_back(request);
+    }
+
+    for (auto& batch : deviceBatches) {
+        if (batch.empty()) {
+            continue;
+        }
+        const auto first = batch.front();
+        batch.erase(batch.begin());
+        first->InferBatch(batch);
+    }
+}
+
 }  // namespace vpux
@@ -14,6 +14,8 @@
 #include "vpux_private_config.hpp"
 #include "vpux_private_properties.hpp"
 
+#include <sstream>
+
 namespace vpux {
 
 Metrics::Metrics(const VPUXBackends::CPtr& backends): _backends(backends) {
@@ -122,6 +124,24 @@ uint32_t Metrics::GetDriverVersion(const std::string& specifiedDeviceName) const
     IE_THROW() << "No device with name '" << specifiedDeviceName << "' is available";
 }
 
+std::map<std::string, uint64_t> Metrics::GetQueueingDelays(const std::string& specifiedDeviceName) const {
+    const auto devName = getDeviceName(specifiedDeviceName);
+    auto device = _backends->getDevice(devName);
+    if (!device) {
+        IE_THROW() << "No device with name '" << specifiedDeviceName << "' is available";
+    }
+
+    std::map<std::string, uint64_t> delays;
+    for (const auto& delay : device->getQueueingDelays()) {
+        std::stringstream priority;
+        priority << delay.first;
+        delays[priority.str() + "_COUNT"] = delay.second.count;
+        delays[priority.str() + "_TOTAL_US"] = delay.second.totalUs;
+        delays[priority.str() + "_MAX_US"] = delay.second.maxUs;
+    }
+    return delays;
+}
+
 std::string Metrics::getDeviceName(const std::string& specifiedDeviceName) const {
     std::vector<std::string> devNames;
     if (_backends == nullptr || (devNames = _backends->getAvailableDevicesNames()).empty()) {
@@ -71,6 +71,19 @@ Config addPlatformToTheConfig(Config config, std::string platform) {
     config.update({{ov::intel_vpux::vpux_platform.name(), platform}});
     return config;
 }
+
+// The network is loaded to the specified device only, unless the multi-device execution is requested
+std::vector<std::shared_ptr<Device>> getInferenceDevices(const VPUXBackends& backends, const Config& config,
+                                                         const std::string& platform) {
+    auto device = backends.getDevice(config.get<DEVICE_ID>());
+    if (config.get<MULTI_DEVICE_EXECUTION>()) {
+        auto devices = backends.getDevices(platform);
+        if (!devices.empty()) {
+            return devices;
+        }
+    }
+    return {device};
+}
 }  // namespace
 
 Engine::Engine()
@@ -226,6 +239,31 @@ Engine::Engine()
               [](const Config& config) {
                   return config.get<USE_ELF_COMPILER_BACKEND>();
               }}},
+            {ov::intel_vpux::cache_max_size.name(),
+             {true, ov::PropertyMutability::RW,
+              [](const Config& config) {
+                  return config.get<CACHE_MAX_SIZE>();
+              }}},
+            {ov::intel_vpux::multi_device_execution.name(),
+             {false, ov::PropertyMutability::RW,
+              [](const Config& config) {
+                  return config.get<MULTI_DEVICE_EXECUTION>();
+              }}},
+            {ov::intel_vpux::max_inflight_inferences.name(),
+             {false, ov::PropertyMutability::RW,
+              [](const Config& config) {
+                  return config.get<MAX_INFLIGHT_INFERENCES>();
+              }}},
+            {ov::intel_vpux::dynamic_batch_size.name(),
+             {false, ov::PropertyMutability::RW,
+              [](const Config& config) {
+                  return config.get<DYNAMIC_BATCH_SIZE>();
+              }}},
+            {ov::intel_vpux::dynamic_batch_timeout.name(),
+             {false, ov::PropertyMutability::RW,
+              [](const Config& config) {
+                  return config.get<DYNAMIC_BATCH_TIMEOUT>();
+              }}},
             {ov::intel_vpux::device_total_mem_size.name(),
              {true, ov::PropertyMutability::RO,
               [&](const Config& config) {
@@ -237,6 +275,11 @@ Engine::Engine()
               [&](const Config& config) {
                   IE_SET_METRIC_RETURN(NPU_DRIVER_VERSION, _metrics->GetDriverVersion(getSpecifiedDeviceName(config)));
               }}},
+            {ov::intel_vpux::queueing_delays.name(),
+             {false, ov::PropertyMutability::RO,
+              [&](const Config& config) {
+                  return _metrics->GetQueueingDelays(getSpecifiedDeviceName(config));
+              }}},
             // from Engine::GetConfig
 
             // from Engine::GetMetric
@@ -461,11 +504,11 @@ Engine::Engine()
 //      Load network
 //------------------------------------------------------------------------------
 ie::IExecutableNetworkInternal::Ptr Engine::LoadExeNetwork(const ie::CNNNetwork& network,
-                                                           std::shared_ptr<Device>& device,
+                                                           const std::vector<std::shared_ptr<Device>>& devices,
                                                            const Config& networkConfig) {
     OV_ITT_SCOPED_TASK(itt::domains::VPUXPlugin, "Engine::LoadExeNetwork");
     try {
-        return std::make_shared<ExecutableNetwork>(network, device, networkConfig, GetCore()->isNewAPI());
+        return std::make_shared<ExecutableNetwork>(network, devices, networkConfig, GetCore()->isNewAPI());
     } catch (const std::exception& ex) {
         IE_THROW(Unexpected) << ex.what();
     } catch (...) {
@@ -477,17 +520,10 @@ ie::IExecutableNetworkInternal::Ptr Engine::LoadExeNetworkImpl(const ie::CNNNetw
                                                                const std::map<std::string, std::string>& config) {
     auto localConfig = mergeConfigs(_globalConfig, config);
 
-    const auto set_cache_dir = localConfig.get<CACHE_DIR>();
-    if (!set_cache_dir.empty()) {
-        const auto compilerType = localConfig.get<COMPILER_TYPE>();
-        if (compilerType == cvtCompilerType(ov::intel_vpux::CompilerType::MLIR))
-            IE_THROW() << "Option 'CACHE_DIR' is not supported with MLIR compiler type";
-    }
-
     const auto platform = _backends->getCompilationPlatform(localConfig.get<PLATFORM>(), localConfig.get<DEVICE_ID>());
-    auto device = _backends->getDevice(localConfig.get<DEVICE_ID>());
+    const auto devices = getInferenceDevices(*_backends, localConfig, platform);
     localConfig.update({{ov::intel_vpux::vpux_platform.name(), platform}});
-    return LoadExeNetwork(network, device, localConfig);
+    return LoadExeNetwork(network, devices, localConfig);
 }
 
 ie::IExecutableNetworkInternal::Ptr Engine::LoadExeNetworkImpl(const ie::CNNNetwork&, const ie::RemoteContext::Ptr&,
@@ -508,19 +544,40 @@ ie::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(const std::string& mod
     const auto platform = _backends->getCompilationPlatform(localConfig.get<PLATFORM>(), localConfig.get<DEVICE_ID>());
     localConfig.update({{ov::intel_vpux::vpux_platform.name(), platform}});
 
-    return ImportNetwork(vpu::KmbPlugin::utils::skipMagic(blobStream), config);
+    // The blob can be read from the file again, so the host copy is released once the device has consumed it
+    const auto blobSource = [modelFileName]() {
+        std::ifstream stream(modelFileName, std::ios::binary);
+        if (!stream.is_open()) {
+            IE_THROW() << "Could not open file: " << modelFileName;
+        }
+        auto& blobStream = vpu::KmbPlugin::utils::skipMagic(stream);
+        std::vector<char> blob(vpu::KmbPlugin::utils::getFileSize(blobStream));
+        if (!blobStream.read(blob.data(), blob.size())) {
+            IE_THROW() << "Could not read file: " << modelFileName;
+        }
+        return blob;
+    };
+
+    return ImportExeNetwork(vpu::KmbPlugin::utils::skipMagic(blobStream), config, blobSource);
 }
 
 ie::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istream& networkModel,
                                                           const std::map<std::string, std::string>& config) {
+    return ImportExeNetwork(networkModel, config, {});
+}
+
+ie::IExecutableNetworkInternal::Ptr Engine::ImportExeNetwork(std::istream& networkModel,
+                                                             const std::map<std::string, std::string>& config,
+                                                             const NetworkDescription::BlobSource& blobSource) {
     OV_ITT_SCOPED_TASK(itt::domains::VPUXPlugin, "Engine::ImportNetwork");
     try {
         auto localConfig = mergeConfigs(_globalConfig, config, OptionMode::RunTime);
         const auto platform =
                 _backends->getCompilationPlatform(localConfig.get<PLATFORM>(), localConfig.get<DEVICE_ID>());
         localConfig.update({{ov::intel_vpux::vpux_platform.name(), platform}});
-        auto device = _backends->getDevice(localConfig.get<DEVICE_ID>());
-        const auto executableNetwork = std::make_shared<ExecutableNetwork>(networkModel, device, localConfig);
+        const auto devices = getInferenceDevices(*_backends, localConfig, platform);
+        const auto executableNetwork =
+                std::make_shared<ExecutableNetwork>(networkModel, devices, localConfig, blobSource);
         executableNetwork->SetPointerToPlugin(shared_from_this());
         return executableNetwork;
     } catch (const std::exception& ex) {
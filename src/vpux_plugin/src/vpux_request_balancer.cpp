@@ -0,0 +1,64 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux_request_balancer.h"
+
+// System
+#include <algorithm>
+#include <iterator>
+
+// Plugin
+#include "vpux/utils/core/error.hpp"
+
+namespace vpux {
+namespace ie = InferenceEngine;
+
+InferRequestBalancer::InferRequestBalancer(size_t numDevices): _deviceRequests(numDevices) {
+    VPUX_THROW_WHEN(numDevices == 0, "Infer requests can't be balanced without devices");
+}
+
+ie::IInferRequestInternal::Ptr InferRequestBalancer::createRequest(const RequestFactory& factory) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    const auto deviceIndex = selectDeviceImpl();
+    auto request = factory(deviceIndex);
+    _deviceRequests[deviceIndex].push_back(request);
+    return request;
+}
+
+size_t InferRequestBalancer::selectDevice() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return selectDeviceImpl();
+}
+
+size_t InferRequestBalancer::getDeviceIndex(const ie::IInferRequestInternal::Ptr& request) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    const auto isRequest = [&](const std::weak_ptr<ie::IInferRequestInternal>& deviceRequest) {
+        return deviceRequest.lock() == request;
+    };
+    const auto deviceIt = std::find_if(_deviceRequests.begin(), _deviceRequests.end(),
+                                       [&](const std::vector<std::weak_ptr<ie::IInferRequestInternal>>& requests) {
+                                           return std::any_of(requests.begin(), requests.end(), isRequest);
+                                       });
+    VPUX_THROW_WHEN(deviceIt == _deviceRequests.end(), "Infer request was not created by this executable network");
+    return static_cast<size_t>(std::distance(_deviceRequests.begin(), deviceIt));
+}
+
+size_t InferRequestBalancer::selectDeviceImpl() {
+    size_t selected = 0;
+    for (size_t i = 0; i < _deviceRequests.size(); ++i) {
+        auto& requests = _deviceRequests[i];
+        requests.erase(std::remove_if(requests.begin(), requests.end(),
+                                      [](const std::weak_ptr<ie::IInferRequestInternal>& request) {
+                                          return request.expired();
+                                      }),
+                       requests.end());
+        if (requests.size() < _deviceRequests[selected].size()) {
+            selected = i;
+        }
+    }
+    return selected;
+}
+
+}  // namespace vpux
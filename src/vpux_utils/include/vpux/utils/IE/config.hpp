@@ -344,6 +344,9 @@ public:
 
     std::string toString() const;
 
+    // Returns the values of the set options, which are used in the given mode, sorted by key
+    ConfigMap toMap(OptionMode mode) const;
+
 private:
     std::shared_ptr<const OptionsDesc> _desc;
     ImplMap _impl;
@@ -0,0 +1,24 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+// Resident memory of the current process.
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace vpux {
+
+// Resident set size of the current process in KB, 0 if it is not available on the platform
+int64_t getCurrentRSS();
+int64_t getPeakRSS();
+
+// Resets the peak resident set size, so the following getPeakRSS call reports the peak since this point.
+// Returns false if the platform doesn't support it.
+bool resetPeakRSS();
+
+}  // namespace vpux
@@ -0,0 +1,53 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+// Offline decoder of the traces dumped by TraceRecorder.
+//
+
+#pragma once
+
+#include "vpux/utils/core/trace_recorder.hpp"
+
+#include <cstdint>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <vector>
+
+namespace vpux {
+
+constexpr char TRACE_FILE_MAGIC[8] = {'V', 'P', 'U', 'X', 'T', 'R', 'C', '\0'};
+constexpr uint32_t TRACE_FILE_VERSION = 1;
+
+struct DecodedTraceRecord final {
+    uint32_t threadId = 0;
+    TraceRecord record;
+};
+
+struct DecodedTrace final {
+    std::map<uint32_t, TraceEventDesc> events;
+    std::vector<DecodedTraceRecord> records;  ///< Records of all threads sorted by the timestamp
+};
+
+/**
+ * @fn readTrace
+ * @brief Reads the binary trace written by TraceRecorder::dump
+ */
+DecodedTrace readTrace(std::istream& stream);
+
+/**
+ * @fn printTraceAsText
+ * @brief Prints one line per record with the time relative to the first record
+ */
+void printTraceAsText(const DecodedTrace& trace, std::ostream& stream);
+
+/**
+ * @fn printTraceAsPerfetto
+ * @brief Prints the trace in the Chrome JSON trace event format, which is opened by the Perfetto UI
+ */
+void printTraceAsPerfetto(const DecodedTrace& trace, std::ostream& stream);
+
+}  // namespace vpux
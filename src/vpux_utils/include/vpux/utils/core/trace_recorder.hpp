@@ -0,0 +1,338 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+// Binary trace recorder for the hot paths.
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace vpux {
+
+//
+// Trace records
+//
+
+constexpr size_t MAX_TRACE_EVENT_ARGS = 4;
+
+enum class TracePhase : uint8_t {
+    Instant = 0,
+    Begin = 1,
+    End = 2,
+};
+
+enum class TraceArgType : uint8_t {
+    None = 0,
+    Int = 1,
+    UInt = 2,
+    Double = 3,
+};
+
+// Arguments are kept as raw 64-bit words, their types are stored along to decode them offline
+struct TraceRecord final {
+    uint64_t timestampNs = 0;
+    uint32_t eventId = 0;
+    TracePhase phase = TracePhase::Instant;
+    uint8_t numArgs = 0;
+    std::array<TraceArgType, MAX_TRACE_EVENT_ARGS> argTypes = {};
+    std::array<uint64_t, MAX_TRACE_EVENT_ARGS> args = {};
+};
+
+struct TraceEventDesc final {
+    uint32_t id = 0;
+    std::string category;
+    std::string name;
+    std::string argNames;  // Comma-separated names of the arguments
+};
+
+// FNV-1a hash of "<category>.<name>", evaluated at compile time by VPUX_TRACE_EVENT
+constexpr uint32_t hashTraceEventName(const char* name) {
+    uint32_t hash = 2166136261u;
+    for (; *name != '\0'; ++name) {
+        hash = (hash ^ static_cast<uint8_t>(*name)) * 16777619u;
+    }
+    return hash;
+}
+
+//
+// TraceRecorder
+//
+
+/**
+ * @brief Records the trace events of all threads into per-thread ring buffers
+ * @details Recording does not format anything: each thread appends fixed-size records to its own buffer without
+ * taking a lock, so the tracing may stay enabled in production. The oldest records of a thread are overwritten when
+ * its buffer is full. The buffer of an exited thread is kept for the dump until a new thread takes it over, so the
+ * number of buffers is bounded by the number of threads alive at the same time. The dump is a binary file with the
+ * event table followed by the records of each thread, it is decoded offline by the trace_decoder tool.
+ *
+ * When the IE_NPU_TRACE_FILE environment variable is set, the recording is enabled at load and the trace is dumped to
+ * that file at exit. The recording is always disabled at exit.
+ */
+class TraceRecorder final {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 8192;
+
+    // The recorder is never destroyed, so the threads still recording during the static destruction keep valid
+    // buffers
+    static TraceRecorder& get();
+
+    TraceRecorder(const TraceRecorder&) = delete;
+    TraceRecorder& operator=(const TraceRecorder&) = delete;
+
+public:
+    static bool isEnabled() {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Starts recording, each thread keeps the last capacityPerThread records
+     * @note The capacity applies to the buffers of the threads which record their first event after the call,
+     * the existing buffers are kept as is
+     */
+    void enable(size_t capacityPerThread = DEFAULT_CAPACITY);
+    void disable();
+
+    // Stops the recording and writes the trace to the IE_NPU_TRACE_FILE file if it is set, called at exit
+    void finalize();
+
+    // Drops the recorded events
+    void clear();
+
+    void registerEvent(const TraceEventDesc& desc);
+
+    template <typename... Args>
+    void record(uint32_t eventId, TracePhase phase, const Args&... args) {
+        static_assert(sizeof...(Args) <= MAX_TRACE_EVENT_ARGS, "Too many trace event arguments");
+
+        TraceRecord rec;
+        rec.timestampNs = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count());
+        rec.eventId = eventId;
+        rec.phase = phase;
+        rec.numArgs = static_cast<uint8_t>(sizeof...(Args));
+
+        size_t ind = 0;
+        (void)std::initializer_list<int>{(encodeArg(rec, ind++, args), 0)...};
+
+        // The thread has no buffer anymore when it records during its exit
+        if (auto* buffer = getThreadBuffer()) {
+            buffer->push(rec);
+        }
+    }
+
+    /**
+     * @brief Writes the event table and the records of all threads in the binary format
+     * @note The buffers are read while the threads keep recording, the records overwritten during the dump are
+     * missing from it
+     */
+    void dump(std::ostream& stream) const;
+    void dump(const std::string& fileName) const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Ring of the records of one thread, written by that thread only
+     * @details Each slot is a seqlock: its sequence is odd while the record is written and encodes the index of the
+     * record once it is written, so the reader detects the records which are overwritten while it copies them.
+     * The records are kept as atomic words to make these concurrent copies well-defined.
+     */
+    class ThreadBuffer final {
+    public:
+        ThreadBuffer(uint32_t threadId, size_t capacity): _threadId(threadId), _slots(capacity) {
+        }
+
+        // Called by the owner thread, the oldest record is overwritten, so the buffer always keeps the latest events
+        void push(const TraceRecord& rec) {
+            const auto index = _head.load(std::memory_order_relaxed);
+            auto& slot = _slots[index % _slots.size()];
+
+            std::array<uint64_t, RECORD_WORDS> words = {};
+            std::memcpy(words.data(), &rec, sizeof(rec));
+
+            slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            for (size_t i = 0; i < RECORD_WORDS; ++i) {
+                slot.words[i].store(words[i], std::memory_order_relaxed);
+            }
+            slot.sequence.store(2 * index + 2, std::memory_order_release);
+            _head.store(index + 1, std::memory_order_release);
+        }
+
+        // The methods below are called under the lock of the recorder
+
+        // Hides the records written so far from the dump
+        void clear() {
+            _begin = _head.load(std::memory_order_acquire);
+        }
+
+        // The buffer is taken over by a new thread, the records of the previous one are dropped
+        void reset(uint32_t threadId) {
+            _threadId = threadId;
+            clear();
+        }
+
+        // Copies the records from the oldest one, skipping the ones overwritten during the copy
+        std::vector<TraceRecord> snapshot() const;
+
+        uint32_t threadId() const {
+            return _threadId;
+        }
+
+        size_t capacity() const {
+            return _slots.size();
+        }
+
+    private:
+        static_assert(std::is_trivially_copyable<TraceRecord>::value, "Trace records are copied as raw words");
+        static constexpr size_t RECORD_WORDS = (sizeof(TraceRecord) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+        struct Slot final {
+            std::atomic<uint64_t> sequence{0};
+            std::array<std::atomic<uint64_t>, RECORD_WORDS> words = {};
+        };
+
+        uint32_t _threadId;
+        std::vector<Slot> _slots;
+        std::atomic<uint64_t> _head{0};  // Number of records written by the thread
+        uint64_t _begin = 0;             // Index of the first record not cleared
+    };
+
+    class ThreadBufferLease;
+
+    TraceRecorder();
+
+    ThreadBuffer* getThreadBuffer();
+    ThreadBuffer* acquireThreadBuffer();
+    void releaseThreadBuffer(ThreadBuffer* buffer);
+
+    template <typename T>
+    static void encodeArg(TraceRecord& rec, size_t ind, const T& val) {
+        static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                      "Only numeric trace event arguments are supported");
+        encodeArgImpl(rec, ind, val, std::is_floating_point<T>(), std::is_signed<T>());
+    }
+
+    template <typename T, typename IsSigned>
+    static void encodeArgImpl(TraceRecord& rec, size_t ind, const T& val, std::true_type, IsSigned) {
+        const auto dbl = static_cast<double>(val);
+        std::memcpy(&rec.args[ind], &dbl, sizeof(dbl));
+        rec.argTypes[ind] = TraceArgType::Double;
+    }
+
+    template <typename T>
+    static void encodeArgImpl(TraceRecord& rec, size_t ind, const T& val, std::false_type, std::true_type) {
+        rec.args[ind] = static_cast<uint64_t>(static_cast<int64_t>(val));
+        rec.argTypes[ind] = TraceArgType::Int;
+    }
+
+    template <typename T>
+    static void encodeArgImpl(TraceRecord& rec, size_t ind, const T& val, std::false_type, std::false_type) {
+        rec.args[ind] = static_cast<uint64_t>(val);
+        rec.argTypes[ind] = TraceArgType::UInt;
+    }
+
+    static std::atomic<bool> _enabled;
+
+    mutable std::mutex _mutex;  // Guards the event table, the lists of the thread buffers and the capacity
+    std::vector<TraceEventDesc> _events;
+    std::vector<std::unique_ptr<ThreadBuffer>> _threadBuffers;
+    std::vector<ThreadBuffer*> _freeThreadBuffers;  // Buffers of the exited threads
+    uint32_t _nextThreadId = 0;
+    size_t _capacity = DEFAULT_CAPACITY;
+    std::string _dumpFileName;
+};
+
+//
+// TraceEvent
+//
+
+/**
+ * @brief Trace event registered in the event table of the recorder, use VPUX_TRACE_EVENT to define it
+ * @details Arguments are recorded as is, they are formatted only by the offline decoder.
+ * The event costs one relaxed atomic load when the recording is disabled.
+ */
+class TraceEvent final {
+public:
+    class Scope final {
+    public:
+        Scope(uint32_t id, bool active): _id(id), _active(active) {
+        }
+
+        Scope(Scope&& other): _id(other._id), _active(other._active) {
+            other._active = false;
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        Scope& operator=(Scope&&) = delete;
+
+        ~Scope() {
+            if (_active) {
+                TraceRecorder::get().record(_id, TracePhase::End);
+            }
+        }
+
+    private:
+        uint32_t _id;
+        bool _active;
+    };
+
+public:
+    TraceEvent(uint32_t id, const char* category, const char* name, const char* argNames): _id(id) {
+        TraceRecorder::get().registerEvent({id, category, name, argNames});
+    }
+
+    uint32_t id() const {
+        return _id;
+    }
+
+    template <typename... Args>
+    void record(const Args&... args) const {
+        if (TraceRecorder::isEnabled()) {
+            TraceRecorder::get().record(_id, TracePhase::Instant, args...);
+        }
+    }
+
+    // Records the beginning of the event now and its end when the returned scope is destroyed
+    template <typename... Args>
+    Scope scope(const Args&... args) const {
+        const auto active = TraceRecorder::isEnabled();
+        if (active) {
+            TraceRecorder::get().record(_id, TracePhase::Begin, args...);
+        }
+        return Scope(_id, active);
+    }
+
+private:
+    uint32_t _id;
+};
+
+}  // namespace vpux
+
+//
+// VPUX_TRACE_EVENT
+//
+
+// Defines a static trace event, the category and the name must be string literals, the identifier of the event
+// is computed from them at compile time
+#define VPUX_TRACE_EVENT(var, category, name, argNames)                                                            \
+    static const ::vpux::TraceEvent var(                                                                           \
+            std::integral_constant<uint32_t, ::vpux::hashTraceEventName(category "." name)>::value, category, name, \
+            argNames)
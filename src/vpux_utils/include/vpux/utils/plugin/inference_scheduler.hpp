@@ -0,0 +1,123 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include <openvino/runtime/properties.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <vector>
+
+namespace vpux {
+
+/**
+ * @brief Time spent by the inferences of the same priority waiting for the host-side scheduler
+ */
+struct QueueingDelay final {
+    uint64_t count = 0;
+    uint64_t totalUs = 0;
+    uint64_t maxUs = 0;
+};
+
+/**
+ * @brief Host-side scheduler of the inferences submitted to the same device by all executable networks
+ * @details Bounds the number of inferences in flight on the device. When a slot is released, the queued
+ * inferences are granted in the following order:
+ *  - HIGH priority inferences go first, so latency-critical work overtakes the queued (not the running) one;
+ *  - MEDIUM and LOW priority inferences share the remaining slots in proportion to their weights,
+ *    so LOW priority work is not starved.
+ * The limit equal to 0 disables the scheduling: inferences are submitted immediately as before.
+ */
+class InferenceScheduler final {
+public:
+    using Weights = std::array<uint32_t, 2>;  // MEDIUM, LOW
+    using Ticket = uint64_t;
+    using Submit = std::function<void()>;
+
+    explicit InferenceScheduler(uint32_t maxInFlight = 0, const Weights& weights = {4, 1});
+
+    InferenceScheduler(const InferenceScheduler&) = delete;
+    InferenceScheduler& operator=(const InferenceScheduler&) = delete;
+
+    /**
+     * @brief Adds the limit of a loaded network, the device is shared, so the most restrictive network wins
+     * @details The limit equal to 0 is ignored. Each added limit must be removed once its network is released,
+     * the remaining networks get their own limit back then.
+     */
+    void addInFlightLimit(uint32_t maxInFlight);
+    void removeInFlightLimit(uint32_t maxInFlight);
+
+    /**
+     * @brief Queues the inference of the given priority without blocking
+     * @details `submit` is run once the inference may be submitted to the device: by the calling thread if there
+     * is a free slot, otherwise by the thread which frees it in release. It must not throw.
+     * @return Ticket of the inference, it can be cancelled while it is queued
+     */
+    Ticket enqueue(ov::hint::Priority priority, Submit submit);
+
+    /**
+     * @brief Removes the queued inference
+     * @return false if the inference has already been granted, its `submit` is run or is being run then
+     */
+    bool cancel(Ticket ticket);
+
+    /**
+     * @brief Blocks until the inference of the given priority may be submitted to the device
+     */
+    void acquire(ov::hint::Priority priority);
+
+    /**
+     * @brief Must be called once the granted inference is completed
+     */
+    void release();
+
+    // Limit in force, 0 if the inferences are not limited
+    uint32_t getMaxInFlight() const;
+    size_t getQueuedCount() const;
+    QueueingDelay getQueueingDelay(ov::hint::Priority priority) const;
+
+private:
+    enum Class : size_t { HIGH, MEDIUM, LOW, COUNT };
+
+    struct Pending final {
+        Ticket ticket;
+        Submit submit;
+        std::chrono::steady_clock::time_point queuedAt;
+    };
+
+    static Class toClass(ov::hint::Priority priority);
+    // Runs the submits of the granted inferences, must be called without the lock
+    static void run(const std::vector<Submit>& granted);
+
+    uint32_t getMaxInFlightImpl() const;
+    bool hasFreeSlot() const;
+    bool isQueueEmpty() const;
+    // Picks the class of the next inference to be granted, the queue of the class must not be empty
+    Class nextClass();
+    std::vector<Submit> dispatch();
+    void recordDelay(Class cls, std::chrono::steady_clock::time_point queuedAt);
+
+    mutable std::mutex _mutex;
+
+    uint32_t _maxInFlight = 0;
+    std::multiset<uint32_t> _limits;
+    uint32_t _inFlight = 0;
+
+    Weights _weights;
+    Weights _credits;
+
+    Ticket _nextTicket = 0;
+    std::array<std::deque<Pending>, COUNT> _queues;
+
+    std::array<QueueingDelay, COUNT> _delays;
+};
+
+}  // namespace vpux
@@ -0,0 +1,101 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include "vpux/utils/plugin/profiling_parser.hpp"
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace vpux {
+namespace profiling {
+
+/**
+ * @brief Aggregated profiling of the top-level tasks of one layer executed on one engine
+ */
+struct LayerTaskStats {
+    uint64_t durationNs = 0;  ///< Sum of the durations of the tasks
+    size_t numTasks = 0;      ///< Number of the tasks, changes together with the tiling of the layer
+    size_t numClusters = 0;   ///< Number of clusters the tasks are split across, 0 if cluster info is not profiled
+    uint64_t criticalPathNs = 0;  ///< Part of the duration which lies on the critical path of the inference
+};
+
+enum class CompareStatus { UNCHANGED, CHANGED, ADDED, REMOVED };
+
+/**
+ * @brief Difference of one layer on one engine between two profiled runs
+ * @details Tasks are aligned by the layer name and by the engine (task kind) they were executed on
+ */
+struct LayerTaskDiff {
+    std::string layerName;
+    std::string layerType;
+    TaskInfo::ExecType execType = TaskInfo::ExecType::NONE;
+    bool inBefore = false;
+    bool inAfter = false;
+    LayerTaskStats before;
+    LayerTaskStats after;
+
+    int64_t getDeltaNs() const;
+    bool isTilingChanged() const;
+    bool isClusteringChanged() const;
+    CompareStatus getStatus() const;
+};
+
+struct EngineStats {
+    uint64_t busyNs = 0;  ///< Time when at least one task of the engine was running
+    uint64_t idleNs = 0;  ///< Time of the inference when the engine was not running any task
+    size_t numTasks = 0;
+};
+
+struct EngineDiff {
+    TaskInfo::ExecType execType = TaskInfo::ExecType::NONE;
+    EngineStats before;
+    EngineStats after;
+};
+
+struct ScheduleStats {
+    uint64_t latencyNs = 0;       ///< From the start of the first task until the end of the last one
+    uint64_t idleNs = 0;          ///< Time of the inference when no engine was running any task
+    uint64_t criticalPathNs = 0;  ///< Sum of the durations of the critical path tasks
+    std::vector<std::string> criticalPathLayers;  ///< Layers on the critical path in execution order
+};
+
+/**
+ * @brief Comparison of the schedules of the same model profiled twice, e.g. before and after a compiler update
+ * @details Profiling does not carry dependencies, so the critical path is approximated by walking back from the
+ * task finishing last and choosing each time the task which finished the latest before the current one started.
+ */
+struct ProfilingComparison {
+    ScheduleStats before;
+    ScheduleStats after;
+    std::vector<EngineDiff> engines;
+    std::vector<LayerTaskDiff> layers;
+};
+
+enum class CompareSortKey { DELTA, NAME, BEFORE, AFTER };
+
+/**
+ * @fn compareProfiling
+ * @brief Aligns tasks of two profiled runs and computes per-layer and per-engine differences
+ * @param before output of \b getTaskInfo for the reference run
+ * @param after output of \b getTaskInfo for the run being analyzed
+ * @return layers are sorted by the absolute time delta in descending order
+ * @see getTaskInfo
+ */
+ProfilingComparison compareProfiling(const std::vector<TaskInfo>& before, const std::vector<TaskInfo>& after);
+
+CompareSortKey parseCompareSortKey(const std::string& key);
+
+void sortLayerDiffs(std::vector<LayerTaskDiff>& layers, CompareSortKey sortKey);
+
+void printComparisonAsText(const ProfilingComparison& comparison, std::ostream& outStream);
+
+void printComparisonAsJson(const ProfilingComparison& comparison, std::ostream& outStream);
+
+}  // namespace profiling
+}  // namespace vpux
@@ -0,0 +1,260 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include "vpux/utils/core/error.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vpux {
+
+/**
+ * @brief Statistics of the requests handled by RequestCoalescer
+ */
+struct CoalescingStats final {
+    uint64_t batches = 0;          ///< Number of the groups run by the batched runner
+    uint64_t batchedRequests = 0;  ///< Number of the requests run by the batched runner
+    uint64_t singleRequests = 0;   ///< Number of the requests returned to their callers to be run alone
+    uint64_t addedLatencyTotalUs = 0;  ///< Time spent by the requests waiting to be grouped
+    uint64_t addedLatencyMaxUs = 0;
+    uint64_t elapsedUs = 0;  ///< From the first submission until the last dispatch or batch completion
+
+    uint64_t getThroughputFps() const {
+        return elapsedUs == 0 ? 0 : (batchedRequests + singleRequests) * 1000000 / elapsedUs;
+    }
+};
+
+/**
+ * @brief Groups the requests submitted concurrently to run them at once
+ * @details The first pending request waits for the others during the window. The group is formed as soon as it is
+ * full or the window is over. Groups of several requests are run by the batched runner on a dedicated thread, one at
+ * a time, so the resources shared by the batches need no synchronization. While a group is running, the next one
+ * keeps growing. A request left alone is returned to its caller right away and is run by its own pipeline,
+ * concurrently with the batches and with the other requests, so the light traffic is not serialized. The batched
+ * runner may decline a group, e.g. if it can't be run at once, its requests are then returned to the callers too.
+ */
+template <typename Request>
+class RequestCoalescer final {
+public:
+    /// Returns false if the group is declined and its requests must be run by their callers
+    using BatchRunner = std::function<bool(const std::vector<Request>&)>;
+    /// Gets false if the caller must run the request alone, or the error of the batched runner
+    using Completion = std::function<void(bool isBatched, std::exception_ptr error)>;
+
+    RequestCoalescer(size_t maxBatch, std::chrono::microseconds window, BatchRunner runBatch)
+            : _maxBatch(maxBatch), _window(window), _runBatch(std::move(runBatch)) {
+        VPUX_THROW_WHEN(_maxBatch < 2, "Batch size must be at least 2, got {0}", _maxBatch);
+        _groupingWorker = std::thread([this]() {
+            groupRequests();
+        });
+        _batchWorker = std::thread([this]() {
+            runBatches();
+        });
+    }
+
+    RequestCoalescer(const RequestCoalescer&) = delete;
+    RequestCoalescer& operator=(const RequestCoalescer&) = delete;
+
+    // The pending requests are dispatched before the threads are joined
+    ~RequestCoalescer() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stopped = true;
+        }
+        _stateChanged.notify_all();
+        _groupingWorker.join();
+        _batchWorker.join();
+    }
+
+    /**
+     * @brief Queues the request without blocking
+     * @details `done` is called by the coalescer threads, without the lock, once the request is run by the batched
+     * runner or is returned to the caller. It must not throw.
+     */
+    void submit(Request request, Completion done) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        VPUX_THROW_WHEN(_stopped, "Request is submitted to the stopped coalescer");
+
+        Pending pending{std::move(request), std::move(done), Clock::now()};
+        if (_firstSubmittedAt == Clock::time_point()) {
+            _firstSubmittedAt = pending.submittedAt;
+        }
+        _pending.push_back(std::move(pending));
+        _stateChanged.notify_all();
+    }
+
+    /**
+     * @brief Queues the request
+     * @return The future set to true once the request is run by the batched runner, or to false if the caller must
+     * run the request alone. The exceptions of the batched runner are forwarded.
+     */
+    std::future<bool> submit(Request request) {
+        const auto promise = std::make_shared<std::promise<bool>>();
+        auto future = promise->get_future();
+        submit(std::move(request), [promise](bool isBatched, std::exception_ptr error) {
+            if (error != nullptr) {
+                promise->set_exception(error);
+            } else {
+                promise->set_value(isBatched);
+            }
+        });
+        return future;
+    }
+
+    CoalescingStats getStats() const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _stats;
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Pending final {
+        Request request;
+        Completion done;
+        Clock::time_point submittedAt;
+    };
+
+    void groupRequests() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (true) {
+            _stateChanged.wait(lock, [&]() {
+                return _stopped || !_pending.empty();
+            });
+            if (_pending.empty()) {
+                _groupingDone = true;
+                _stateChanged.notify_all();
+                return;
+            }
+
+            const auto deadline = _pending.front().submittedAt + _window;
+            _stateChanged.wait_until(lock, deadline, [&]() {
+                return _stopped || _pending.size() >= _maxBatch;
+            });
+
+            if (_pending.size() == 1) {
+                auto single = takePending(1);
+                ++_stats.singleRequests;
+                updateElapsed();
+
+                lock.unlock();
+                single.front().done(false, nullptr);
+                lock.lock();
+                continue;
+            }
+
+            // Only this thread takes the pending requests, so the group can't shrink while the previous one runs
+            _stateChanged.wait(lock, [&]() {
+                return !_batchBusy;
+            });
+            _group = takePending(std::min(_pending.size(), _maxBatch));
+            _batchBusy = true;
+            _stateChanged.notify_all();
+        }
+    }
+
+    void runBatches() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (true) {
+            _stateChanged.wait(lock, [&]() {
+                return _batchBusy || _groupingDone;
+            });
+            if (!_batchBusy) {
+                return;
+            }
+
+            auto group = std::move(_group);
+            _group.clear();
+
+            std::vector<Request> requests;
+            for (const auto& pending : group) {
+                requests.push_back(pending.request);
+            }
+
+            lock.unlock();
+            bool isBatched = false;
+            std::exception_ptr error;
+            try {
+                isBatched = _runBatch(requests);
+            } catch (...) {
+                error = std::current_exception();
+            }
+            lock.lock();
+
+            if (error == nullptr && !isBatched) {
+                _stats.singleRequests += group.size();
+            } else {
+                ++_stats.batches;
+                _stats.batchedRequests += group.size();
+            }
+            updateElapsed();
+            _batchBusy = false;
+            _stateChanged.notify_all();
+
+            // Statistics are updated first, so they account for the request once it is completed
+            lock.unlock();
+            for (auto& pending : group) {
+                pending.done(error == nullptr && isBatched, error);
+            }
+            lock.lock();
+        }
+    }
+
+    // Called under the lock
+    std::vector<Pending> takePending(size_t count) {
+        const auto dispatchedAt = Clock::now();
+
+        std::vector<Pending> taken;
+        for (size_t i = 0; i < count; ++i) {
+            const auto delayUs = static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::microseconds>(dispatchedAt - _pending.front().submittedAt)
+                            .count());
+            _stats.addedLatencyTotalUs += delayUs;
+            _stats.addedLatencyMaxUs = std::max(_stats.addedLatencyMaxUs, delayUs);
+
+            taken.push_back(std::move(_pending.front()));
+            _pending.pop_front();
+        }
+        return taken;
+    }
+
+    // Called under the lock
+    void updateElapsed() {
+        _stats.elapsedUs = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - _firstSubmittedAt).count());
+    }
+
+    const size_t _maxBatch;
+    const std::chrono::microseconds _window;
+    const BatchRunner _runBatch;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _stateChanged;
+    std::deque<Pending> _pending;
+    std::vector<Pending> _group;  ///< Handed from the grouping thread to the batch thread
+    bool _batchBusy = false;
+    bool _groupingDone = false;
+    bool _stopped = false;
+
+    Clock::time_point _firstSubmittedAt;
+    CoalescingStats _stats;
+
+    std::thread _groupingWorker;
+    std::thread _batchWorker;
+};
+
+}  // namespace vpux
@@ -217,6 +217,18 @@ std::string vpux::Config::toString() const {
     return resultStream.str();
 }
 
+vpux::Config::ConfigMap vpux::Config::toMap(OptionMode mode) const {
+    ConfigMap result;
+    for (const auto& p : _impl) {
+        const auto optMode = _desc->get(p.first, OptionMode::Both).mode();
+        if (mode == OptionMode::Both || optMode == OptionMode::Both || optMode == mode) {
+            result.emplace(p.first.str(), p.second->toString());
+        }
+    }
+
+    return result;
+}
+
 //
 // envVarStrToBool
 //
@@ -0,0 +1,86 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/utils/core/process_memory.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#ifdef _WIN32
+// clang-format off
+#include <windows.h>
+#include <psapi.h>
+// clang-format on
+#endif
+
+using namespace vpux;
+
+namespace {
+
+#ifdef __linux__
+
+int64_t readProcStatusField(const std::string& field) {
+    std::ifstream status("/proc/self/status");
+
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, field.size(), field) == 0 && line.size() > field.size() && line[field.size()] == ':') {
+            std::istringstream value(line.substr(field.size() + 1));
+            int64_t kb = 0;
+            value >> kb;
+            return kb;
+        }
+    }
+
+    return 0;
+}
+
+#endif
+
+}  // namespace
+
+int64_t vpux::getCurrentRSS() {
+#if defined(__linux__)
+    return readProcStatusField("VmRSS");
+#elif defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return static_cast<int64_t>(counters.WorkingSetSize / 1024);
+    }
+    return 0;
+#else
+    return 0;
+#endif
+}
+
+int64_t vpux::getPeakRSS() {
+#if defined(__linux__)
+    return readProcStatusField("VmHWM");
+#elif defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return static_cast<int64_t>(counters.PeakWorkingSetSize / 1024);
+    }
+    return 0;
+#else
+    return 0;
+#endif
+}
+
+bool vpux::resetPeakRSS() {
+#if defined(__linux__)
+    // Writing "5" resets the peak RSS counter of the process (Linux 4.0+)
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    if (!clearRefs.is_open()) {
+        return false;
+    }
+    clearRefs << "5";
+    clearRefs.flush();
+    return clearRefs.good();
+#else
+    return false;
+#endif
+}
@@ -0,0 +1,205 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/utils/core/trace_decoder.hpp"
+
+#include "vpux/utils/core/error.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+using namespace vpux;
+
+namespace {
+
+template <typename T>
+T readValue(std::istream& stream) {
+    T val;
+    stream.read(reinterpret_cast<char*>(&val), sizeof(val));
+    VPUX_THROW_UNLESS(stream.good(), "Unexpected end of the trace");
+    return val;
+}
+
+std::string readString(std::istream& stream) {
+    const auto size = readValue<uint32_t>(stream);
+    std::string str(size, '\0');
+    stream.read(&str[0], size);
+    VPUX_THROW_UNLESS(stream.good(), "Unexpected end of the trace");
+    return str;
+}
+
+TraceRecord readRecord(std::istream& stream) {
+    TraceRecord rec;
+    rec.timestampNs = readValue<uint64_t>(stream);
+    rec.eventId = readValue<uint32_t>(stream);
+    rec.phase = static_cast<TracePhase>(readValue<uint8_t>(stream));
+    rec.numArgs = readValue<uint8_t>(stream);
+    VPUX_THROW_WHEN(rec.numArgs > MAX_TRACE_EVENT_ARGS, "Trace record has {0} arguments, at most {1} are supported",
+                    rec.numArgs, MAX_TRACE_EVENT_ARGS);
+    for (size_t i = 0; i < rec.numArgs; ++i) {
+        rec.argTypes[i] = static_cast<TraceArgType>(readValue<uint8_t>(stream));
+        rec.args[i] = readValue<uint64_t>(stream);
+    }
+    return rec;
+}
+
+// Events missing from the table are still printed, by their identifiers
+TraceEventDesc getEvent(const DecodedTrace& trace, uint32_t eventId) {
+    const auto it = trace.events.find(eventId);
+    if (it != trace.events.end()) {
+        return it->second;
+    }
+
+    std::stringstream name;
+    name << "event_" << std::hex << eventId;
+    return {eventId, "unknown", name.str(), ""};
+}
+
+std::vector<std::string> getArgNames(const TraceEventDesc& event, const TraceRecord& rec) {
+    std::vector<std::string> names;
+    std::stringstream argNames(event.argNames);
+    std::string name;
+    while (std::getline(argNames, name, ',')) {
+        names.push_back(name);
+    }
+    for (size_t i = names.size(); i < rec.numArgs; ++i) {
+        names.push_back("arg" + std::to_string(i));
+    }
+    return names;
+}
+
+void printArgValue(const TraceRecord& rec, size_t ind, std::ostream& stream) {
+    switch (rec.argTypes[ind]) {
+    case TraceArgType::Int:
+        stream << static_cast<int64_t>(rec.args[ind]);
+        break;
+    case TraceArgType::UInt:
+        stream << rec.args[ind];
+        break;
+    case TraceArgType::Double: {
+        double val;
+        std::memcpy(&val, &rec.args[ind], sizeof(val));
+        stream << val;
+        break;
+    }
+    default:
+        VPUX_THROW("Unsupported trace argument type '{0}'", static_cast<int>(rec.argTypes[ind]));
+    }
+}
+
+char getPhaseCode(TracePhase phase) {
+    switch (phase) {
+    case TracePhase::Instant:
+        return 'i';
+    case TracePhase::Begin:
+        return 'B';
+    case TracePhase::End:
+        return 'E';
+    default:
+        VPUX_THROW("Unsupported trace phase '{0}'", static_cast<int>(phase));
+    }
+}
+
+std::string escapeJson(const std::string& str) {
+    std::string escaped;
+    for (const auto c : str) {
+        if (c == '"' || c == '\\') {
+            escaped.push_back('\\');
+        }
+        escaped.push_back(c);
+    }
+    return escaped;
+}
+
+double getRelativeTimeUs(const DecodedTrace& trace, const TraceRecord& rec) {
+    return static_cast<double>(rec.timestampNs - trace.records.front().record.timestampNs) / 1000.0;
+}
+
+}  // namespace
+
+DecodedTrace vpux::readTrace(std::istream& stream) {
+    char magic[sizeof(TRACE_FILE_MAGIC)];
+    stream.read(magic, sizeof(magic));
+    VPUX_THROW_UNLESS(stream.good() && std::memcmp(magic, TRACE_FILE_MAGIC, sizeof(magic)) == 0,
+                      "The file is not a trace recorded by TraceRecorder");
+    const auto version = readValue<uint32_t>(stream);
+    VPUX_THROW_UNLESS(version == TRACE_FILE_VERSION, "Unsupported trace version '{0}', expected '{1}'", version,
+                      TRACE_FILE_VERSION);
+
+    DecodedTrace trace;
+    const auto numEvents = readValue<uint32_t>(stream);
+    for (uint32_t i = 0; i < numEvents; ++i) {
+        TraceEventDesc event;
+        event.id = readValue<uint32_t>(stream);
+        event.category = readString(stream);
+        event.name = readString(stream);
+        event.argNames = readString(stream);
+        trace.events[event.id] = event;
+    }
+
+    const auto numThreads = readValue<uint32_t>(stream);
+    for (uint32_t i = 0; i < numThreads; ++i) {
+        const auto threadId = readValue<uint32_t>(stream);
+        const auto numRecords = readValue<uint64_t>(stream);
+        for (uint64_t r = 0; r < numRecords; ++r) {
+            trace.records.push_back({threadId, readRecord(stream)});
+        }
+    }
+
+    std::stable_sort(trace.records.begin(), trace.records.end(),
+                     [](const DecodedTraceRecord& lhs, const DecodedTraceRecord& rhs) {
+                         return lhs.record.timestampNs < rhs.record.timestampNs;
+                     });
+    return trace;
+}
+
+void vpux::printTraceAsText(const DecodedTrace& trace, std::ostream& stream) {
+    stream << std::fixed << std::setprecision(3);
+    for (const auto& decoded : trace.records) {
+        const auto& rec = decoded.record;
+        const auto event = getEvent(trace, rec.eventId);
+        stream << std::setw(14) << getRelativeTimeUs(trace, rec) << " us  T" << decoded.threadId << "  "
+               << getPhaseCode(rec.phase) << "  " << event.category << "." << event.name;
+
+        const auto argNames = getArgNames(event, rec);
+        for (size_t i = 0; i < rec.numArgs; ++i) {
+            stream << "  " << argNames[i] << "=";
+            printArgValue(rec, i, stream);
+        }
+        stream << std::endl;
+    }
+}
+
+void vpux::printTraceAsPerfetto(const DecodedTrace& trace, std::ostream& stream) {
+    stream << std::fixed << std::setprecision(3);
+    stream << "{\"traceEvents\": [" << std::endl;
+    for (size_t r = 0; r < trace.records.size(); ++r) {
+        const auto& decoded = trace.records[r];
+        const auto& rec = decoded.record;
+
+        const auto event = getEvent(trace, rec.eventId);
+        stream << "{\"name\": \"" << escapeJson(event.name) << "\", \"cat\": \"" << escapeJson(event.category)
+               << "\", \"ph\": \"" << getPhaseCode(rec.phase) << "\", ";
+        if (rec.phase == TracePhase::Instant) {
+            stream << "\"s\": \"t\", ";
+        }
+        stream << "\"ts\": " << getRelativeTimeUs(trace, rec) << ", \"pid\": 0, \"tid\": " << decoded.threadId;
+
+        if (rec.numArgs != 0) {
+            const auto argNames = getArgNames(event, rec);
+            stream << ", \"args\": {";
+            for (size_t i = 0; i < rec.numArgs; ++i) {
+                stream << (i == 0 ? "" : ", ") << "\"" << escapeJson(argNames[i]) << "\": ";
+                printArgValue(rec, i, stream);
+            }
+            stream << "}";
+        }
+        stream << "}" << (r + 1 == trace.records.size() ? "" : ",") << std::endl;
+    }
+    stream << "]}" << std::endl;
+}
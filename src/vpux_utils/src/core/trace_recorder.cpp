@@ -0,0 +1,239 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/utils/core/trace_recorder.hpp"
+#include "vpux/utils/core/trace_decoder.hpp"
+
+#include "vpux/utils/core/error.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+
+using namespace vpux;
+
+namespace {
+
+template <typename T>
+void writeValue(std::ostream& stream, const T& val) {
+    stream.write(reinterpret_cast<const char*>(&val), sizeof(val));
+}
+
+void writeString(std::ostream& stream, const std::string& str) {
+    writeValue(stream, static_cast<uint32_t>(str.size()));
+    stream.write(str.data(), str.size());
+}
+
+// Fields are written one by one, so the padding of TraceRecord does not leak into the file
+void writeRecord(std::ostream& stream, const TraceRecord& rec) {
+    writeValue(stream, rec.timestampNs);
+    writeValue(stream, rec.eventId);
+    writeValue(stream, static_cast<uint8_t>(rec.phase));
+    writeValue(stream, rec.numArgs);
+    for (size_t i = 0; i < rec.numArgs; ++i) {
+        writeValue(stream, static_cast<uint8_t>(rec.argTypes[i]));
+        writeValue(stream, rec.args[i]);
+    }
+}
+
+// Set when the thread buffer lease of the thread is destroyed, the flag itself has no destructor
+thread_local bool isThreadBufferReleased = false;
+
+// Stops the recording at exit, the recorder itself is never destroyed
+struct TraceRecorderFinalizer final {
+    ~TraceRecorderFinalizer() {
+        TraceRecorder::get().finalize();
+    }
+} traceRecorderFinalizer;
+
+}  // namespace
+
+//
+// TraceRecorder
+//
+
+std::atomic<bool> vpux::TraceRecorder::_enabled{false};
+
+// Returns the buffer of the thread to the recorder when the thread exits
+class vpux::TraceRecorder::ThreadBufferLease final {
+public:
+    ~ThreadBufferLease() {
+        isThreadBufferReleased = true;
+        if (buffer != nullptr) {
+            TraceRecorder::get().releaseThreadBuffer(buffer);
+        }
+    }
+
+    ThreadBuffer* buffer = nullptr;
+};
+
+TraceRecorder& vpux::TraceRecorder::get() {
+    static auto* recorder = new TraceRecorder();
+    return *recorder;
+}
+
+vpux::TraceRecorder::TraceRecorder() {
+    if (const auto env = std::getenv("IE_NPU_TRACE_FILE")) {
+        _dumpFileName = env;
+        enable();
+    }
+}
+
+void vpux::TraceRecorder::enable(size_t capacityPerThread) {
+    VPUX_THROW_WHEN(capacityPerThread == 0, "Trace buffer capacity must be positive");
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _capacity = capacityPerThread;
+    _enabled.store(true, std::memory_order_relaxed);
+}
+
+void vpux::TraceRecorder::disable() {
+    _enabled.store(false, std::memory_order_relaxed);
+}
+
+void vpux::TraceRecorder::finalize() {
+    disable();
+    if (_dumpFileName.empty()) {
+        return;
+    }
+
+    try {
+        dump(_dumpFileName);
+    } catch (...) {
+        // Exceptions must not leave the destructor of the static object
+    }
+}
+
+void vpux::TraceRecorder::clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto& buffer : _threadBuffers) {
+        buffer->clear();
+    }
+}
+
+void vpux::TraceRecorder::registerEvent(const TraceEventDesc& desc) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    // Events defined in headers are registered once per translation unit
+    const auto it = std::find_if(_events.begin(), _events.end(), [&](const TraceEventDesc& event) {
+        return event.id == desc.id;
+    });
+    if (it != _events.end()) {
+        VPUX_THROW_UNLESS(it->category == desc.category && it->name == desc.name,
+                          "Trace events '{0}.{1}' and '{2}.{3}' have the same identifier", it->category, it->name,
+                          desc.category, desc.name);
+        return;
+    }
+    _events.push_back(desc);
+}
+
+TraceRecorder::ThreadBuffer* vpux::TraceRecorder::getThreadBuffer() {
+    if (isThreadBufferReleased) {
+        return nullptr;
+    }
+
+    thread_local ThreadBufferLease lease;
+    if (lease.buffer == nullptr) {
+        lease.buffer = acquireThreadBuffer();
+    }
+    return lease.buffer;
+}
+
+// Buffers are owned by the recorder, so the records of the exited threads are kept for the dump until the buffer is
+// taken over by a new thread
+TraceRecorder::ThreadBuffer* vpux::TraceRecorder::acquireThreadBuffer() {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    const auto threadId = _nextThreadId++;
+    while (!_freeThreadBuffers.empty()) {
+        auto* buffer = _freeThreadBuffers.back();
+        _freeThreadBuffers.pop_back();
+        if (buffer->capacity() == _capacity) {
+            buffer->reset(threadId);
+            return buffer;
+        }
+
+        // Created before the capacity was changed
+        _threadBuffers.erase(std::find_if(_threadBuffers.begin(), _threadBuffers.end(),
+                                          [&](const std::unique_ptr<ThreadBuffer>& threadBuffer) {
+                                              return threadBuffer.get() == buffer;
+                                          }));
+    }
+
+    _threadBuffers.push_back(std::make_unique<ThreadBuffer>(threadId, _capacity));
+    return _threadBuffers.back().get();
+}
+
+void vpux::TraceRecorder::releaseThreadBuffer(ThreadBuffer* buffer) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _freeThreadBuffers.push_back(buffer);
+}
+
+//
+// TraceRecorder::ThreadBuffer
+//
+
+std::vector<TraceRecord> vpux::TraceRecorder::ThreadBuffer::snapshot() const {
+    const auto head = _head.load(std::memory_order_acquire);
+    const auto capacity = static_cast<uint64_t>(_slots.size());
+    const auto first = std::max(_begin, head > capacity ? head - capacity : 0);
+
+    std::vector<TraceRecord> records;
+    records.reserve(static_cast<size_t>(head - first));
+    for (auto index = first; index < head; ++index) {
+        const auto& slot = _slots[index % capacity];
+        const auto sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence != 2 * index + 2) {
+            continue;
+        }
+
+        std::array<uint64_t, RECORD_WORDS> words;
+        for (size_t i = 0; i < RECORD_WORDS; ++i) {
+            words[i] = slot.words[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) != sequence) {
+            continue;
+        }
+
+        TraceRecord rec;
+        std::memcpy(static_cast<void*>(&rec), words.data(), sizeof(rec));
+        records.push_back(rec);
+    }
+    return records;
+}
+
+void vpux::TraceRecorder::dump(std::ostream& stream) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    stream.write(TRACE_FILE_MAGIC, sizeof(TRACE_FILE_MAGIC));
+    writeValue(stream, TRACE_FILE_VERSION);
+
+    writeValue(stream, static_cast<uint32_t>(_events.size()));
+    for (const auto& event : _events) {
+        writeValue(stream, event.id);
+        writeString(stream, event.category);
+        writeString(stream, event.name);
+        writeString(stream, event.argNames);
+    }
+
+    writeValue(stream, static_cast<uint32_t>(_threadBuffers.size()));
+    for (const auto& buffer : _threadBuffers) {
+        const auto records = buffer->snapshot();
+        writeValue(stream, buffer->threadId());
+        writeValue(stream, static_cast<uint64_t>(records.size()));
+        for (const auto& rec : records) {
+            writeRecord(stream, rec);
+        }
+    }
+
+    VPUX_THROW_UNLESS(stream.good(), "Failed to write the trace");
+}
+
+void vpux::TraceRecorder::dump(const std::string& fileName) const {
+    std::ofstream stream(fileName, std::ios::out | std::ios::binary);
+    VPUX_THROW_UNLESS(stream.is_open(), "Failed to open '{0}' to write the trace", fileName);
+    dump(stream);
+}
@@ -0,0 +1,206 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/utils/plugin/inference_scheduler.hpp"
+
+#include "vpux/utils/core/error.hpp"
+
+#include <algorithm>
+#include <future>
+#include <memory>
+
+using namespace vpux;
+
+InferenceScheduler::InferenceScheduler(uint32_t maxInFlight, const Weights& weights)
+        : _maxInFlight(maxInFlight), _weights(weights), _credits(weights) {
+    VPUX_THROW_WHEN(std::find(weights.begin(), weights.end(), 0u) != weights.end(),
+                    "Weights of the priority classes must be positive");
+}
+
+InferenceScheduler::Class InferenceScheduler::toClass(ov::hint::Priority priority) {
+    switch (priority) {
+    case ov::hint::Priority::HIGH:
+        return HIGH;
+    case ov::hint::Priority::MEDIUM:
+        return MEDIUM;
+    case ov::hint::Priority::LOW:
+        return LOW;
+    default:
+        VPUX_THROW("Unsupported priority '{0}'", static_cast<int>(priority));
+    }
+}
+
+void InferenceScheduler::addInFlightLimit(uint32_t maxInFlight) {
+    if (maxInFlight == 0) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _limits.insert(maxInFlight);
+}
+
+void InferenceScheduler::removeInFlightLimit(uint32_t maxInFlight) {
+    if (maxInFlight == 0) {
+        return;
+    }
+
+    std::vector<Submit> granted;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        const auto limit = _limits.find(maxInFlight);
+        VPUX_THROW_WHEN(limit == _limits.end(), "In-flight limit '{0}' has not been added", maxInFlight);
+        _limits.erase(limit);
+        granted = dispatch();
+    }
+    run(granted);
+}
+
+InferenceScheduler::Ticket InferenceScheduler::enqueue(ov::hint::Priority priority, Submit submit) {
+    const auto cls = toClass(priority);
+    const auto queuedAt = std::chrono::steady_clock::now();
+
+    std::vector<Submit> granted;
+    Ticket ticket = 0;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        ticket = _nextTicket++;
+
+        // Uncontended inferences don't spend the credits of the weighted round-robin
+        if (isQueueEmpty() && hasFreeSlot()) {
+            ++_inFlight;
+            recordDelay(cls, queuedAt);
+            granted.push_back(std::move(submit));
+        } else {
+            _queues[cls].push_back(Pending{ticket, std::move(submit), queuedAt});
+            granted = dispatch();
+        }
+    }
+    run(granted);
+    return ticket;
+}
+
+bool InferenceScheduler::cancel(Ticket ticket) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto& queue : _queues) {
+        const auto pending = std::find_if(queue.begin(), queue.end(), [&](const Pending& item) {
+            return item.ticket == ticket;
+        });
+        if (pending != queue.end()) {
+            queue.erase(pending);
+            return true;
+        }
+    }
+    return false;
+}
+
+void InferenceScheduler::acquire(ov::hint::Priority priority) {
+    // The promise outlives this call, the releasing thread may still be inside set_value when the wait returns
+    const auto granted = std::make_shared<std::promise<void>>();
+    auto future = granted->get_future();
+    enqueue(priority, [granted]() {
+        granted->set_value();
+    });
+    future.wait();
+}
+
+void InferenceScheduler::release() {
+    std::vector<Submit> granted;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        VPUX_THROW_WHEN(_inFlight == 0, "Release without a granted inference");
+
+        --_inFlight;
+        granted = dispatch();
+    }
+    run(granted);
+}
+
+void InferenceScheduler::run(const std::vector<Submit>& granted) {
+    for (const auto& submit : granted) {
+        submit();
+    }
+}
+
+uint32_t InferenceScheduler::getMaxInFlightImpl() const {
+    if (_limits.empty()) {
+        return _maxInFlight;
+    }
+    return _maxInFlight == 0 ? *_limits.begin() : std::min(_maxInFlight, *_limits.begin());
+}
+
+bool InferenceScheduler::hasFreeSlot() const {
+    const auto maxInFlight = getMaxInFlightImpl();
+    return maxInFlight == 0 || _inFlight < maxInFlight;
+}
+
+bool InferenceScheduler::isQueueEmpty() const {
+    return std::all_of(_queues.begin(), _queues.end(), [](const std::deque<Pending>& queue) {
+        return queue.empty();
+    });
+}
+
+InferenceScheduler::Class InferenceScheduler::nextClass() {
+    if (!_queues[HIGH].empty()) {
+        return HIGH;
+    }
+
+    // Weighted round-robin: a class is served while it has credits, credits are refilled once all are spent
+    const std::array<Class, 2> weighted = {MEDIUM, LOW};
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        for (size_t idx = 0; idx < weighted.size(); ++idx) {
+            if (!_queues[weighted[idx]].empty() && _credits[idx] > 0) {
+                --_credits[idx];
+                return weighted[idx];
+            }
+        }
+        _credits = _weights;
+    }
+
+    VPUX_THROW("No queued inferences to schedule");
+}
+
+std::vector<InferenceScheduler::Submit> InferenceScheduler::dispatch() {
+    std::vector<Submit> granted;
+    while (hasFreeSlot() && !isQueueEmpty()) {
+        const auto cls = nextClass();
+        auto& queue = _queues[cls];
+        recordDelay(cls, queue.front().queuedAt);
+        granted.push_back(std::move(queue.front().submit));
+        queue.pop_front();
+        ++_inFlight;
+    }
+    return granted;
+}
+
+void InferenceScheduler::recordDelay(Class cls, std::chrono::steady_clock::time_point queuedAt) {
+    const auto delay = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - queuedAt)
+                    .count());
+
+    auto& stats = _delays[cls];
+    ++stats.count;
+    stats.totalUs += delay;
+    stats.maxUs = std::max(stats.maxUs, delay);
+}
+
+uint32_t InferenceScheduler::getMaxInFlight() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return getMaxInFlightImpl();
+}
+
+size_t InferenceScheduler::getQueuedCount() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    size_t count = 0;
+    for (const auto& queue : _queues) {
+        count += queue.size();
+    }
+    return count;
+}
+
+QueueingDelay InferenceScheduler::getQueueingDelay(ov::hint::Priority priority) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _delays[toClass(priority)];
+}
@@ -0,0 +1,443 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/utils/plugin/profiling_compare.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iterator>
+#include <map>
+#include <set>
+#include <sstream>
+#include <tuple>
+
+using namespace vpux;
+using namespace vpux::profiling;
+
+namespace {
+
+using LayerTaskKey = std::pair<std::string, TaskInfo::ExecType>;
+
+struct LayerTaskInfo {
+    std::string layerType;
+    LayerTaskStats stats;
+    std::set<std::string> clusters;
+};
+
+struct ProfiledRun {
+    std::map<LayerTaskKey, LayerTaskInfo> layers;
+    std::map<TaskInfo::ExecType, EngineStats> engines;
+    ScheduleStats schedule;
+};
+
+const std::map<TaskInfo::ExecType, std::string> execTypeToStr = {
+        {TaskInfo::ExecType::NONE, "NONE"}, {TaskInfo::ExecType::DPU, "DPU"}, {TaskInfo::ExecType::SW, "SW"},
+        {TaskInfo::ExecType::DMA, "DMA"},   {TaskInfo::ExecType::UPA, "UPA"},
+};
+
+const std::map<CompareStatus, std::string> statusToStr = {
+        {CompareStatus::UNCHANGED, "unchanged"},
+        {CompareStatus::CHANGED, "changed"},
+        {CompareStatus::ADDED, "added"},
+        {CompareStatus::REMOVED, "removed"},
+};
+
+bool hasSuffix(const TaskInfo& task, const std::string& suffix) {
+    return std::strstr(task.name, suffix.c_str()) != nullptr;
+}
+
+bool isLowLevelTask(const TaskInfo& task) {
+    return hasSuffix(task, VARIANT_LEVEL_PROFILING_SUFFIX) || hasSuffix(task, TILE_LEVEL_PROFILING_SUFFIX);
+}
+
+bool isClusterLevelTask(const TaskInfo& task) {
+    return hasSuffix(task, CLUSTER_LEVEL_PROFILING_SUFFIX) && !isLowLevelTask(task);
+}
+
+// Cluster id follows CLUSTER_LEVEL_PROFILING_SUFFIX and ends either with the end of the name or with '/'
+std::string getClusterId(const std::string& taskName) {
+    const auto pos = taskName.rfind(CLUSTER_LEVEL_PROFILING_SUFFIX);
+    const auto idBegin = pos + CLUSTER_LEVEL_PROFILING_SUFFIX.size();
+    return taskName.substr(idBegin, taskName.find('/', idBegin) - idBegin);
+}
+
+// Layer name is the task name without the cluster/variant suffixes and location origin details
+std::string getTaskLayerName(const std::string& taskName) {
+    return RawProfilingRecord::getLayerName(taskName.substr(0, taskName.find(CLUSTER_LEVEL_PROFILING_SUFFIX)));
+}
+
+uint64_t getEndTime(const TaskInfo& task) {
+    return task.start_time_ns + task.duration_ns;
+}
+
+// Total time covered by at least one task
+uint64_t getBusyTime(std::vector<TaskInfo> tasks) {
+    std::sort(tasks.begin(), tasks.end(), [](const TaskInfo& lhs, const TaskInfo& rhs) {
+        return lhs.start_time_ns < rhs.start_time_ns;
+    });
+
+    uint64_t busyNs = 0;
+    uint64_t coveredUntil = 0;
+    for (const auto& task : tasks) {
+        const auto begin = std::max(task.start_time_ns, coveredUntil);
+        const auto end = getEndTime(task);
+        if (end > begin) {
+            busyNs += end - begin;
+            coveredUntil = end;
+        }
+    }
+    return busyNs;
+}
+
+std::vector<TaskInfo> getCriticalPath(std::vector<TaskInfo> tasks) {
+    std::stable_sort(tasks.begin(), tasks.end(), [](const TaskInfo& lhs, const TaskInfo& rhs) {
+        return std::make_tuple(getEndTime(lhs), lhs.duration_ns) < std::make_tuple(getEndTime(rhs), rhs.duration_ns);
+    });
+
+    std::vector<TaskInfo> criticalPath;
+    auto current = tasks.end();
+    if (!tasks.empty()) {
+        current = std::prev(tasks.end());
+    }
+    while (current != tasks.end()) {
+        criticalPath.push_back(*current);
+
+        const auto startTime = current->start_time_ns;
+        auto predecessor = std::upper_bound(tasks.begin(), current, startTime, [](uint64_t time, const TaskInfo& task) {
+            return time < getEndTime(task);
+        });
+        current = predecessor == tasks.begin() ? tasks.end() : std::prev(predecessor);
+    }
+
+    std::reverse(criticalPath.begin(), criticalPath.end());
+    return criticalPath;
+}
+
+ProfiledRun analyzeRun(const std::vector<TaskInfo>& tasks) {
+    ProfiledRun run;
+
+    std::vector<TaskInfo> topLevelTasks;
+    for (const auto& task : tasks) {
+        const std::string taskName(task.name);
+        if (isClusterLevelTask(task)) {
+            run.layers[{getTaskLayerName(taskName), task.exec_type}].clusters.insert(getClusterId(taskName));
+        } else if (!isLowLevelTask(task)) {
+            topLevelTasks.push_back(task);
+        }
+    }
+    if (topLevelTasks.empty()) {
+        return run;
+    }
+
+    std::map<TaskInfo::ExecType, std::vector<TaskInfo>> engineTasks;
+    for (const auto& task : topLevelTasks) {
+        auto& layer = run.layers[{getTaskLayerName(task.name), task.exec_type}];
+        layer.layerType = task.layer_type;
+        layer.stats.durationNs += task.duration_ns;
+        ++layer.stats.numTasks;
+
+        engineTasks[task.exec_type].push_back(task);
+    }
+
+    const auto firstTask = std::min_element(topLevelTasks.begin(), topLevelTasks.end(),
+                                            [](const TaskInfo& lhs, const TaskInfo& rhs) {
+                                                return lhs.start_time_ns < rhs.start_time_ns;
+                                            });
+    const auto lastTask = std::max_element(topLevelTasks.begin(), topLevelTasks.end(),
+                                           [](const TaskInfo& lhs, const TaskInfo& rhs) {
+                                               return getEndTime(lhs) < getEndTime(rhs);
+                                           });
+    run.schedule.latencyNs = getEndTime(*lastTask) - firstTask->start_time_ns;
+    run.schedule.idleNs = run.schedule.latencyNs - getBusyTime(topLevelTasks);
+
+    for (const auto& engine : engineTasks) {
+        auto& stats = run.engines[engine.first];
+        stats.busyNs = getBusyTime(engine.second);
+        stats.idleNs = run.schedule.latencyNs - stats.busyNs;
+        stats.numTasks = engine.second.size();
+    }
+
+    for (const auto& task : getCriticalPath(topLevelTasks)) {
+        const auto layerName = getTaskLayerName(task.name);
+        run.layers[{layerName, task.exec_type}].stats.criticalPathNs += task.duration_ns;
+        run.schedule.criticalPathNs += task.duration_ns;
+
+        // Consecutive tasks of the same layer are reported once
+        if (run.schedule.criticalPathLayers.empty() || run.schedule.criticalPathLayers.back() != layerName) {
+            run.schedule.criticalPathLayers.push_back(layerName);
+        }
+    }
+
+    for (auto& layer : run.layers) {
+        layer.second.stats.numClusters = layer.second.clusters.size();
+    }
+
+    return run;
+}
+
+double toUs(uint64_t ns) {
+    return static_cast<double>(ns) / 1000;
+}
+
+double toUs(int64_t ns) {
+    return static_cast<double>(ns) / 1000;
+}
+
+std::string getDeltaPercent(uint64_t before, uint64_t after) {
+    if (before == 0) {
+        return "-";
+    }
+    std::ostringstream percent;
+    percent << std::showpos << std::fixed << std::setprecision(1)
+            << (static_cast<double>(after) - static_cast<double>(before)) * 100 / before << "%";
+    return percent.str();
+}
+
+std::string escapeJson(const std::string& str) {
+    std::string escaped;
+    for (const auto ch : str) {
+        if (ch == '"' || ch == '\\') {
+            escaped += '\\';
+        }
+        escaped += ch;
+    }
+    return escaped;
+}
+
+void printScheduleAsJson(const ScheduleStats& schedule, std::ostream& outStream) {
+    outStream << "{\"latency_ns\": " << schedule.latencyNs << ", \"idle_ns\": " << schedule.idleNs
+              << ", \"critical_path_ns\": " << schedule.criticalPathNs << ", \"critical_path_layers\": [";
+    for (size_t i = 0; i < schedule.criticalPathLayers.size(); ++i) {
+        outStream << (i == 0 ? "" : ", ") << "\"" << escapeJson(schedule.criticalPathLayers[i]) << "\"";
+    }
+    outStream << "]}";
+}
+
+void printLayerStatsAsJson(const LayerTaskStats& stats, std::ostream& outStream) {
+    outStream << "{\"duration_ns\": " << stats.durationNs << ", \"tasks\": " << stats.numTasks
+              << ", \"clusters\": " << stats.numClusters << ", \"critical_path_ns\": " << stats.criticalPathNs << "}";
+}
+
+void printEngineStatsAsJson(const EngineStats& stats, std::ostream& outStream) {
+    outStream << "{\"busy_ns\": " << stats.busyNs << ", \"idle_ns\": " << stats.idleNs
+              << ", \"tasks\": " << stats.numTasks << "}";
+}
+
+// Layers which are on the critical path of one run only
+std::vector<std::string> getCriticalPathDifference(const ScheduleStats& lhs, const ScheduleStats& rhs) {
+    const std::set<std::string> rhsLayers(rhs.criticalPathLayers.begin(), rhs.criticalPathLayers.end());
+    std::vector<std::string> difference;
+    for (const auto& layer : lhs.criticalPathLayers) {
+        if (rhsLayers.count(layer) == 0 && std::find(difference.begin(), difference.end(), layer) == difference.end()) {
+            difference.push_back(layer);
+        }
+    }
+    return difference;
+}
+
+}  // namespace
+
+//
+// LayerTaskDiff
+//
+
+int64_t vpux::profiling::LayerTaskDiff::getDeltaNs() const {
+    return static_cast<int64_t>(after.durationNs) - static_cast<int64_t>(before.durationNs);
+}
+
+bool vpux::profiling::LayerTaskDiff::isTilingChanged() const {
+    return inBefore && inAfter && before.numTasks != after.numTasks;
+}
+
+bool vpux::profiling::LayerTaskDiff::isClusteringChanged() const {
+    return inBefore && inAfter && before.numClusters != after.numClusters;
+}
+
+CompareStatus vpux::profiling::LayerTaskDiff::getStatus() const {
+    if (!inBefore) {
+        return CompareStatus::ADDED;
+    }
+    if (!inAfter) {
+        return CompareStatus::REMOVED;
+    }
+    if (isTilingChanged() || isClusteringChanged()) {
+        return CompareStatus::CHANGED;
+    }
+    return CompareStatus::UNCHANGED;
+}
+
+//
+// compareProfiling
+//
+
+ProfilingComparison vpux::profiling::compareProfiling(const std::vector<TaskInfo>& before,
+                                                      const std::vector<TaskInfo>& after) {
+    const auto beforeRun = analyzeRun(before);
+    const auto afterRun = analyzeRun(after);
+
+    ProfilingComparison comparison;
+    comparison.before = beforeRun.schedule;
+    comparison.after = afterRun.schedule;
+
+    std::map<TaskInfo::ExecType, EngineDiff> engines;
+    for (const auto& engine : beforeRun.engines) {
+        engines[engine.first].before = engine.second;
+    }
+    for (const auto& engine : afterRun.engines) {
+        engines[engine.first].after = engine.second;
+    }
+    for (auto& engine : engines) {
+        engine.second.execType = engine.first;
+        comparison.engines.push_back(engine.second);
+    }
+
+    std::map<LayerTaskKey, LayerTaskDiff> layers;
+    const auto addLayers = [&](const ProfiledRun& run, bool isBefore) {
+        for (const auto& layer : run.layers) {
+            // Cluster level tasks without the top-level one are not reported
+            if (layer.second.stats.numTasks == 0) {
+                continue;
+            }
+
+            auto& diff = layers[layer.first];
+            diff.layerName = layer.first.first;
+            diff.execType = layer.first.second;
+            diff.layerType = layer.second.layerType;
+            (isBefore ? diff.inBefore : diff.inAfter) = true;
+            (isBefore ? diff.before : diff.after) = layer.second.stats;
+        }
+    };
+    addLayers(beforeRun, /*isBefore=*/true);
+    addLayers(afterRun, /*isBefore=*/false);
+
+    for (const auto& layer : layers) {
+        comparison.layers.push_back(layer.second);
+    }
+    sortLayerDiffs(comparison.layers, CompareSortKey::DELTA);
+
+    return comparison;
+}
+
+CompareSortKey vpux::profiling::parseCompareSortKey(const std::string& key) {
+    static const std::map<std::string, CompareSortKey> keys = {
+            {"delta", CompareSortKey::DELTA},
+            {"name", CompareSortKey::NAME},
+            {"before", CompareSortKey::BEFORE},
+            {"after", CompareSortKey::AFTER},
+    };
+    const auto it = keys.find(key);
+    VPUX_THROW_WHEN(it == keys.end(), "Unknown sort key: {0}. Valid keys: delta, name, before, after", key);
+    return it->second;
+}
+
+void vpux::profiling::sortLayerDiffs(std::vector<LayerTaskDiff>& layers, CompareSortKey sortKey) {
+    const auto byName = [](const LayerTaskDiff& diff) {
+        return std::make_tuple(diff.layerName, diff.execType);
+    };
+    std::stable_sort(layers.begin(), layers.end(), [&](const LayerTaskDiff& lhs, const LayerTaskDiff& rhs) {
+        switch (sortKey) {
+        case CompareSortKey::DELTA:
+            return std::make_tuple(-std::abs(lhs.getDeltaNs()), byName(lhs)) <
+                   std::make_tuple(-std::abs(rhs.getDeltaNs()), byName(rhs));
+        case CompareSortKey::BEFORE:
+            return std::make_tuple(rhs.before.durationNs, byName(lhs)) <
+                   std::make_tuple(lhs.before.durationNs, byName(rhs));
+        case CompareSortKey::AFTER:
+            return std::make_tuple(rhs.after.durationNs, byName(lhs)) <
+                   std::make_tuple(lhs.after.durationNs, byName(rhs));
+        default:
+            return byName(lhs) < byName(rhs);
+        }
+    });
+}
+
+void vpux::profiling::printComparisonAsText(const ProfilingComparison& comparison, std::ostream& outStream) {
+    std::ios::fmtflags origFlags(outStream.flags());
+    outStream << std::fixed << std::setprecision(2);
+
+    const auto printRow = [&](const std::string& label, uint64_t before, uint64_t after) {
+        outStream << std::left << std::setw(24) << label << std::right << std::setw(12) << toUs(before)
+                  << std::setw(12) << toUs(after) << std::setw(12)
+                  << toUs(static_cast<int64_t>(after) - static_cast<int64_t>(before)) << std::setw(10)
+                  << getDeltaPercent(before, after) << std::endl;
+    };
+
+    outStream << std::left << std::setw(24) << "Schedule" << std::right << std::setw(12) << "Before(us)"
+              << std::setw(12) << "After(us)" << std::setw(12) << "Delta(us)" << std::setw(10) << "Delta" << std::endl;
+    printRow("Latency", comparison.before.latencyNs, comparison.after.latencyNs);
+    printRow("Idle", comparison.before.idleNs, comparison.after.idleNs);
+    printRow("Critical path", comparison.before.criticalPathNs, comparison.after.criticalPathNs);
+    for (const auto& engine : comparison.engines) {
+        const auto& name = execTypeToStr.at(engine.execType);
+        printRow(name + " busy", engine.before.busyNs, engine.after.busyNs);
+        printRow(name + " idle", engine.before.idleNs, engine.after.idleNs);
+    }
+    outStream << std::endl;
+
+    for (const auto& layer : getCriticalPathDifference(comparison.after, comparison.before)) {
+        outStream << "Joined critical path: " << layer << std::endl;
+    }
+    for (const auto& layer : getCriticalPathDifference(comparison.before, comparison.after)) {
+        outStream << "Left critical path:   " << layer << std::endl;
+    }
+    outStream << std::endl;
+
+    outStream << std::left << std::setw(60) << "Layer" << std::setw(20) << "Type" << std::setw(6) << "Exec"
+              << std::setw(10) << "Status" << std::right << std::setw(12) << "Before(us)" << std::setw(12)
+              << "After(us)" << std::setw(12) << "Delta(us)" << std::setw(10) << "Delta" << std::setw(10) << "Tasks"
+              << std::setw(10) << "Clusters" << std::endl;
+    for (const auto& layer : comparison.layers) {
+        const auto tasks = std::to_string(layer.before.numTasks) + "->" + std::to_string(layer.after.numTasks);
+        const auto clusters =
+                std::to_string(layer.before.numClusters) + "->" + std::to_string(layer.after.numClusters);
+        outStream << std::left << std::setw(60) << layer.layerName << std::setw(20) << layer.layerType << std::setw(6)
+                  << execTypeToStr.at(layer.execType) << std::setw(10) << statusToStr.at(layer.getStatus())
+                  << std::right << std::setw(12) << toUs(layer.before.durationNs) << std::setw(12)
+                  << toUs(layer.after.durationNs) << std::setw(12) << toUs(layer.getDeltaNs()) << std::setw(10)
+                  << getDeltaPercent(layer.before.durationNs, layer.after.durationNs) << std::setw(10) << tasks
+                  << std::setw(10) << clusters << std::endl;
+    }
+
+    outStream.flags(origFlags);
+}
+
+void vpux::profiling::printComparisonAsJson(const ProfilingComparison& comparison, std::ostream& outStream) {
+    outStream << "{" << std::endl;
+
+    outStream << "\"before\": ";
+    printScheduleAsJson(comparison.before, outStream);
+    outStream << "," << std::endl << "\"after\": ";
+    printScheduleAsJson(comparison.after, outStream);
+    outStream << "," << std::endl;
+
+    outStream << "\"engines\": [" << std::endl;
+    for (size_t i = 0; i < comparison.engines.size(); ++i) {
+        const auto& engine = comparison.engines[i];
+        outStream << "{\"exec\": \"" << execTypeToStr.at(engine.execType) << "\", \"before\": ";
+        printEngineStatsAsJson(engine.before, outStream);
+        outStream << ", \"after\": ";
+        printEngineStatsAsJson(engine.after, outStream);
+        outStream << "}" << (i + 1 == comparison.engines.size() ? "" : ",") << std::endl;
+    }
+    outStream << "]," << std::endl;
+
+    outStream << "\"layers\": [" << std::endl;
+    for (size_t i = 0; i < comparison.layers.size(); ++i) {
+        const auto& layer = comparison.layers[i];
+        outStream << "{\"name\": \"" << escapeJson(layer.layerName) << "\", \"type\": \""
+                  << escapeJson(layer.layerType) << "\", \"exec\": \"" << execTypeToStr.at(layer.execType)
+                  << "\", \"status\": \"" << statusToStr.at(layer.getStatus())
+                  << "\", \"delta_ns\": " << layer.getDeltaNs() << ", \"before\": ";
+        printLayerStatsAsJson(layer.before, outStream);
+        outStream << ", \"after\": ";
+        printLayerStatsAsJson(layer.after, outStream);
+        outStream << "}" << (i + 1 == comparison.layers.size() ? "" : ",") << std::endl;
+    }
+    outStream << "]" << std::endl;
+
+    outStream << "}" << std::endl;
+}
@@ -11,6 +11,7 @@
 #include <vpux.hpp>
 #include <vpux_compiler.hpp>
 #include "vpux/utils/core/logger.hpp"
+#include "zero_queue_manager.h"
 
 #include <ie_allocator.hpp>
 
@@ -21,7 +22,12 @@ class ZeroDevice : public IDevice {
 public:
     ZeroDevice(ze_driver_handle_t driver, ze_device_handle_t device, ze_context_handle_t context,
                ze_graph_dditable_ext_t* graph_ddi_table_ext,
-               ze_graph_profiling_dditable_ext_t* graph_profiling_ddi_table_ext);
+               ze_graph_profiling_dditable_ext_t* graph_profiling_ddi_table_ext, uint32_t index = 0);
+
+    /**
+     * @brief Returns the platform part of the device name, e.g. "3720"
+     */
+    static std::string getPlatformName(ze_device_handle_t device);
 
     std::shared_ptr<Allocator> getAllocator() const override;
 
@@ -33,6 +39,7 @@ public:
     Uuid getUuid() const override;
     uint64_t getTotalMemSize() const override;
     uint32_t getDriverVersion() const override;
+    std::map<ov::hint::Priority, QueueingDelay> getQueueingDelays() const override;
 
     IInferRequest::Ptr createInferRequest(const InferenceEngine::InputsDataMap& networkInputs,
                                           const InferenceEngine::OutputsDataMap& networkOutputs,
@@ -59,6 +66,12 @@ private:
 
     uint32_t _group_ordinal;
 
+    // Queues and scheduler shared by all networks loaded to the device
+    std::shared_ptr<ZeroQueueManager> _queue_manager;
+
+    // Index of the device among the devices of the same platform, used as the second part of the name
+    uint32_t _index = 0;
+
     Logger log;
 };
 }  // namespace vpux
@@ -7,11 +7,15 @@
 
 #include "vpux.hpp"
 #include "vpux/utils/core/logger.hpp"
+#include "zero_queue_manager.h"
 #include "zero_wrappers.h"
 
 #include <ze_api.h>
 #include <ze_graph_ext.h>
 
+#include <memory>
+#include <mutex>
+
 namespace vpux {
 
 class ZeroExecutor final : public Executor {
@@ -20,7 +24,7 @@ public:
                  ze_graph_dditable_ext_t* graph_ddi_table_ext,
                  ze_graph_profiling_dditable_ext_t* graph_profiling_ddi_table_ext,
                  const vpux::NetworkDescription::Ptr& networkDescription, const Config& config,
-                 const uint32_t& group_ordinal);
+                 const uint32_t& group_ordinal, const std::shared_ptr<ZeroQueueManager>& queue_manager);
 
     ZeroExecutor(const ZeroExecutor&) = delete;
     ZeroExecutor(ZeroExecutor&&) = delete;
@@ -34,6 +38,16 @@ public:
     };
 
     void setArgumentValue(uint32_t argi_, const void* argv_) const;
+
+    /**
+     * @brief Blocks until the graph initialization submitted at creation is completed
+     * @note Graph initialization is asynchronous so that several networks are initialized in parallel,
+     * it must be completed before the graph is executed
+     */
+    void waitForGraphInitialization();
+
+    bool isCompiledNetworkReleasable() const override;
+
     inline ze_graph_handle_t graph() const {
         return _graph;
     };
@@ -55,6 +69,9 @@ public:
     inline const std::array<std::shared_ptr<CommandQueue>, stage::COUNT>& getCommandQueue() const {
         return _command_queues;
     }
+    inline InferenceScheduler& scheduler() const {
+        return _queue_manager->scheduler();
+    }
     inline const uint32_t& get_group_ordinal() const {
         return _group_ordinal;
     };
@@ -83,7 +100,13 @@ private:
     std::map<std::string, ArgumentDescriptor> _inputs_desc_map;
     std::map<std::string, ArgumentDescriptor> _outputs_desc_map;
 
+    std::shared_ptr<ZeroQueueManager> _queue_manager;
     std::array<std::shared_ptr<CommandQueue>, stage::COUNT> _command_queues;
+
+    std::unique_ptr<CommandList> _graph_init_command_list;
+    std::unique_ptr<CommandQueue> _graph_init_command_queue;
+    std::unique_ptr<Fence> _graph_init_fence;
+    std::once_flag _graph_init_flag;
 };
 
 }  // namespace vpux
@@ -40,7 +40,19 @@ public:
 
     void GetResult() override;
 
+    /**
+     * @brief Records the inferences of all the requests into one command list when the device allows it
+     * @details The command list of the batch is kept until the batch is run with a different set of requests
+     */
+    void InferBatch(const std::vector<IInferRequest::Ptr>& others) override;
+    size_t getMaxInFlight() const override;
+
 private:
+    // Copies the inputs to the staging buffers of the pipeline unless they are already there
+    void prepareInputs();
+    // Copies the outputs from the staging buffers of the pipeline unless they are already there
+    void copyOutputs();
+
     const Executor::Ptr _executorPtr;
     const ZeroExecutor* _executor;
     const Config _config;
@@ -54,6 +66,10 @@ private:
     vpux::zeroProfiling::ProfilingPool _profiling_pool;
     vpux::zeroProfiling::ProfilingQuery _profiling_query;
     std::unique_ptr<Pipeline> _pipeline;
+
+    // Other requests of the cached batch, weak pointers tell apart a new request allocated at the same address
+    std::vector<std::weak_ptr<IInferRequest>> _batchRequests;
+    std::unique_ptr<PipelineBatch> _batch;
 };
 
 }  //  namespace vpux
@@ -5,6 +5,12 @@
 
 #pragma once
 
+#include <array>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+
 #include "zero_executor.h"
 #include "zero_memory.h"
 #include "zero_profiling.h"
@@ -14,12 +20,15 @@
 namespace vpux {
 struct Pipeline {
 public:
-    Pipeline() = default;
+    Pipeline(const Config& config, InferenceScheduler& scheduler)
+            : _scheduler(scheduler), _priority(config.get<MODEL_PRIORITY>()){};
     Pipeline(const Pipeline&) = delete;
     Pipeline(Pipeline&&) = delete;
     Pipeline& operator=(const Pipeline&) = delete;
     Pipeline& operator=(Pipeline&&) = delete;
-    virtual ~Pipeline() = default;
+    virtual ~Pipeline() {
+        unschedule();
+    };
 
     virtual void push() = 0;
     virtual void pull() = 0;
@@ -31,13 +40,86 @@ public:
     inline zeroMemory::MemoryManagementUnit& outputs() {
         return _outputs;
     };
+    // Buffer which holds the current value of variable states, the keys are state names
+    inline zeroMemory::MemoryManagementUnit& states() {
+        return _states[_states_idx];
+    };
+
+    // Synchronize host and device copies of the current state value, no-op if the device uses host memory
+    virtual void downloadState(const std::string& /*name*/, const std::size_t /*size*/){};
+    virtual void uploadState(const std::string& /*name*/, const std::size_t /*size*/){};
 
 protected:
+    /**
+     * @brief Queues the submission of the inference in the host-side scheduler, see InferenceScheduler
+     * @details Doesn't block, `submit` is run once the scheduler grants the inference, possibly by the thread of
+     * another request which completes its inference. The errors of `submit` are rethrown by waitForSubmission.
+     */
+    void schedule(std::function<void()> submit);
+    // Blocks until the queued submission is done, must be called before waiting for the inference
+    void waitForSubmission();
+    // Must be called once the inference is completed
+    void unschedule();
+    // Must be called by the destructor of the derived pipeline, the queued submission uses its command lists
+    void cancelSubmission();
+
+    inline bool hasStates() const {
+        return _states[0].getSize() != 0;
+    };
+    // Must be called once the inference is finished
+    inline void swapStates() {
+        _states_idx = (_states_idx + 1) % _states.size();
+    };
+
     zeroMemory::MemoryManagementUnit _inputs;
     zeroMemory::MemoryManagementUnit _outputs;
+
+    // Variable states are double-buffered: ReadValue reads the state from the current buffer while Assign writes
+    // the new value to the other one. Buffers are swapped after each inference, so the state stays on the device
+    // and is copied to/from the host only on explicit request.
+    std::array<zeroMemory::MemoryManagementUnit, 2> _states;
+    std::size_t _states_idx = 0;
+
+private:
+    enum class Submission { NONE, QUEUED, SUBMITTED };
+
+    InferenceScheduler& _scheduler;
+    const ov::hint::Priority _priority;
+
+    std::mutex _submission_mutex;
+    std::condition_variable _submitted;
+    Submission _submission = Submission::NONE;
+    std::exception_ptr _submission_error;
+    InferenceScheduler::Ticket _ticket = 0;
+};
+
+/**
+ * @brief Inferences of several pipelines of the same executable network recorded into one command list
+ * @details Small models are dominated by the host overhead of the submission and synchronization, so the batch
+ * submits all the inferences at once and waits for a single fence. Each inference keeps using the staging buffers
+ * of its own pipeline, so the results are identical to the individual submission.
+ */
+struct PipelineBatch {
+public:
+    PipelineBatch() = default;
+    PipelineBatch(const PipelineBatch&) = delete;
+    PipelineBatch& operator=(const PipelineBatch&) = delete;
+    virtual ~PipelineBatch() = default;
+
+    virtual void push() = 0;
+    virtual void pull() = 0;
+    virtual void reset() const = 0;
 };
 
 std::unique_ptr<Pipeline> makePipeline(const Executor::Ptr& executorPtr, const Config& config,
                                        vpux::zeroProfiling::ProfilingPool& profiling_pool,
                                        vpux::zeroProfiling::ProfilingQuery& profiling_query);
+
+/**
+ * @brief Creates the batch of the pipelines created by makePipeline for the same executor
+ * @return nullptr if the pipelines can't be batched (discrete device or stateful network), they have to be
+ * submitted one by one then
+ */
+std::unique_ptr<PipelineBatch> makePipelineBatch(const Executor::Ptr& executorPtr, const Config& config,
+                                                 const std::vector<Pipeline*>& pipelines);
 }  // namespace vpux
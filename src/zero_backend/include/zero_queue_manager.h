@@ -0,0 +1,52 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include "vpux/utils/plugin/inference_scheduler.hpp"
+#include "zero_wrappers.h"
+
+#include <ze_api.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace vpux {
+
+/**
+ * @brief Command queues and host-side scheduler shared by all executable networks loaded to the same device
+ * @details Networks of the same priority submit their stages to the same queues instead of creating private ones,
+ * so the number of queues per device is bounded by the number of priorities times the number of stages.
+ */
+class ZeroQueueManager final {
+public:
+    ZeroQueueManager(ze_device_handle_t device_handle, ze_context_handle_t context, uint32_t group_ordinal);
+
+    ZeroQueueManager(const ZeroQueueManager&) = delete;
+    ZeroQueueManager& operator=(const ZeroQueueManager&) = delete;
+
+    /**
+     * @brief Returns the queue of the stage for the networks of the given priority, creates it on the first request
+     * @note The queue is destroyed when the last network using it is released
+     */
+    std::shared_ptr<CommandQueue> getCommandQueue(ov::hint::Priority priority, stage stage, const Config& config);
+
+    inline InferenceScheduler& scheduler() {
+        return _scheduler;
+    }
+
+private:
+    ze_device_handle_t _device_handle = nullptr;
+    ze_context_handle_t _context = nullptr;
+    uint32_t _group_ordinal = 0;
+
+    std::mutex _mutex;
+    std::map<std::pair<ze_command_queue_priority_t, stage>, std::weak_ptr<CommandQueue>> _command_queues;
+
+    InferenceScheduler _scheduler;
+};
+
+}  // namespace vpux
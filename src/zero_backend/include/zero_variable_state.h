@@ -0,0 +1,25 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include <cpp_interfaces/interface/ie_ivariable_state_internal.hpp>
+
+#include "zero_pipeline.h"
+
+namespace vpux {
+// State value lives in the pipeline memory, it's copied to/from the host only by calls of this class
+class ZeroVariableState final : public InferenceEngine::IVariableStateInternal {
+public:
+    ZeroVariableState(const std::string& name, const InferenceEngine::TensorDesc& tensorDesc, Pipeline& pipeline);
+
+    void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& new_state) override;
+    InferenceEngine::Blob::CPtr GetState() const override;
+
+private:
+    Pipeline& _pipeline;
+};
+}  // namespace vpux
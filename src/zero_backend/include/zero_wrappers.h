@@ -12,6 +12,8 @@
 #include <ze_api.h>
 #include <ze_graph_ext.h>
 
+#include <mutex>
+
 namespace vpux {
 class CommandList;
 class CommandQueue;
@@ -141,6 +143,9 @@ private:
     ze_command_queue_handle_t _handle = nullptr;
     ze_context_handle_t _context = nullptr;
 
+    // The queue is shared by the networks of the same priority, concurrent submission to it is not allowed by L0
+    mutable std::mutex _mutex;
+
     Logger _log;
 };
 
@@ -6,6 +6,8 @@
 #include "zero_backend.h"
 
 #include <description_buffer.hpp>
+#include <device_helpers.hpp>
+#include <map>
 #include <vector>
 
 #include "ze_intel_vpu_uuid.h"
@@ -45,7 +47,6 @@ ZeroStructsInitializer::ZeroStructsInitializer(): log(Logger::global().nest("NPU
     zeroUtils::throwOnFail("zeInit", zeInit(ZE_INIT_FLAG_VPU_ONLY));
 
     ze_driver_handle_t driver_handle = nullptr;
-    ze_device_handle_t device_handle = nullptr;
 
     ze_graph_dditable_ext_t* _graph_ddi_table_ext = nullptr;
     ze_graph_profiling_dditable_ext_t* _graph_profiling_ddi_table_ext = nullptr;
@@ -96,16 +97,26 @@ ZeroStructsInitializer::ZeroStructsInitializer(): log(Logger::global().nest("NPU
             zeDriverGetExtensionFunctionAddress(driver_handle, "ZE_extension_profiling_data",
                                                 reinterpret_cast<void**>(&_graph_profiling_ddi_table_ext)));
 
-    uint32_t device_count = 1;
-    // Get our target device
-    zeroUtils::throwOnFail("zeDeviceGet", zeDeviceGet(driver_handle, &device_count, &device_handle));
+    // Get all devices exposed by the driver
+    uint32_t device_count = 0;
+    zeroUtils::throwOnFail("zeDeviceGet", zeDeviceGet(driver_handle, &device_count, nullptr));
 
+    std::vector<ze_device_handle_t> device_handles(device_count);
+    zeroUtils::throwOnFail("zeDeviceGet", zeDeviceGet(driver_handle, &device_count, device_handles.data()));
+
+    // The context is created for the driver, so it is shared by all its devices
     ze_context_desc_t context_desc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC, 0, 0};
     zeroUtils::throwOnFail("zeContextCreate", zeContextCreate(driver_handle, &context_desc, &context));
 
-    auto device = std::make_shared<ZeroDevice>(driver_handle, device_handle, context, _graph_ddi_table_ext,
-                                               _graph_profiling_ddi_table_ext);
-    devices.emplace(std::make_pair(device->getName(), device));
+    // Devices of the same platform are distinguished by index: "3720.0", "3720.1", ...
+    std::map<std::string, uint32_t> platform_device_count;
+    for (const auto device_handle : device_handles) {
+        const auto index = platform_device_count[ZeroDevice::getPlatformName(device_handle)]++;
+        auto device = std::make_shared<ZeroDevice>(driver_handle, device_handle, context, _graph_ddi_table_ext,
+                                                   _graph_profiling_ddi_table_ext, index);
+        log.debug("Found device {0}", device->getName());
+        devices.emplace(std::make_pair(device->getName(), device));
+    }
 }
 
 ZeroStructsInitializer::~ZeroStructsInitializer() {
@@ -132,9 +143,10 @@ const std::shared_ptr<IDevice> ZeroEngineBackend::getDevice() const {
         return {};
 }
 
-const std::shared_ptr<IDevice> ZeroEngineBackend::getDevice(const std::string& /*name*/) const {
-    // TODO Add the search of the device by platform & slice
-    return getDevice();
+const std::shared_ptr<IDevice> ZeroEngineBackend::getDevice(const std::string& name) const {
+    const auto& devices = instance->getInstanceDevices();
+    const auto it = devices.find(utils::resolveDeviceName(name, getDeviceNames()));
+    return it != devices.end() ? it->second : nullptr;
 }
 
 const std::vector<std::string> ZeroEngineBackend::getDeviceNames() const {
@@ -17,12 +17,13 @@ static size_t get_cpu_ram_size();
 
 ZeroDevice::ZeroDevice(ze_driver_handle_t driver, ze_device_handle_t device, ze_context_handle_t context,
                        ze_graph_dditable_ext_t* graph_ddi_table_ext,
-                       ze_graph_profiling_dditable_ext_t* graph_profiling_ddi_table_ext)
+                       ze_graph_profiling_dditable_ext_t* graph_profiling_ddi_table_ext, uint32_t index)
         : _driver_handle(driver),
           _device_handle(device),
           _context(context),
           _graph_ddi_table_ext(graph_ddi_table_ext),
           _graph_profiling_ddi_table_ext(graph_profiling_ddi_table_ext),
+          _index(index),
           log(Logger::global().nest("ZeroDevice", 0)) {
     ze_device_properties_t properties = {};
     properties.stype = ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES;
@@ -67,6 +68,8 @@ ZeroDevice::ZeroDevice(ze_driver_handle_t driver, ze_device_handle_t device, ze_
 
     // Find the corespondinng command queue group.
     _group_ordinal = zeroUtils::findGroupOrdinal(command_group_properties, properties);
+
+    _queue_manager = std::make_shared<ZeroQueueManager>(_device_handle, _context, _group_ordinal);
 }
 
 std::shared_ptr<Allocator> ZeroDevice::getAllocator() const {
@@ -78,13 +81,14 @@ std::shared_ptr<Executor> ZeroDevice::createExecutor(const NetworkDescription::P
                                                      const Config& config) {
     OV_ITT_SCOPED_TASK(itt::domains::LevelZeroBackend, "Device::createExecutor");
     return std::make_shared<ZeroExecutor>(_driver_handle, _device_handle, _context, _graph_ddi_table_ext,
-                                          _graph_profiling_ddi_table_ext, networkDescription, config, _group_ordinal);
+                                          _graph_profiling_ddi_table_ext, networkDescription, config, _group_ordinal,
+                                          _queue_manager);
 }
 
-std::string ZeroDevice::getName() const {
+std::string ZeroDevice::getPlatformName(ze_device_handle_t device) {
     ze_device_properties_t properties = {};
     properties.stype = ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES;
-    zeroUtils::throwOnFail("zeDeviceGetProperties", zeDeviceGetProperties(_device_handle, &properties));
+    zeroUtils::throwOnFail("zeDeviceGetProperties", zeDeviceGetProperties(device, &properties));
 
 //    KMD is setting usDeviceID from VpuFamilyID.h
 #define VPU_2700_DEVICE_ID 0x6200
@@ -92,23 +96,21 @@ std::string ZeroDevice::getName() const {
 #define VPU_3720_P_DEVICE_ID 0x7D1D
 #define VPU_3720_S_DEVICE_ID 0xAD1D
 
-    std::string name;
     switch (properties.deviceId) {
     case VPU_2700_DEVICE_ID:
-        name = "2700";
-        break;
+        return "2700";
     case VPU_3700_DEVICE_ID:
-        name = "3700";
-        break;
+        return "3700";
     case VPU_3720_P_DEVICE_ID:
     case VPU_3720_S_DEVICE_ID:
-        name = "3720";
-        break;
+        return "3720";
     default:
-        name = "AUTO_DETECT";
+        return "AUTO_DETECT";
     }
+}
 
-    return name + ".0";
+std::string ZeroDevice::getName() const {
+    return getPlatformName(_device_handle) + "." + std::to_string(_index);
 }
 
 std::string ZeroDevice::getFullDeviceName() const {
@@ -141,6 +143,14 @@ uint64_t ZeroDevice::getTotalMemSize() const {
     return totalMemSize;
 }
 
+std::map<ov::hint::Priority, QueueingDelay> ZeroDevice::getQueueingDelays() const {
+    std::map<ov::hint::Priority, QueueingDelay> delays;
+    for (const auto priority : {ov::hint::Priority::LOW, ov::hint::Priority::MEDIUM, ov::hint::Priority::HIGH}) {
+        delays[priority] = _queue_manager->scheduler().getQueueingDelay(priority);
+    }
+    return delays;
+}
+
 IInferRequest::Ptr ZeroDevice::createInferRequest(const InferenceEngine::InputsDataMap& networkInputs,
                                                   const InferenceEngine::OutputsDataMap& networkOutputs,
                                                   const Executor::Ptr& executor, const Config& config,
@@ -13,6 +13,7 @@
 #include "vpux/al/config/common.hpp"
 
 #include "vpux/utils/IE/itt.hpp"
+#include "vpux/utils/core/checked_cast.hpp"
 
 #include <functional>
 #include <iostream>
@@ -25,7 +26,7 @@ ZeroExecutor::ZeroExecutor(ze_driver_handle_t /*driver*/, ze_device_handle_t dev
                            ze_graph_dditable_ext_t* graph_ddi_table_ext,
                            ze_graph_profiling_dditable_ext_t* graph_profiling_ddi_table_ext,
                            const vpux::NetworkDescription::Ptr& networkDescription, const Config& config,
-                           const uint32_t& group_ordinal)
+                           const uint32_t& group_ordinal, const std::shared_ptr<ZeroQueueManager>& queue_manager)
         : _config(config),
           _logger("Graph", _config.get<LOG_LEVEL>()),
           _networkDesc(networkDescription),
@@ -34,19 +35,16 @@ ZeroExecutor::ZeroExecutor(ze_driver_handle_t /*driver*/, ze_device_handle_t dev
           _graph_ddi_table_ext(graph_ddi_table_ext),
           _graph_profiling_ddi_table_ext(graph_profiling_ddi_table_ext),
           _group_ordinal(group_ordinal),
-          _command_queues{{std::make_shared<CommandQueue>(_device, _context,
-                                                          zeroUtils::toZeQueuePriority(_config.get<MODEL_PRIORITY>()),
-                                                          _config, group_ordinal),
-                           std::make_shared<CommandQueue>(_device, _context,
-                                                          zeroUtils::toZeQueuePriority(_config.get<MODEL_PRIORITY>()),
-                                                          _config, group_ordinal),
-                           std::make_shared<CommandQueue>(_device, _context,
-                                                          zeroUtils::toZeQueuePriority(_config.get<MODEL_PRIORITY>()),
-                                                          _config, group_ordinal)}} {
+          _queue_manager(queue_manager),
+          _command_queues{{_queue_manager->getCommandQueue(_config.get<MODEL_PRIORITY>(), stage::UPLOAD, _config),
+                           _queue_manager->getCommandQueue(_config.get<MODEL_PRIORITY>(), stage::EXECUTE, _config),
+                           _queue_manager->getCommandQueue(_config.get<MODEL_PRIORITY>(), stage::READBACK, _config)}} {
     OV_ITT_SCOPED_TASK(itt::domains::LevelZeroBackend, "Executor::ZeroExecutor");
-    CommandList graph_command_list(_device, _context, graph_ddi_table_ext, _config, _group_ordinal);
-    CommandQueue graph_command_queue(_device, _context, ZE_COMMAND_QUEUE_PRIORITY_NORMAL, _config, _group_ordinal);
-    Fence fence(graph_command_queue, _config);
+    _graph_init_command_list =
+            std::make_unique<CommandList>(_device, _context, graph_ddi_table_ext, _config, _group_ordinal);
+    _graph_init_command_queue = std::make_unique<CommandQueue>(_device, _context, ZE_COMMAND_QUEUE_PRIORITY_NORMAL,
+                                                               _config, _group_ordinal);
+    _graph_init_fence = std::make_unique<Fence>(*_graph_init_command_queue, _config);
     ze_device_properties_t properties = {};
     zeroUtils::throwOnFail("zeDeviceGetProperties", zeDeviceGetProperties(_device, &properties));
 
@@ -74,12 +72,32 @@ ZeroExecutor::ZeroExecutor(ze_driver_handle_t /*driver*/, ze_device_handle_t dev
         }
     }
     OV_ITT_TASK_NEXT(ZERO_EXECUTOR_GRAPH, "appendGraphInitialize");
-    graph_command_list.appendGraphInitialize(_graph);
-    graph_command_list.close();
+    _graph_init_command_list->appendGraphInitialize(_graph);
+    _graph_init_command_list->close();
 
+    // The initialization is not waited for here, see waitForGraphInitialization
     OV_ITT_TASK_NEXT(ZERO_EXECUTOR_GRAPH, "queue_execute");
-    graph_command_queue.executeCommandList(graph_command_list, fence);
-    fence.hostSynchronize();
+    _graph_init_command_queue->executeCommandList(*_graph_init_command_list, *_graph_init_fence);
+
+    // The limit is removed by the destructor, so it is added once nothing else can throw
+    _queue_manager->scheduler().addInFlightLimit(checked_cast<uint32_t>(_config.get<MAX_INFLIGHT_INFERENCES>()));
+}
+
+void ZeroExecutor::waitForGraphInitialization() {
+    std::call_once(_graph_init_flag, [this]() {
+        OV_ITT_SCOPED_TASK(itt::domains::LevelZeroBackend, "Executor::waitForGraphInitialization");
+        _graph_init_fence->hostSynchronize();
+
+        _graph_init_fence.reset();
+        _graph_init_command_queue.reset();
+        _graph_init_command_list.reset();
+    });
+}
+
+bool ZeroExecutor::isCompiledNetworkReleasable() const {
+    // The driver keeps its own copy of the blob since the graph creation,
+    // but the profiling output is parsed with the help of the host copy
+    return !_config.get<PERF_COUNT>();
 }
 
 void ZeroExecutor::setArgumentValue(uint32_t argi_, const void* argv_) const {
@@ -87,6 +105,15 @@ void ZeroExecutor::setArgumentValue(uint32_t argi_, const void* argv_) const {
 }
 
 ZeroExecutor::~ZeroExecutor() {
+    _queue_manager->scheduler().removeInFlightLimit(checked_cast<uint32_t>(_config.get<MAX_INFLIGHT_INFERENCES>()));
+
+    // The graph can't be destroyed while its initialization is in flight
+    try {
+        waitForGraphInitialization();
+    } catch (const std::exception& ex) {
+        _logger.error("Graph initialization failed: {0}", ex.what());
+    }
+
     auto result = _graph_ddi_table_ext->pfnDestroy(_graph);
     if (ZE_RESULT_SUCCESS != result) {
         _logger.error("_graph_ddi_table_ext->pfnDestroy failed {0:X+}", uint64_t(result));
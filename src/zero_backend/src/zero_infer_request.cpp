@@ -7,8 +7,8 @@
 #include <ie_blob.h>
 #include <blob_factory.hpp>
 
-#include <vpux_variable_state.hpp>
 #include "zero_infer_request.h"
+#include "zero_variable_state.h"
 
 #include "vpux/al/config/common.hpp"
 #include "vpux/al/config/runtime.hpp"
@@ -16,10 +16,18 @@
 #include "vpux/utils/IE/data_attributes_check.hpp"
 #include "vpux/utils/IE/itt.hpp"
 #include "vpux/utils/IE/prefix.hpp"
+#include "vpux/utils/core/trace_recorder.hpp"
 
 namespace ie = InferenceEngine;
 using namespace vpux;
 
+namespace {
+
+VPUX_TRACE_EVENT(inferAsyncEvent, "ZeroInferRequest", "infer_async", "");
+VPUX_TRACE_EVENT(getResultEvent, "ZeroInferRequest", "get_result", "");
+
+}  // namespace
+
 //------------------------------------------------------------------------------
 //      Helpers
 //------------------------------------------------------------------------------
@@ -86,6 +94,19 @@ bool twoApiLayoutCouplingCheck(const ze_graph_argument_layout_t zeroL, const ie:
     return false;
 }
 
+bool isSameBatch(const std::vector<std::weak_ptr<IInferRequest>>& cached,
+                 const std::vector<IInferRequest::Ptr>& requests) {
+    if (cached.size() != requests.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < requests.size(); ++i) {
+        if (cached[i].owner_before(requests[i]) || requests[i].owner_before(cached[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
 template <typename T>
 std::size_t getNumDims(const T& dims) {
     return std::count_if(std::begin(dims), std::end(dims), [](const std::size_t& dim) -> bool {
@@ -121,6 +142,10 @@ ZeroInferRequest::ZeroInferRequest(const ie::InputsDataMap& networkInputs, const
     const auto& deviceInputs = _executor->getNetworkDesc().getDeviceInputsInfo();
     for (const auto& deviceInput : deviceInputs) {
         const std::string& inputName = deviceInput.first;
+        // States are kept in the pipeline memory, see QueryState
+        if (isStateInputName(inputName)) {
+            continue;
+        }
         const auto& networkInputMatch = _networkInputs.find(inputName);
         if (networkInputMatch == _networkInputs.end()) {
             IE_THROW() << "Network input not found: " + inputName;
@@ -133,6 +158,9 @@ ZeroInferRequest::ZeroInferRequest(const ie::InputsDataMap& networkInputs, const
     const auto& deviceOutputs = _executor->getNetworkDesc().getDeviceOutputsInfo();
     for (const auto& deviceOutput : deviceOutputs) {
         const std::string& outputName = deviceOutput.first;
+        if (isStateOutputName(outputName)) {
+            continue;
+        }
         const auto& networkOutputMatch = _networkOutputs.find(outputName);
         if (networkOutputMatch == _networkOutputs.end()) {
             IE_THROW() << "Network output not found: " + outputName;
@@ -151,7 +179,13 @@ void ZeroInferRequest::InferImpl() {
 void ZeroInferRequest::InferAsync() {
     _logger.debug("InferRequest::InferAsync started");
     OV_ITT_SCOPED_TASK(itt::domains::LevelZeroBackend, "InferAsync");
+    const auto traceScope = inferAsyncEvent.scope();
+
+    prepareInputs();
+    _pipeline->push();
+}
 
+void ZeroInferRequest::prepareInputs() {
     execDataPreprocessing(_inputs);
     const auto& deviceInputs = _executor->getNetworkDesc().getDeviceInputsInfo();
     const std::map<std::string, ZeroExecutor::ArgumentDescriptor>& executorInputsDescriptors =
@@ -161,6 +195,9 @@ void ZeroInferRequest::InferAsync() {
     for (const auto& deviceInput : deviceInputs) {
         const auto& name = deviceInput.first;
         const auto& data = deviceInput.second;
+        if (isStateInputName(name)) {
+            continue;
+        }
         const auto& input = _inputs.at(name);
 
         if (!executorInputsDescriptors.count(name)) {
@@ -196,8 +233,6 @@ void ZeroInferRequest::InferAsync() {
             }
         }
     }
-
-    _pipeline->push();
 }
 
 std::vector<std::shared_ptr<ie::IVariableStateInternal>> ZeroInferRequest::QueryState() {
@@ -209,7 +244,8 @@ std::vector<std::shared_ptr<ie::IVariableStateInternal>> ZeroInferRequest::Query
             IE_ASSERT(1 == _networkInputs.count(readValueName));
             IE_ASSERT(1 == _networkOutputs.count(ASSIGN_PREFIX + stateInfo.first));
 
-            _states.push_back(std::make_shared<VariableState>(stateInfo.first, this->GetBlob(readValueName)));
+            _states.push_back(std::make_shared<ZeroVariableState>(stateInfo.first,
+                                                                  stateInfo.second->getTensorDesc(), *_pipeline));
         }
     });
 
@@ -218,9 +254,16 @@ std::vector<std::shared_ptr<ie::IVariableStateInternal>> ZeroInferRequest::Query
 
 void ZeroInferRequest::GetResult() {
     OV_ITT_SCOPED_TASK(itt::domains::LevelZeroBackend, "GetResult");
-    const auto& deviceOutputs = _executor->getNetworkDesc().getDeviceOutputsInfo();
+    const auto traceScope = getResultEvent.scope();
 
     _pipeline->pull();
+    copyOutputs();
+    _pipeline->reset();
+    _logger.debug("InferRequest::GetResult finished");
+}
+
+void ZeroInferRequest::copyOutputs() {
+    const auto& deviceOutputs = _executor->getNetworkDesc().getDeviceOutputsInfo();
     const std::map<std::string, ZeroExecutor::ArgumentDescriptor>& executorOutputsDescriptors =
             _executor->outputs_desc_map();
 
@@ -228,6 +271,9 @@ void ZeroInferRequest::GetResult() {
     for (auto& deviceOutput : deviceOutputs) {
         const auto& name = deviceOutput.first;
         const auto& data = deviceOutput.second;
+        if (isStateOutputName(name)) {
+            continue;
+        }
         const auto& output = _outputs.at(name);
 
         if (!executorOutputsDescriptors.count(name)) {
@@ -260,9 +306,51 @@ void ZeroInferRequest::GetResult() {
             }
         }
     }
+}
 
-    _pipeline->reset();
-    _logger.debug("InferRequest::GetResult finished");
+void ZeroInferRequest::InferBatch(const std::vector<IInferRequest::Ptr>& others) {
+    _logger.debug("InferRequest::InferBatch started for {0} requests", others.size() + 1);
+    OV_ITT_SCOPED_TASK(itt::domains::LevelZeroBackend, "InferBatch");
+
+    std::vector<ZeroInferRequest*> requests = {this};
+    for (const auto& other : others) {
+        auto request = dynamic_cast<ZeroInferRequest*>(other.get());
+        if (request == nullptr || request->_executor != _executor) {
+            _logger.warning("Requests of different executable networks can't be batched, run them one by one");
+            IInferRequest::InferBatch(others);
+            return;
+        }
+        requests.push_back(request);
+    }
+
+    if (_batch == nullptr || !isSameBatch(_batchRequests, others)) {
+        std::vector<Pipeline*> pipelines;
+        for (const auto request : requests) {
+            pipelines.push_back(request->_pipeline.get());
+        }
+        _batch = makePipelineBatch(_executorPtr, _config, pipelines);
+        _batchRequests.assign(others.begin(), others.end());
+    }
+    if (_batch == nullptr) {
+        _logger.debug("Pipelines can't be batched on this device, run the requests one by one");
+        IInferRequest::InferBatch(others);
+        return;
+    }
+
+    for (const auto request : requests) {
+        request->prepareInputs();
+    }
+    _batch->push();
+    _batch->pull();
+    for (const auto request : requests) {
+        request->copyOutputs();
+    }
+    _batch->reset();
+    _logger.debug("InferRequest::InferBatch finished");
+}
+
+size_t ZeroInferRequest::getMaxInFlight() const {
+    return _executor->scheduler().getMaxInFlight();
 }
 
 std::map<std::string, ie::InferenceEngineProfileInfo> ZeroInferRequest::GetPerformanceCounts() const {
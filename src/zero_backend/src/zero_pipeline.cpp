@@ -5,6 +5,9 @@
 
 #include "zero_pipeline.h"
 
+#include <cstring>
+#include <functional>
+
 #include <ze_api.h>
 #include <ze_graph_ext.h>
 
@@ -16,6 +19,106 @@
 using namespace vpux;
 
 namespace vpux {
+namespace {
+std::string getStateName(const std::string& argumentName, const std::string& prefix) {
+    return argumentName.substr(argumentName.find(prefix) + prefix.size());
+}
+
+void appendStateArguments(const ZeroExecutor* executor, std::array<zeroMemory::MemoryManagementUnit, 2>& states) {
+    for (const auto& desc : executor->inputs_desc_map()) {
+        if (isStateInputName(desc.first)) {
+            for (auto& buffer : states) {
+                buffer.appendArgument(getStateName(desc.first, READVALUE_PREFIX), desc.second.info);
+            }
+        }
+    }
+}
+
+// ReadValue takes the state from the `current` buffer, Assign stores the new value to the `next` one
+void setStateArguments(const ZeroExecutor* executor, const std::function<void*(const std::string&)>& current,
+                       const std::function<void*(const std::string&)>& next) {
+    for (const auto& desc : executor->inputs_desc_map()) {
+        if (isStateInputName(desc.first)) {
+            executor->setArgumentValue(desc.second.idx, current(getStateName(desc.first, READVALUE_PREFIX)));
+        }
+    }
+    for (const auto& desc : executor->outputs_desc_map()) {
+        if (isStateOutputName(desc.first)) {
+            executor->setArgumentValue(desc.second.idx, next(getStateName(desc.first, ASSIGN_PREFIX)));
+        }
+    }
+}
+}  // namespace
+
+void Pipeline::schedule(std::function<void()> submit) {
+    {
+        std::lock_guard<std::mutex> lock(_submission_mutex);
+        _submission = Submission::QUEUED;
+        _submission_error = nullptr;
+    }
+
+    _ticket = _scheduler.enqueue(_priority, [this, submit = std::move(submit)]() {
+        std::exception_ptr error;
+        try {
+            submit();
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        std::lock_guard<std::mutex> lock(_submission_mutex);
+        _submission = Submission::SUBMITTED;
+        _submission_error = error;
+        _submitted.notify_all();
+    });
+}
+
+void Pipeline::waitForSubmission() {
+    std::unique_lock<std::mutex> lock(_submission_mutex);
+    _submitted.wait(lock, [this]() {
+        return _submission != Submission::QUEUED;
+    });
+
+    if (_submission_error != nullptr) {
+        const auto error = _submission_error;
+        _submission_error = nullptr;
+        lock.unlock();
+
+        unschedule();
+        std::rethrow_exception(error);
+    }
+}
+
+void Pipeline::unschedule() {
+    {
+        std::lock_guard<std::mutex> lock(_submission_mutex);
+        if (_submission != Submission::SUBMITTED) {
+            return;
+        }
+        _submission = Submission::NONE;
+    }
+    _scheduler.release();
+}
+
+void Pipeline::cancelSubmission() {
+    // The request may be destroyed without waiting for the result
+    {
+        std::lock_guard<std::mutex> lock(_submission_mutex);
+        if (_submission == Submission::QUEUED && _scheduler.cancel(_ticket)) {
+            _submission = Submission::NONE;
+            return;
+        }
+    }
+
+    // The inference has been granted, its submission may still be run by another thread
+    {
+        std::unique_lock<std::mutex> lock(_submission_mutex);
+        _submitted.wait(lock, [this]() {
+            return _submission != Submission::QUEUED;
+        });
+    }
+    unschedule();
+}
+
 struct DiscretePipeline final : public Pipeline {
 public:
     DiscretePipeline(const Config& config, const ze_device_handle_t& device_handle, const ze_context_handle_t context,
@@ -23,14 +126,18 @@ public:
                      ze_graph_profiling_query_handle_t profiling_handle,
                      const std::array<std::shared_ptr<CommandQueue>, stage::COUNT>& command_queues,
                      const uint32_t& group_ordinal)
-            : _config(config),
+            : Pipeline(config, static_cast<ZeroExecutor*>(executorPtr.get())->scheduler()),
+              _config(config),
               _command_queues{command_queues},
               _command_list{{{device_handle, context, graph_ddi_table_ext, _config, group_ordinal},
                              {device_handle, context, graph_ddi_table_ext, _config, group_ordinal},
                              {device_handle, context, graph_ddi_table_ext, _config, group_ordinal}}},
+              _swapped_execute_command_list{device_handle, context, graph_ddi_table_ext, _config, group_ordinal},
+              _state_command_list{device_handle, context, graph_ddi_table_ext, _config, group_ordinal},
               _fence{{{*_command_queues[stage::UPLOAD], _config},
                       {*_command_queues[stage::EXECUTE], _config},
                       {*_command_queues[stage::READBACK], _config}}},
+              _state_fence{*_command_queues[stage::UPLOAD], _config},
               _event_pool(device_handle, context, stage::COUNT, _config),
               _event{{{_event_pool.handle(), stage::UPLOAD, _config},
                       {_event_pool.handle(), stage::EXECUTE, _config},
@@ -39,57 +146,105 @@ public:
 
         OV_ITT_SCOPED_TASK(itt::domains::LevelZeroBackend, "Zero_infer_request::DiscretePipeline::DiscretePipeline");
         for (const auto& desc : executor->inputs_desc_map()) {
-            _inputs.appendArgument(desc.first, desc.second.info);
+            if (!isStateInputName(desc.first)) {
+                _inputs.appendArgument(desc.first, desc.second.info);
+            }
         }
         _inputs.allocate(device_handle, context);
         _command_list[stage::UPLOAD].appendMemoryCopy(_inputs.getDeviceMemRegion(), _inputs.getHostMemRegion(),
                                                       _inputs.getSize());
         for (const auto& desc : executor->inputs_desc_map()) {
-            executor->setArgumentValue(desc.second.idx, _inputs.getDevicePtr(desc.first));
+            if (!isStateInputName(desc.first)) {
+                executor->setArgumentValue(desc.second.idx, _inputs.getDevicePtr(desc.first));
+            }
         }
 
         _command_list[stage::UPLOAD].appendBarrier();
         _event[stage::UPLOAD].AppendSignalEvent(_command_list[stage::UPLOAD]);
 
         for (const auto& desc : executor->outputs_desc_map()) {
-            _outputs.appendArgument(desc.first, desc.second.info);
+            if (!isStateOutputName(desc.first)) {
+                _outputs.appendArgument(desc.first, desc.second.info);
+            }
         }
         _outputs.allocate(device_handle, context);
         _command_list[stage::READBACK].appendMemoryCopy(_outputs.getHostMemRegion(), _outputs.getDeviceMemRegion(),
                                                         _outputs.getSize());
         for (const auto& desc : executor->outputs_desc_map()) {
-            executor->setArgumentValue(desc.second.idx, _outputs.getDevicePtr(desc.first));
+            if (!isStateOutputName(desc.first)) {
+                executor->setArgumentValue(desc.second.idx, _outputs.getDevicePtr(desc.first));
+            }
+        }
+
+        appendStateArguments(executor, _states);
+        if (hasStates()) {
+            for (auto& buffer : _states) {
+                buffer.allocate(device_handle, context);
+            }
+            setStateArguments(
+                    executor,
+                    [&](const std::string& name) {
+                        return _states[0].getDevicePtr(name);
+                    },
+                    [&](const std::string& name) {
+                        return _states[1].getDevicePtr(name);
+                    });
         }
 
         _event[stage::UPLOAD].AppendWaitOnEvent(_command_list[stage::EXECUTE]);
 
         _command_list[stage::EXECUTE].appendGraphExecute(executor->graph(), profiling_handle);
 
+        // Arguments are captured by the command list, so the swapped state buffers need their own one
+        if (hasStates()) {
+            setStateArguments(
+                    executor,
+                    [&](const std::string& name) {
+                        return _states[1].getDevicePtr(name);
+                    },
+                    [&](const std::string& name) {
+                        return _states[0].getDevicePtr(name);
+                    });
+            _event[stage::UPLOAD].AppendWaitOnEvent(_swapped_execute_command_list);
+            _swapped_execute_command_list.appendGraphExecute(executor->graph(), profiling_handle);
+        }
+
         _event[stage::UPLOAD].AppendEventReset(_command_list[stage::READBACK]);
 
         for (auto& commandList : _command_list) {
             commandList.close();
         }
+        _swapped_execute_command_list.close();
+
+        // Initial value of the state is zero
+        if (hasStates()) {
+            std::memset(_states[0].getHostMemRegion(), 0, _states[0].getSize());
+            copyState(_states[0].getDeviceMemRegion(), _states[0].getHostMemRegion(), _states[0].getSize());
+        }
     };
 
     DiscretePipeline(const DiscretePipeline&) = delete;
     DiscretePipeline& operator=(const DiscretePipeline&) = delete;
-    virtual ~DiscretePipeline() = default;
+    ~DiscretePipeline() override {
+        cancelSubmission();
+    };
 
     void push() override {
-        OV_ITT_TASK_CHAIN(ZERO_INFER_REQUEST_DP_PUSH, itt::domains::LevelZeroBackend, "DiscretePipeline::push",
-                          "UPLOAD");
-        // Dispatch command to copy input data from upload heap to default heap
-        _command_queues[stage::UPLOAD]->executeCommandList(_command_list[stage::UPLOAD]);
-
-        OV_ITT_TASK_NEXT(ZERO_INFER_REQUEST_DP_PUSH, "EXECUTE");
-        // Submit the command list for execute
-        _command_queues[stage::EXECUTE]->executeCommandList(_command_list[stage::EXECUTE], _fence[stage::EXECUTE]);
+        OV_ITT_SCOPED_TASK(itt::domains::LevelZeroBackend, "DiscretePipeline::push");
+        auto& executeCommandList = _states_idx == 0 ? _command_list[stage::EXECUTE] : _swapped_execute_command_list;
+        schedule([this, &executeCommandList]() {
+            // Dispatch command to copy input data from upload heap to default heap
+            _command_queues[stage::UPLOAD]->executeCommandList(_command_list[stage::UPLOAD]);
+            // Submit the command list for execute
+            _command_queues[stage::EXECUTE]->executeCommandList(executeCommandList, _fence[stage::EXECUTE]);
+        });
     };
 
     void pull() override {
         OV_ITT_TASK_CHAIN(ZERO_INFER_REQUEST_DP_PULL, itt::domains::LevelZeroBackend, "DiscretePipeline::pull",
-                          "EXECUTE");
+                          "schedule");
+        waitForSubmission();
+        OV_ITT_TASK_NEXT(ZERO_INFER_REQUEST_DP_PULL, "EXECUTE");
         // Wait for execute to finish
         _fence[stage::EXECUTE].hostSynchronize();
         OV_ITT_TASK_NEXT(ZERO_INFER_REQUEST_DP_PULL, "READBACK");
@@ -98,6 +253,11 @@ public:
         // Wait for output copy to finish execution for _fence from the host, to make sure that data
         // is available in the hostMem buffer of the output
         _fence[stage::READBACK].hostSynchronize();
+        unschedule();
+
+        if (hasStates()) {
+            swapStates();
+        }
     };
 
     void reset() const override {
@@ -107,11 +267,33 @@ public:
         }
     };
 
+    void downloadState(const std::string& name, const std::size_t size) override {
+        copyState(states().getHostPtr(name), states().getDevicePtr(name), size);
+    };
+
+    void uploadState(const std::string& name, const std::size_t size) override {
+        copyState(states().getDevicePtr(name), states().getHostPtr(name), size);
+    };
+
 private:
+    // Synchronous copy, can be used only when there is no inference in flight
+    void copyState(void* dst, const void* src, const std::size_t size) {
+        OV_ITT_SCOPED_TASK(itt::domains::LevelZeroBackend, "DiscretePipeline::copyState");
+        _state_command_list.reset();
+        _state_command_list.appendMemoryCopy(dst, src, size);
+        _state_command_list.close();
+        _command_queues[stage::UPLOAD]->executeCommandList(_state_command_list, _state_fence);
+        _state_fence.hostSynchronize();
+        _state_fence.reset();
+    };
+
     const Config _config;
     const std::array<std::shared_ptr<CommandQueue>, stage::COUNT>& _command_queues;
     std::array<CommandList, stage::COUNT> _command_list;
+    CommandList _swapped_execute_command_list;
+    CommandList _state_command_list;
     std::array<Fence, stage::COUNT> _fence;
+    Fence _state_fence;
     EventPool _event_pool;
     std::array<Event, stage::COUNT> _event;
 };
@@ -122,61 +304,106 @@ public:
                        ze_graph_dditable_ext_t* graph_ddi_table_ext, const Executor::Ptr& executorPtr,
                        ze_graph_profiling_query_handle_t profiling_handle, CommandQueue& command_queue,
                        const uint32_t& group_ordinal)
-            : _config(config),
+            : Pipeline(config, static_cast<ZeroExecutor*>(executorPtr.get())->scheduler()),
+              _config(config),
               _command_queue{command_queue},
               _command_list{device_handle, context, graph_ddi_table_ext, _config, group_ordinal},
+              _swapped_command_list{device_handle, context, graph_ddi_table_ext, _config, group_ordinal},
               _fence{_command_queue, _config},
               _event_pool{device_handle, context, 1, _config},
-              _event{_event_pool.handle(), 0, _config} {
+              _event{_event_pool.handle(), 0, _config},
+              _profiling_handle(profiling_handle) {
         const ZeroExecutor* executor = static_cast<ZeroExecutor*>(executorPtr.get());
 
         OV_ITT_SCOPED_TASK(itt::domains::LevelZeroBackend,
                            "Zero_infer_request::IntegratedPipeline::IntegratedPipeline");
         for (const auto& desc : executor->inputs_desc_map()) {
-            _inputs.appendArgument(desc.first, desc.second.info);
+            if (!isStateInputName(desc.first)) {
+                _inputs.appendArgument(desc.first, desc.second.info);
+            }
         }
         _inputs.allocate(context, ZE_HOST_MEM_ALLOC_FLAG_BIAS_WRITE_COMBINED);
         for (const auto& desc : executor->inputs_desc_map()) {
-            executor->setArgumentValue(desc.second.idx, _inputs.getHostPtr(desc.first));
+            if (!isStateInputName(desc.first)) {
+                executor->setArgumentValue(desc.second.idx, _inputs.getHostPtr(desc.first));
+            }
         }
 
         for (const auto& desc : executor->outputs_desc_map()) {
-            _outputs.appendArgument(desc.first, desc.second.info);
+            if (!isStateOutputName(desc.first)) {
+                _outputs.appendArgument(desc.first, desc.second.info);
+            }
         }
         _outputs.allocate(context);
         for (const auto& desc : executor->outputs_desc_map()) {
-            executor->setArgumentValue(desc.second.idx, _outputs.getHostPtr(desc.first));
+            if (!isStateOutputName(desc.first)) {
+                executor->setArgumentValue(desc.second.idx, _outputs.getHostPtr(desc.first));
+            }
         }
 
-        _command_list.appendGraphExecute(executor->graph(), profiling_handle);
-        // appendBarrier used in L0 as well
-        if (!sync_output_with_fences_) {
-            _command_list.appendBarrier();
-            _event.AppendSignalEvent(_command_list);
+        appendStateArguments(executor, _states);
+        if (hasStates()) {
+            for (auto& buffer : _states) {
+                buffer.allocate(context);
+            }
+            // Initial value of the state is zero
+            std::memset(_states[0].getHostMemRegion(), 0, _states[0].getSize());
+            setStateArguments(
+                    executor,
+                    [&](const std::string& name) {
+                        return _states[0].getHostPtr(name);
+                    },
+                    [&](const std::string& name) {
+                        return _states[1].getHostPtr(name);
+                    });
+        }
+        appendGraphExecute(_command_list, executor->graph(), profiling_handle);
+
+        // Arguments are captured by the command list, so the swapped state buffers need their own one
+        if (hasStates()) {
+            setStateArguments(
+                    executor,
+                    [&](const std::string& name) {
+                        return _states[1].getHostPtr(name);
+                    },
+                    [&](const std::string& name) {
+                        return _states[0].getHostPtr(name);
+                    });
+            appendGraphExecute(_swapped_command_list, executor->graph(), profiling_handle);
         }
-        _command_list.close();
     };
 
     IntegratedPipeline(const IntegratedPipeline&) = delete;
     IntegratedPipeline& operator=(const IntegratedPipeline&) = delete;
-    virtual ~IntegratedPipeline() = default;
+    ~IntegratedPipeline() override {
+        cancelSubmission();
+    };
 
     void push() override {
         OV_ITT_TASK_CHAIN(ZERO_EXECUTOR_IP_PUSH, itt::domains::LevelZeroBackend, "IntegratedPipeline", "push");
-        if (sync_output_with_fences_) {
-            _command_queue.executeCommandList(_command_list, _fence);
-        } else {
-            _command_queue.executeCommandList(_command_list);
-        }
+        auto& commandList = _states_idx == 0 ? _command_list : _swapped_command_list;
+        schedule([this, &commandList]() {
+            if (sync_output_with_fences_) {
+                _command_queue.executeCommandList(commandList, _fence);
+            } else {
+                _command_queue.executeCommandList(commandList);
+            }
+        });
     };
 
     void pull() override {
         OV_ITT_TASK_CHAIN(ZERO_EXECUTOR_IP_PULL, itt::domains::LevelZeroBackend, "IntegratedPipeline", "pull");
+        waitForSubmission();
         if (sync_output_with_fences_) {
             _fence.hostSynchronize();
         } else {
             _event.hostSynchronize();
         }
+        unschedule();
+
+        if (hasStates()) {
+            swapStates();
+        }
     };
 
     void reset() const override {
@@ -187,25 +414,112 @@ public:
         }
     };
 
+    // States are double-buffered, the batch would need a command list per combination of their indices
+    bool isBatchable() const {
+        return !hasStates();
+    };
+
+    // Records the inference to the command list of the batch, arguments are captured by the command list
+    void appendBatchedGraphExecute(const ZeroExecutor* executor, CommandList& command_list) {
+        for (const auto& desc : executor->inputs_desc_map()) {
+            if (!isStateInputName(desc.first)) {
+                executor->setArgumentValue(desc.second.idx, _inputs.getHostPtr(desc.first));
+            }
+        }
+        for (const auto& desc : executor->outputs_desc_map()) {
+            if (!isStateOutputName(desc.first)) {
+                executor->setArgumentValue(desc.second.idx, _outputs.getHostPtr(desc.first));
+            }
+        }
+        command_list.appendGraphExecute(executor->graph(), _profiling_handle);
+    };
+
 private:
+    void appendGraphExecute(CommandList& command_list, const ze_graph_handle_t& graph_handle,
+                            ze_graph_profiling_query_handle_t profiling_handle) {
+        command_list.appendGraphExecute(graph_handle, profiling_handle);
+        // appendBarrier used in L0 as well
+        if (!sync_output_with_fences_) {
+            command_list.appendBarrier();
+            _event.AppendSignalEvent(command_list);
+        }
+        command_list.close();
+    };
+
     const Config _config;
     CommandQueue& _command_queue;
     CommandList _command_list;
+    CommandList _swapped_command_list;
     Fence _fence;
     EventPool _event_pool;
     Event _event;
+    ze_graph_profiling_query_handle_t _profiling_handle = nullptr;
     bool sync_output_with_fences_ = true;
 };
 
+struct IntegratedPipelineBatch final : public PipelineBatch {
+public:
+    IntegratedPipelineBatch(const Config& config, const ZeroExecutor* executor,
+                            const std::vector<IntegratedPipeline*>& pipelines)
+            : _config(config),
+              _scheduler(executor->scheduler()),
+              _priority(config.get<MODEL_PRIORITY>()),
+              _command_queue(*executor->getCommandQueue()[stage::EXECUTE]),
+              _command_list{executor->device(), executor->context(), executor->graph_ddi_table_ext(), _config,
+                            executor->get_group_ordinal()},
+              _fence{_command_queue, _config} {
+        OV_ITT_SCOPED_TASK(itt::domains::LevelZeroBackend, "IntegratedPipelineBatch::IntegratedPipelineBatch");
+        for (const auto pipeline : pipelines) {
+            pipeline->appendBatchedGraphExecute(executor, _command_list);
+        }
+        _command_list.close();
+    };
+
+    ~IntegratedPipelineBatch() override {
+        if (_scheduled) {
+            _scheduler.release();
+        }
+    };
+
+    void push() override {
+        OV_ITT_TASK_CHAIN(ZERO_EXECUTOR_IPB_PUSH, itt::domains::LevelZeroBackend, "IntegratedPipelineBatch", "push");
+        // The whole batch is a single submission for the host-side scheduler
+        _scheduler.acquire(_priority);
+        _scheduled = true;
+        _command_queue.executeCommandList(_command_list, _fence);
+    };
+
+    void pull() override {
+        OV_ITT_TASK_CHAIN(ZERO_EXECUTOR_IPB_PULL, itt::domains::LevelZeroBackend, "IntegratedPipelineBatch", "pull");
+        _fence.hostSynchronize();
+        _scheduled = false;
+        _scheduler.release();
+    };
+
+    void reset() const override {
+        _fence.reset();
+    };
+
+private:
+    const Config _config;
+    InferenceScheduler& _scheduler;
+    const ov::hint::Priority _priority;
+    CommandQueue& _command_queue;
+    CommandList _command_list;
+    Fence _fence;
+    bool _scheduled = false;
+};
+
 std::unique_ptr<Pipeline> makePipeline(const Executor::Ptr& executorPtr, const Config& config,
                                        vpux::zeroProfiling::ProfilingPool& profiling_pool,
                                        vpux::zeroProfiling::ProfilingQuery& profiling_query) {
     OV_ITT_SCOPED_TASK(itt::domains::LevelZeroBackend, "Infer_request::makePipeline");
+    ZeroExecutor* executor = static_cast<ZeroExecutor*>(executorPtr.get());
+    executor->waitForGraphInitialization();
+
     if (profiling_pool.create())
         profiling_query.create(profiling_pool._handle);
 
-    const ZeroExecutor* executor = static_cast<ZeroExecutor*>(executorPtr.get());
-
     const ze_device_handle_t device_handle = executor->device();
     const ze_context_handle_t context = executor->context();
     ze_graph_dditable_ext_t* graph_ddi_table_ext = executor->graph_ddi_table_ext();
@@ -225,4 +539,22 @@ std::unique_ptr<Pipeline> makePipeline(const Executor::Ptr& executorPtr, const C
                                               profiling_query.getHandle(), command_queues, group_ordinal);
 }
 
+std::unique_ptr<PipelineBatch> makePipelineBatch(const Executor::Ptr& executorPtr, const Config& config,
+                                                 const std::vector<Pipeline*>& pipelines) {
+    OV_ITT_SCOPED_TASK(itt::domains::LevelZeroBackend, "Infer_request::makePipelineBatch");
+    const ZeroExecutor* executor = static_cast<ZeroExecutor*>(executorPtr.get());
+
+    // Discrete devices need upload and readback stages for each inference, so there is nothing to amortize
+    std::vector<IntegratedPipeline*> integratedPipelines;
+    for (const auto pipeline : pipelines) {
+        const auto integratedPipeline = dynamic_cast<IntegratedPipeline*>(pipeline);
+        if (integratedPipeline == nullptr || !integratedPipeline->isBatchable()) {
+            return nullptr;
+        }
+        integratedPipelines.push_back(integratedPipeline);
+    }
+
+    return std::make_unique<IntegratedPipelineBatch>(config, executor, integratedPipelines);
+}
+
 }  // namespace vpux
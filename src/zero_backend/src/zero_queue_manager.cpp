@@ -0,0 +1,30 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "zero_queue_manager.h"
+
+#include "zero_utils.h"
+
+using namespace vpux;
+
+ZeroQueueManager::ZeroQueueManager(ze_device_handle_t device_handle, ze_context_handle_t context,
+                                   uint32_t group_ordinal)
+        : _device_handle(device_handle), _context(context), _group_ordinal(group_ordinal) {
+}
+
+std::shared_ptr<CommandQueue> ZeroQueueManager::getCommandQueue(ov::hint::Priority priority, stage stage,
+                                                                const Config& config) {
+    const auto ze_priority = zeroUtils::toZeQueuePriority(priority);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto& cached = _command_queues[std::make_pair(ze_priority, stage)];
+    if (auto command_queue = cached.lock()) {
+        return command_queue;
+    }
+
+    auto command_queue = std::make_shared<CommandQueue>(_device_handle, _context, ze_priority, config, _group_ordinal);
+    cached = command_queue;
+    return command_queue;
+}
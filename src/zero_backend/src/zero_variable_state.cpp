@@ -0,0 +1,54 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "zero_variable_state.h"
+
+#include <cstring>
+
+#include <ie_blob.h>
+#include <blob_factory.hpp>
+
+#include "vpux/utils/IE/itt.hpp"
+
+namespace ie = InferenceEngine;
+using namespace vpux;
+
+ZeroVariableState::ZeroVariableState(const std::string& name, const ie::TensorDesc& tensorDesc, Pipeline& pipeline)
+        : ie::IVariableStateInternal{name}, _pipeline(pipeline) {
+    // Host copy returned by GetState, pipeline buffers can't be exposed since they are swapped on each inference
+    state = make_blob_with_precision(tensorDesc);
+    state->allocate();
+}
+
+void ZeroVariableState::Reset() {
+    OV_ITT_SCOPED_TASK(itt::domains::LevelZeroBackend, "ZeroVariableState::Reset");
+    std::memset(_pipeline.states().getHostPtr(name), 0, state->byteSize());
+    _pipeline.uploadState(name, state->byteSize());
+}
+
+void ZeroVariableState::SetState(const ie::Blob::Ptr& new_state) {
+    OV_ITT_SCOPED_TASK(itt::domains::LevelZeroBackend, "ZeroVariableState::SetState");
+    IE_ASSERT(new_state != nullptr);
+    IE_ASSERT(new_state->byteSize() == state->byteSize());
+
+    auto new_state_mem_blob = ie::as<ie::MemoryBlob>(new_state);
+    IE_ASSERT(new_state_mem_blob);
+    auto new_state_mem_locker = new_state_mem_blob->rmap();
+
+    std::memcpy(_pipeline.states().getHostPtr(name), new_state_mem_locker.as<const void*>(), state->byteSize());
+    _pipeline.uploadState(name, state->byteSize());
+}
+
+ie::Blob::CPtr ZeroVariableState::GetState() const {
+    OV_ITT_SCOPED_TASK(itt::domains::LevelZeroBackend, "ZeroVariableState::GetState");
+    _pipeline.downloadState(name, state->byteSize());
+
+    auto state_mem_blob = ie::as<ie::MemoryBlob>(state);
+    IE_ASSERT(state_mem_blob);
+    auto state_mem_locker = state_mem_blob->wmap();
+
+    std::memcpy(state_mem_locker.as<void*>(), _pipeline.states().getHostPtr(name), state->byteSize());
+    return state;
+}
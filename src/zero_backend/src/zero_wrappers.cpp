@@ -101,10 +101,12 @@ CommandQueue::CommandQueue(const ze_device_handle_t& device_handle, const ze_con
                            zeCommandQueueCreate(_context, device_handle, &queue_desc, &_handle));
 }
 void CommandQueue::executeCommandList(CommandList& command_list) const {
+    std::lock_guard<std::mutex> lock(_mutex);
     zeroUtils::throwOnFail("zeCommandQueueExecuteCommandLists",
                            zeCommandQueueExecuteCommandLists(_handle, 1, &command_list._handle, nullptr));
 }
 void CommandQueue::executeCommandList(CommandList& command_list, Fence& fence) const {
+    std::lock_guard<std::mutex> lock(_mutex);
     zeroUtils::throwOnFail("zeCommandQueueExecuteCommandLists",
                            zeCommandQueueExecuteCommandLists(_handle, 1, &command_list._handle, fence.handle()));
 }
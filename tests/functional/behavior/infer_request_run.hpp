@@ -13,6 +13,7 @@
 #include "functional_test_utils/ov_plugin_cache.hpp"
 #include "ngraph_functions/builders.hpp"
 #include "vpu_test_env_cfg.hpp"
+#include "vpux_private_properties.hpp"
 
 #include <gmock/gmock-matchers.h>
 #include <gmock/gmock.h>
@@ -22,6 +23,7 @@
 #include <openvino/core/any.hpp>
 #include <openvino/core/node_vector.hpp>
 #include <openvino/op/op.hpp>
+#include <openvino/opsets/opset6.hpp>
 #include <openvino/runtime/compiled_model.hpp>
 #include <openvino/runtime/core.hpp>
 
@@ -175,6 +177,100 @@ TEST_P(InferRequestRunTests, MultipleExecutorTestsSyncInfers) {
     }
 }
 
+TEST_P(InferRequestRunTests, StateIsUpdatedByEachInference) {
+    // Skip test according to plugin specific disabledTestPatterns() (if any)
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    // state = state + input, the output is the new state
+    const ov::Shape shape = {1, 16};
+    const auto variable =
+            std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{shape, ov::element::f32, "state"});
+    const auto param = std::make_shared<ov::opset6::Parameter>(ov::element::f32, shape);
+    const auto init = ov::opset6::Constant::create(ov::element::f32, shape, {0.f});
+    const auto readValue = std::make_shared<ov::opset6::ReadValue>(init, variable);
+    const auto add = std::make_shared<ov::opset6::Add>(readValue, param);
+    const auto assign = std::make_shared<ov::opset6::Assign>(add, variable);
+    const auto result = std::make_shared<ov::opset6::Result>(add);
+    const auto stateful = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::SinkVector{assign},
+                                                      ov::ParameterVector{param}, "stateful");
+
+    OV_ASSERT_NO_THROW(compiledModel = core->compile_model(stateful, target_device, configuration));
+    ov::InferRequest inferReq;
+    OV_ASSERT_NO_THROW(inferReq = compiledModel.create_infer_request());
+
+    const auto inputTensor = inferReq.get_input_tensor();
+    std::fill_n(inputTensor.data<float>(), inputTensor.get_size(), 1.f);
+    const auto expectOutput = [&](float expected) {
+        const auto outputTensor = inferReq.get_output_tensor();
+        const auto data = outputTensor.data<float>();
+        for (size_t i = 0; i < outputTensor.get_size(); ++i) {
+            ASSERT_EQ(data[i], expected) << "at " << i;
+        }
+    };
+
+    // Several inferences, so both state buffers are read and written
+    for (int i = 1; i <= 4; ++i) {
+        OV_ASSERT_NO_THROW(inferReq.infer());
+        expectOutput(static_cast<float>(i));
+    }
+
+    auto states = inferReq.query_state();
+    ASSERT_EQ(states.size(), 1u);
+    const auto state = states.front().get_state();
+    for (size_t i = 0; i < state.get_size(); ++i) {
+        ASSERT_EQ(state.data<float>()[i], 4.f) << "at " << i;
+    }
+
+    states.front().reset();
+    OV_ASSERT_NO_THROW(inferReq.infer());
+    expectOutput(1.f);
+
+    ov::Tensor newState(ov::element::f32, shape);
+    std::fill_n(newState.data<float>(), newState.get_size(), 10.f);
+    states.front().set_state(newState);
+    OV_ASSERT_NO_THROW(inferReq.infer());
+    expectOutput(11.f);
+}
+
+TEST_P(InferRequestRunTests, InferencesOfAllPrioritiesAreRunWithInFlightLimit) {
+    // Skip test according to plugin specific disabledTestPatterns() (if any)
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const auto getCount = [&](const std::string& key) -> uint64_t {
+        const auto delays = core->get_property(target_device, ov::intel_vpux::queueing_delays);
+        const auto it = delays.find(key);
+        return it != delays.end() ? it->second : 0;
+    };
+    const auto highCountBefore = getCount("HIGH_COUNT");
+    const auto lowCountBefore = getCount("LOW_COUNT");
+
+    // Both networks share the queues and the in-flight limit of the device
+    std::vector<ov::CompiledModel> compiledModels;
+    for (const auto priority : {ov::hint::Priority::HIGH, ov::hint::Priority::LOW}) {
+        auto config = configuration;
+        config[ov::hint::model_priority.name()] = priority;
+        config[ov::intel_vpux::max_inflight_inferences.name()] = int64_t(1);
+        OV_ASSERT_NO_THROW(compiledModels.push_back(core->compile_model(function, target_device, config)));
+    }
+
+    const int inferReqNumber = 8;
+    std::vector<ov::InferRequest> inferReqs;
+    for (auto& model : compiledModels) {
+        for (int i = 0; i < inferReqNumber; ++i) {
+            OV_ASSERT_NO_THROW(inferReqs.push_back(model.create_infer_request()));
+        }
+    }
+    for (auto& inferReq : inferReqs) {
+        OV_ASSERT_NO_THROW(inferReq.start_async());
+    }
+    for (auto& inferReq : inferReqs) {
+        OV_ASSERT_NO_THROW(inferReq.wait());
+    }
+
+    EXPECT_GE(getCount("HIGH_COUNT") - highCountBefore, static_cast<uint64_t>(inferReqNumber));
+    EXPECT_GE(getCount("LOW_COUNT") - lowCountBefore, static_cast<uint64_t>(inferReqNumber));
+}
+
 }  // namespace behavior
 }  // namespace test
 }  // namespace ov
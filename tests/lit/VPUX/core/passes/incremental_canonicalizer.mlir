@@ -0,0 +1,30 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=%arch%" --incremental-canonicalize --incremental-canonicalize %s | FileCheck %s
+// REQUIRES: arch-VPUX30XX || arch-VPUX37XX
+
+// CHECK-LABEL: @Eliminate
+func.func @Eliminate(%arg0 : tensor<4x4xf32>) -> tensor<4x4xf32> {
+    %0 = IE.Reshape(%arg0) { shape_value = [4, 4] } : tensor<4x4xf32> -> tensor<4x4xf32>
+    return %0 : tensor<4x4xf32>
+
+    // CHECK-NOT: IE.Reshape
+    // CHECK:     return %arg0
+}
+
+// -----
+
+// CHECK-LABEL: @ConstFold
+func.func @ConstFold() -> tensor<4x4xf32> {
+    %0 = const.Declare tensor<16xf32> = dense<1.0> : tensor<16xf32>
+    %1 = IE.Reshape(%0) { shape_value = [4, 4] } : tensor<16xf32> -> tensor<4x4xf32>
+    return %1 : tensor<4x4xf32>
+
+    // CHECK-DAG:       [[VAL0:%.+]] = const.Declare tensor<4x4xf32> =
+    // CHECK-SAME:      dense<1.000000e+00> : tensor<16xf32>, [#const.Reshape<[4, 4]>]
+    // CHECK-NOT:   IE.Reshape
+    // CHECK:       return [[VAL0]]
+}
@@ -0,0 +1,23 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=%arch%" --incremental-canonicalize --convert-power-to-mult --incremental-canonicalize %s | FileCheck %s
+// REQUIRES: arch-VPUX30XX || arch-VPUX37XX
+
+// The first canonicalization leaves the exponent constant in place, the pass in between makes it dead,
+// so the second canonicalization must not be skipped
+
+// CHECK-LABEL: @RerunAfterChange
+func.func @RerunAfterChange(%arg0: tensor<1x16xf16>) -> tensor<1x16xf16> {
+    %cst_exponent = const.Declare tensor<1x1xf16> = dense<2.0> : tensor<1x1xf16>
+    %power = IE.Power(%arg0, %cst_exponent) {auto_broadcast = #IE.auto_broadcast_type<NUMPY>} : tensor<1x16xf16>, tensor<1x1xf16> -> tensor<1x16xf16>
+    return %power : tensor<1x16xf16>
+
+    // CHECK-NOT:   const.Declare
+    // CHECK-NOT:   IE.Power
+    // CHECK:       [[VAL0:%.+]] = IE.Multiply(%arg0, %arg0)
+    // CHECK-NOT:   const.Declare
+    // CHECK:       return [[VAL0]]
+}
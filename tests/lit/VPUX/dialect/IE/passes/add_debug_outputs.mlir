@@ -0,0 +1,78 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=%arch%" --add-debug-outputs="layer-names=conv,softmax,split,relu,missing" %s | FileCheck %s
+// REQUIRES: arch-VPUX30XX || arch-VPUX37XX
+
+// CHECK-LABEL: @AddDebugOutputs
+module @AddDebugOutputs {
+
+IE.CNNNetwork entryPoint : @main inputsInfo : {
+    DataInfo "input" : tensor<1x8x4x4xf16>
+} outputsInfo : {
+    DataInfo "relu" : tensor<1x4x4x4xf16>
+}
+
+// CHECK:       outputsInfo : {
+// CHECK-NEXT:      DataInfo "relu" : tensor<1x4x4x4xf16>
+// CHECK-NEXT:      DataInfo "softmax" : tensor<1x8x4x4xf16>
+// CHECK-NEXT:      DataInfo "split.0" : tensor<1x4x4x4xf16>
+// CHECK-NEXT:      DataInfo "split.1" : tensor<1x4x4x4xf16>
+// CHECK-NEXT:  }
+
+// CHECK:       func.func @main([[ARG0:%.+]]: tensor<1x8x4x4xf16>)
+// CHECK-SAME:      -> (tensor<1x4x4x4xf16>, tensor<1x8x4x4xf16>, tensor<1x4x4x4xf16>, tensor<1x4x4x4xf16>)
+func.func @main(%arg0: tensor<1x8x4x4xf16>) -> tensor<1x4x4x4xf16> {
+    %0 = IE.SoftMax(%arg0) {axisInd = 1} : tensor<1x8x4x4xf16> -> tensor<1x8x4x4xf16> loc(fused["softmax", "t_SoftMax"])
+    %1:2 = IE.Split(%0) {axis_value = 1, num_splits = 2} : tensor<1x8x4x4xf16> -> tensor<1x4x4x4xf16>, tensor<1x4x4x4xf16> loc(fused["split", "t_Split"])
+    %2 = IE.Add(%1#0, %1#1) {auto_broadcast = #IE.auto_broadcast_type<NUMPY>} : tensor<1x4x4x4xf16>, tensor<1x4x4x4xf16> -> tensor<1x4x4x4xf16> loc(fused["add", "t_Add"])
+    %3 = IE.ReLU(%2) : tensor<1x4x4x4xf16> -> tensor<1x4x4x4xf16> loc(fused["relu", "t_Relu"])
+    return %3 : tensor<1x4x4x4xf16>
+
+    // CHECK:       [[SOFTMAX:%.+]] = IE.SoftMax([[ARG0]])
+    // CHECK:       [[SPLIT:%.+]]:2 = IE.Split([[SOFTMAX]])
+    // CHECK:       [[ADD:%.+]] = IE.Add([[SPLIT]]#0, [[SPLIT]]#1)
+    // CHECK:       [[RELU:%.+]] = IE.ReLU([[ADD]])
+    // CHECK:       return [[RELU]], [[SOFTMAX]], [[SPLIT]]#0, [[SPLIT]]#1
+}
+
+}
+
+// -----
+
+// CHECK-LABEL: @FusedPostOp
+module @FusedPostOp {
+
+IE.CNNNetwork entryPoint : @main inputsInfo : {
+    DataInfo "input" : tensor<1x16x4x4xf16>
+} outputsInfo : {
+    DataInfo "output" : tensor<1x16x3x3xf16>
+}
+
+// CHECK:       outputsInfo : {
+// CHECK-NEXT:      DataInfo "output" : tensor<1x16x3x3xf16>
+// CHECK-NEXT:      DataInfo "softmax" : tensor<1x16x3x3xf16>
+// CHECK-NEXT:  }
+
+// CHECK:       func.func @main([[ARG0:%.+]]: tensor<1x16x4x4xf16>) -> (tensor<1x16x3x3xf16>, tensor<1x16x3x3xf16>)
+func.func @main(%arg0: tensor<1x16x4x4xf16>) -> tensor<1x16x3x3xf16> {
+    %filters = const.Declare tensor<16x16x2x2xf16> = dense<1.0> : tensor<16x16x2x2xf16>
+    %0 = IE.Convolution(%arg0, %filters) {
+            dilations = [1, 1], pads_begin = [0, 0], pads_end = [0, 0],
+            post_op = #IE.PostOp<name = "IE.ReLU", attrs = {}>, strides = [1, 1]
+        } : tensor<1x16x4x4xf16>, tensor<16x16x2x2xf16> -> tensor<1x16x3x3xf16> loc(fused["conv", "t_Convolution"])
+    %1 = IE.SoftMax(%0) {axisInd = 1} : tensor<1x16x3x3xf16> -> tensor<1x16x3x3xf16> loc(fused["softmax", "t_SoftMax"])
+    %2 = IE.Add(%1, %1) {auto_broadcast = #IE.auto_broadcast_type<NUMPY>} : tensor<1x16x3x3xf16>, tensor<1x16x3x3xf16> -> tensor<1x16x3x3xf16> loc(fused["add", "t_Add"])
+    return %2 : tensor<1x16x3x3xf16>
+
+    // The convolution result includes the fused ReLU, it is not the result of the original layer
+
+    // CHECK:       [[CONV:%.+]] = IE.Convolution
+    // CHECK:       [[SOFTMAX:%.+]] = IE.SoftMax([[CONV]])
+    // CHECK:       [[ADD:%.+]] = IE.Add([[SOFTMAX]], [[SOFTMAX]])
+    // CHECK:       return [[ADD]], [[SOFTMAX]]
+}
+
+}
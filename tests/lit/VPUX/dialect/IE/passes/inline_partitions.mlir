@@ -0,0 +1,50 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=%arch%" --inline-partitions %s | FileCheck %s
+// REQUIRES: arch-VPUX30XX || arch-VPUX37XX
+
+// CHECK-LABEL: @TwoPartitions
+module @TwoPartitions {
+
+IE.CNNNetwork entryPoint : @main inputsInfo : {
+    DataInfo "input" : tensor<1x16x4x4xf16>
+} outputsInfo : {
+    DataInfo "output" : tensor<1x16x4x4xf16>
+}
+
+// CHECK-NOT:   func.func private
+func.func private @main_part0(%arg0: tensor<1x16x4x4xf16>) -> tensor<1x16x4x4xf16> {
+    %cst = const.Declare tensor<1x16x1x1xf16> = dense<1.0> : tensor<1x16x1x1xf16>
+    %0 = IE.Add(%arg0, %cst) {auto_broadcast = #IE.auto_broadcast_type<NUMPY>} : tensor<1x16x4x4xf16>, tensor<1x16x1x1xf16> -> tensor<1x16x4x4xf16>
+    %1 = IE.ReLU(%0) : tensor<1x16x4x4xf16> -> tensor<1x16x4x4xf16>
+    return %1 : tensor<1x16x4x4xf16>
+}
+
+func.func private @main_part1(%arg0: tensor<1x16x4x4xf16>) -> tensor<1x16x4x4xf16> {
+    %cst = const.Declare tensor<1x16x1x1xf16> = dense<1.0> : tensor<1x16x1x1xf16>
+    %0 = IE.Add(%arg0, %cst) {auto_broadcast = #IE.auto_broadcast_type<NUMPY>} : tensor<1x16x4x4xf16>, tensor<1x16x1x1xf16> -> tensor<1x16x4x4xf16>
+    %1 = IE.SoftMax(%0) {axisInd = 1} : tensor<1x16x4x4xf16> -> tensor<1x16x4x4xf16>
+    return %1 : tensor<1x16x4x4xf16>
+}
+
+// CHECK:       func.func @main([[ARG0:%.+]]: tensor<1x16x4x4xf16>) -> tensor<1x16x4x4xf16>
+func.func @main(%arg0: tensor<1x16x4x4xf16>) -> tensor<1x16x4x4xf16> {
+    %0 = call @main_part0(%arg0) : (tensor<1x16x4x4xf16>) -> tensor<1x16x4x4xf16>
+    %1 = call @main_part1(%0) : (tensor<1x16x4x4xf16>) -> tensor<1x16x4x4xf16>
+    return %1 : tensor<1x16x4x4xf16>
+
+    // The constant cloned into both partitions is merged
+
+    // CHECK:       [[CST:%.+]] = const.Declare tensor<1x16x1x1xf16> = dense<1.000000e+00> : tensor<1x16x1x1xf16>
+    // CHECK:       [[ADD0:%.+]] = IE.Add([[ARG0]], [[CST]])
+    // CHECK:       [[RELU:%.+]] = IE.ReLU([[ADD0]])
+    // CHECK-NOT:   const.Declare
+    // CHECK:       [[ADD1:%.+]] = IE.Add([[RELU]], [[CST]])
+    // CHECK:       [[SOFTMAX:%.+]] = IE.SoftMax([[ADD1]])
+    // CHECK:       return [[SOFTMAX]]
+}
+
+}
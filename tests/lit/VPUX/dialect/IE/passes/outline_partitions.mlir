@@ -0,0 +1,68 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=%arch%" --outline-partitions="num-partitions=2 min-partition-size=1" %s | FileCheck %s
+// REQUIRES: arch-VPUX30XX || arch-VPUX37XX
+
+// CHECK-LABEL: @TwoPartitions
+module @TwoPartitions {
+
+IE.CNNNetwork entryPoint : @main inputsInfo : {
+    DataInfo "input" : tensor<1x16x4x4xf16>
+} outputsInfo : {
+    DataInfo "output" : tensor<1x16x4x4xf16>
+}
+
+// CHECK:       func.func private @main_part0([[ARG0:%.+]]: tensor<1x16x4x4xf16>) -> tensor<1x16x4x4xf16>
+// CHECK:           [[CST:%.+]] = const.Declare tensor<1x16x1x1xf16> = dense<1.000000e+00> : tensor<1x16x1x1xf16>
+// CHECK:           [[ADD:%.+]] = IE.Add([[ARG0]], [[CST]])
+// CHECK:           [[RELU:%.+]] = IE.ReLU([[ADD]])
+// CHECK:           return [[RELU]]
+
+// CHECK:       func.func private @main_part1([[ARG0:%.+]]: tensor<1x16x4x4xf16>) -> tensor<1x16x4x4xf16>
+// CHECK:           [[CST:%.+]] = const.Declare tensor<1x16x1x1xf16> = dense<1.000000e+00> : tensor<1x16x1x1xf16>
+// CHECK:           [[ADD:%.+]] = IE.Add([[ARG0]], [[CST]])
+// CHECK:           [[SOFTMAX:%.+]] = IE.SoftMax([[ADD]])
+// CHECK:           return [[SOFTMAX]]
+
+// CHECK:       func.func @main([[ARG0:%.+]]: tensor<1x16x4x4xf16>) -> tensor<1x16x4x4xf16>
+func.func @main(%arg0: tensor<1x16x4x4xf16>) -> tensor<1x16x4x4xf16> {
+    %cst = const.Declare tensor<1x16x1x1xf16> = dense<1.0> : tensor<1x16x1x1xf16>
+    %0 = IE.Add(%arg0, %cst) {auto_broadcast = #IE.auto_broadcast_type<NUMPY>} : tensor<1x16x4x4xf16>, tensor<1x16x1x1xf16> -> tensor<1x16x4x4xf16>
+    %1 = IE.ReLU(%0) : tensor<1x16x4x4xf16> -> tensor<1x16x4x4xf16>
+    %2 = IE.Add(%1, %cst) {auto_broadcast = #IE.auto_broadcast_type<NUMPY>} : tensor<1x16x4x4xf16>, tensor<1x16x1x1xf16> -> tensor<1x16x4x4xf16>
+    %3 = IE.SoftMax(%2) {axisInd = 1} : tensor<1x16x4x4xf16> -> tensor<1x16x4x4xf16>
+    return %3 : tensor<1x16x4x4xf16>
+
+    // CHECK-NOT:   const.Declare
+    // CHECK:       [[PART0:%.+]] = call @main_part0([[ARG0]])
+    // CHECK:       [[PART1:%.+]] = call @main_part1([[PART0]])
+    // CHECK:       return [[PART1]]
+}
+
+}
+
+// -----
+
+// CHECK-LABEL: @TooSmall
+module @TooSmall {
+
+IE.CNNNetwork entryPoint : @main inputsInfo : {
+    DataInfo "input" : tensor<1x16x4x4xf16>
+} outputsInfo : {
+    DataInfo "output" : tensor<1x16x4x4xf16>
+}
+
+// CHECK-NOT:   func.func private
+// CHECK:       func.func @main([[ARG0:%.+]]: tensor<1x16x4x4xf16>) -> tensor<1x16x4x4xf16>
+func.func @main(%arg0: tensor<1x16x4x4xf16>) -> tensor<1x16x4x4xf16> {
+    %0 = IE.ReLU(%arg0) : tensor<1x16x4x4xf16> -> tensor<1x16x4x4xf16>
+    return %0 : tensor<1x16x4x4xf16>
+
+    // CHECK:       [[RELU:%.+]] = IE.ReLU([[ARG0]])
+    // CHECK:       return [[RELU]]
+}
+
+}
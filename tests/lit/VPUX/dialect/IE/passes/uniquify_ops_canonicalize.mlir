@@ -0,0 +1,27 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=%arch%" --uniquify-ops="canonicalize=true" %s | FileCheck %s
+// REQUIRES: arch-VPUX30XX || arch-VPUX37XX
+
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+// The identity Reshape is removed by its canonicalizer in the same traversal,
+// so both Reorders get the same producer and are merged
+
+// CHECK-LABEL: @UniquifyAfterCanonicalization
+func.func @UniquifyAfterCanonicalization(%arg0: tensor<1x16x4x4xf16>) -> tensor<1x16x4x4xf16, {order = #NHWC}> {
+    %0 = IE.Reshape(%arg0) {shape_value = [1, 16, 4, 4]} : tensor<1x16x4x4xf16> -> tensor<1x16x4x4xf16>
+    %1 = IE.Reorder(%0) {dstOrder = #NHWC} : tensor<1x16x4x4xf16> -> tensor<1x16x4x4xf16, {order = #NHWC}>
+    %2 = IE.Reorder(%arg0) {dstOrder = #NHWC} : tensor<1x16x4x4xf16> -> tensor<1x16x4x4xf16, {order = #NHWC}>
+    %3 = IE.Add(%1, %2) {auto_broadcast = #IE.auto_broadcast_type<NUMPY>} : tensor<1x16x4x4xf16, {order = #NHWC}>, tensor<1x16x4x4xf16, {order = #NHWC}> -> tensor<1x16x4x4xf16, {order = #NHWC}>
+    return %3 : tensor<1x16x4x4xf16, {order = #NHWC}>
+
+    // CHECK-NOT:   IE.Reshape
+    // CHECK:       [[REORDER:%.+]] = IE.Reorder(%arg0)
+    // CHECK-NOT:   IE.Reorder
+    // CHECK:       [[ADD:%.+]] = IE.Add([[REORDER]], [[REORDER]])
+    // CHECK:       return [[ADD]]
+}
@@ -0,0 +1,47 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+// RUN: vpux-opt --vpu-arch=VPUX30XX --split-input-file --reference-sw-mode="constant-folding=true" %s | FileCheck %s --check-prefix=FOLDED
+// RUN: vpux-opt --vpu-arch=VPUX30XX --split-input-file --reference-sw-mode %s | FileCheck %s --check-prefix=NOT-FOLDED
+
+// FOLDED-LABEL: @ConstantWithTransformations
+// NOT-FOLDED-LABEL: @ConstantWithTransformations
+module @ConstantWithTransformations {
+
+IE.CNNNetwork
+    entryPoint : @main
+    inputsInfo : {
+        DataInfo "input" : tensor<1x2x2x2xf16>
+    }
+    outputsInfo : {
+        DataInfo "output" : tensor<1x2x2x2xf16>
+    }
+
+func.func @main(%arg0: tensor<1x2x2x2xf16>) -> tensor<1x2x2x2xf16> {
+    %cst = const.Declare tensor<1x2x2x2xf16> =
+        dense<[
+            [
+                [
+                    [1.0, 2.0],
+                    [3.0, 4.0]
+                ],
+                [
+                    [5.0, 6.0],
+                    [7.0, 8.0]
+                ]
+            ]
+        ]> : tensor<1x2x2x2xf32>, [#const.ConvertElemType<f16>]
+
+    %0 = IE.SoftMax(%cst) {axisInd = 1} : tensor<1x2x2x2xf16> -> tensor<1x2x2x2xf16>
+
+    return %0 : tensor<1x2x2x2xf16>
+
+    // FOLDED:          const.Declare memref<1x2x2x2xf16{{.*}}> = dense<{{.+}}> : tensor<1x2x2x2xf16>{{$}}
+
+    // NOT-FOLDED:      const.Declare memref<1x2x2x2xf16{{.*}}> = dense<{{.+}}> : tensor<1x2x2x2xf32>,
+    // NOT-FOLDED-SAME:     [#const.ConvertElemType<f16>
+}
+
+}
@@ -0,0 +1,93 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+// RUN: echo '{"traceEvents":[ {"name":"conv1?t_Convolution/cluster_0", "cat":"DPU", "ph":"X", "ts":10.000, "dur":5.000, "pid":1, "tid":0}, {"name":"conv1?t_Convolution/cluster_1", "cat":"DPU", "ph":"X", "ts":11.000, "dur":5.000, "pid":2, "tid":0}, {"name":"conv1?t_Convolution/_cluster_0", "cat":"DMA", "ph":"X", "ts":0.000, "dur":100.000, "pid":0, "tid":0}, {"name":"conv1", "cat":"Layer", "ph":"X", "ts":0.000, "dur":100.000, "pid":3, "tid":0}, {"name":"conv2?t_Convolution?add_0/cluster_0", "cat":"DPU", "ph":"X", "ts":20.000, "dur":2.000, "pid":1, "tid":0}, {"name":"conv2?t_Convolution?add_1/cluster_0", "cat":"DPU", "ph":"X", "ts":22.000, "dur":2.000, "pid":1, "tid":0}, {"name":"conv4?t_Convolution?add_0/cluster_0", "cat":"DPU", "ph":"X", "ts":30.000, "dur":3.000, "pid":1, "tid":0} ], "displayTimeUnit": "ns"}' > %t.json
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=VPUX37XX compilation-mode=DefaultHW" --apply-profiled-costs="profiled-costs-file=%t.json" %s | FileCheck %s
+
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+// CHECK-LABEL: @ProfiledConv
+func.func @ProfiledConv(%arg0: tensor<1x64x28x28xf16, {order = #NHWC}>) -> tensor<1x80x28x28xf16, {order = #NHWC}> {
+    %cst = const.Declare tensor<80x1x1x4xsi32> = dense<10> : tensor<80x1x1x4xsi32>
+    %cst_0 = const.Declare tensor<80x64x3x3xf16, {order = #NHWC}> = dense<1.000000e+00> : tensor<80x64x3x3xf16>, [#const.Reorder<#NHWC>]
+
+    %0 = VPU.NCE.Convolution(%arg0, %cst_0, %cst) {
+        multiClusterStrategy = #VPU.multi_cluster_strategy<SplitOverKernel>,
+        pad = #VPU.Padding<left = 1 : i64, right = 1 : i64, top = 1 : i64, bottom = 1 : i64>,
+        rawFilterShape = [80, 64, 3, 3], strides = [1, 1]
+    } -> tensor<1x80x28x28xf16, {order = #NHWC}> loc(fused["conv1", "t_Convolution"])
+
+    return %0 : tensor<1x80x28x28xf16, {order = #NHWC}>
+
+    // Compute tasks span 6 us, DMA and layer events are ignored, 6000 ns at 1300 MHz
+    // CHECK:       VPU.NCE.Convolution
+    // CHECK-SAME:      profiledCost = {cycles = 7800 : i64, strategy = #VPU.multi_cluster_strategy<SplitOverKernel>}
+}
+
+// -----
+
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+// CHECK-LABEL: @ProfiledConvWithoutStrategy
+func.func @ProfiledConvWithoutStrategy(%arg0: tensor<1x64x28x28xf16, {order = #NHWC}>) -> tensor<1x80x28x28xf16, {order = #NHWC}> {
+    %cst = const.Declare tensor<80x1x1x4xsi32> = dense<10> : tensor<80x1x1x4xsi32>
+    %cst_0 = const.Declare tensor<80x64x3x3xf16, {order = #NHWC}> = dense<1.000000e+00> : tensor<80x64x3x3xf16>, [#const.Reorder<#NHWC>]
+
+    %0 = VPU.NCE.Convolution(%arg0, %cst_0, %cst) {
+        pad = #VPU.Padding<left = 1 : i64, right = 1 : i64, top = 1 : i64, bottom = 1 : i64>,
+        rawFilterShape = [80, 64, 3, 3], strides = [1, 1]
+    } -> tensor<1x80x28x28xf16, {order = #NHWC}> loc(fused["conv1", "t_Convolution"])
+
+    return %0 : tensor<1x80x28x28xf16, {order = #NHWC}>
+
+    // CHECK:       VPU.NCE.Convolution
+    // CHECK-SAME:      profiledCost = {cycles = 7800 : i64, strategy = #VPU.multi_cluster_strategy<{{[A-Za-z]+}}>}
+}
+
+// -----
+
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+// CHECK-LABEL: @LayerSplitIntoSeveralOps
+func.func @LayerSplitIntoSeveralOps(%arg0: tensor<1x64x28x28xf16, {order = #NHWC}>) -> tensor<1x64x28x28xf16, {order = #NHWC}> {
+    %0 = VPU.NCE.Eltwise(%arg0, %arg0) {
+        multiClusterStrategy = #VPU.multi_cluster_strategy<SplitOverHeight>,
+        op_type = #VPU.eltwise_type<ADD>
+    } -> tensor<1x64x28x28xf16, {order = #NHWC}> loc(fused["conv2", "t_Convolution", "add_0"])
+
+    %1 = VPU.NCE.Eltwise(%0, %arg0) {
+        multiClusterStrategy = #VPU.multi_cluster_strategy<SplitOverHeight>,
+        op_type = #VPU.eltwise_type<ADD>
+    } -> tensor<1x64x28x28xf16, {order = #NHWC}> loc(fused["conv2", "t_Convolution", "add_1"])
+
+    %2 = VPU.NCE.Eltwise(%1, %arg0) {
+        multiClusterStrategy = #VPU.multi_cluster_strategy<SplitOverHeight>,
+        op_type = #VPU.eltwise_type<ADD>
+    } -> tensor<1x64x28x28xf16, {order = #NHWC}> loc(fused["conv3", "t_Eltwise"])
+
+    return %2 : tensor<1x64x28x28xf16, {order = #NHWC}>
+
+    // Both sides are matched by the original layer name, conv2 is profiled but its time can't be distributed
+    // between the ops of the layer. Unprofiled layer keeps VPUNN cost
+    // CHECK-NOT:   profiledCost
+}
+
+// -----
+
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+// CHECK-LABEL: @ProfiledLayerWithSeveralSuffixes
+func.func @ProfiledLayerWithSeveralSuffixes(%arg0: tensor<1x64x28x28xf16, {order = #NHWC}>) -> tensor<1x64x28x28xf16, {order = #NHWC}> {
+    %0 = VPU.NCE.Eltwise(%arg0, %arg0) {
+        multiClusterStrategy = #VPU.multi_cluster_strategy<SplitOverHeight>,
+        op_type = #VPU.eltwise_type<ADD>
+    } -> tensor<1x64x28x28xf16, {order = #NHWC}> loc(fused["conv4", "t_Convolution", "add_0"])
+
+    return %0 : tensor<1x64x28x28xf16, {order = #NHWC}>
+
+    // 3000 ns at 1300 MHz
+    // CHECK:       VPU.NCE.Eltwise
+    // CHECK-SAME:      profiledCost = {cycles = 3900 : i64, strategy = #VPU.multi_cluster_strategy<SplitOverHeight>}
+}
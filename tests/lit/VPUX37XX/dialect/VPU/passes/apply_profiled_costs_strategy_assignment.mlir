@@ -0,0 +1,36 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+// RUN: echo '{"traceEvents":[ {"name":"conv1?t_Convolution/cluster_0", "cat":"DPU", "ph":"X", "ts":10.000, "dur":0.001, "pid":1, "tid":0}, {"name":"conv1?t_Convolution/cluster_1", "cat":"DPU", "ph":"X", "ts":10.000, "dur":0.001, "pid":2, "tid":0} ], "displayTimeUnit": "ns"}' > %t.json
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=VPUX37XX compilation-mode=DefaultHW" --multi-cluster-strategy-assignment %s | FileCheck %s --check-prefix=NOT-PROFILED
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=VPUX37XX compilation-mode=DefaultHW" --apply-profiled-costs="profiled-costs-file=%t.json" --multi-cluster-strategy-assignment %s | FileCheck %s --check-prefix=PROFILED
+
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+// NOT-PROFILED-LABEL: @MeasuredCostOverridesStrategy
+// PROFILED-LABEL: @MeasuredCostOverridesStrategy
+func.func @MeasuredCostOverridesStrategy(%arg0: tensor<1x32x112x112xf16, {order = #NHWC}>) -> tensor<1x32x112x112xf16, {order = #NHWC}> {
+    %cst = const.Declare tensor<32x1x1x4xsi32> = dense<10> : tensor<32x1x1x4xsi32>
+    %cst_0 = const.Declare tensor<32x32x3x3xf16, {order = #NHWC}> = dense<1.000000e+00> : tensor<32x32x3x3xf16>, [#const.Reorder<#NHWC>]
+
+    // The layer was profiled with the strategy it is compiled with
+    %0 = VPU.NCE.Convolution(%arg0, %cst_0, %cst) {
+        multiClusterStrategy = #VPU.multi_cluster_strategy<SplitOverKernel>,
+        pad = #VPU.Padding<left = 1 : i64, right = 1 : i64, top = 1 : i64, bottom = 1 : i64>,
+        rawFilterShape = [32, 32, 3, 3], strides = [1, 1]
+    } -> tensor<1x32x112x112xf16, {order = #NHWC}> loc(fused["conv1", "t_Convolution"])
+
+    return %0 : tensor<1x32x112x112xf16, {order = #NHWC}>
+
+    // VPUNN estimates the spatial split as the fastest one for a wide layer with few channels
+    // NOT-PROFILED:        VPU.NCE.Convolution
+    // NOT-PROFILED-SAME:       multiClusterStrategy = #VPU.multi_cluster_strategy<SplitOverHeight>
+    // NOT-PROFILED-NOT:        profiledCost
+
+    // The measured time of SplitOverKernel is 1 ns, so it wins over the estimated cost of SplitOverHeight
+    // PROFILED:            VPU.NCE.Convolution
+    // PROFILED-SAME:           multiClusterStrategy = #VPU.multi_cluster_strategy<SplitOverKernel>
+    // PROFILED-SAME:           profiledCost = {cycles = 1 : i64, strategy = #VPU.multi_cluster_strategy<SplitOverKernel>}
+}
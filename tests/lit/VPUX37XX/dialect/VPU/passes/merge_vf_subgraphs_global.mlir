@@ -0,0 +1,111 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=VPUX37XX compilation-mode=DefaultHW" --merge-vertical-fusion-subgraphs="partitioning-mode=GLOBAL" %s | FileCheck %s
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=VPUX37XX compilation-mode=DefaultHW" --merge-vertical-fusion-subgraphs %s | FileCheck %s --check-prefix=GREEDY
+
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+func.func @GlobalPartitioningBuildOutCMXSubgraph(%arg0: tensor<1x32x150x256xf16, {order = #NHWC}>) -> tensor<1x32x150x256xf16, {order = #NHWC}> {
+    %cst_0 = const.Declare tensor<32x16x3x3xf16, {order = #NHWC}> = dense<1.0> : tensor<32x16x3x3xf16>, [#const.Reorder<#NHWC>]
+    %cst_1 = const.Declare tensor<32x1x1x4xsi32> = dense<1> : tensor<32x1x1x4xsi32>
+    %cst_2 = const.Declare tensor<32x32x3x3xf16, {order = #NHWC}> = dense<1.0> : tensor<32x32x3x3xf16>, [#const.Reorder<#NHWC>]
+    %cst_4 = const.Declare tensor<16x32x11x1xf16, {order = #NHWC}> = dense<1.0> : tensor<16x32x11x1xf16>, [#const.Reorder<#NHWC>]
+    %cst_5 = const.Declare tensor<16x1x1x4xsi32> = dense<1> : tensor<16x1x1x4xsi32>
+
+    %0 = VPU.VerticalFusion (%arg0 as %arg1: tensor<1x32x150x256xf16, {order = #NHWC}>, %cst_4 as %arg2: tensor<16x32x11x1xf16, {order = #NHWC}>, %cst_5 as %arg3: tensor<16x1x1x4xsi32>) attributes {tilingStrategy = [1, 1, 2, 1]} -> tensor<1x16x150x256xf16, {order = #NHWC}> {
+      %2 = VPU.NCE.Convolution(%arg1, %arg2, %arg3) 
+         {pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 5 : i64, bottom = 5 : i64>, 
+         ppe = #VPU.PPETask<mode = <LPRELU>, clamp_low = 0 : i64, clamp_high = 255 : i64, lrelu_mult = 1228 : i64, lrelu_shift = 12 : i64, fp_prelu_alpha = 0.2998046875 : f64>, 
+         rawFilterShape = [16, 32, 11, 1], strides = [1, 1]} -> tensor<1x16x150x256xf16, {order = #NHWC}> 
+      VPU.Yield %2 
+    }
+    %1 = VPU.VerticalFusion (%0 as %arg1: tensor<1x16x150x256xf16, {order = #NHWC}>, %cst_0 as %arg2: tensor<32x16x3x3xf16, {order = #NHWC}>, %cst_1 as %arg3: tensor<32x1x1x4xsi32>) attributes {tilingStrategy = [1, 1, 2, 1]} -> tensor<1x32x150x256xf16, {order = #NHWC}> {
+      %2 = VPU.NCE.Convolution(%arg1, %arg2, %arg3) 
+         {pad = #VPU.Padding<left = 1 : i64, right = 1 : i64, top = 1 : i64, bottom = 1 : i64>, 
+         ppe = #VPU.PPETask<mode = <LPRELU>, clamp_low = 0 : i64, clamp_high = 255 : i64, lrelu_mult = 1228 : i64, lrelu_shift = 12 : i64, fp_prelu_alpha = 0.2998046875 : f64>, 
+         rawFilterShape = [32, 16, 3, 3], strides = [1, 1]} -> tensor<1x32x150x256xf16, {order = #NHWC}> 
+      VPU.Yield %2
+    }
+    return %1 : tensor<1x32x150x256xf16, {order = #NHWC}>
+
+    //CHECK: [[VERTICAL_FUSION:%.+]] = VPU.VerticalFusion (%arg0 as %arg1: tensor<1x32x150x256xf16, {order = #NHWC}>, %cst_1 as %arg2: tensor<16x32x11x1xf16, {order = #NHWC}>, %cst_2 as %arg3: tensor<16x1x1x4xsi32>, %cst as %arg4: tensor<32x16x3x3xf16, {order = #NHWC}>, %cst_0 as %arg5: tensor<32x1x1x4xsi32>)
+    //CHECK-SAME: attributes {tilingStrategy = [1, 1, 3, 1]} -> tensor<1x32x150x256xf16, {order = #NHWC}> {
+    //CHECK: [[CONV0:%.+]] = VPU.NCE.Convolution(%arg1, %arg2, %arg3)
+    //CHECK: [[CONV1:%.+]] = VPU.NCE.Convolution([[CONV0]], %arg4, %arg5)
+    //CHECK:  VPU.Yield [[CONV1]]
+    //CHECK-NOT: vf_partition_boundary
+    //CHECK: return [[VERTICAL_FUSION]]
+}
+
+// -----
+
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+func.func @GlobalPartitioningSpillsSmallerActivation(%arg0: tensor<1x352x32x32xf16, {order = #NHWC}>) -> tensor<1x64x32x32xf16, {order = #NHWC}> {
+    %cst = const.Declare tensor<64x352x3x3xf16, {order = #NHWC}> = dense<1.0> : tensor<64x352x3x3xf16>, [#const.Reorder<#NHWC>]
+    %cst_0 = const.Declare tensor<64x1x1x4xsi32> = dense<1> : tensor<64x1x1x4xsi32>
+    %cst_1 = const.Declare tensor<352x64x3x3xf16, {order = #NHWC}> = dense<1.0> : tensor<352x64x3x3xf16>, [#const.Reorder<#NHWC>]
+    %cst_2 = const.Declare tensor<352x1x1x4xsi32> = dense<1> : tensor<352x1x1x4xsi32>
+
+    %0 = VPU.VerticalFusion (
+        %arg0 as %arg1: tensor<1x352x32x32xf16, {order = #NHWC}>,
+        %cst as %arg2: tensor<64x352x3x3xf16, {order = #NHWC}>,
+        %cst_0 as %arg3: tensor<64x1x1x4xsi32>) attributes {tilingStrategy = [1, 1, 2, 1]}
+            -> tensor<1x64x32x32xf16, {order = #NHWC}> {
+      %3 = VPU.NCE.Convolution(%arg1, %arg2, %arg3)
+         {pad = #VPU.Padding<left = 1 : i64, right = 1 : i64, top = 1 : i64, bottom = 1 : i64>,
+         rawFilterShape = [64, 352, 3, 3], strides = [1, 1]} -> tensor<1x64x32x32xf16, {order = #NHWC}>
+      VPU.Yield %3
+    }
+    %1 = VPU.VerticalFusion (
+        %0 as %arg1: tensor<1x64x32x32xf16, {order = #NHWC}>,
+        %cst_1 as %arg2: tensor<352x64x3x3xf16, {order = #NHWC}>,
+        %cst_2 as %arg3: tensor<352x1x1x4xsi32>) attributes {tilingStrategy = [1, 1, 2, 1]}
+            -> tensor<1x352x32x32xf16, {order = #NHWC}> {
+      %3 = VPU.NCE.Convolution(%arg1, %arg2, %arg3)
+         {pad = #VPU.Padding<left = 1 : i64, right = 1 : i64, top = 1 : i64, bottom = 1 : i64>,
+         rawFilterShape = [352, 64, 3, 3], strides = [1, 1]} -> tensor<1x352x32x32xf16, {order = #NHWC}>
+      VPU.Yield %3
+    }
+    %2 = VPU.VerticalFusion (
+        %1 as %arg1: tensor<1x352x32x32xf16, {order = #NHWC}>,
+        %cst as %arg2: tensor<64x352x3x3xf16, {order = #NHWC}>,
+        %cst_0 as %arg3: tensor<64x1x1x4xsi32>) attributes {tilingStrategy = [1, 1, 2, 1]}
+            -> tensor<1x64x32x32xf16, {order = #NHWC}> {
+      %3 = VPU.NCE.Convolution(%arg1, %arg2, %arg3)
+         {pad = #VPU.Padding<left = 1 : i64, right = 1 : i64, top = 1 : i64, bottom = 1 : i64>,
+         rawFilterShape = [64, 352, 3, 3], strides = [1, 1]} -> tensor<1x64x32x32xf16, {order = #NHWC}>
+      VPU.Yield %3
+    }
+    return %2 : tensor<1x64x32x32xf16, {order = #NHWC}>
+
+    // Weights of all three convolutions don't fit the VF weights limit, so only two neighbouring regions can be merged.
+    // Greedy merging takes the first pair and spills the 352-channel activation,
+    // global partitioning merges the last pair and spills the 64-channel activation instead.
+
+    //CHECK: [[VF_0:%.+]] = VPU.VerticalFusion (%arg0 as %arg1: tensor<1x352x32x32xf16, {order = #NHWC}>,
+    //CHECK-SAME: -> tensor<1x64x32x32xf16, {order = #NHWC}>
+    //CHECK:    [[CONV_0:%.+]] = VPU.NCE.Convolution(%arg1, %arg2, %arg3)
+    //CHECK:    VPU.Yield [[CONV_0]]
+    //CHECK: [[VF_1:%.+]] = VPU.VerticalFusion ([[VF_0]] as %arg1: tensor<1x64x32x32xf16, {order = #NHWC}>,
+    //CHECK-SAME: -> tensor<1x64x32x32xf16, {order = #NHWC}>
+    //CHECK:    [[CONV_1:%.+]] = VPU.NCE.Convolution(%arg1, %arg2, %arg3)
+    //CHECK:    [[CONV_2:%.+]] = VPU.NCE.Convolution([[CONV_1]], %arg4, %arg5)
+    //CHECK:    VPU.Yield [[CONV_2]]
+    //CHECK-NOT: vf_partition_boundary
+    //CHECK: return [[VF_1]]
+
+    //GREEDY: [[VF_0:%.+]] = VPU.VerticalFusion (%arg0 as %arg1: tensor<1x352x32x32xf16, {order = #NHWC}>,
+    //GREEDY-SAME: -> tensor<1x352x32x32xf16, {order = #NHWC}>
+    //GREEDY:    [[CONV_0:%.+]] = VPU.NCE.Convolution(%arg1, %arg2, %arg3)
+    //GREEDY:    [[CONV_1:%.+]] = VPU.NCE.Convolution([[CONV_0]], %arg4, %arg5)
+    //GREEDY:    VPU.Yield [[CONV_1]]
+    //GREEDY: [[VF_1:%.+]] = VPU.VerticalFusion ([[VF_0]] as %arg1: tensor<1x352x32x32xf16, {order = #NHWC}>,
+    //GREEDY-SAME: -> tensor<1x64x32x32xf16, {order = #NHWC}>
+    //GREEDY:    [[CONV_2:%.+]] = VPU.NCE.Convolution(%arg1, %arg2, %arg3)
+    //GREEDY:    VPU.Yield [[CONV_2]]
+    //GREEDY: return [[VF_1]]
+}
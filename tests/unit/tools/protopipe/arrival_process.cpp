@@ -0,0 +1,133 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "arrival_process.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+class ArrivalTraceFile {
+public:
+    explicit ArrivalTraceFile(const std::vector<int64_t>& timestamps)
+            : _path(::testing::TempDir() + "arrival_trace_" +
+                    ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".txt") {
+        std::ofstream file(_path);
+        for (const auto ts : timestamps) {
+            file << ts << std::endl;
+        }
+    }
+
+    ~ArrivalTraceFile() {
+        std::remove(_path.c_str());
+    }
+
+    const std::string& path() const {
+        return _path;
+    }
+
+private:
+    std::string _path;
+};
+
+}  // namespace
+
+using ArrivalProcessUnitTests = ::testing::Test;
+
+TEST_F(ArrivalProcessUnitTests, periodicIntervalIsInverseOfRate) {
+    PeriodicArrival arrival(100.0);
+    EXPECT_EQ(arrival.next(), 10000);
+    EXPECT_EQ(arrival.next(), 10000);
+}
+
+TEST_F(ArrivalProcessUnitTests, periodicRateIsLimitedToOneArrivalPerMicrosecond) {
+    EXPECT_EQ(PeriodicArrival(1e6).next(), 1);
+    EXPECT_THROW(PeriodicArrival(2e6), std::logic_error);
+    EXPECT_THROW(PeriodicArrival(0.0), std::logic_error);
+    EXPECT_THROW(PeriodicArrival(-1.0), std::logic_error);
+}
+
+TEST_F(ArrivalProcessUnitTests, poissonIntervalsArePositiveWithExpectedMean) {
+    PoissonArrival arrival(1000.0, 42);
+
+    constexpr int numArrivals = 10000;
+    int64_t total = 0;
+    for (int i = 0; i < numArrivals; ++i) {
+        const auto interval = arrival.next();
+        ASSERT_GT(interval, 0);
+        total += interval;
+    }
+    EXPECT_NEAR(static_cast<double>(total) / numArrivals, 1000.0, 50.0);
+}
+
+TEST_F(ArrivalProcessUnitTests, poissonIntervalsArePositiveAtMaxRate) {
+    PoissonArrival arrival(1e6, 0);
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_GT(arrival.next(), 0);
+    }
+}
+
+TEST_F(ArrivalProcessUnitTests, poissonIsReproducibleWithSeed) {
+    PoissonArrival first(500.0, 7);
+    const auto copy = first.clone();
+    PoissonArrival second(500.0, 7);
+    for (int i = 0; i < 100; ++i) {
+        const auto interval = first.next();
+        EXPECT_EQ(interval, second.next());
+        EXPECT_EQ(interval, copy->next());
+    }
+}
+
+TEST_F(ArrivalProcessUnitTests, burstyArrivalsSkipOffPeriods) {
+    constexpr int64_t onUs = 1000;
+    constexpr int64_t offUs = 9000;
+    BurstyArrival arrival(10000.0, onUs, offUs, 3);
+
+    int64_t ts = 0;
+    for (int i = 0; i < 1000; ++i) {
+        const auto interval = arrival.next();
+        ASSERT_GT(interval, 0);
+        ts += interval;
+        // NB: Arrival at the end of the "on" period belongs to it.
+        const auto phase = ts % (onUs + offUs);
+        EXPECT_TRUE(phase <= onUs) << "Arrival at " << ts << " is in the \"off\" period";
+    }
+}
+
+TEST_F(ArrivalProcessUnitTests, burstyRejectsInvalidPeriods) {
+    EXPECT_THROW(BurstyArrival(100.0, 0, 1000, 0), std::logic_error);
+    EXPECT_THROW(BurstyArrival(100.0, 1000, -1, 0), std::logic_error);
+}
+
+TEST_F(ArrivalProcessUnitTests, traceIntervalsAreReplayedInLoop) {
+    ArrivalTraceFile file({100, 150, 350, 360});
+    TraceArrival arrival(file.path());
+
+    const std::vector<int64_t> expected = {50, 200, 10, 50, 200, 10};
+    for (const auto interval : expected) {
+        EXPECT_EQ(arrival.next(), interval);
+    }
+}
+
+TEST_F(ArrivalProcessUnitTests, traceWithEqualTimestampsIsRejected) {
+    ArrivalTraceFile file({100, 100, 100});
+    EXPECT_THROW(TraceArrival{file.path()}, std::logic_error);
+}
+
+TEST_F(ArrivalProcessUnitTests, traceWithDescendingTimestampsIsRejected) {
+    ArrivalTraceFile file({100, 200, 150});
+    EXPECT_THROW(TraceArrival{file.path()}, std::logic_error);
+}
+
+TEST_F(ArrivalProcessUnitTests, traceWithSingleTimestampIsRejected) {
+    ArrivalTraceFile file({100});
+    EXPECT_THROW(TraceArrival{file.path()}, std::logic_error);
+}
@@ -0,0 +1,71 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "models.hpp"
+
+#include <openvino/op/constant.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::vector<float> collectWeights(const std::shared_ptr<ov::Model>& model) {
+    std::vector<float> weights;
+    for (const auto& op : model->get_ordered_ops()) {
+        if (const auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(op)) {
+            if (constant->get_element_type() == ov::element::f32) {
+                const auto values = constant->cast_vector<float>();
+                weights.insert(weights.end(), values.begin(), values.end());
+            }
+        }
+    }
+    return weights;
+}
+
+}  // namespace
+
+using SyntheticModelsUnitTests = ::testing::Test;
+
+TEST_F(SyntheticModelsUnitTests, everyKindIsBuilt) {
+    for (const auto& kind : vpux::bench::getSyntheticModelKinds()) {
+        const auto model = vpux::bench::createSyntheticModel(kind, "small");
+
+        ASSERT_NE(model, nullptr) << kind;
+        EXPECT_EQ(model->get_friendly_name(), kind);
+        ASSERT_EQ(model->inputs().size(), 1u) << kind;
+        ASSERT_EQ(model->outputs().size(), 1u) << kind;
+        EXPECT_EQ(model->input().get_any_name(), "input");
+        EXPECT_EQ(model->output().get_any_name(), "output");
+        EXPECT_TRUE(model->output().get_partial_shape().is_static()) << kind;
+        EXPECT_FALSE(collectWeights(model).empty()) << kind;
+    }
+}
+
+TEST_F(SyntheticModelsUnitTests, everySizeIsSupported) {
+    const auto sizes = vpux::bench::getSyntheticModelSizes();
+    ASSERT_EQ(sizes.front(), "small");
+
+    size_t prevNumOps = 0;
+    for (const auto& size : sizes) {
+        const auto model = vpux::bench::createSyntheticModel("resnet", size);
+        EXPECT_GT(model->get_ordered_ops().size(), prevNumOps) << size;
+        prevNumOps = model->get_ordered_ops().size();
+    }
+}
+
+TEST_F(SyntheticModelsUnitTests, weightsAreDeterministic) {
+    const auto first = vpux::bench::createSyntheticModel("transformer", "small");
+    const auto second = vpux::bench::createSyntheticModel("transformer", "small");
+    EXPECT_EQ(collectWeights(first), collectWeights(second));
+}
+
+TEST_F(SyntheticModelsUnitTests, unsupportedParametersAreRejected) {
+    EXPECT_ANY_THROW(vpux::bench::createSyntheticModel("vgg", "small"));
+    EXPECT_ANY_THROW(vpux::bench::createSyntheticModel("resnet", "huge"));
+}
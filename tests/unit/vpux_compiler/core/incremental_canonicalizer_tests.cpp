@@ -0,0 +1,148 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/core/passes.hpp"
+#include "vpux/compiler/dialect/IE/passes.hpp"
+#include "vpux/compiler/dialect/VPU/passes.hpp"
+#include "vpux/compiler/dialect/const/ops.hpp"
+#include "vpux/compiler/init.hpp"
+
+#include "common/utils.hpp"
+
+#include <mlir/IR/MLIRContext.h>
+#include <mlir/Parser/Parser.h>
+#include <mlir/Pass/PassManager.h>
+
+#include <gtest/gtest.h>
+
+using namespace vpux;
+
+namespace {
+
+constexpr llvm::StringLiteral inputIR = R"(
+        module @test {
+            func.func @main(%arg0: tensor<1x16xf16>) -> tensor<1x16xf16> {
+                %cst = const.Declare tensor<1x1xf16> = dense<2.0> : tensor<1x1xf16>
+                %0 = IE.Reshape(%arg0) { shape_value = [1, 16] } : tensor<1x16xf16> -> tensor<1x16xf16>
+                %1 = IE.Power(%0, %cst) {auto_broadcast = #IE.auto_broadcast_type<NUMPY>} : tensor<1x16xf16>, tensor<1x1xf16> -> tensor<1x16xf16>
+                return %1 : tensor<1x16xf16>
+            }
+        }
+    )";
+
+constexpr llvm::StringLiteral skipMessage = "was not changed since 'incremental-canonicalize' patterns converged";
+
+constexpr llvm::StringLiteral independentChainsIR = R"(
+        module @test {
+            func.func @main(%arg0: tensor<1x16xf16>, %arg1: tensor<1x16xf16>) -> (tensor<1x16xf16>, tensor<1x16xf16>) {
+                %cst = const.Declare tensor<1x1xf16> = dense<2.0> : tensor<1x1xf16>
+                %0 = IE.Power(%arg0, %cst) {auto_broadcast = #IE.auto_broadcast_type<NUMPY>} : tensor<1x16xf16>, tensor<1x1xf16> -> tensor<1x16xf16>
+                %1 = IE.ReLU(%arg1) : tensor<1x16xf16> -> tensor<1x16xf16>
+                %2 = IE.ReLU(%1) : tensor<1x16xf16> -> tensor<1x16xf16>
+                %3 = IE.ReLU(%2) : tensor<1x16xf16> -> tensor<1x16xf16>
+                %4 = IE.ReLU(%3) : tensor<1x16xf16> -> tensor<1x16xf16>
+                %5 = IE.ReLU(%4) : tensor<1x16xf16> -> tensor<1x16xf16>
+                %6 = IE.ReLU(%5) : tensor<1x16xf16> -> tensor<1x16xf16>
+                return %0, %6 : tensor<1x16xf16>, tensor<1x16xf16>
+            }
+        }
+    )";
+
+size_t countOccurrences(const std::string& str, StringRef pattern) {
+    size_t count = 0;
+    for (auto pos = str.find(pattern.str()); pos != std::string::npos; pos = str.find(pattern.str(), pos + 1)) {
+        ++count;
+    }
+    return count;
+}
+
+}  // namespace
+
+using MLIR_IncrementalCanonicalizer = MLIR_UnitBase;
+
+TEST_F(MLIR_IncrementalCanonicalizer, SkipsUnchangedIR) {
+    mlir::MLIRContext ctx(registry);
+
+    auto module = mlir::parseSourceString<mlir::ModuleOp>(inputIR, &ctx);
+    ASSERT_TRUE(module.get() != nullptr);
+
+    const Logger log("test", LogLevel::Trace);
+
+    mlir::PassManager pm(&ctx, mlir::OpPassManager::Nesting::Implicit);
+    pm.addPass(VPU::createInitCompilerPass(VPU::ArchKind::VPUX37XX, VPU::CompilationMode::DefaultHW, None, None,
+                                           Logger::global()));
+    pm.addPass(createIncrementalCanonicalizerPass(getDefaultGreedyRewriteConfig(), log));
+    pm.addPass(createIncrementalCanonicalizerPass(getDefaultGreedyRewriteConfig(), log));
+    pm.addPass(createIncrementalCanonicalizerPass(getDefaultGreedyRewriteConfig(), log));
+
+    testing::internal::CaptureStdout();
+    const auto result = pm.run(module.get());
+    const auto output = testing::internal::GetCapturedStdout();
+
+    ASSERT_TRUE(mlir::succeeded(result));
+    EXPECT_EQ(countOccurrences(output, skipMessage), 2);
+}
+
+TEST_F(MLIR_IncrementalCanonicalizer, RerunsAfterChange) {
+    mlir::MLIRContext ctx(registry);
+
+    auto module = mlir::parseSourceString<mlir::ModuleOp>(inputIR, &ctx);
+    ASSERT_TRUE(module.get() != nullptr);
+
+    const Logger log("test", LogLevel::Trace);
+
+    mlir::PassManager pm(&ctx, mlir::OpPassManager::Nesting::Implicit);
+    pm.addPass(VPU::createInitCompilerPass(VPU::ArchKind::VPUX37XX, VPU::CompilationMode::DefaultHW, None, None,
+                                           Logger::global()));
+    pm.addPass(createIncrementalCanonicalizerPass(getDefaultGreedyRewriteConfig(), log));
+    // Replaces Power with Multiply and leaves the exponent constant without users
+    pm.addPass(IE::createConvertPowerToMultPass());
+    pm.addPass(createIncrementalCanonicalizerPass(getDefaultGreedyRewriteConfig(), log));
+
+    testing::internal::CaptureStdout();
+    const auto result = pm.run(module.get());
+    const auto output = testing::internal::GetCapturedStdout();
+
+    ASSERT_TRUE(mlir::succeeded(result));
+    EXPECT_EQ(countOccurrences(output, skipMessage), 0);
+
+    size_t numConstants = 0;
+    module->walk([&](Const::DeclareOp) {
+        ++numConstants;
+    });
+    EXPECT_EQ(numConstants, 0);
+}
+
+TEST_F(MLIR_IncrementalCanonicalizer, VisitsOnlyChangedOps) {
+    mlir::MLIRContext ctx(registry);
+
+    auto module = mlir::parseSourceString<mlir::ModuleOp>(independentChainsIR, &ctx);
+    ASSERT_TRUE(module.get() != nullptr);
+
+    const Logger log("test", LogLevel::Trace);
+
+    mlir::PassManager pm(&ctx, mlir::OpPassManager::Nesting::Implicit);
+    pm.addPass(VPU::createInitCompilerPass(VPU::ArchKind::VPUX37XX, VPU::CompilationMode::DefaultHW, None, None,
+                                           Logger::global()));
+    pm.addPass(createIncrementalCanonicalizerPass(getDefaultGreedyRewriteConfig(), log));
+    // Replaces Power with Multiply and leaves the exponent constant without users, the ReLU chain stays the same
+    pm.addPass(IE::createConvertPowerToMultPass());
+    pm.addPass(createIncrementalCanonicalizerPass(getDefaultGreedyRewriteConfig(), log));
+
+    testing::internal::CaptureStdout();
+    const auto result = pm.run(module.get());
+    const auto output = testing::internal::GetCapturedStdout();
+
+    ASSERT_TRUE(mlir::succeeded(result));
+
+    // The changed Multiply and constant, the return operation which uses Multiply and the last ReLU it returns
+    EXPECT_EQ(countOccurrences(output, "Apply 'incremental-canonicalize' patterns to 4 of 9 operations of 'main'"), 1);
+
+    size_t numConstants = 0;
+    module->walk([&](Const::DeclareOp) {
+        ++numConstants;
+    });
+    EXPECT_EQ(numConstants, 0);
+}
@@ -1112,6 +1112,90 @@ TEST_F(MLIR_ClusterShapeUtils, OverlappedDistributionWithComputeShapesAndOffsets
     }
 }
 
+TEST_F(MLIR_ClusterShapeUtils, SameDistributionDifferentShapes) {
+    mlir::MLIRContext ctx(registry);
+    ctx.loadDialect<VPU::VPUDialect>();
+
+    const auto distributionModeAttr = VPU::DistributionModeAttr::get(&ctx, VPU::DistributionMode::SEGMENTED);
+    const auto numTilesAttr = getIntArrayAttr(&ctx, SmallVector<int64_t>({1, 1, 4, 1}));
+    const auto numClustersAttr = getIntAttr(&ctx, 4);
+    const auto distributedAttr = VPU::DistributedTensorAttr::get(&ctx, distributionModeAttr, numTilesAttr, nullptr,
+                                                                 nullptr, nullptr, numClustersAttr, nullptr, nullptr,
+                                                                 nullptr, nullptr, nullptr, nullptr, nullptr);
+
+    const auto elemType = mlir::Float16Type::get(&ctx);
+    const auto dimsOrder = mlir::AffineMapAttr::get(DimsOrder::NHWC.toAffineMap(&ctx));
+    const auto dimsSpace = vpux::IndexedSymbolAttr::get(&ctx, CMX_NAME);
+
+    const auto firstType = VPU::DistributedTensorType::get(&ctx, SmallVector<int64_t>({1, 64, 13, 16}), elemType,
+                                                           dimsOrder, dimsSpace, distributedAttr);
+    const auto secondType = VPU::DistributedTensorType::get(&ctx, SmallVector<int64_t>({1, 64, 8, 16}), elemType,
+                                                            dimsOrder, dimsSpace, distributedAttr);
+
+    // The layouts are cached per shape and distribution, repeated queries must return the same values
+    for (auto iteration = 0; iteration < 2; iteration++) {
+        const SmallVector<Shape> expectedFirstShapes(
+                {Shape({1, 64, 4, 16}), Shape({1, 64, 4, 16}), Shape({1, 64, 4, 16}), Shape({1, 64, 1, 16})});
+        EXPECT_EQ(to_small_vector(firstType.getPerClusterComputeShapes()), expectedFirstShapes);
+        EXPECT_EQ(to_small_vector(firstType.getPerClusterMemoryShapes()), expectedFirstShapes);
+
+        const SmallVector<Shape> expectedSecondShapes(
+                {Shape({1, 64, 2, 16}), Shape({1, 64, 2, 16}), Shape({1, 64, 2, 16}), Shape({1, 64, 2, 16})});
+        EXPECT_EQ(to_small_vector(secondType.getPerClusterComputeShapes()), expectedSecondShapes);
+        EXPECT_EQ(to_small_vector(secondType.getPerClusterMemoryShapes()), expectedSecondShapes);
+
+        const SmallVector<Shape> expectedSecondOffsets(
+                {Shape({0, 0, 0, 0}), Shape({0, 0, 2, 0}), Shape({0, 0, 4, 0}), Shape({0, 0, 6, 0})});
+        EXPECT_EQ(to_small_vector(secondType.getPerClusterComputeShapeOffsets()), expectedSecondOffsets);
+        EXPECT_EQ(to_small_vector(secondType.getPerClusterMemoryShapeOffsets()), expectedSecondOffsets);
+    }
+
+    // The queries return views into the cache instead of copies
+    EXPECT_EQ(firstType.getPerClusterComputeShapes().data(), firstType.getPerClusterComputeShapes().data());
+    EXPECT_EQ(firstType.getPerClusterMemoryShapeOffsets().data(),
+              VPU::getPerClusterMemoryShapeOffsets(firstType.getShape(), distributedAttr).data());
+    EXPECT_NE(firstType.getPerClusterComputeShapes().data(), secondType.getPerClusterComputeShapes().data());
+}
+
+TEST_F(MLIR_ClusterShapeUtils, ExplicitShapesAreParsedOnce) {
+    mlir::MLIRContext ctx(registry);
+    ctx.loadDialect<VPU::VPUDialect>();
+
+    const auto distributionModeAttr = VPU::DistributionModeAttr::get(&ctx, VPU::DistributionMode::OVERLAPPED);
+    const auto numTilesAttr = getIntArrayAttr(&ctx, SmallVector<int64_t>({1, 1, 2, 1}));
+    const auto numClustersAttr = getIntAttr(&ctx, 2);
+
+    SmallVector<SmallVector<int64_t>> shapes;
+    shapes.push_back(SmallVector<int64_t>({1, 64, 7, 16}));
+    shapes.push_back(SmallVector<int64_t>({1, 64, 6, 16}));
+    const auto shapesAttr = vpux::getIntArrayOfArray(&ctx, shapes);
+
+    SmallVector<SmallVector<int64_t>> offsets;
+    offsets.push_back(SmallVector<int64_t>({0, 0, 0, 0}));
+    offsets.push_back(SmallVector<int64_t>({0, 0, 7, 0}));
+    const auto offsetsAttr = vpux::getIntArrayOfArray(&ctx, offsets);
+
+    const auto distributedAttr = VPU::DistributedTensorAttr::get(
+            &ctx, distributionModeAttr, numTilesAttr, nullptr, nullptr, nullptr, numClustersAttr, nullptr, nullptr,
+            shapesAttr, offsetsAttr, shapesAttr, offsetsAttr, nullptr);
+
+    const auto elemType = mlir::Float16Type::get(&ctx);
+    const auto dimsOrder = mlir::AffineMapAttr::get(DimsOrder::NHWC.toAffineMap(&ctx));
+    const auto dimsSpace = vpux::IndexedSymbolAttr::get(&ctx, CMX_NAME);
+    const auto distributedType = VPU::DistributedTensorType::get(&ctx, SmallVector<int64_t>({1, 64, 13, 16}),
+                                                                 elemType, dimsOrder, dimsSpace, distributedAttr);
+
+    const SmallVector<Shape> expectedShapes({Shape({1, 64, 7, 16}), Shape({1, 64, 6, 16})});
+    const SmallVector<Shape> expectedOffsets({Shape({0, 0, 0, 0}), Shape({0, 0, 7, 0})});
+    EXPECT_EQ(to_small_vector(distributedType.getPerClusterComputeShapes()), expectedShapes);
+    EXPECT_EQ(to_small_vector(distributedType.getPerClusterMemoryShapeOffsets()), expectedOffsets);
+
+    // The compute and memory views share the same attributes, so they share the parsed arrays as well
+    EXPECT_EQ(distributedType.getPerClusterComputeShapes().data(), distributedType.getPerClusterMemoryShapes().data());
+    EXPECT_EQ(distributedType.getPerClusterComputeShapeOffsets().data(),
+              distributedType.getPerClusterMemoryShapeOffsets().data());
+}
+
 // Single axis H alignment, H SEGMENTED mode
 TEST_F(MLIR_ClusterShapeUtils, DISABLED_AlignedSingleAxisSegmentedMode) {
     mlir::MLIRContext ctx(registry);
@@ -5,6 +5,7 @@
 
 #include "vpux/compiler/dialect/VPUIP/ops.hpp"
 #include "vpux/compiler/dialect/VPURT/inference_execution_simulator.hpp"
+#include "vpux/compiler/dialect/VPURT/schedule_analysis_report.hpp"
 #include "vpux/compiler/dialect/VPURT/task.hpp"
 #include "vpux/compiler/init.hpp"
 
@@ -294,3 +295,107 @@ TEST_F(MLIR_InferenceExecutionAnalysis, CheckBarrierConfigClass) {
     EXPECT_EQ(barrierConf.getReleaseCycle(), 10);
     EXPECT_TRUE(barrierConf.isReleased());
 }
+
+TEST_F(MLIR_InferenceExecutionAnalysis, CheckScheduleAnalysisReport) {
+    mlir::MLIRContext ctx(registry);
+
+    // Weights prefetch and input DMA are followed by NCE task which output is spilled to DDR
+    // DMA P0:   [--][--]       [--]
+    // NCE C0:           [------]
+    constexpr StringLiteral inputIR = R"(
+        module @test attributes {VPU.arch = #VPU.arch_kind<VPUX37XX>, VPU.compilationMode = #VPU.compilation_mode<DefaultHW>} {
+            IE.ExecutorResource 6 of @NCE at 1.700000e+03 MHz {
+                IE.MemoryResource 1327104 bytes of @CMX_NN_FragmentationAware
+                IE.MemoryResource 1474560 bytes of @CMX_NN {VPU.bandwidth = 64 : i64, VPU.derateFactor = 1.000000e+00 : f64}
+                IE.ExecutorResource 2 of @SHAVE_ACT
+                IE.ExecutorResource 1 of @DPU
+            }
+            IE.ExecutorResource 1 of @DMA_NN
+            IE.MemoryResource 524288000 bytes of @DDR {VPU.bandwidth = 64 : i64, VPU.derateFactor = 6.000000e-01 : f64}
+
+            func.func @main(%arg0: memref<1x16x24x24xf16, affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>, @DDR>, %arg1: memref<1x16x24x24xf16, affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>, @DDR>) -> memref<1x16x24x24xf16, affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>, @DDR> {
+                %bar0 = VPURT.ConfigureBarrier<0> -> !VPURT.Barrier
+                %bar1 = VPURT.ConfigureBarrier<1> -> !VPURT.Barrier
+
+                %cst_WT = const.Declare memref<16x1x1x4xsi32> = dense<2> : tensor<16x1x1x4xsi32>
+
+                %netin = VPURT.DeclareBuffer <NetworkInput> [0] <0> -> memref<1x16x24x24xf16, affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>, @DDR>
+                %buf_ddr = VPURT.DeclareBuffer <DDR> <0> -> memref<1x16x24x24xf16, affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>, @DDR>
+                %buf_cmx_in = VPURT.DeclareBuffer <CMX_NN> [0] <0> -> memref<1x16x24x24xf16, affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>, [@CMX_NN, 0]>
+                %buf_cmx_out = VPURT.DeclareBuffer <CMX_NN> [0] <18432> -> memref<1x16x24x24xf16, affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>, [@CMX_NN, 0]>
+                %buf_cmx_WT = VPURT.DeclareBuffer <CMX_NN> [0] <36864> -> memref<16x1x1x4xsi32, [@CMX_NN, 0]>
+
+                VPURT.Task updates(%bar0 : !VPURT.Barrier) attributes {isTrailingSWLayer = false} {
+                    %0 = VPUIP.NNDMA {port = 0 : i64} inputs(%cst_WT : memref<16x1x1x4xsi32>) outputs(%buf_cmx_WT : memref<16x1x1x4xsi32, [@CMX_NN, 0]>) -> memref<16x1x1x4xsi32, [@CMX_NN, 0]>
+                }
+
+                VPURT.Task updates(%bar0 : !VPURT.Barrier) attributes {isTrailingSWLayer = false} {
+                    %0 = VPUIP.NNDMA {port = 0 : i64} inputs(%netin : memref<1x16x24x24xf16, affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>, @DDR>) outputs(%buf_cmx_in : memref<1x16x24x24xf16, affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>, [@CMX_NN, 0]>) -> memref<1x16x24x24xf16, affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>, [@CMX_NN, 0]>
+                }
+
+                VPURT.Task waits(%bar0 : !VPURT.Barrier) updates(%bar1 : !VPURT.Barrier) attributes {isTrailingSWLayer = false} {
+                    %0 = VPUIP.NCEClusterTask {kernel_padding = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>, kernel_size = [1, 1], kernel_strides = [1, 1], task_type = #VPUIP.nce_task_type<ELTWISE>}
+                    input(%buf_cmx_in : memref<1x16x24x24xf16, affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>, [@CMX_NN, 0]>)
+                    weights(%buf_cmx_in : memref<1x16x24x24xf16, affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>, [@CMX_NN, 0]>)
+                    parent_input(%buf_cmx_in : memref<1x16x24x24xf16, affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>, [@CMX_NN, 0]>)
+                    parent_output(%buf_cmx_out : memref<1x16x24x24xf16, affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>, [@CMX_NN, 0]>)
+                    outputs(%buf_cmx_out : memref<1x16x24x24xf16, affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>, [@CMX_NN, 0]>) -> memref<1x16x24x24xf16, affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>, [@CMX_NN, 0]> variants : {
+                    DPUTask {cluster_id = 0 : i64, outEnd = [23, 23, 15], mpe_mode = #VPU.mpe_mode<CUBOID_16x16>, pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>, outStart = [0, 0, 0]}
+                    } PPE : {
+                    }
+                }
+
+                VPURT.Task waits(%bar1 : !VPURT.Barrier) attributes {isTrailingSWLayer = false} {
+                    %0 = VPUIP.NNDMA {port = 0 : i64} inputs(%buf_cmx_out : memref<1x16x24x24xf16, affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>, [@CMX_NN, 0]>) outputs(%buf_ddr : memref<1x16x24x24xf16, affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>, @DDR>) -> memref<1x16x24x24xf16, affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>, @DDR>
+                }
+
+                return %arg1 : memref<1x16x24x24xf16, affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>, @DDR>
+            }
+        }
+    )";
+
+    Logger log("inference-simulator-test", LogLevel::Info);
+
+    auto module = mlir::parseSourceString<mlir::ModuleOp>(inputIR, &ctx);
+    ASSERT_TRUE(module.get() != nullptr);
+
+    auto funcOp = module.get().lookupSymbol<mlir::func::FuncOp>("main");
+    ASSERT_TRUE(funcOp != nullptr);
+
+    auto taskOps = to_small_vector(funcOp.getOps<VPURT::TaskOp>());
+    ASSERT_EQ(taskOps.size(), 4);
+    EXPECT_EQ(VPURT::getDMATransferKind(taskOps[0]), VPURT::DMATransferKind::Prefetch);
+    EXPECT_EQ(VPURT::getDMATransferKind(taskOps[1]), VPURT::DMATransferKind::Other);
+    EXPECT_EQ(VPURT::getDMATransferKind(taskOps[3]), VPURT::DMATransferKind::SpillWrite);
+
+    VPURT::InferenceExecutionSimulator infSim(log, funcOp);
+    infSim.runSim();
+
+    // All tasks are serialized, so each of them is on the critical path
+    const auto criticalPath = infSim.getCriticalPath();
+    ASSERT_EQ(criticalPath.size(), taskOps.size());
+    for (size_t i = 0; i < criticalPath.size(); i++) {
+        EXPECT_EQ(criticalPath[i].taskOp, taskOps[i]);
+    }
+    EXPECT_EQ(criticalPath.back().cycleStart + criticalPath.back().cycleCost, infSim.getInferenceLatencyInCycles());
+
+    const auto report = VPURT::createScheduleAnalysisReport(infSim, 1700.0, 1);
+
+    EXPECT_EQ(report["summary"]["latency_cycles"].get<int64_t>(), infSim.getInferenceLatencyInCycles());
+    EXPECT_EQ(report["summary"]["tasks"].get<size_t>(), taskOps.size());
+    EXPECT_EQ(report["critical_path"]["tasks"].size(), taskOps.size());
+
+    EXPECT_EQ(report["dma"]["prefetch_bytes"].get<int64_t>(), 16 * 4 * 4);
+    EXPECT_EQ(report["dma"]["spill_write_bytes"].get<int64_t>(), 16 * 24 * 24 * 2);
+    EXPECT_EQ(report["dma"]["spill_read_bytes"].get<int64_t>(), 0);
+    EXPECT_EQ(report["dma"]["spill_bytes"].get<int64_t>(), 16 * 24 * 24 * 2);
+
+    // DMA and DPU queues are used
+    ASSERT_EQ(report["executors"].size(), 2);
+    for (const auto& executor : report["executors"]) {
+        EXPECT_EQ(executor["busy_cycles"].get<int64_t>() + executor["idle_cycles"].get<int64_t>(),
+                  infSim.getInferenceLatencyInCycles() * executor["executors"].get<int64_t>());
+    }
+
+    EXPECT_EQ(report["top_layers"].size(), 1);
+}
@@ -0,0 +1,149 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/VPU30XX/pipelines.hpp"
+#include "vpux/compiler/VPU37XX/pipelines.hpp"
+#include "vpux/compiler/dialect/const/ops.hpp"
+#include "vpux/compiler/dialect/const/passes.hpp"
+#include "vpux/compiler/utils/types.hpp"
+
+#include "vpux/utils/core/checked_cast.hpp"
+#include "vpux/utils/core/mem_size.hpp"
+#include "vpux/utils/core/process_memory.hpp"
+#include "vpux/utils/core/range.hpp"
+
+#include "common/utils.hpp"
+
+#include <mlir/Dialect/Func/IR/FuncOps.h>
+#include <mlir/IR/BuiltinOps.h>
+#include <mlir/Pass/PassManager.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace vpux;
+
+namespace {
+
+constexpr size_t NUM_CONSTANTS = 16;
+const SmallVector<int64_t> CONSTANT_SHAPE = {1, 64, 128, 128};
+
+// Weights of the model, owned outside of the context like the OpenVINO model weights
+std::vector<std::vector<float>> generateWeights() {
+    const auto numElems = checked_cast<size_t>(CONSTANT_SHAPE[0] * CONSTANT_SHAPE[1] * CONSTANT_SHAPE[2] *
+                                               CONSTANT_SHAPE[3]);
+
+    std::vector<std::vector<float>> weights(NUM_CONSTANTS);
+    for (auto ind : irange(NUM_CONSTANTS)) {
+        weights[ind].assign(numElems, static_cast<float>(ind));
+    }
+
+    return weights;
+}
+
+// The constants are imported as zero-copy views of the weights and converted by the pipeline the same way as the
+// weights of a convolution
+mlir::OwningOpRef<mlir::ModuleOp> buildModule(mlir::MLIRContext& ctx, const std::vector<std::vector<float>>& weights) {
+    const auto loc = mlir::UnknownLoc::get(&ctx);
+    const auto baseType = mlir::RankedTensorType::get(CONSTANT_SHAPE, mlir::Float32Type::get(&ctx));
+    const auto outType = getTensorType(ShapeRef(CONSTANT_SHAPE), mlir::Float16Type::get(&ctx), DimsOrder::NHWC,
+                                       nullptr);
+
+    auto module = mlir::ModuleOp::create(loc);
+    auto builder = mlir::OpBuilder::atBlockBegin(module.getBody());
+
+    const SmallVector<mlir::Type> resultTypes(NUM_CONSTANTS, outType);
+    auto func = builder.create<mlir::func::FuncOp>(loc, "main", builder.getFunctionType({}, resultTypes));
+    builder.setInsertionPointToStart(func.addEntryBlock());
+
+    SmallVector<mlir::Value> results;
+    for (const auto& buf : weights) {
+        const auto rawBuffer = StringRef(reinterpret_cast<const char*>(buf.data()), buf.size() * sizeof(float));
+        const auto content = Const::ContentAttr::get(Const::OpaqueElementsAttr::get(baseType, rawBuffer))
+                                     .convertElemType(mlir::Float16Type::get(&ctx))
+                                     .reorder(DimsOrder::NHWC);
+        results.push_back(builder.create<Const::DeclareOp>(loc, outType, content).getOutput());
+    }
+
+    builder.create<mlir::func::ReturnOp>(loc, results);
+
+    return module;
+}
+
+// Writes the constants into the blob one by one, as the ELF backend does
+void serializeConstants(mlir::ModuleOp module, std::vector<char>& blob) {
+    size_t offset = 0;
+    module.walk([&](Const::DeclareOp constOp) {
+        const auto content = constOp.getContent();
+        const auto size = checked_cast<size_t>(constOp.getBinarySize());
+        content.copyTo(makeMutableArrayRef(blob.data() + offset, size));
+        offset += size;
+    });
+    ASSERT_EQ(offset, blob.size());
+}
+
+}  // namespace
+
+class MLIR_ConstantMemoryTest : public MLIR_UnitBase {
+public:
+    mlir::MLIRContext ctx;
+
+public:
+    MLIR_ConstantMemoryTest(): MLIR_UnitBase() {
+        ctx.appendDialectRegistry(registry);
+        ctx.loadDialect<Const::ConstDialect>();
+        ctx.loadDialect<mlir::func::FuncDialect>();
+    }
+};
+
+TEST_F(MLIR_ConstantMemoryTest, ConstantFoldingIsDisabledByDefault) {
+    EXPECT_FALSE(ReferenceSWOptions30XX().enableConstantFolding);
+    EXPECT_FALSE(ReferenceHWOptions30XX().enableConstantFolding);
+    EXPECT_FALSE(DefaultHWOptions30XX().enableConstantFolding);
+    EXPECT_FALSE(ReferenceSWOptions37XX().enableConstantFolding);
+    EXPECT_FALSE(ReferenceHWOptions37XX().enableConstantFolding);
+    EXPECT_FALSE(DefaultHWOptions37XX().enableConstantFolding);
+}
+
+TEST_F(MLIR_ConstantMemoryTest, PeakMemoryOfExportIsBoundedWithoutFolding) {
+    if (!resetPeakRSS()) {
+        GTEST_SKIP() << "Peak resident memory can't be reset on this platform";
+    }
+
+    const auto weights = generateWeights();
+    const auto module = buildModule(ctx, weights);
+
+    const auto weightsSize = Byte(checked_cast<int64_t>(NUM_CONSTANTS * weights.front().size() * sizeof(float)));
+    const auto foldedSize = Byte(weightsSize.count() / 2);
+
+    // The blob is the output of the compilation, it is not counted
+    std::vector<char> blob(checked_cast<size_t>(foldedSize.count()), 1);
+
+    ASSERT_TRUE(resetPeakRSS());
+    const auto startRSS = KB(getCurrentRSS());
+
+    serializeConstants(module.get(), blob);
+
+    // Only one folded constant with its temporary buffers is alive at a time
+    const auto exportPeakGrowth = KB(getPeakRSS()) - startRSS;
+    EXPECT_LT(exportPeakGrowth.to<Byte>().count(), weightsSize.count() / 4)
+            << "Export of " << weightsSize.to<KB>().count() << " KB of weights grew the peak resident memory by "
+            << exportPeakGrowth.count() << " KB";
+
+    // The folded constants are interned in the context, so the same export costs at least their total size.
+    // This makes sure the check above is able to catch the regression.
+    mlir::PassManager pm(&ctx, mlir::OpPassManager::Nesting::Implicit);
+    pm.addPass(Const::createConstantFoldingPass());
+
+    ASSERT_TRUE(resetPeakRSS());
+    const auto foldingStartRSS = KB(getCurrentRSS());
+
+    ASSERT_TRUE(mlir::succeeded(pm.run(module.get())));
+    serializeConstants(module.get(), blob);
+
+    const auto foldingPeakGrowth = KB(getPeakRSS()) - foldingStartRSS;
+    EXPECT_GT(foldingPeakGrowth.to<Byte>().count(), foldedSize.count() * 9 / 10);
+}
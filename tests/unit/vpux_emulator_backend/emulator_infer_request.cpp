@@ -0,0 +1,167 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ie_blob.h>
+#include <ie_input_info.hpp>
+
+#include "emulator_executor.hpp"
+#include "emulator_infer_request.hpp"
+#include "fake_network_description.hpp"
+#include "vpux/al/config/common.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace ie = InferenceEngine;
+
+namespace {
+
+constexpr auto INPUT_NAME = "input";
+constexpr auto OUTPUT_NAME = "output";
+constexpr size_t NUM_ELEMENTS = 4;
+
+const ie::TensorDesc dataDesc(ie::Precision::FP32, {1, NUM_ELEMENTS}, ie::Layout::NC);
+
+struct NetworkCounters {
+    size_t built = 0;
+    size_t runs = 0;
+};
+
+// Echoes the input back, the number of built networks and runs is recorded
+class FakeEmulatorNetwork final : public vpux::IEmulatorNetwork {
+public:
+    explicit FakeEmulatorNetwork(NetworkCounters& counters)
+            : _counters(counters), _input(NUM_ELEMENTS), _output(NUM_ELEMENTS) {
+        ++_counters.built;
+    }
+
+    std::vector<std::string> getInputNames() const override {
+        return {INPUT_NAME};
+    }
+
+    std::vector<std::string> getOutputNames() const override {
+        return {OUTPUT_NAME};
+    }
+
+    void populate(const std::string&, const void* data) override {
+        std::copy_n(static_cast<const float*>(data), NUM_ELEMENTS, _input.begin());
+    }
+
+    void run() override {
+        ++_counters.runs;
+        _output = _input;
+    }
+
+    const char* getOutputData(const std::string&) const override {
+        return reinterpret_cast<const char*>(_output.data());
+    }
+
+private:
+    NetworkCounters& _counters;
+    std::vector<float> _input;
+    std::vector<float> _output;
+};
+
+class EmulatorInferRequestUnitTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto options = std::make_shared<vpux::OptionsDesc>();
+        vpux::registerCommonOptions(*options);
+        _config = std::make_unique<vpux::Config>(options);
+
+        const auto network = std::make_shared<vpux::NetworkDescription>(std::make_shared<vpux::FakeNetworkDescription>(
+                std::vector<char>{'b', 'l', 'o', 'b'},
+                vpux::NetworkIOVector{{INPUT_NAME, std::make_shared<ie::Data>(INPUT_NAME, dataDesc)}},
+                vpux::NetworkIOVector{{OUTPUT_NAME, std::make_shared<ie::Data>(OUTPUT_NAME, dataDesc)}}));
+
+        const auto createNetwork = [this](const void*, const vpux::Config&) -> vpux::IEmulatorNetwork::Ptr {
+            return std::make_unique<FakeEmulatorNetwork>(_counters);
+        };
+        _executor = std::make_shared<vpux::EmulatorExecutor>(network, *_config, createNetwork);
+    }
+
+    std::unique_ptr<vpux::EmulatorInferRequest> createInferRequest() {
+        const auto inputInfo = std::make_shared<ie::InputInfo>();
+        inputInfo->setInputData(std::make_shared<ie::Data>(INPUT_NAME, dataDesc));
+        const auto output = std::make_shared<ie::Data>(OUTPUT_NAME, dataDesc);
+
+        return std::make_unique<vpux::EmulatorInferRequest>(ie::InputsDataMap{{INPUT_NAME, inputInfo}},
+                                                            ie::OutputsDataMap{{OUTPUT_NAME, output}}, _executor,
+                                                            *_config, "fake",
+                                                            std::vector<std::shared_ptr<const ov::Node>>{},
+                                                            std::vector<std::shared_ptr<const ov::Node>>{},
+                                                            vpux::NetworkIOVector{});
+    }
+
+    static void setInput(vpux::EmulatorInferRequest& request, float start) {
+        const auto mapped = ie::as<ie::MemoryBlob>(request.GetBlob(INPUT_NAME))->wmap();
+        const auto data = mapped.as<float*>();
+        std::iota(data, data + NUM_ELEMENTS, start);
+    }
+
+    // Checks the network echoed the input back
+    static void checkOutput(vpux::EmulatorInferRequest& request, float start) {
+        const auto mapped = ie::as<ie::MemoryBlob>(request.GetBlob(OUTPUT_NAME))->rmap();
+        const auto data = mapped.as<const float*>();
+        for (size_t i = 0; i < NUM_ELEMENTS; ++i) {
+            EXPECT_EQ(data[i], start + static_cast<float>(i));
+        }
+    }
+
+    static void infer(vpux::EmulatorInferRequest& request, float start) {
+        setInput(request, start);
+        request.InferImpl();
+        checkOutput(request, start);
+    }
+
+    NetworkCounters _counters;
+    std::unique_ptr<vpux::Config> _config;
+    std::shared_ptr<vpux::EmulatorExecutor> _executor;
+};
+
+}  // namespace
+
+TEST_F(EmulatorInferRequestUnitTests, networkIsBuiltOnceForSeveralInferences) {
+    auto request = createInferRequest();
+
+    infer(*request, 0.f);
+    infer(*request, 10.f);
+
+    EXPECT_EQ(_counters.built, 1u);
+    EXPECT_EQ(_counters.runs, 2u);
+}
+
+TEST_F(EmulatorInferRequestUnitTests, networkIsReusedByNextRequest) {
+    auto first = createInferRequest();
+    infer(*first, 0.f);
+    first.reset();
+
+    auto second = createInferRequest();
+    infer(*second, 10.f);
+
+    EXPECT_EQ(_counters.built, 1u);
+    EXPECT_EQ(_counters.runs, 2u);
+}
+
+TEST_F(EmulatorInferRequestUnitTests, concurrentRequestsUseSeparateNetworks) {
+    auto first = createInferRequest();
+    auto second = createInferRequest();
+
+    setInput(*first, 0.f);
+    setInput(*second, 10.f);
+    first->InferAsync();
+    second->InferAsync();
+    first->GetResult();
+    second->GetResult();
+
+    checkOutput(*first, 0.f);
+    checkOutput(*second, 10.f);
+    EXPECT_EQ(_counters.built, 2u);
+}
@@ -0,0 +1,185 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ie_blob.h>
+#include <ie_input_info.hpp>
+
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Path.h>
+
+#include "fake_network_description.hpp"
+#include "vpux/IMD/executor.hpp"
+#include "vpux/IMD/infer_request.hpp"
+#include "vpux/IMD/parsed_config.hpp"
+#include "vpux/al/config/common.hpp"
+
+#include <fstream>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace ie = InferenceEngine;
+
+namespace {
+
+constexpr auto INPUT_NAME = "input";
+constexpr auto OUTPUT_NAME = "output";
+
+const ie::TensorDesc dataDesc(ie::Precision::FP32, {1, 4}, ie::Layout::NC);
+
+class IMDSessionUnitTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        llvm::SmallString<128> rootDir(::testing::TempDir());
+        llvm::sys::path::append(rootDir,
+                                std::string("imd_") + ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        _rootDir = rootDir.str().str();
+        llvm::sys::fs::remove_directories(_rootDir);
+
+        llvm::SmallString<128> binDir(_rootDir);
+        llvm::sys::path::append(binDir, "linux64", "bin");
+        ASSERT_FALSE(llvm::sys::fs::create_directories(binDir));
+
+        llvm::SmallString<128> logPath(_rootDir);
+        llvm::sys::path::append(logPath, "runs.log");
+        _logPath = logPath.str().str();
+
+        // Fake simulator: records its working directory and echoes the input back
+        llvm::SmallString<128> appPath(binDir);
+        llvm::sys::path::append(appPath, "moviSim");
+        {
+            std::ofstream app(appPath.str().str());
+            app << "#!/bin/sh" << std::endl;
+            app << "pwd >> \"" << _logPath << "\"" << std::endl;
+            app << "cp input-0.bin output-0.bin" << std::endl;
+        }
+        ASSERT_FALSE(llvm::sys::fs::setPermissions(appPath, llvm::sys::fs::all_read | llvm::sys::fs::owner_all));
+    }
+
+    void TearDown() override {
+        llvm::sys::fs::remove_directories(_rootDir);
+    }
+
+    std::shared_ptr<vpux::IMD::ExecutorImpl> createExecutor(bool sessionMode) {
+        auto options = std::make_shared<vpux::OptionsDesc>();
+        vpux::registerCommonOptions(*options);
+        options->add<vpux::IMD::MV_TOOLS_PATH>();
+        options->add<vpux::IMD::LAUNCH_MODE>();
+        options->add<vpux::IMD::MV_RUN_TIMEOUT>();
+        options->add<vpux::IMD::SESSION_MODE>();
+
+        _config = std::make_unique<vpux::Config>(options);
+        _config->update({{vpux::IMD::MV_TOOLS_PATH::key().str(), _rootDir},
+                         {vpux::IMD::SESSION_MODE::key().str(), sessionMode ? "YES" : "NO"}});
+
+        const auto network = std::make_shared<vpux::NetworkDescription>(std::make_shared<vpux::FakeNetworkDescription>(
+                std::vector<char>{'b', 'l', 'o', 'b'},
+                vpux::NetworkIOVector{{INPUT_NAME, std::make_shared<ie::Data>(INPUT_NAME, dataDesc)}},
+                vpux::NetworkIOVector{{OUTPUT_NAME, std::make_shared<ie::Data>(OUTPUT_NAME, dataDesc)}}));
+
+        return std::make_shared<vpux::IMD::ExecutorImpl>(ie::VPUXConfigParams::VPUXPlatform::VPU3700, network,
+                                                         *_config);
+    }
+
+    std::unique_ptr<vpux::IMD::IMDInferRequest> createInferRequest(
+            const std::shared_ptr<vpux::IMD::ExecutorImpl>& executor) {
+        const auto inputInfo = std::make_shared<ie::InputInfo>();
+        inputInfo->setInputData(std::make_shared<ie::Data>(INPUT_NAME, dataDesc));
+        const auto output = std::make_shared<ie::Data>(OUTPUT_NAME, dataDesc);
+
+        return std::make_unique<vpux::IMD::IMDInferRequest>(ie::InputsDataMap{{INPUT_NAME, inputInfo}},
+                                                            ie::OutputsDataMap{{OUTPUT_NAME, output}}, executor,
+                                                            *_config, "fake",
+                                                            std::vector<std::shared_ptr<const ov::Node>>{},
+                                                            std::vector<std::shared_ptr<const ov::Node>>{},
+                                                            vpux::NetworkIOVector{});
+    }
+
+    // Runs the inference and checks the application echoed the input back
+    void infer(vpux::IMD::IMDInferRequest& request, float start) {
+        {
+            const auto mapped = ie::as<ie::MemoryBlob>(request.GetBlob(INPUT_NAME))->wmap();
+            const auto data = mapped.as<float*>();
+            std::iota(data, data + dataDesc.getDims().back(), start);
+        }
+
+        request.InferImpl();
+
+        const auto mapped = ie::as<ie::MemoryBlob>(request.GetBlob(OUTPUT_NAME))->rmap();
+        const auto data = mapped.as<const float*>();
+        for (size_t i = 0; i < dataDesc.getDims().back(); ++i) {
+            EXPECT_EQ(data[i], start + static_cast<float>(i));
+        }
+    }
+
+    std::vector<std::string> readRunDirs() const {
+        std::vector<std::string> runDirs;
+        std::ifstream log(_logPath);
+        for (std::string line; std::getline(log, line);) {
+            runDirs.push_back(line);
+        }
+        return runDirs;
+    }
+
+    std::string _rootDir;
+    std::string _logPath;
+    std::unique_ptr<vpux::Config> _config;
+};
+
+}  // namespace
+
+TEST_F(IMDSessionUnitTests, sessionWorkDirIsReusedAcrossInferences) {
+    const auto executor = createExecutor(/*sessionMode=*/true);
+    auto request = createInferRequest(executor);
+
+    infer(*request, 0.f);
+    infer(*request, 10.f);
+    infer(*request, 20.f);
+
+    const auto runDirs = readRunDirs();
+    ASSERT_EQ(runDirs.size(), 3u);
+    EXPECT_EQ(runDirs[1], runDirs[0]);
+    EXPECT_EQ(runDirs[2], runDirs[0]);
+
+    request.reset();
+    EXPECT_FALSE(llvm::sys::fs::exists(runDirs[0]));
+}
+
+TEST_F(IMDSessionUnitTests, sessionBlobIsSharedByRequests) {
+    const auto executor = createExecutor(/*sessionMode=*/true);
+    auto first = createInferRequest(executor);
+    auto second = createInferRequest(executor);
+
+    infer(*first, 0.f);
+    infer(*second, 10.f);
+
+    const auto runDirs = readRunDirs();
+    ASSERT_EQ(runDirs.size(), 2u);
+    EXPECT_NE(runDirs[0], runDirs[1]);
+
+    for (const auto& runDir : runDirs) {
+        bool isSameFile = false;
+        ASSERT_FALSE(llvm::sys::fs::equivalent(runDir + "/test.blob", executor->getSessionBlobPath(), isSameFile));
+        EXPECT_TRUE(isSameFile);
+    }
+}
+
+TEST_F(IMDSessionUnitTests, workDirIsRecreatedForEachInferenceWithoutSession) {
+    const auto executor = createExecutor(/*sessionMode=*/false);
+    auto request = createInferRequest(executor);
+
+    infer(*request, 0.f);
+    infer(*request, 10.f);
+
+    const auto runDirs = readRunDirs();
+    ASSERT_EQ(runDirs.size(), 2u);
+    EXPECT_NE(runDirs[0], runDirs[1]);
+    EXPECT_FALSE(llvm::sys::fs::exists(runDirs[0]));
+    EXPECT_FALSE(llvm::sys::fs::exists(runDirs[1]));
+}
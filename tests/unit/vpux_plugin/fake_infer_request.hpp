@@ -0,0 +1,62 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include "vpux.hpp"
+#include "vpux/utils/plugin/inference_scheduler.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace vpux {
+
+/**
+ * @brief Infer request recording the calls of the backend interface to the shared event list
+ * @details With the scheduler set, the request holds a slot of the device from InferAsync till GetResult.
+ */
+class FakeInferRequest final : public IInferRequest {
+public:
+    using Ptr = std::shared_ptr<FakeInferRequest>;
+
+    FakeInferRequest(const std::string& name, std::vector<std::string>& events)
+            : IInferRequest({}, {}), _name(name), _events(events) {
+    }
+
+    void InferAsync() override {
+        if (failInferAsync) {
+            throw std::runtime_error(_name + " can't be started");
+        }
+        if (scheduler != nullptr) {
+            scheduler->acquire(ov::hint::Priority::MEDIUM);
+        }
+        _events.push_back(_name + ".InferAsync");
+    }
+
+    void GetResult() override {
+        _events.push_back(_name + ".GetResult");
+        if (scheduler != nullptr) {
+            scheduler->release();
+        }
+        if (failGetResult) {
+            throw std::runtime_error(_name + " failed");
+        }
+    }
+
+    size_t getMaxInFlight() const override {
+        return scheduler != nullptr ? scheduler->getMaxInFlight() : 0;
+    }
+
+    bool failInferAsync = false;
+    bool failGetResult = false;
+    InferenceScheduler* scheduler = nullptr;
+
+private:
+    std::string _name;
+    std::vector<std::string>& _events;
+};
+
+}  // namespace vpux
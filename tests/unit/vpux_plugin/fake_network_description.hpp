@@ -0,0 +1,68 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include "vpux_compiler.hpp"
+
+#include <string>
+#include <vector>
+
+namespace vpux {
+
+/**
+ * @brief Network description which only holds the compiled network and the device I/O
+ */
+class FakeNetworkDescription final : public INetworkDescription {
+public:
+    explicit FakeNetworkDescription(const std::vector<char>& compiledNetwork, const NetworkIOVector& inputsInfo = {},
+                                    const NetworkIOVector& outputsInfo = {})
+            : _inputsInfo(inputsInfo), _outputsInfo(outputsInfo), _compiledNetwork(compiledNetwork) {
+    }
+
+    const std::string& getName() const override {
+        return _name;
+    }
+    const NetworkIOVector& getDeviceInputsInfo() const override {
+        return _inputsInfo;
+    }
+    const NetworkIOVector& getDeviceOutputsInfo() const override {
+        return _outputsInfo;
+    }
+    const NetworkIOVector& getDeviceProfilingOutputsInfo() const override {
+        return _profilingInfo;
+    }
+    const std::vector<OVRawNode>& getOVParameters() const override {
+        return _nodes;
+    }
+    const std::vector<OVRawNode>& getOVResults() const override {
+        return _nodes;
+    }
+    const std::vector<char>& getCompiledNetwork() const override {
+        return _compiledNetwork;
+    }
+    const void* getNetworkModel() const override {
+        return _compiledNetwork.data();
+    }
+    std::size_t getNetworkModelSize() const override {
+        return _compiledNetwork.size();
+    }
+    int getNumStreams() const override {
+        return 1;
+    }
+    void releaseCompiledNetwork() override {
+        _compiledNetwork = {};
+    }
+
+private:
+    std::string _name = "fake";
+    NetworkIOVector _inputsInfo;
+    NetworkIOVector _outputsInfo;
+    NetworkIOVector _profilingInfo;
+    std::vector<OVRawNode> _nodes;
+    std::vector<char> _compiledNetwork;
+};
+
+}  // namespace vpux
@@ -0,0 +1,174 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Path.h>
+#include <openvino/opsets/opset8.hpp>
+
+#include "fake_network_description.hpp"
+#include "vpux/al/config/common.hpp"
+#include "vpux/al/config/compiler.hpp"
+#include "vpux_compiled_model_cache.h"
+
+#include <fstream>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace ie = InferenceEngine;
+
+namespace {
+
+const std::vector<char> compiledNetwork = {'b', 'l', 'o', 'b'};
+
+std::shared_ptr<ov::Model> makeModel(const ov::Shape& shape) {
+    const auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+    const auto relu = std::make_shared<ov::opset8::Relu>(param);
+    const auto result = std::make_shared<ov::opset8::Result>(relu);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+}
+
+vpux::Config makeConfig(const std::map<std::string, std::string>& values = {}) {
+    auto options = std::make_shared<vpux::OptionsDesc>();
+    vpux::registerCommonOptions(*options);
+    vpux::registerCompilerOptions(*options);
+
+    vpux::Config config(options);
+    config.update(values);
+    return config;
+}
+
+std::string computeKey(const std::shared_ptr<ov::Model>& model, const vpux::Config& config,
+                       const std::string& compilerVersion = "1.0") {
+    return vpux::CompiledModelCache::computeKey(model, ie::InputsDataMap{}, ie::OutputsDataMap{}, true, config,
+                                                compilerVersion);
+}
+
+class CompiledModelCacheUnitTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        llvm::SmallString<128> path(::testing::TempDir());
+        llvm::sys::path::append(path, std::string("compiled_model_cache_") +
+                                              ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        _cacheDir = path.str().str();
+        llvm::sys::fs::remove_directories(_cacheDir);
+    }
+
+    void TearDown() override {
+        llvm::sys::fs::remove_directories(_cacheDir);
+    }
+
+    vpux::NetworkDescription::Ptr getOrCompile(vpux::CompiledModelCache& cache, const std::string& key) {
+        const auto parse = [&](const std::vector<char>& blob) {
+            ++_numParsed;
+            if (blob != compiledNetwork) {
+                throw std::runtime_error("Blob is corrupted");
+            }
+            return std::make_shared<vpux::NetworkDescription>(std::make_shared<vpux::FakeNetworkDescription>(blob));
+        };
+        const auto compile = [&]() {
+            ++_numCompiled;
+            return std::make_shared<vpux::NetworkDescription>(
+                    std::make_shared<vpux::FakeNetworkDescription>(compiledNetwork));
+        };
+        return cache.getOrCompile(key, parse, compile);
+    }
+
+    std::vector<std::string> listCacheDir() const {
+        std::vector<std::string> files;
+        std::error_code err;
+        for (llvm::sys::fs::directory_iterator it(_cacheDir, err), end; it != end && !err; it.increment(err)) {
+            files.push_back(it->path());
+        }
+        return files;
+    }
+
+    std::string _cacheDir;
+    size_t _numParsed = 0;
+    size_t _numCompiled = 0;
+};
+
+}  // namespace
+
+TEST_F(CompiledModelCacheUnitTests, missIsCompiledAndStored) {
+    vpux::CompiledModelCache cache(_cacheDir, 0, vpux::Logger::global());
+
+    const auto network = getOrCompile(cache, "key");
+    EXPECT_EQ(network->getCompiledNetwork(), compiledNetwork);
+    EXPECT_EQ(_numCompiled, 1u);
+    EXPECT_EQ(_numParsed, 0u);
+    EXPECT_EQ(listCacheDir().size(), 1u);
+}
+
+TEST_F(CompiledModelCacheUnitTests, hitIsLoadedWithoutCompilation) {
+    {
+        vpux::CompiledModelCache cache(_cacheDir, 0, vpux::Logger::global());
+        getOrCompile(cache, "key");
+    }
+
+    vpux::CompiledModelCache cache(_cacheDir, 0, vpux::Logger::global());
+    const auto network = getOrCompile(cache, "key");
+    EXPECT_EQ(network->getCompiledNetwork(), compiledNetwork);
+    EXPECT_EQ(_numCompiled, 1u);
+    EXPECT_EQ(_numParsed, 1u);
+}
+
+TEST_F(CompiledModelCacheUnitTests, otherKeyIsMiss) {
+    vpux::CompiledModelCache cache(_cacheDir, 0, vpux::Logger::global());
+    getOrCompile(cache, "key");
+    getOrCompile(cache, "other_key");
+    EXPECT_EQ(_numCompiled, 2u);
+    EXPECT_EQ(listCacheDir().size(), 2u);
+}
+
+TEST_F(CompiledModelCacheUnitTests, corruptedEntryIsRecompiledAndReplaced) {
+    vpux::CompiledModelCache cache(_cacheDir, 0, vpux::Logger::global());
+    getOrCompile(cache, "key");
+
+    const auto files = listCacheDir();
+    ASSERT_EQ(files.size(), 1u);
+    std::ofstream(files.front(), std::ios::binary | std::ios::trunc) << "garbage";
+
+    const auto network = getOrCompile(cache, "key");
+    EXPECT_EQ(network->getCompiledNetwork(), compiledNetwork);
+    EXPECT_EQ(_numCompiled, 2u);
+
+    // The replaced entry is valid
+    getOrCompile(cache, "key");
+    EXPECT_EQ(_numCompiled, 2u);
+}
+
+TEST_F(CompiledModelCacheUnitTests, keyIsStableForSameCompilation) {
+    EXPECT_EQ(computeKey(makeModel({1, 3, 16, 16}), makeConfig()),
+              computeKey(makeModel({1, 3, 16, 16}), makeConfig()));
+}
+
+TEST_F(CompiledModelCacheUnitTests, keyDependsOnModel) {
+    EXPECT_NE(computeKey(makeModel({1, 3, 16, 16}), makeConfig()),
+              computeKey(makeModel({1, 3, 32, 32}), makeConfig()));
+}
+
+TEST_F(CompiledModelCacheUnitTests, keyDependsOnCompileTimeOptions) {
+    const auto model = makeModel({1, 3, 16, 16});
+    const auto config = makeConfig({{vpux::COMPILATION_MODE_PARAMS::key().str(), "dummy-op-replacement=true"}});
+    EXPECT_NE(computeKey(model, makeConfig()), computeKey(model, config));
+}
+
+TEST_F(CompiledModelCacheUnitTests, keyDoesNotDependOnCacheAndLogOptions) {
+    const auto model = makeModel({1, 3, 16, 16});
+    const auto config =
+            makeConfig({{vpux::LOG_LEVEL::key().str(), "LOG_DEBUG"}, {vpux::CACHE_DIR::key().str(), "dir"}});
+    EXPECT_EQ(computeKey(model, makeConfig()), computeKey(model, config));
+}
+
+TEST_F(CompiledModelCacheUnitTests, keyDependsOnCompilerVersion) {
+    const auto model = makeModel({1, 3, 16, 16});
+    EXPECT_NE(computeKey(model, makeConfig(), "1.0"), computeKey(model, makeConfig(), "1.1"));
+}
@@ -0,0 +1,41 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <device_helpers.hpp>
+
+#include <string>
+#include <vector>
+
+namespace {
+
+const std::vector<std::string> availableNames = {"3700.0", "3720.0", "3720.1"};
+
+}  // namespace
+
+using DeviceHelpersUnitTests = ::testing::Test;
+
+TEST_F(DeviceHelpersUnitTests, nameWithIndexIsResolvedExactly) {
+    EXPECT_EQ(utils::resolveDeviceName("3720.1", availableNames), "3720.1");
+    EXPECT_EQ(utils::resolveDeviceName("3700.0", availableNames), "3700.0");
+}
+
+TEST_F(DeviceHelpersUnitTests, nameWithAbsentIndexIsNotResolved) {
+    EXPECT_EQ(utils::resolveDeviceName("3720.2", availableNames), "");
+    EXPECT_EQ(utils::resolveDeviceName("3720.0", {}), "");
+}
+
+TEST_F(DeviceHelpersUnitTests, nameWithoutIndexRefersToFirstDevice) {
+    EXPECT_EQ(utils::resolveDeviceName("3720", availableNames), "3700.0");
+    EXPECT_EQ(utils::resolveDeviceName("", availableNames), "3700.0");
+    EXPECT_EQ(utils::resolveDeviceName("3720", {}), "");
+}
+
+TEST_F(DeviceHelpersUnitTests, devicesOfPlatformAreListed) {
+    EXPECT_EQ(utils::getPlatformDeviceNames("3720", availableNames), (std::vector<std::string>{"3720.0", "3720.1"}));
+    EXPECT_EQ(utils::getPlatformDeviceNames("3700", availableNames), std::vector<std::string>{"3700.0"});
+    EXPECT_TRUE(utils::getPlatformDeviceNames("3720_EMU", availableNames).empty());
+}
@@ -0,0 +1,131 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ie_blob.h>
+
+#include "fake_infer_request.hpp"
+#include "vpux_dynamic_batcher.h"
+
+#include <chrono>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace ie = InferenceEngine;
+
+namespace {
+
+constexpr size_t BATCH_SIZE = 3;
+constexpr size_t NUM_ELEMENTS = 4;
+
+ie::Blob::Ptr makeBlob(size_t batch, ie::Precision precision = ie::Precision::FP32,
+                       ie::Layout layout = ie::Layout::NC) {
+    ie::Blob::Ptr blob = ie::make_shared_blob<float>(ie::TensorDesc(precision, {batch, NUM_ELEMENTS}, layout));
+    blob->allocate();
+    return blob;
+}
+
+void fill(const ie::Blob::Ptr& blob, float start) {
+    const auto mapped = ie::as<ie::MemoryBlob>(blob)->wmap();
+    const auto data = mapped.as<float*>();
+    std::iota(data, data + blob->size(), start);
+}
+
+std::vector<float> read(const ie::Blob::Ptr& blob) {
+    const auto mapped = ie::as<ie::MemoryBlob>(blob)->rmap();
+    const auto data = mapped.as<const float*>();
+    return std::vector<float>(data, data + blob->size());
+}
+
+}  // namespace
+
+using DynamicBatcherUnitTests = ::testing::Test;
+
+TEST_F(DynamicBatcherUnitTests, blobIsSliceOfBatchedBlob) {
+    EXPECT_TRUE(vpux::batching::isSlice(makeBlob(1), makeBlob(BATCH_SIZE), BATCH_SIZE));
+}
+
+TEST_F(DynamicBatcherUnitTests, blobOfOtherSizeIsNotSlice) {
+    EXPECT_FALSE(vpux::batching::isSlice(makeBlob(1), makeBlob(BATCH_SIZE + 1), BATCH_SIZE));
+    EXPECT_FALSE(vpux::batching::isSlice(makeBlob(2), makeBlob(BATCH_SIZE), BATCH_SIZE));
+}
+
+TEST_F(DynamicBatcherUnitTests, blobOfOtherLayoutIsNotSlice) {
+    EXPECT_FALSE(vpux::batching::isSlice(makeBlob(1, ie::Precision::FP32, ie::Layout::CN), makeBlob(BATCH_SIZE),
+                                         BATCH_SIZE));
+}
+
+TEST_F(DynamicBatcherUnitTests, blobOfOtherPrecisionIsNotSlice) {
+    ie::Blob::Ptr blob = ie::make_shared_blob<int32_t>(ie::TensorDesc(ie::Precision::I32, {1, NUM_ELEMENTS},
+                                                                      ie::Layout::NC));
+    blob->allocate();
+    EXPECT_FALSE(vpux::batching::isSlice(blob, makeBlob(BATCH_SIZE), BATCH_SIZE));
+}
+
+TEST_F(DynamicBatcherUnitTests, nullBlobIsNotSlice) {
+    EXPECT_FALSE(vpux::batching::isSlice(nullptr, makeBlob(BATCH_SIZE), BATCH_SIZE));
+    EXPECT_FALSE(vpux::batching::isSlice(makeBlob(1), nullptr, BATCH_SIZE));
+}
+
+TEST_F(DynamicBatcherUnitTests, slicesAreGatheredAndScattered) {
+    const auto batched = makeBlob(BATCH_SIZE);
+    fill(batched, -100.f);
+
+    std::vector<ie::Blob::Ptr> inputs;
+    for (size_t slice = 0; slice < BATCH_SIZE; ++slice) {
+        inputs.push_back(makeBlob(1));
+        fill(inputs.back(), static_cast<float>(slice * NUM_ELEMENTS));
+        vpux::batching::copyToSlice(inputs.back(), batched, slice);
+    }
+
+    std::vector<float> expectedBatched(BATCH_SIZE * NUM_ELEMENTS);
+    std::iota(expectedBatched.begin(), expectedBatched.end(), 0.f);
+    EXPECT_EQ(read(batched), expectedBatched);
+
+    for (size_t slice = 0; slice < BATCH_SIZE; ++slice) {
+        const auto output = makeBlob(1);
+        vpux::batching::copyFromSlice(batched, slice, output);
+        EXPECT_EQ(read(output), read(inputs[slice]));
+    }
+}
+
+TEST_F(DynamicBatcherUnitTests, partialBatchKeepsOtherSlices) {
+    const auto batched = makeBlob(BATCH_SIZE);
+    fill(batched, 0.f);
+    const auto before = read(batched);
+
+    const auto input = makeBlob(1);
+    fill(input, 100.f);
+    vpux::batching::copyToSlice(input, batched, 1);
+
+    const auto after = read(batched);
+    for (size_t i = 0; i < after.size(); ++i) {
+        const auto isSecondSlice = i >= NUM_ELEMENTS && i < 2 * NUM_ELEMENTS;
+        EXPECT_EQ(after[i], isSecondSlice ? 100.f + static_cast<float>(i - NUM_ELEMENTS) : before[i]);
+    }
+}
+
+TEST_F(DynamicBatcherUnitTests, groupIsSubmittedWithoutBatchedVariant) {
+    std::vector<std::string> events;
+    const vpux::IInferRequest::Ptr first = std::make_shared<vpux::FakeInferRequest>("first", events);
+    const vpux::IInferRequest::Ptr second = std::make_shared<vpux::FakeInferRequest>("second", events);
+
+    std::vector<vpux::IInferRequest::Ptr> submitted;
+    vpux::DynamicBatcher batcher(
+            [&](const std::vector<vpux::IInferRequest::Ptr>& requests) {
+                submitted = requests;
+            },
+            2, std::chrono::seconds(10), vpux::Logger::global());
+
+    auto firstInference = batcher.submit(first);
+    auto secondInference = batcher.submit(second);
+    EXPECT_TRUE(firstInference.get());
+    EXPECT_TRUE(secondInference.get());
+
+    const std::vector<vpux::IInferRequest::Ptr> expected = {first, second};
+    EXPECT_EQ(submitted, expected);
+}
@@ -0,0 +1,84 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "fake_infer_request.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using vpux::FakeInferRequest;
+using vpux::InferenceScheduler;
+
+class InferBatchUnitTests : public ::testing::Test {
+protected:
+    FakeInferRequest::Ptr makeRequest(const std::string& name) {
+        return std::make_shared<FakeInferRequest>(name, events);
+    }
+
+    std::vector<std::string> events;
+};
+
+TEST_F(InferBatchUnitTests, allRequestsAreStartedBeforeWaiting) {
+    const auto first = makeRequest("first");
+    const auto second = makeRequest("second");
+    const auto third = makeRequest("third");
+
+    first->InferBatch({second, third});
+
+    const std::vector<std::string> expected = {"first.InferAsync", "second.InferAsync", "third.InferAsync",
+                                               "first.GetResult",  "second.GetResult",  "third.GetResult"};
+    EXPECT_EQ(events, expected);
+}
+
+TEST_F(InferBatchUnitTests, startedRequestsAreWaitedForIfStartFails) {
+    const auto first = makeRequest("first");
+    const auto second = makeRequest("second");
+    const auto third = makeRequest("third");
+    second->failInferAsync = true;
+
+    EXPECT_THROW(first->InferBatch({second, third}), std::runtime_error);
+
+    const std::vector<std::string> expected = {"first.InferAsync", "first.GetResult"};
+    EXPECT_EQ(events, expected);
+}
+
+TEST_F(InferBatchUnitTests, allRequestsAreWaitedForIfResultFails) {
+    const auto first = makeRequest("first");
+    const auto second = makeRequest("second");
+    first->failGetResult = true;
+    second->failGetResult = true;
+
+    try {
+        first->InferBatch({second});
+        FAIL() << "Failure of the batch is not reported";
+    } catch (const std::runtime_error& ex) {
+        EXPECT_STREQ(ex.what(), "first failed");
+    }
+
+    const std::vector<std::string> expected = {"first.InferAsync", "second.InferAsync", "first.GetResult",
+                                               "second.GetResult"};
+    EXPECT_EQ(events, expected);
+}
+
+TEST_F(InferBatchUnitTests, noMoreRequestsAreStartedThanDeviceRuns) {
+    InferenceScheduler scheduler(2);
+    const auto first = makeRequest("first");
+    const auto second = makeRequest("second");
+    const auto third = makeRequest("third");
+    for (const auto& request : {first, second, third}) {
+        request->scheduler = &scheduler;
+    }
+
+    // The third request would wait forever for a slot held by the batch itself
+    first->InferBatch({second, third});
+
+    const std::vector<std::string> expected = {"first.InferAsync", "second.InferAsync", "first.GetResult",
+                                               "third.InferAsync", "second.GetResult",  "third.GetResult"};
+    EXPECT_EQ(events, expected);
+    EXPECT_EQ(scheduler.getQueuedCount(), 0u);
+}
@@ -0,0 +1,57 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "fake_network_description.hpp"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+const std::vector<char> compiledNetwork = {'b', 'l', 'o', 'b'};
+
+vpux::NetworkDescription makeReleasedNetwork(const std::vector<char>& readBack) {
+    vpux::NetworkDescription network(std::make_shared<vpux::FakeNetworkDescription>(compiledNetwork));
+    network.releaseCompiledNetwork([readBack]() {
+        return readBack;
+    });
+    return network;
+}
+
+}  // namespace
+
+using NetworkDescriptionUnitTests = ::testing::Test;
+
+TEST_F(NetworkDescriptionUnitTests, compiledNetworkIsReadFromImplUntilReleased) {
+    vpux::NetworkDescription network(std::make_shared<vpux::FakeNetworkDescription>(compiledNetwork));
+    EXPECT_EQ(network.readCompiledNetwork(), compiledNetwork);
+}
+
+TEST_F(NetworkDescriptionUnitTests, releasedNetworkIsReadFromSource) {
+    const auto network = makeReleasedNetwork(compiledNetwork);
+    EXPECT_TRUE(network.getCompiledNetwork().empty());
+    EXPECT_EQ(network.readCompiledNetwork(), compiledNetwork);
+}
+
+TEST_F(NetworkDescriptionUnitTests, sourceOfOtherSizeIsRejected) {
+    EXPECT_ANY_THROW(makeReleasedNetwork({'b', 'l', 'o'}).readCompiledNetwork());
+    EXPECT_ANY_THROW(makeReleasedNetwork({'b', 'l', 'o', 'b', 's'}).readCompiledNetwork());
+}
+
+TEST_F(NetworkDescriptionUnitTests, sourceWithOtherContentIsRejected) {
+    EXPECT_ANY_THROW(makeReleasedNetwork({'b', 'l', 'o', 'p'}).readCompiledNetwork());
+}
+
+TEST_F(NetworkDescriptionUnitTests, sourceErrorIsForwarded) {
+    vpux::NetworkDescription network(std::make_shared<vpux::FakeNetworkDescription>(compiledNetwork));
+    network.releaseCompiledNetwork([]() -> std::vector<char> {
+        throw std::runtime_error("Could not open file");
+    });
+    EXPECT_THROW(network.readCompiledNetwork(), std::runtime_error);
+}
@@ -0,0 +1,100 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "fake_infer_request.hpp"
+#include "vpux_request_balancer.h"
+
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ie = InferenceEngine;
+
+class InferRequestBalancerUnitTests : public ::testing::Test {
+protected:
+    ie::IInferRequestInternal::Ptr createRequest(vpux::InferRequestBalancer& balancer, size_t* deviceIndex = nullptr) {
+        return balancer.createRequest([&](size_t index) {
+            if (deviceIndex != nullptr) {
+                *deviceIndex = index;
+            }
+            return std::make_shared<vpux::FakeInferRequest>("request", events);
+        });
+    }
+
+    std::vector<std::string> events;
+};
+
+TEST_F(InferRequestBalancerUnitTests, requestsAreSpreadBetweenDevices) {
+    vpux::InferRequestBalancer balancer(3);
+
+    std::vector<size_t> deviceIndices(6);
+    std::vector<ie::IInferRequestInternal::Ptr> requests;
+    for (auto& deviceIndex : deviceIndices) {
+        requests.push_back(createRequest(balancer, &deviceIndex));
+    }
+
+    const std::vector<size_t> expected = {0, 1, 2, 0, 1, 2};
+    EXPECT_EQ(deviceIndices, expected);
+    for (size_t i = 0; i < requests.size(); ++i) {
+        EXPECT_EQ(balancer.getDeviceIndex(requests[i]), expected[i]);
+    }
+}
+
+TEST_F(InferRequestBalancerUnitTests, deviceOfDestroyedRequestIsSelected) {
+    vpux::InferRequestBalancer balancer(2);
+
+    const auto first = createRequest(balancer);
+    auto second = createRequest(balancer);
+    const auto third = createRequest(balancer);
+    EXPECT_EQ(balancer.getDeviceIndex(second), 1u);
+
+    // The first device has two live requests, the second one has none
+    second.reset();
+    EXPECT_EQ(balancer.selectDevice(), 1u);
+
+    size_t deviceIndex = 0;
+    createRequest(balancer, &deviceIndex);
+    EXPECT_EQ(deviceIndex, 1u);
+}
+
+TEST_F(InferRequestBalancerUnitTests, concurrentRequestsAreSpreadBetweenDevices) {
+    constexpr size_t numDevices = 4;
+    constexpr size_t requestsPerDevice = 16;
+    vpux::InferRequestBalancer balancer(numDevices);
+
+    std::mutex mutex;
+    std::vector<ie::IInferRequestInternal::Ptr> requests;
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < numDevices * requestsPerDevice; ++i) {
+        threads.emplace_back([&]() {
+            const auto request = createRequest(balancer);
+            std::lock_guard<std::mutex> lock(mutex);
+            requests.push_back(request);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::vector<size_t> numRequests(numDevices);
+    for (const auto& request : requests) {
+        ++numRequests[balancer.getDeviceIndex(request)];
+    }
+    EXPECT_TRUE(std::all_of(numRequests.begin(), numRequests.end(), [](size_t count) {
+        return count == requestsPerDevice;
+    }));
+}
+
+TEST_F(InferRequestBalancerUnitTests, requestOfOtherBalancerIsRejected) {
+    vpux::InferRequestBalancer balancer(2);
+    vpux::InferRequestBalancer otherBalancer(2);
+
+    const auto request = createRequest(otherBalancer);
+    EXPECT_ANY_THROW(balancer.getDeviceIndex(request));
+}
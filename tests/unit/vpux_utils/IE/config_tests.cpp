@@ -197,3 +197,29 @@ TEST_F(MLIR_ConfigSerializationTests, CanDumpLogLevel) {
 
     EXPECT_EQ(expected, conf.toString());
 }
+
+TEST_F(MLIR_ConfigSerializationTests, CanDumpConfigToMapByMode) {
+    struct RunTimeOption final : OptionBase<RunTimeOption, int64_t> {
+        static StringRef key() {
+            return "RUN_TIME_OPT";
+        }
+
+        static OptionMode mode() {
+            return OptionMode::RunTime;
+        }
+    };
+
+    options->add<SimpleOption>();
+    options->add<PrivateOption>();
+    options->add<RunTimeOption>();
+
+    conf.update({{"RUN_TIME_OPT", "3"}, {"PUBLIC_OPT", "NO"}, {"PRIVATE_OPT", "5"}});
+
+    const Config::ConfigMap expectedCompileTime = {{"PRIVATE_OPT", "5"}, {"PUBLIC_OPT", "NO"}};
+    EXPECT_EQ(expectedCompileTime, conf.toMap(OptionMode::CompileTime));
+
+    const Config::ConfigMap expectedRunTime = {{"PUBLIC_OPT", "NO"}, {"RUN_TIME_OPT", "3"}};
+    EXPECT_EQ(expectedRunTime, conf.toMap(OptionMode::RunTime));
+
+    EXPECT_EQ(3, conf.toMap(OptionMode::Both).size());
+}
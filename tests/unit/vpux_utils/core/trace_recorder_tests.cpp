@@ -0,0 +1,180 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/utils/core/trace_decoder.hpp"
+#include "vpux/utils/core/trace_recorder.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <sstream>
+#include <thread>
+
+using namespace vpux;
+
+namespace {
+
+VPUX_TRACE_EVENT(scheduleEvent, "TraceRecorderTests", "schedule", "op,cycle,ratio");
+VPUX_TRACE_EVENT(inferEvent, "TraceRecorderTests", "infer", "request");
+
+class TraceRecorderTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto& recorder = TraceRecorder::get();
+        recorder.disable();
+        recorder.clear();
+    }
+
+    // The capacity is restored even if the test changing it fails
+    void TearDown() override {
+        auto& recorder = TraceRecorder::get();
+        recorder.enable(TraceRecorder::DEFAULT_CAPACITY);
+        recorder.disable();
+    }
+
+    static DecodedTrace dumpAndRead() {
+        auto& recorder = TraceRecorder::get();
+        recorder.disable();
+
+        std::stringstream stream;
+        recorder.dump(stream);
+        return readTrace(stream);
+    }
+
+    static std::vector<DecodedTraceRecord> getRecords(const DecodedTrace& trace, const TraceEvent& event) {
+        std::vector<DecodedTraceRecord> records;
+        std::copy_if(trace.records.begin(), trace.records.end(), std::back_inserter(records),
+                     [&](const DecodedTraceRecord& decoded) {
+                         return decoded.record.eventId == event.id();
+                     });
+        return records;
+    }
+};
+
+}  // namespace
+
+TEST_F(TraceRecorderTests, NothingIsRecordedWhenDisabled) {
+    scheduleEvent.record(1, 2, 0.5);
+
+    EXPECT_TRUE(dumpAndRead().records.empty());
+}
+
+TEST_F(TraceRecorderTests, TypedArgumentsAreDecoded) {
+    TraceRecorder::get().enable();
+    scheduleEvent.record(size_t(42), int64_t(-7), 0.25);
+
+    const auto trace = dumpAndRead();
+    ASSERT_EQ(trace.events.count(scheduleEvent.id()), 1);
+    EXPECT_EQ(trace.events.at(scheduleEvent.id()).name, "schedule");
+
+    const auto records = getRecords(trace, scheduleEvent);
+    ASSERT_EQ(records.size(), 1);
+    const auto& rec = records.front().record;
+    EXPECT_EQ(rec.phase, TracePhase::Instant);
+    ASSERT_EQ(rec.numArgs, 3);
+    EXPECT_EQ(rec.argTypes[0], TraceArgType::UInt);
+    EXPECT_EQ(rec.args[0], 42);
+    EXPECT_EQ(rec.argTypes[1], TraceArgType::Int);
+    EXPECT_EQ(static_cast<int64_t>(rec.args[1]), -7);
+    EXPECT_EQ(rec.argTypes[2], TraceArgType::Double);
+
+    std::stringstream text;
+    printTraceAsText(trace, text);
+    EXPECT_NE(text.str().find("TraceRecorderTests.schedule  op=42  cycle=-7  ratio=0.250"), std::string::npos);
+}
+
+TEST_F(TraceRecorderTests, OldestRecordsAreOverwritten) {
+    // The buffer of a new thread is created with the new capacity
+    std::thread([]() {
+        TraceRecorder::get().enable(4);
+        for (int request = 0; request < 10; ++request) {
+            inferEvent.record(request);
+        }
+    }).join();
+
+    const auto records = getRecords(dumpAndRead(), inferEvent);
+    ASSERT_EQ(records.size(), 4);
+    EXPECT_EQ(static_cast<int64_t>(records.front().record.args[0]), 6);
+    EXPECT_EQ(static_cast<int64_t>(records.back().record.args[0]), 9);
+}
+
+TEST_F(TraceRecorderTests, ThreadsAndScopesAreExportedToPerfetto) {
+    TraceRecorder::get().enable();
+    std::thread([]() {
+        const auto scope = inferEvent.scope(1);
+        scheduleEvent.record(3, 4, 1.0);
+    }).join();
+    inferEvent.record(2);
+
+    const auto trace = dumpAndRead();
+    const auto records = getRecords(trace, inferEvent);
+    ASSERT_EQ(records.size(), 3);
+    EXPECT_EQ(records[0].record.phase, TracePhase::Begin);
+    EXPECT_EQ(records[1].record.phase, TracePhase::End);
+    EXPECT_EQ(records[0].threadId, records[1].threadId);
+    EXPECT_NE(records[0].threadId, records[2].threadId);
+
+    std::stringstream json;
+    printTraceAsPerfetto(trace, json);
+    EXPECT_NE(json.str().find("\"name\": \"infer\", \"cat\": \"TraceRecorderTests\", \"ph\": \"B\""),
+              std::string::npos);
+    EXPECT_NE(json.str().find("\"args\": {\"op\": 3, \"cycle\": 4, \"ratio\": 1.000}"), std::string::npos);
+}
+
+TEST_F(TraceRecorderTests, CapacityChangeKeepsExistingBuffers) {
+    TraceRecorder::get().enable();
+    inferEvent.record(0);
+
+    TraceRecorder::get().enable(1);
+    inferEvent.record(1);
+    inferEvent.record(2);
+
+    const auto records = getRecords(dumpAndRead(), inferEvent);
+    ASSERT_EQ(records.size(), 3);
+}
+
+TEST_F(TraceRecorderTests, BuffersOfExitedThreadsAreReused) {
+    TraceRecorder::get().enable();
+    for (int request = 0; request < 3; ++request) {
+        std::thread([request]() {
+            inferEvent.record(request);
+        }).join();
+    }
+
+    // Each thread took over the buffer of the previous one and dropped its records
+    const auto records = getRecords(dumpAndRead(), inferEvent);
+    ASSERT_EQ(records.size(), 1);
+    EXPECT_EQ(static_cast<int64_t>(records.front().record.args[0]), 2);
+}
+
+TEST_F(TraceRecorderTests, DumpIsConsistentWhileRecording) {
+    TraceRecorder::get().enable();
+
+    std::atomic<bool> stop{false};
+    std::thread recorder([&]() {
+        for (int request = 0; !stop.load(); ++request) {
+            scheduleEvent.record(request, -request, 0.5);
+        }
+    });
+
+    for (int i = 0; i < 10; ++i) {
+        std::stringstream stream;
+        TraceRecorder::get().dump(stream);
+        for (const auto& decoded : getRecords(readTrace(stream), scheduleEvent)) {
+            const auto& rec = decoded.record;
+            ASSERT_EQ(rec.numArgs, 3);
+            EXPECT_EQ(static_cast<int64_t>(rec.args[0]), -static_cast<int64_t>(rec.args[1]));
+        }
+    }
+
+    stop = true;
+    recorder.join();
+}
+
+TEST_F(TraceRecorderTests, InvalidFileIsRejected) {
+    std::stringstream stream("not a trace");
+    EXPECT_ANY_THROW(readTrace(stream));
+}
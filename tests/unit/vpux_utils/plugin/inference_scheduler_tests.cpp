@@ -0,0 +1,216 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include <gtest/gtest.h>
+#include <vpux/utils/plugin/inference_scheduler.hpp>
+
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace vpux;
+using ov::hint::Priority;
+
+namespace {
+
+// Records the order in which the queued inferences are submitted to the device
+class SubmissionRecorder {
+public:
+    explicit SubmissionRecorder(InferenceScheduler& scheduler): _scheduler(scheduler) {
+    }
+
+    ~SubmissionRecorder() {
+        for (auto& thread : _threads) {
+            thread.join();
+        }
+    }
+
+    // Starts the inference in a separate thread and waits until it is queued by the scheduler
+    void submit(Priority priority) {
+        const auto queued = _scheduler.getQueuedCount();
+        _threads.emplace_back([this, priority]() {
+            _scheduler.acquire(priority);
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _order.push_back(priority);
+            }
+            _scheduler.release();
+        });
+        while (_scheduler.getQueuedCount() == queued) {
+            std::this_thread::yield();
+        }
+    }
+
+    std::vector<Priority> finish() {
+        for (auto& thread : _threads) {
+            thread.join();
+        }
+        _threads.clear();
+        return _order;
+    }
+
+private:
+    InferenceScheduler& _scheduler;
+    std::vector<std::thread> _threads;
+    std::mutex _mutex;
+    std::vector<Priority> _order;
+};
+
+}  // namespace
+
+TEST(InferenceSchedulerTests, unboundedDoesNotQueue) {
+    InferenceScheduler scheduler;
+
+    for (size_t i = 0; i < 16; ++i) {
+        scheduler.acquire(Priority::LOW);
+    }
+    EXPECT_EQ(scheduler.getQueuedCount(), 0u);
+    EXPECT_EQ(scheduler.getQueueingDelay(Priority::LOW).count, 16u);
+
+    for (size_t i = 0; i < 16; ++i) {
+        scheduler.release();
+    }
+    EXPECT_ANY_THROW(scheduler.release());
+}
+
+TEST(InferenceSchedulerTests, highPriorityOvertakesQueuedWork) {
+    InferenceScheduler scheduler(1);
+    SubmissionRecorder recorder(scheduler);
+
+    scheduler.acquire(Priority::MEDIUM);
+    recorder.submit(Priority::LOW);
+    recorder.submit(Priority::MEDIUM);
+    recorder.submit(Priority::HIGH);
+    scheduler.release();
+
+    const std::vector<Priority> expected = {Priority::HIGH, Priority::MEDIUM, Priority::LOW};
+    EXPECT_EQ(recorder.finish(), expected);
+}
+
+TEST(InferenceSchedulerTests, runningWorkIsNotPreempted) {
+    InferenceScheduler scheduler(1);
+    SubmissionRecorder recorder(scheduler);
+
+    scheduler.acquire(Priority::LOW);
+    recorder.submit(Priority::HIGH);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_EQ(scheduler.getQueuedCount(), 1u);
+
+    scheduler.release();
+    recorder.finish();
+
+    EXPECT_EQ(scheduler.getQueueingDelay(Priority::HIGH).count, 1u);
+    EXPECT_GE(scheduler.getQueueingDelay(Priority::HIGH).maxUs, 10000u);
+}
+
+TEST(InferenceSchedulerTests, weightedRoundRobin) {
+    InferenceScheduler scheduler(1, {2, 1});
+    SubmissionRecorder recorder(scheduler);
+
+    scheduler.acquire(Priority::MEDIUM);
+    for (size_t i = 0; i < 3; ++i) {
+        recorder.submit(Priority::LOW);
+    }
+    for (size_t i = 0; i < 4; ++i) {
+        recorder.submit(Priority::MEDIUM);
+    }
+    scheduler.release();
+
+    // LOW priority work gets its share instead of waiting for all MEDIUM priority one
+    const std::vector<Priority> expected = {Priority::MEDIUM, Priority::MEDIUM, Priority::LOW, Priority::MEDIUM,
+                                            Priority::MEDIUM, Priority::LOW,    Priority::LOW};
+    EXPECT_EQ(recorder.finish(), expected);
+}
+
+TEST(InferenceSchedulerTests, strictestLimitWins) {
+    InferenceScheduler scheduler;
+    scheduler.addInFlightLimit(2);
+    scheduler.addInFlightLimit(0);
+    scheduler.addInFlightLimit(3);
+
+    SubmissionRecorder recorder(scheduler);
+    scheduler.acquire(Priority::MEDIUM);
+    scheduler.acquire(Priority::MEDIUM);
+    recorder.submit(Priority::MEDIUM);
+    EXPECT_EQ(scheduler.getQueuedCount(), 1u);
+
+    scheduler.release();
+    scheduler.release();
+    recorder.finish();
+    EXPECT_EQ(scheduler.getQueuedCount(), 0u);
+}
+
+TEST(InferenceSchedulerTests, limitIsRestoredWhenRemoved) {
+    InferenceScheduler scheduler;
+    scheduler.addInFlightLimit(3);
+    scheduler.addInFlightLimit(1);
+
+    std::vector<Priority> order;
+    scheduler.acquire(Priority::MEDIUM);
+    scheduler.enqueue(Priority::LOW, [&]() {
+        order.push_back(Priority::LOW);
+    });
+    EXPECT_EQ(scheduler.getQueuedCount(), 1u);
+
+    // The queued inference is granted as soon as the strictest network is released
+    scheduler.removeInFlightLimit(1);
+    EXPECT_EQ(order, std::vector<Priority>{Priority::LOW});
+    EXPECT_EQ(scheduler.getQueuedCount(), 0u);
+
+    scheduler.release();
+    scheduler.release();
+    EXPECT_ANY_THROW(scheduler.removeInFlightLimit(1));
+}
+
+TEST(InferenceSchedulerTests, enqueueDoesNotBlock) {
+    InferenceScheduler scheduler(1);
+
+    std::vector<Priority> order;
+    const auto record = [&](Priority priority) {
+        return [&order, priority]() {
+            order.push_back(priority);
+        };
+    };
+
+    scheduler.enqueue(Priority::LOW, record(Priority::LOW));
+    scheduler.enqueue(Priority::LOW, record(Priority::LOW));
+    scheduler.enqueue(Priority::HIGH, record(Priority::HIGH));
+    EXPECT_EQ(order, std::vector<Priority>{Priority::LOW});
+    EXPECT_EQ(scheduler.getQueuedCount(), 2u);
+
+    // The queued work is submitted by the thread which releases the slot
+    scheduler.release();
+    const std::vector<Priority> expected = {Priority::LOW, Priority::HIGH};
+    EXPECT_EQ(order, expected);
+
+    scheduler.release();
+    scheduler.release();
+    EXPECT_EQ(order.size(), 3u);
+}
+
+TEST(InferenceSchedulerTests, cancelledWorkIsNotSubmitted) {
+    InferenceScheduler scheduler(1);
+
+    size_t submitted = 0;
+    const auto first = scheduler.enqueue(Priority::MEDIUM, [&]() {
+        ++submitted;
+    });
+    const auto second = scheduler.enqueue(Priority::MEDIUM, [&]() {
+        ++submitted;
+    });
+
+    EXPECT_FALSE(scheduler.cancel(first));
+    EXPECT_TRUE(scheduler.cancel(second));
+    EXPECT_FALSE(scheduler.cancel(second));
+
+    scheduler.release();
+    EXPECT_EQ(submitted, 1u);
+    EXPECT_ANY_THROW(scheduler.release());
+}
+
+TEST(InferenceSchedulerTests, zeroWeightIsRejected) {
+    EXPECT_ANY_THROW(InferenceScheduler(1, {0, 1}));
+}
@@ -0,0 +1,152 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/utils/plugin/profiling_compare.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <sstream>
+
+using namespace vpux;
+using namespace vpux::profiling;
+
+namespace {
+
+TaskInfo makeTask(const std::string& name, const std::string& layerType, TaskInfo::ExecType execType,
+                  uint64_t startTimeNs, uint64_t durationNs) {
+    TaskInfo task;
+    const auto nameLen = name.copy(task.name, sizeof(task.name) - 1);
+    task.name[nameLen] = '\0';
+    const auto typeLen = layerType.copy(task.layer_type, sizeof(task.layer_type) - 1);
+    task.layer_type[typeLen] = '\0';
+    task.exec_type = execType;
+    task.start_time_ns = startTimeNs;
+    task.duration_ns = durationNs;
+    return task;
+}
+
+// Tasks are named the same way as the profiling parser names them for the compiler profiling lit tests
+// Before: conv1 on 2 clusters, its output is spilled by DMA, then relu1 after a gap
+// After:  conv1 split into 2 tiles on 4 clusters without spill, relu1, new pool1
+std::vector<TaskInfo> getBeforeTasks() {
+    return {
+            makeTask("conv1?t_Convolution", "Convolution", TaskInfo::ExecType::DPU, 0, 100),
+            makeTask("conv1?t_Convolution/cluster_0", "Convolution", TaskInfo::ExecType::DPU, 0, 100),
+            makeTask("conv1?t_Convolution/cluster_1", "Convolution", TaskInfo::ExecType::DPU, 0, 90),
+            makeTask("conv1?t_Convolution/cluster_1/variant_0", "Convolution", TaskInfo::ExecType::DPU, 0, 90),
+            makeTask("conv1?t_Convolution", "Convolution", TaskInfo::ExecType::DMA, 100, 20),
+            makeTask("relu1?t_ReLU", "ReLU", TaskInfo::ExecType::SW, 130, 50),
+    };
+}
+
+std::vector<TaskInfo> getAfterTasks() {
+    std::vector<TaskInfo> tasks = {
+            makeTask("conv1?t_Convolution", "Convolution", TaskInfo::ExecType::DPU, 0, 60),
+            makeTask("conv1?t_Convolution", "Convolution", TaskInfo::ExecType::DPU, 60, 50),
+            makeTask("relu1?t_ReLU", "ReLU", TaskInfo::ExecType::SW, 110, 40),
+            makeTask("pool1?t_MaxPool", "MaxPool", TaskInfo::ExecType::DPU, 150, 20),
+    };
+    for (size_t cluster = 0; cluster < 4; ++cluster) {
+        tasks.push_back(makeTask("conv1?t_Convolution/cluster_" + std::to_string(cluster), "Convolution",
+                                 TaskInfo::ExecType::DPU, 0, 110));
+    }
+    return tasks;
+}
+
+const LayerTaskDiff& findLayer(const ProfilingComparison& comparison, const std::string& name,
+                               TaskInfo::ExecType execType) {
+    const auto it = std::find_if(comparison.layers.begin(), comparison.layers.end(), [&](const LayerTaskDiff& diff) {
+        return diff.layerName == name && diff.execType == execType;
+    });
+    VPUX_THROW_WHEN(it == comparison.layers.end(), "Layer {0} is not found", name);
+    return *it;
+}
+
+}  // namespace
+
+TEST(ProfilingCompareTests, AlignsLayersByNameAndEngine) {
+    const auto comparison = compareProfiling(getBeforeTasks(), getAfterTasks());
+
+    ASSERT_EQ(comparison.layers.size(), 4);
+
+    const auto& conv = findLayer(comparison, "conv1", TaskInfo::ExecType::DPU);
+    EXPECT_EQ(conv.layerType, "Convolution");
+    EXPECT_EQ(conv.getStatus(), CompareStatus::CHANGED);
+    EXPECT_EQ(conv.getDeltaNs(), 10);
+    EXPECT_TRUE(conv.isTilingChanged());
+    EXPECT_EQ(conv.before.numTasks, 1);
+    EXPECT_EQ(conv.after.numTasks, 2);
+    EXPECT_TRUE(conv.isClusteringChanged());
+    EXPECT_EQ(conv.before.numClusters, 2);
+    EXPECT_EQ(conv.after.numClusters, 4);
+
+    const auto& spill = findLayer(comparison, "conv1", TaskInfo::ExecType::DMA);
+    EXPECT_EQ(spill.getStatus(), CompareStatus::REMOVED);
+    EXPECT_EQ(spill.getDeltaNs(), -20);
+
+    const auto& relu = findLayer(comparison, "relu1", TaskInfo::ExecType::SW);
+    EXPECT_EQ(relu.getStatus(), CompareStatus::UNCHANGED);
+    EXPECT_EQ(relu.getDeltaNs(), -10);
+
+    const auto& pool = findLayer(comparison, "pool1", TaskInfo::ExecType::DPU);
+    EXPECT_EQ(pool.getStatus(), CompareStatus::ADDED);
+    EXPECT_EQ(pool.getDeltaNs(), 20);
+
+    // Sorted by the absolute delta by default
+    EXPECT_EQ(comparison.layers.front().getDeltaNs(), -20);
+    EXPECT_EQ(comparison.layers.back().getDeltaNs(), -10);
+}
+
+TEST(ProfilingCompareTests, ScheduleAndEngineDeltas) {
+    const auto comparison = compareProfiling(getBeforeTasks(), getAfterTasks());
+
+    EXPECT_EQ(comparison.before.latencyNs, 180);
+    EXPECT_EQ(comparison.before.idleNs, 10);
+    EXPECT_EQ(comparison.after.latencyNs, 170);
+    EXPECT_EQ(comparison.after.idleNs, 0);
+
+    const std::vector<std::string> beforePath = {"conv1", "relu1"};
+    EXPECT_EQ(comparison.before.criticalPathLayers, beforePath);
+    EXPECT_EQ(comparison.before.criticalPathNs, 170);
+    const std::vector<std::string> afterPath = {"conv1", "relu1", "pool1"};
+    EXPECT_EQ(comparison.after.criticalPathLayers, afterPath);
+    EXPECT_EQ(comparison.after.criticalPathNs, 170);
+
+    ASSERT_EQ(comparison.engines.size(), 3);
+    for (const auto& engine : comparison.engines) {
+        if (engine.execType == TaskInfo::ExecType::DMA) {
+            EXPECT_EQ(engine.before.busyNs, 20);
+            EXPECT_EQ(engine.before.idleNs, 160);
+            EXPECT_EQ(engine.after.numTasks, 0);
+        } else if (engine.execType == TaskInfo::ExecType::DPU) {
+            EXPECT_EQ(engine.before.busyNs, 100);
+            EXPECT_EQ(engine.after.busyNs, 130);
+            EXPECT_EQ(engine.after.idleNs, 40);
+        }
+    }
+}
+
+TEST(ProfilingCompareTests, SortAndPrint) {
+    auto comparison = compareProfiling(getBeforeTasks(), getAfterTasks());
+
+    sortLayerDiffs(comparison.layers, parseCompareSortKey("name"));
+    EXPECT_EQ(comparison.layers.front().layerName, "conv1");
+    EXPECT_EQ(comparison.layers.back().layerName, "relu1");
+
+    sortLayerDiffs(comparison.layers, parseCompareSortKey("after"));
+    EXPECT_EQ(comparison.layers.front().after.durationNs, 110);
+
+    EXPECT_ANY_THROW(parseCompareSortKey("unknown"));
+
+    std::stringstream text;
+    printComparisonAsText(comparison, text);
+    EXPECT_NE(text.str().find("Joined critical path: pool1"), std::string::npos);
+
+    std::stringstream json;
+    printComparisonAsJson(comparison, json);
+    EXPECT_NE(json.str().find("\"name\": \"pool1\", \"type\": \"MaxPool\", \"exec\": \"DPU\", \"status\": \"added\""),
+              std::string::npos);
+}
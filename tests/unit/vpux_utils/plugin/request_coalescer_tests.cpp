@@ -0,0 +1,210 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include <gtest/gtest.h>
+#include <vpux/utils/plugin/request_coalescer.hpp>
+
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace vpux;
+using namespace std::chrono_literals;
+
+namespace {
+
+// Records the groups run by the coalescer, the runner may be held to keep the batch running
+class GroupRecorder {
+public:
+    RequestCoalescer<int>::BatchRunner batchRunner() {
+        return [this](const std::vector<int>& requests) {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _batches.push_back(requests);
+            }
+            if (_releasedFuture.valid()) {
+                _releasedFuture.wait();
+            }
+            return true;
+        };
+    }
+
+    void hold() {
+        _released = std::promise<void>();
+        _releasedFuture = _released.get_future().share();
+    }
+
+    void release() {
+        _released.set_value();
+    }
+
+    std::vector<std::vector<int>> batches() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _batches;
+    }
+
+    void waitForBatches(size_t count) {
+        while (batches().size() < count) {
+            std::this_thread::yield();
+        }
+    }
+
+private:
+    std::mutex _mutex;
+    std::vector<std::vector<int>> _batches;
+    std::promise<void> _released;
+    std::shared_future<void> _releasedFuture;
+};
+
+}  // namespace
+
+TEST(RequestCoalescerTests, FullGroupIsRunWithoutWaitingForWindow) {
+    GroupRecorder recorder;
+    RequestCoalescer<int> coalescer(3, 1h, recorder.batchRunner());
+
+    std::vector<std::future<bool>> futures;
+    for (int i = 0; i < 3; ++i) {
+        futures.push_back(coalescer.submit(i));
+    }
+    for (auto& future : futures) {
+        EXPECT_TRUE(future.get());
+    }
+
+    const std::vector<std::vector<int>> expected = {{0, 1, 2}};
+    EXPECT_EQ(recorder.batches(), expected);
+
+    const auto stats = coalescer.getStats();
+    EXPECT_EQ(stats.batches, 1);
+    EXPECT_EQ(stats.batchedRequests, 3);
+    EXPECT_EQ(stats.singleRequests, 0);
+}
+
+TEST(RequestCoalescerTests, LoneRequestIsReturnedToCaller) {
+    GroupRecorder recorder;
+    RequestCoalescer<int> coalescer(4, 1ms, recorder.batchRunner());
+
+    EXPECT_FALSE(coalescer.submit(7).get());
+    EXPECT_TRUE(recorder.batches().empty());
+
+    const auto stats = coalescer.getStats();
+    EXPECT_EQ(stats.singleRequests, 1);
+    EXPECT_EQ(stats.batches, 0);
+    EXPECT_GE(stats.addedLatencyMaxUs, 1000);
+    EXPECT_EQ(stats.addedLatencyTotalUs, stats.addedLatencyMaxUs);
+}
+
+TEST(RequestCoalescerTests, LoneRequestDoesNotWaitForRunningBatch) {
+    GroupRecorder recorder;
+    RequestCoalescer<int> coalescer(2, 100ms, recorder.batchRunner());
+
+    recorder.hold();
+    auto first = coalescer.submit(0);
+    auto second = coalescer.submit(1);
+    recorder.waitForBatches(1);
+
+    // Returned to the caller while the batch is still held
+    EXPECT_FALSE(coalescer.submit(2).get());
+
+    recorder.release();
+    EXPECT_TRUE(first.get());
+    EXPECT_TRUE(second.get());
+
+    const auto stats = coalescer.getStats();
+    EXPECT_EQ(stats.batches, 1);
+    EXPECT_EQ(stats.batchedRequests, 2);
+    EXPECT_EQ(stats.singleRequests, 1);
+}
+
+TEST(RequestCoalescerTests, RequestsSubmittedDuringBatchAreGrouped) {
+    GroupRecorder recorder;
+    RequestCoalescer<int> coalescer(3, 1h, recorder.batchRunner());
+
+    recorder.hold();
+    std::vector<std::future<bool>> futures;
+    for (int i = 0; i < 3; ++i) {
+        futures.push_back(coalescer.submit(i));
+    }
+    recorder.waitForBatches(1);
+
+    // The next group is not run before the previous one is over
+    for (int i = 3; i < 6; ++i) {
+        futures.push_back(coalescer.submit(i));
+    }
+    recorder.release();
+    for (auto& future : futures) {
+        EXPECT_TRUE(future.get());
+    }
+
+    const std::vector<std::vector<int>> expected = {{0, 1, 2}, {3, 4, 5}};
+    EXPECT_EQ(recorder.batches(), expected);
+}
+
+TEST(RequestCoalescerTests, DeclinedGroupIsReturnedToCallers) {
+    const auto decliningRunner = [](const std::vector<int>&) {
+        return false;
+    };
+    RequestCoalescer<int> coalescer(2, 1h, decliningRunner);
+
+    auto first = coalescer.submit(0);
+    auto second = coalescer.submit(1);
+    EXPECT_FALSE(first.get());
+    EXPECT_FALSE(second.get());
+
+    const auto stats = coalescer.getStats();
+    EXPECT_EQ(stats.batches, 0);
+    EXPECT_EQ(stats.singleRequests, 2);
+}
+
+TEST(RequestCoalescerTests, RunnerErrorIsForwardedToAllRequestsOfGroup) {
+    const auto failingRunner = [](const std::vector<int>&) -> bool {
+        throw std::runtime_error("device lost");
+    };
+    RequestCoalescer<int> coalescer(2, 1h, failingRunner);
+
+    auto first = coalescer.submit(0);
+    auto second = coalescer.submit(1);
+    EXPECT_THROW(first.get(), std::runtime_error);
+    EXPECT_THROW(second.get(), std::runtime_error);
+}
+
+TEST(RequestCoalescerTests, PendingRequestsAreDispatchedOnDestruction) {
+    GroupRecorder recorder;
+    std::future<bool> future;
+    {
+        RequestCoalescer<int> coalescer(2, 1h, recorder.batchRunner());
+        future = coalescer.submit(0);
+    }
+
+    EXPECT_FALSE(future.get());
+    EXPECT_TRUE(recorder.batches().empty());
+}
+
+TEST(RequestCoalescerTests, CompletionDoesNotBlockCallers) {
+    GroupRecorder recorder;
+    recorder.hold();
+    RequestCoalescer<int> coalescer(2, 1h, recorder.batchRunner());
+
+    std::vector<std::promise<std::thread::id>> completedBy(2);
+    std::vector<std::future<std::thread::id>> completions;
+    for (auto& promise : completedBy) {
+        completions.push_back(promise.get_future());
+    }
+    for (int i = 0; i < 2; ++i) {
+        coalescer.submit(i, [&completedBy, i](bool isBatched, std::exception_ptr error) {
+            EXPECT_TRUE(isBatched);
+            EXPECT_EQ(error, nullptr);
+            completedBy[i].set_value(std::this_thread::get_id());
+        });
+    }
+
+    // The batch is still running, the callers have already returned
+    recorder.waitForBatches(1);
+    recorder.release();
+    for (auto& completion : completions) {
+        EXPECT_NE(completion.get(), std::this_thread::get_id());
+    }
+}
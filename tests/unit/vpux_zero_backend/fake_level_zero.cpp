@@ -0,0 +1,479 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "fake_level_zero.hpp"
+
+#include <ze_intel_vpu_uuid.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+
+using vpux::FakeLevelZero;
+
+//
+// Handles
+//
+
+struct _ze_driver_handle_t final {};
+
+struct _ze_device_handle_t final {
+    size_t index = 0;
+};
+
+struct _ze_context_handle_t final {};
+
+struct _ze_command_queue_handle_t final {
+    size_t device = 0;
+    ze_command_queue_priority_t priority = ZE_COMMAND_QUEUE_PRIORITY_NORMAL;
+};
+
+// Submissions may be done by the thread of another request, see InferenceScheduler
+struct _ze_fence_handle_t final {
+    std::atomic<bool> signaled{false};
+};
+
+struct _ze_event_pool_handle_t final {};
+
+struct _ze_event_handle_t final {
+    std::atomic<bool> signaled{false};
+};
+
+struct _ze_graph_handle_t final {
+    std::string blob;
+    const FakeLevelZero::Graph* graph = nullptr;
+    std::vector<void*> buffers;
+};
+
+struct _ze_command_list_handle_t final {
+    // Commands are run on the host when the command list is submitted
+    std::vector<std::function<void(FakeLevelZero::Submission&)>> commands;
+};
+
+namespace {
+
+_ze_driver_handle_t driver;
+_ze_context_handle_t context;
+std::vector<std::unique_ptr<_ze_device_handle_t>> deviceHandles;
+
+const FakeLevelZero::Device& getDevice(ze_device_handle_t device) {
+    return FakeLevelZero::instance().devices().at(device->index);
+}
+
+//
+// Graph extension
+//
+
+ze_result_t ZE_APICALL graphCreate(ze_context_handle_t, ze_device_handle_t, const ze_graph_desc_t* desc,
+                                   ze_graph_handle_t* graph) {
+    auto handle = new _ze_graph_handle_t;
+    handle->blob.assign(reinterpret_cast<const char*>(desc->pInput), desc->inputSize);
+    handle->graph = &FakeLevelZero::instance().getGraph(handle->blob);
+    handle->buffers.resize(handle->graph->arguments.size(), nullptr);
+    *graph = handle;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL graphDestroy(ze_graph_handle_t graph) {
+    delete graph;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL graphGetProperties(ze_graph_handle_t graph, ze_graph_properties_t* properties) {
+    properties->numGraphArgs = static_cast<uint32_t>(graph->graph->arguments.size());
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL graphGetArgumentProperties(ze_graph_handle_t graph, uint32_t index,
+                                                  ze_graph_argument_properties_t* properties) {
+    const auto& argument = graph->graph->arguments.at(index);
+
+    *properties = {};
+    std::strncpy(properties->name, argument.name.c_str(), sizeof(properties->name) - 1);
+    properties->type = argument.isInput ? ZE_GRAPH_ARGUMENT_TYPE_INPUT : ZE_GRAPH_ARGUMENT_TYPE_OUTPUT;
+    properties->dims[0] = 1;
+    properties->dims[1] = argument.size;
+    properties->networkPrecision = ZE_GRAPH_ARGUMENT_PRECISION_FP32;
+    properties->networkLayout = ZE_GRAPH_ARGUMENT_LAYOUT_NC;
+    properties->devicePrecision = ZE_GRAPH_ARGUMENT_PRECISION_FP32;
+    properties->deviceLayout = ZE_GRAPH_ARGUMENT_LAYOUT_NC;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL graphSetArgumentValue(ze_graph_handle_t graph, uint32_t index, const void* value) {
+    graph->buffers.at(index) = const_cast<void*>(value);
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL appendGraphInitialize(ze_command_list_handle_t, ze_graph_handle_t, ze_event_handle_t,
+                                             uint32_t, ze_event_handle_t*) {
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL appendGraphExecute(ze_command_list_handle_t command_list, ze_graph_handle_t graph,
+                                          ze_graph_profiling_query_handle_t, ze_event_handle_t, uint32_t,
+                                          ze_event_handle_t*) {
+    // Argument values are captured when the execution is appended, as the driver does
+    const auto buffers = graph->buffers;
+    const auto* desc = graph->graph;
+    const auto blob = graph->blob;
+    command_list->commands.push_back([buffers, desc, blob](FakeLevelZero::Submission& submission) {
+        desc->kernel(buffers);
+        submission.graphs.push_back(blob);
+    });
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL profilingPoolCreate(ze_graph_handle_t, uint32_t, ze_graph_profiling_pool_handle_t*) {
+    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ze_graph_dditable_ext_t makeGraphTable() {
+    ze_graph_dditable_ext_t table = {};
+    table.pfnCreate = graphCreate;
+    table.pfnDestroy = graphDestroy;
+    table.pfnGetProperties = graphGetProperties;
+    table.pfnGetArgumentProperties = graphGetArgumentProperties;
+    table.pfnSetArgumentValue = graphSetArgumentValue;
+    table.pfnAppendGraphInitialize = appendGraphInitialize;
+    table.pfnAppendGraphExecute = appendGraphExecute;
+    return table;
+}
+
+ze_graph_profiling_dditable_ext_t makeProfilingTable() {
+    ze_graph_profiling_dditable_ext_t table = {};
+    table.pfnProfilingPoolCreate = profilingPoolCreate;
+    return table;
+}
+
+ze_graph_dditable_ext_t graphTable = makeGraphTable();
+ze_graph_profiling_dditable_ext_t profilingTable = makeProfilingTable();
+
+}  // namespace
+
+//
+// FakeLevelZero
+//
+
+namespace vpux {
+
+FakeLevelZero& FakeLevelZero::instance() {
+    static FakeLevelZero fake;
+    return fake;
+}
+
+void FakeLevelZero::reset(const std::vector<Device>& devices) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_commandQueueCount != 0) {
+        throw std::logic_error("Command queues of the previous test are still alive");
+    }
+
+    _devices = devices;
+    _graphs.clear();
+    _submissions.clear();
+
+    deviceHandles.clear();
+    for (size_t index = 0; index < devices.size(); ++index) {
+        deviceHandles.push_back(std::make_unique<_ze_device_handle_t>());
+        deviceHandles.back()->index = index;
+    }
+}
+
+void FakeLevelZero::registerGraph(const std::string& blob, const std::vector<Argument>& arguments,
+                                  const Kernel& kernel) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _graphs[blob] = Graph{arguments, kernel};
+}
+
+const FakeLevelZero::Graph& FakeLevelZero::getGraph(const std::string& blob) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _graphs.at(blob);
+}
+
+std::vector<FakeLevelZero::Submission> FakeLevelZero::getSubmissions() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _submissions;
+}
+
+std::vector<FakeLevelZero::Submission> FakeLevelZero::getGraphSubmissions() const {
+    std::vector<Submission> result;
+    for (const auto& submission : getSubmissions()) {
+        if (!submission.graphs.empty()) {
+            result.push_back(submission);
+        }
+    }
+    return result;
+}
+
+size_t FakeLevelZero::getCommandQueueCount() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _commandQueueCount;
+}
+
+void FakeLevelZero::record(const Submission& submission) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _submissions.push_back(submission);
+}
+
+void FakeLevelZero::onCommandQueueCreated() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    ++_commandQueueCount;
+}
+
+void FakeLevelZero::onCommandQueueDestroyed() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    --_commandQueueCount;
+}
+
+}  // namespace vpux
+
+//
+// Level Zero API
+//
+
+ze_result_t ZE_APICALL zeInit(ze_init_flags_t) {
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeDriverGet(uint32_t* count, ze_driver_handle_t* drivers) {
+    if (drivers != nullptr) {
+        drivers[0] = &driver;
+    }
+    *count = 1;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeDriverGetApiVersion(ze_driver_handle_t, ze_api_version_t* version) {
+    *version = ZE_API_VERSION_CURRENT;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeDriverGetProperties(ze_driver_handle_t, ze_driver_properties_t* properties) {
+    properties->uuid = ze_intel_vpu_driver_uuid;
+    properties->driverVersion = 1;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeDriverGetExtensionFunctionAddress(ze_driver_handle_t, const char* name, void** address) {
+    if (std::strcmp(name, "ZE_extension_graph") == 0) {
+        *address = &graphTable;
+        return ZE_RESULT_SUCCESS;
+    }
+    if (std::strcmp(name, "ZE_extension_profiling_data") == 0) {
+        *address = &profilingTable;
+        return ZE_RESULT_SUCCESS;
+    }
+    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ze_result_t ZE_APICALL zeDeviceGet(ze_driver_handle_t, uint32_t* count, ze_device_handle_t* devices) {
+    if (devices != nullptr) {
+        for (uint32_t index = 0; index < *count && index < deviceHandles.size(); ++index) {
+            devices[index] = deviceHandles[index].get();
+        }
+    }
+    *count = static_cast<uint32_t>(deviceHandles.size());
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeDeviceGetProperties(ze_device_handle_t device, ze_device_properties_t* properties) {
+    const auto& desc = getDevice(device);
+    properties->type = ZE_DEVICE_TYPE_VPU;
+    properties->deviceId = desc.deviceId;
+    properties->flags = desc.integrated ? ZE_DEVICE_PROPERTY_FLAG_INTEGRATED : 0;
+    std::memset(properties->uuid.id, 0, sizeof(properties->uuid.id));
+    properties->uuid.id[0] = static_cast<uint8_t>(device->index);
+    std::strncpy(properties->name, "Fake NPU", sizeof(properties->name) - 1);
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeDeviceGetMemoryProperties(ze_device_handle_t, uint32_t* count,
+                                                   ze_device_memory_properties_t* properties) {
+    if (properties != nullptr) {
+        properties[0].totalSize = 1ull << 30;
+        std::strncpy(properties[0].name, "DDR", sizeof(properties[0].name) - 1);
+    }
+    *count = 1;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeDeviceGetCommandQueueGroupProperties(ze_device_handle_t, uint32_t* count,
+                                                              ze_command_queue_group_properties_t* properties) {
+    if (properties != nullptr) {
+        properties[0].flags = ZE_COMMAND_QUEUE_GROUP_PROPERTY_FLAG_COMPUTE | ZE_COMMAND_QUEUE_GROUP_PROPERTY_FLAG_COPY;
+        properties[0].numQueues = 1;
+    }
+    *count = 1;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeContextCreate(ze_driver_handle_t, const ze_context_desc_t*, ze_context_handle_t* handle) {
+    *handle = &context;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeContextDestroy(ze_context_handle_t) {
+    return ZE_RESULT_SUCCESS;
+}
+
+// Device memory of the fake device is host memory as well
+ze_result_t ZE_APICALL zeMemAllocHost(ze_context_handle_t, const ze_host_mem_alloc_desc_t*, size_t size, size_t,
+                                      void** ptr) {
+    *ptr = std::calloc(size, 1);
+    return *ptr != nullptr ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+}
+
+ze_result_t ZE_APICALL zeMemAllocDevice(ze_context_handle_t, const ze_device_mem_alloc_desc_t*, size_t size, size_t,
+                                        ze_device_handle_t, void** ptr) {
+    *ptr = std::calloc(size, 1);
+    return *ptr != nullptr ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
+}
+
+ze_result_t ZE_APICALL zeMemFree(ze_context_handle_t, void* ptr) {
+    std::free(ptr);
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeCommandQueueCreate(ze_context_handle_t, ze_device_handle_t device,
+                                            const ze_command_queue_desc_t* desc, ze_command_queue_handle_t* queue) {
+    auto handle = new _ze_command_queue_handle_t;
+    handle->device = device->index;
+    handle->priority = desc->priority;
+    *queue = handle;
+    FakeLevelZero::instance().onCommandQueueCreated();
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeCommandQueueDestroy(ze_command_queue_handle_t queue) {
+    delete queue;
+    FakeLevelZero::instance().onCommandQueueDestroyed();
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeCommandQueueExecuteCommandLists(ze_command_queue_handle_t queue, uint32_t count,
+                                                         ze_command_list_handle_t* command_lists,
+                                                         ze_fence_handle_t fence) {
+    FakeLevelZero::Submission submission;
+    submission.device = queue->device;
+    submission.queue = queue;
+    submission.priority = queue->priority;
+    for (uint32_t index = 0; index < count; ++index) {
+        for (const auto& command : command_lists[index]->commands) {
+            command(submission);
+        }
+    }
+    FakeLevelZero::instance().record(submission);
+
+    if (fence != nullptr) {
+        fence->signaled = true;
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeCommandListCreate(ze_context_handle_t, ze_device_handle_t, const ze_command_list_desc_t*,
+                                           ze_command_list_handle_t* command_list) {
+    *command_list = new _ze_command_list_handle_t;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeCommandListDestroy(ze_command_list_handle_t command_list) {
+    delete command_list;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeCommandListReset(ze_command_list_handle_t command_list) {
+    command_list->commands.clear();
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeCommandListClose(ze_command_list_handle_t) {
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeCommandListAppendMemoryCopy(ze_command_list_handle_t command_list, void* dst,
+                                                     const void* src, size_t size, ze_event_handle_t, uint32_t,
+                                                     ze_event_handle_t*) {
+    command_list->commands.push_back([dst, src, size](FakeLevelZero::Submission& submission) {
+        std::memcpy(dst, src, size);
+        submission.copies.push_back(FakeLevelZero::Copy{dst, src, size});
+    });
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeCommandListAppendBarrier(ze_command_list_handle_t, ze_event_handle_t, uint32_t,
+                                                  ze_event_handle_t*) {
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeCommandListAppendSignalEvent(ze_command_list_handle_t command_list,
+                                                      ze_event_handle_t event) {
+    command_list->commands.push_back([event](FakeLevelZero::Submission&) {
+        event->signaled = true;
+    });
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeCommandListAppendWaitOnEvents(ze_command_list_handle_t, uint32_t, ze_event_handle_t*) {
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeCommandListAppendEventReset(ze_command_list_handle_t command_list, ze_event_handle_t event) {
+    command_list->commands.push_back([event](FakeLevelZero::Submission&) {
+        event->signaled = false;
+    });
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeEventPoolCreate(ze_context_handle_t, const ze_event_pool_desc_t*, uint32_t,
+                                         ze_device_handle_t*, ze_event_pool_handle_t* event_pool) {
+    *event_pool = new _ze_event_pool_handle_t;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeEventPoolDestroy(ze_event_pool_handle_t event_pool) {
+    delete event_pool;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeEventCreate(ze_event_pool_handle_t, const ze_event_desc_t*, ze_event_handle_t* event) {
+    *event = new _ze_event_handle_t;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeEventDestroy(ze_event_handle_t event) {
+    delete event;
+    return ZE_RESULT_SUCCESS;
+}
+
+// Command lists are run at submission, so the event which is not signaled by then would never be
+ze_result_t ZE_APICALL zeEventHostSynchronize(ze_event_handle_t event, uint64_t) {
+    return event->signaled ? ZE_RESULT_SUCCESS : ZE_RESULT_NOT_READY;
+}
+
+ze_result_t ZE_APICALL zeEventHostReset(ze_event_handle_t event) {
+    event->signaled = false;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeFenceCreate(ze_command_queue_handle_t, const ze_fence_desc_t*, ze_fence_handle_t* fence) {
+    *fence = new _ze_fence_handle_t;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeFenceDestroy(ze_fence_handle_t fence) {
+    delete fence;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeFenceReset(ze_fence_handle_t fence) {
+    fence->signaled = false;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeFenceHostSynchronize(ze_fence_handle_t fence, uint64_t) {
+    return fence->signaled ? ZE_RESULT_SUCCESS : ZE_RESULT_NOT_READY;
+}
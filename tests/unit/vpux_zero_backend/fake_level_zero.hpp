@@ -0,0 +1,93 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include <ze_api.h>
+#include <ze_graph_ext.h>
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace vpux {
+
+/**
+ * @brief Level Zero driver replacing the loader in the unit tests
+ * @details The fake implements the part of the Level Zero API used by the backend. Command lists are run on the host
+ * as soon as they are submitted: memory copies are done with memcpy and graph executions call the kernel registered
+ * for the graph blob. Each submission is recorded, so the tests can check which queue got which work and in which
+ * order.
+ */
+class FakeLevelZero final {
+public:
+    struct Device final {
+        uint32_t deviceId = 0x7D1D;  // 3720
+        bool integrated = true;
+    };
+
+    struct Argument final {
+        std::string name;
+        bool isInput = true;
+        uint32_t size = 0;  // FP32 elements
+    };
+
+    // Gets the buffers bound to the graph arguments, in the order of the arguments
+    using Kernel = std::function<void(const std::vector<void*>& buffers)>;
+
+    struct Copy final {
+        void* dst = nullptr;
+        const void* src = nullptr;
+        size_t size = 0;
+    };
+
+    struct Submission final {
+        size_t device = 0;
+        const void* queue = nullptr;
+        ze_command_queue_priority_t priority = ZE_COMMAND_QUEUE_PRIORITY_NORMAL;
+        std::vector<std::string> graphs;  // blobs of the executed graphs
+        std::vector<Copy> copies;
+    };
+
+public:
+    static FakeLevelZero& instance();
+
+    // All the objects created by the backend must be destroyed before the reset
+    void reset(const std::vector<Device>& devices);
+    void registerGraph(const std::string& blob, const std::vector<Argument>& arguments, const Kernel& kernel);
+
+    std::vector<Submission> getSubmissions() const;
+    // Submissions which executed at least one graph, in the order of submission
+    std::vector<Submission> getGraphSubmissions() const;
+    size_t getCommandQueueCount() const;
+
+public:
+    struct Graph final {
+        std::vector<Argument> arguments;
+        Kernel kernel;
+    };
+
+    const std::vector<Device>& devices() const {
+        return _devices;
+    }
+    const Graph& getGraph(const std::string& blob) const;
+    void record(const Submission& submission);
+    void onCommandQueueCreated();
+    void onCommandQueueDestroyed();
+
+private:
+    FakeLevelZero() = default;
+
+    mutable std::mutex _mutex;
+    std::vector<Device> _devices;
+    std::map<std::string, Graph> _graphs;
+    std::vector<Submission> _submissions;
+    size_t _commandQueueCount = 0;
+};
+
+}  // namespace vpux
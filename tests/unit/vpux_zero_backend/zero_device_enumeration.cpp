@@ -0,0 +1,97 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "zero_backend.h"
+#include "zero_test_utils.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace vpux;
+using namespace vpux::zeroTests;
+
+namespace {
+
+constexpr uint32_t VPU_3700_DEVICE_ID = 0x6240;
+constexpr uint32_t VPU_3720_DEVICE_ID = 0x7D1D;
+
+const std::vector<FakeLevelZero::Argument> echoArguments = {{"input", true, NUM_ELEMENTS},
+                                                            {"output", false, NUM_ELEMENTS}};
+
+// Two 3720 devices and one 3700 device exposed by the same driver
+class ZeroDeviceEnumerationUnitTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        FakeLevelZero::instance().reset({FakeLevelZero::Device{VPU_3720_DEVICE_ID, true},
+                                         FakeLevelZero::Device{VPU_3720_DEVICE_ID, true},
+                                         FakeLevelZero::Device{VPU_3700_DEVICE_ID, false}});
+        FakeLevelZero::instance().registerGraph("echo", echoArguments, [](const std::vector<void*>& buffers) {
+            std::copy_n(static_cast<const float*>(buffers[0]), NUM_ELEMENTS, static_cast<float*>(buffers[1]));
+        });
+
+        backend = std::make_unique<ZeroEngineBackend>(config);
+    }
+
+    void TearDown() override {
+        backend.reset();
+    }
+
+    // Runs one inference of the echo network on the device
+    void inferOn(const std::shared_ptr<IDevice>& device) {
+        const FakeNetwork network("echo", echoArguments);
+        const auto executor = network.createExecutor(*device, config);
+        const auto request = network.createInferRequest(*device, executor, config);
+
+        fillBlob(request->GetBlob("input"), 1.f);
+        request->InferImpl();
+        EXPECT_EQ(readBlob(request->GetBlob("output")), 1.f);
+    }
+
+    Config config = createConfig();
+    std::unique_ptr<ZeroEngineBackend> backend;
+};
+
+}  // namespace
+
+TEST_F(ZeroDeviceEnumerationUnitTests, allDevicesAreExposedUnderDistinctNames) {
+    const std::vector<std::string> expected = {"3700.0", "3720.0", "3720.1"};
+    EXPECT_EQ(backend->getDeviceNames(), expected);
+
+    for (const auto& name : expected) {
+        const auto device = backend->getDevice(name);
+        ASSERT_NE(device, nullptr) << name;
+        EXPECT_EQ(device->getName(), name);
+    }
+    EXPECT_NE(backend->getDevice("3720.0")->getUuid().uuid, backend->getDevice("3720.1")->getUuid().uuid);
+}
+
+TEST_F(ZeroDeviceEnumerationUnitTests, absentDeviceIsNotResolved) {
+    EXPECT_EQ(backend->getDevice("3720.2"), nullptr);
+    EXPECT_EQ(backend->getDevice("3720")->getName(), "3700.0");
+}
+
+TEST_F(ZeroDeviceEnumerationUnitTests, inferencesRunOnTheirDevice) {
+    inferOn(backend->getDevice("3720.1"));
+    inferOn(backend->getDevice("3700.0"));
+    inferOn(backend->getDevice("3720.0"));
+
+    // Indices of the devices in the order the driver exposes them
+    const auto submissions = FakeLevelZero::instance().getGraphSubmissions();
+    ASSERT_EQ(submissions.size(), 3u);
+    EXPECT_EQ(submissions[0].device, 1u);
+    EXPECT_EQ(submissions[1].device, 2u);
+    EXPECT_EQ(submissions[2].device, 0u);
+}
+
+TEST_F(ZeroDeviceEnumerationUnitTests, devicesAreScheduledIndependently) {
+    inferOn(backend->getDevice("3720.1"));
+
+    EXPECT_EQ(backend->getDevice("3720.1")->getQueueingDelays().at(ov::hint::Priority::MEDIUM).count, 1u);
+    EXPECT_EQ(backend->getDevice("3720.0")->getQueueingDelays().at(ov::hint::Priority::MEDIUM).count, 0u);
+}
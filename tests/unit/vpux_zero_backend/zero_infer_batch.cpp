@@ -0,0 +1,113 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "vpux_private_properties.hpp"
+#include "zero_backend.h"
+#include "zero_test_utils.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace vpux;
+using namespace vpux::zeroTests;
+
+namespace {
+
+constexpr size_t NUM_REQUESTS = 3;
+
+const std::vector<FakeLevelZero::Argument> scaleArguments = {{"input", true, NUM_ELEMENTS},
+                                                             {"output", false, NUM_ELEMENTS}};
+
+// output = 2 * input, on an integrated or discrete device, the parameter is the in-flight limit of the network
+class ZeroInferBatchUnitTests : public ::testing::TestWithParam<std::tuple<bool, int64_t>> {
+protected:
+    void SetUp() override {
+        FakeLevelZero::instance().reset({FakeLevelZero::Device{0x7D1D, std::get<0>(GetParam())}});
+        FakeLevelZero::instance().registerGraph("scale", scaleArguments, [](const std::vector<void*>& buffers) {
+            const auto input = static_cast<const float*>(buffers[0]);
+            const auto output = static_cast<float*>(buffers[1]);
+            std::transform(input, input + NUM_ELEMENTS, output, [](float value) {
+                return 2.f * value;
+            });
+        });
+
+        _config = createConfig(
+                {{ov::intel_vpux::max_inflight_inferences.name(), std::to_string(std::get<1>(GetParam()))}});
+        _backend = std::make_unique<ZeroEngineBackend>(_config);
+        const FakeNetwork network("scale", scaleArguments);
+        _executor = network.createExecutor(*_backend->getDevice(), _config);
+        for (size_t i = 0; i < NUM_REQUESTS; ++i) {
+            requests.push_back(network.createInferRequest(*_backend->getDevice(), _executor, _config));
+        }
+    }
+
+    void TearDown() override {
+        requests.clear();
+        _executor.reset();
+        _backend.reset();
+    }
+
+    bool isIntegrated() const {
+        return std::get<0>(GetParam());
+    }
+
+    // Runs the batch with the i-th request input equal to `first + i`
+    void inferBatch(float first) {
+        for (size_t i = 0; i < requests.size(); ++i) {
+            fillBlob(requests[i]->GetBlob("input"), first + static_cast<float>(i));
+        }
+        const std::vector<IInferRequest::Ptr> others(requests.begin() + 1, requests.end());
+        requests.front()->InferBatch(others);
+        for (size_t i = 0; i < requests.size(); ++i) {
+            EXPECT_EQ(readBlob(requests[i]->GetBlob("output")), 2.f * (first + static_cast<float>(i))) << i;
+        }
+    }
+
+    std::vector<IInferRequest::Ptr> requests;
+
+private:
+    Config _config = createConfig();
+    std::unique_ptr<ZeroEngineBackend> _backend;
+    Executor::Ptr _executor;
+};
+
+}  // namespace
+
+TEST_P(ZeroInferBatchUnitTests, batchResultsMatchIndividualInferences) {
+    inferBatch(1.f);
+
+    // Integrated devices record the whole batch into one command list, discrete ones run the requests one by one
+    const auto submissions = FakeLevelZero::instance().getGraphSubmissions();
+    if (isIntegrated()) {
+        ASSERT_EQ(submissions.size(), 1u);
+        EXPECT_EQ(submissions[0].graphs, std::vector<std::string>(NUM_REQUESTS, "scale"));
+    } else {
+        ASSERT_EQ(submissions.size(), NUM_REQUESTS);
+    }
+
+    // The cached command list of the batch takes the new inputs
+    inferBatch(10.f);
+    EXPECT_EQ(FakeLevelZero::instance().getGraphSubmissions().size(), isIntegrated() ? 2u : 2 * NUM_REQUESTS);
+}
+
+TEST_P(ZeroInferBatchUnitTests, requestsStayUsableAfterBatch) {
+    inferBatch(1.f);
+
+    fillBlob(requests[1]->GetBlob("input"), 5.f);
+    requests[1]->InferImpl();
+    EXPECT_EQ(readBlob(requests[1]->GetBlob("output")), 10.f);
+}
+
+INSTANTIATE_TEST_SUITE_P(DevicesAndLimits, ZeroInferBatchUnitTests,
+                         ::testing::Combine(::testing::Bool(), ::testing::Values(int64_t{0}, int64_t{1})),
+                         [](const ::testing::TestParamInfo<std::tuple<bool, int64_t>>& info) {
+                             return std::string(std::get<0>(info.param) ? "Integrated" : "Discrete") + "_Limit" +
+                                    std::to_string(std::get<1>(info.param));
+                         });
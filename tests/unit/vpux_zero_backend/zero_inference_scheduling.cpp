@@ -0,0 +1,170 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ie_plugin_config.hpp>
+
+#include "vpux_private_properties.hpp"
+#include "zero_backend.h"
+#include "zero_test_utils.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace vpux;
+using namespace vpux::zeroTests;
+
+namespace {
+
+const std::vector<FakeLevelZero::Argument> echoArguments = {{"input", true, NUM_ELEMENTS},
+                                                            {"output", false, NUM_ELEMENTS}};
+
+// Networks of the given priorities loaded to the same integrated device, all of them run the echo graph
+class ZeroInferenceSchedulingUnitTests : public ::testing::Test {
+protected:
+    struct LoadedNetwork final {
+        FakeNetwork network;
+        Config config;
+        Executor::Ptr executor;
+    };
+
+    void SetUp() override {
+        FakeLevelZero::instance().reset({FakeLevelZero::Device{}});
+        for (const auto& blob : {"low", "medium", "high"}) {
+            FakeLevelZero::instance().registerGraph(blob, echoArguments, [](const std::vector<void*>& buffers) {
+                std::copy_n(static_cast<const float*>(buffers[0]), NUM_ELEMENTS, static_cast<float*>(buffers[1]));
+            });
+        }
+
+        _backend = std::make_unique<ZeroEngineBackend>(createConfig());
+    }
+
+    void TearDown() override {
+        _backend.reset();
+    }
+
+    // The blob of the network is named after its priority
+    LoadedNetwork load(const std::string& blob, const std::string& priority, int64_t maxInFlight = 0) {
+        auto config = createConfig({{ov::hint::model_priority.name(), priority},
+                                    {ov::intel_vpux::max_inflight_inferences.name(), std::to_string(maxInFlight)}});
+        FakeNetwork network(blob, echoArguments);
+        auto executor = network.createExecutor(*_backend->getDevice(), config);
+        return LoadedNetwork{std::move(network), std::move(config), std::move(executor)};
+    }
+
+    IInferRequest::Ptr createInferRequest(const LoadedNetwork& loaded) {
+        return loaded.network.createInferRequest(*_backend->getDevice(), loaded.executor, loaded.config);
+    }
+
+    static std::vector<std::string> getSubmittedGraphs() {
+        std::vector<std::string> graphs;
+        for (const auto& submission : FakeLevelZero::instance().getGraphSubmissions()) {
+            graphs.insert(graphs.end(), submission.graphs.begin(), submission.graphs.end());
+        }
+        return graphs;
+    }
+
+private:
+    std::unique_ptr<ZeroEngineBackend> _backend;
+};
+
+}  // namespace
+
+TEST_F(ZeroInferenceSchedulingUnitTests, queuesAreSharedByNetworksOfTheSamePriority) {
+    auto first = load("medium", CONFIG_VALUE(MODEL_PRIORITY_MED));
+    auto second = load("medium", CONFIG_VALUE(MODEL_PRIORITY_MED));
+    auto firstRequest = createInferRequest(first);
+    auto secondRequest = createInferRequest(second);
+
+    // UPLOAD, EXECUTE and READBACK queues of the MEDIUM priority
+    EXPECT_EQ(FakeLevelZero::instance().getCommandQueueCount(), 3u);
+
+    auto high = load("high", CONFIG_VALUE(MODEL_PRIORITY_HIGH));
+    auto highRequest = createInferRequest(high);
+    EXPECT_EQ(FakeLevelZero::instance().getCommandQueueCount(), 6u);
+
+    for (const auto& request : {firstRequest, secondRequest, highRequest}) {
+        request->InferImpl();
+    }
+    const auto submissions = FakeLevelZero::instance().getGraphSubmissions();
+    ASSERT_EQ(submissions.size(), 3u);
+    EXPECT_EQ(submissions[0].queue, submissions[1].queue);
+    EXPECT_EQ(submissions[1].priority, ZE_COMMAND_QUEUE_PRIORITY_NORMAL);
+    EXPECT_NE(submissions[2].queue, submissions[0].queue);
+    EXPECT_EQ(submissions[2].priority, ZE_COMMAND_QUEUE_PRIORITY_PRIORITY_HIGH);
+
+    // Queues are released with the last network of their priority
+    highRequest.reset();
+    high.executor.reset();
+    EXPECT_EQ(FakeLevelZero::instance().getCommandQueueCount(), 3u);
+
+    firstRequest.reset();
+    first.executor.reset();
+    EXPECT_EQ(FakeLevelZero::instance().getCommandQueueCount(), 3u);
+
+    secondRequest.reset();
+    second.executor.reset();
+    EXPECT_EQ(FakeLevelZero::instance().getCommandQueueCount(), 0u);
+}
+
+TEST_F(ZeroInferenceSchedulingUnitTests, highPriorityOvertakesQueuedInference) {
+    const auto low = load("low", CONFIG_VALUE(MODEL_PRIORITY_LOW), 1);
+    const auto high = load("high", CONFIG_VALUE(MODEL_PRIORITY_HIGH), 1);
+    const auto lowA = createInferRequest(low);
+    const auto lowB = createInferRequest(low);
+    const auto highC = createInferRequest(high);
+
+    fillBlob(lowA->GetBlob("input"), 1.f);
+    fillBlob(lowB->GetBlob("input"), 2.f);
+    fillBlob(highC->GetBlob("input"), 3.f);
+
+    // The device is busy with A, the other inferences are queued without blocking the caller
+    lowA->InferAsync();
+    lowB->InferAsync();
+    highC->InferAsync();
+    EXPECT_EQ(getSubmittedGraphs(), std::vector<std::string>{"low"});
+
+    // Completion of A submits C, which was queued after B
+    lowA->GetResult();
+    const std::vector<std::string> afterA = {"low", "high"};
+    EXPECT_EQ(getSubmittedGraphs(), afterA);
+
+    highC->GetResult();
+    lowB->GetResult();
+    const std::vector<std::string> expected = {"low", "high", "low"};
+    EXPECT_EQ(getSubmittedGraphs(), expected);
+
+    EXPECT_EQ(readBlob(lowA->GetBlob("output")), 1.f);
+    EXPECT_EQ(readBlob(lowB->GetBlob("output")), 2.f);
+    EXPECT_EQ(readBlob(highC->GetBlob("output")), 3.f);
+}
+
+TEST_F(ZeroInferenceSchedulingUnitTests, limitIsRestoredWhenNetworkIsReleased) {
+    auto limiting = load("low", CONFIG_VALUE(MODEL_PRIORITY_LOW), 1);
+    const auto unlimited = load("medium", CONFIG_VALUE(MODEL_PRIORITY_MED));
+    const auto first = createInferRequest(unlimited);
+    const auto second = createInferRequest(unlimited);
+
+    first->InferAsync();
+    second->InferAsync();
+    EXPECT_EQ(getSubmittedGraphs().size(), 1u);
+
+    // The queued inference is submitted as soon as the network which set the limit is released
+    limiting.executor.reset();
+    EXPECT_EQ(getSubmittedGraphs().size(), 2u);
+
+    first->GetResult();
+    second->GetResult();
+
+    // Nothing limits the remaining network anymore
+    first->InferAsync();
+    second->InferAsync();
+    EXPECT_EQ(getSubmittedGraphs().size(), 4u);
+    first->GetResult();
+    second->GetResult();
+}
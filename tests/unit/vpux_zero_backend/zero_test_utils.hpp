@@ -0,0 +1,105 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include <ie_blob.h>
+#include <ie_input_info.hpp>
+
+#include "fake_level_zero.hpp"
+#include "fake_network_description.hpp"
+#include "vpux.hpp"
+#include "vpux/al/config/common.hpp"
+#include "vpux/al/config/runtime.hpp"
+#include "vpux/utils/IE/prefix.hpp"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace vpux {
+namespace zeroTests {
+
+constexpr uint32_t NUM_ELEMENTS = 4;
+
+inline const InferenceEngine::TensorDesc& dataDesc() {
+    static const InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, NUM_ELEMENTS},
+                                                  InferenceEngine::Layout::NC);
+    return desc;
+}
+
+inline Config createConfig(const std::map<std::string, std::string>& values = {}) {
+    auto options = std::make_shared<OptionsDesc>();
+    registerCommonOptions(*options);
+    registerRunTimeOptions(*options);
+
+    Config config(options);
+    config.update(values);
+    return config;
+}
+
+/**
+ * @brief Network loaded to the fake driver, the graph of the blob must be registered in FakeLevelZero
+ * @details All the graph arguments are FP32 tensors of NUM_ELEMENTS elements, the ones with the ReadValue and
+ * Assign prefixes are the variable states.
+ */
+class FakeNetwork final {
+public:
+    FakeNetwork(const std::string& blob, const std::vector<FakeLevelZero::Argument>& arguments) {
+        for (const auto& argument : arguments) {
+            const auto data = std::make_shared<InferenceEngine::Data>(argument.name, dataDesc());
+            if (argument.isInput) {
+                _deviceInputs.emplace_back(argument.name, data);
+                _networkInputs[argument.name] = std::make_shared<InferenceEngine::InputInfo>();
+                _networkInputs[argument.name]->setInputData(data);
+            } else {
+                _deviceOutputs.emplace_back(argument.name, data);
+                _networkOutputs[argument.name] = data;
+            }
+
+            if (isStateInputName(argument.name)) {
+                const auto stateName = argument.name.substr(READVALUE_PREFIX.size());
+                _states.emplace_back(stateName, std::make_shared<InferenceEngine::Data>(stateName, dataDesc()));
+            }
+        }
+
+        _description = std::make_shared<NetworkDescription>(std::make_shared<FakeNetworkDescription>(
+                std::vector<char>(blob.begin(), blob.end()), _deviceInputs, _deviceOutputs));
+    }
+
+    Executor::Ptr createExecutor(IDevice& device, const Config& config) const {
+        return device.createExecutor(_description, config);
+    }
+
+    IInferRequest::Ptr createInferRequest(IDevice& device, const Executor::Ptr& executor,
+                                          const Config& config) const {
+        return device.createInferRequest(_networkInputs, _networkOutputs, executor, config, "fake", {}, {}, _states,
+                                         nullptr);
+    }
+
+private:
+    NetworkIOVector _deviceInputs;
+    NetworkIOVector _deviceOutputs;
+    NetworkIOVector _states;
+    InferenceEngine::InputsDataMap _networkInputs;
+    InferenceEngine::OutputsDataMap _networkOutputs;
+    NetworkDescription::Ptr _description;
+};
+
+inline void fillBlob(const InferenceEngine::Blob::Ptr& blob, float value) {
+    const auto mapped = InferenceEngine::as<InferenceEngine::MemoryBlob>(blob)->wmap();
+    const auto data = mapped.as<float*>();
+    std::fill_n(data, NUM_ELEMENTS, value);
+}
+
+inline float readBlob(const InferenceEngine::Blob::CPtr& blob) {
+    const auto mapped = InferenceEngine::as<InferenceEngine::MemoryBlob>(blob)->rmap();
+    return mapped.as<const float*>()[0];
+}
+
+}  // namespace zeroTests
+}  // namespace vpux
@@ -0,0 +1,155 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <blob_factory.hpp>
+
+#include "zero_backend.h"
+#include "zero_test_utils.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace vpux;
+using namespace vpux::zeroTests;
+
+namespace {
+
+const auto INPUT_NAME = std::string("input");
+const auto OUTPUT_NAME = std::string("output");
+const auto STATE_NAME = std::string("acc");
+
+// state += input, the new state is the output as well
+class ZeroVariableStateUnitTests : public ::testing::TestWithParam<bool> {
+protected:
+    void SetUp() override {
+        FakeLevelZero::instance().reset({FakeLevelZero::Device{0x7D1D, GetParam()}});
+
+        const std::vector<FakeLevelZero::Argument> arguments = {{INPUT_NAME, true, NUM_ELEMENTS},
+                                                                {READVALUE_PREFIX + STATE_NAME, true, NUM_ELEMENTS},
+                                                                {OUTPUT_NAME, false, NUM_ELEMENTS},
+                                                                {ASSIGN_PREFIX + STATE_NAME, false, NUM_ELEMENTS}};
+        FakeLevelZero::instance().registerGraph("accumulator", arguments, [this](const std::vector<void*>& buffers) {
+            const auto input = static_cast<const float*>(buffers[0]);
+            const auto state = static_cast<const float*>(buffers[1]);
+            const auto output = static_cast<float*>(buffers[2]);
+            const auto newState = static_cast<float*>(buffers[3]);
+            for (uint32_t i = 0; i < NUM_ELEMENTS; ++i) {
+                newState[i] = state[i] + input[i];
+                output[i] = newState[i];
+            }
+            stateBuffers.emplace_back(buffers[1], buffers[3]);
+        });
+
+        _backend = std::make_unique<ZeroEngineBackend>(_config);
+        _network = std::make_unique<FakeNetwork>("accumulator", arguments);
+        _executor = _network->createExecutor(*_backend->getDevice(), _config);
+        request = _network->createInferRequest(*_backend->getDevice(), _executor, _config);
+        state = request->QueryState().at(0);
+    }
+
+    void TearDown() override {
+        state.reset();
+        request.reset();
+        _executor.reset();
+        _backend.reset();
+    }
+
+    float infer(float input) {
+        fillBlob(request->GetBlob(INPUT_NAME), input);
+        request->InferImpl();
+        return readBlob(request->GetBlob(OUTPUT_NAME));
+    }
+
+    using StateBuffers = std::pair<const void*, const void*>;
+
+    // Buffers the state was read from and written to by each inference
+    std::vector<StateBuffers> stateBuffers;
+
+    IInferRequest::Ptr request;
+    std::shared_ptr<InferenceEngine::IVariableStateInternal> state;
+
+private:
+    Config _config = createConfig();
+    std::unique_ptr<ZeroEngineBackend> _backend;
+    std::unique_ptr<FakeNetwork> _network;
+    Executor::Ptr _executor;
+};
+
+}  // namespace
+
+TEST_P(ZeroVariableStateUnitTests, stateIsAccumulatedAcrossInferences) {
+    EXPECT_EQ(infer(1.f), 1.f);
+    EXPECT_EQ(infer(1.f), 2.f);
+    EXPECT_EQ(infer(2.f), 4.f);
+    EXPECT_EQ(readBlob(state->GetState()), 4.f);
+}
+
+TEST_P(ZeroVariableStateUnitTests, stateBuffersAreSwappedAfterEachInference) {
+    for (size_t i = 0; i < 4; ++i) {
+        infer(1.f);
+    }
+
+    ASSERT_EQ(stateBuffers.size(), 4u);
+    for (size_t i = 0; i < stateBuffers.size(); ++i) {
+        EXPECT_NE(stateBuffers[i].first, stateBuffers[i].second);
+        if (i > 0) {
+            EXPECT_EQ(stateBuffers[i].first, stateBuffers[i - 1].second);
+        }
+    }
+    EXPECT_EQ(stateBuffers[2], stateBuffers[0]);
+}
+
+TEST_P(ZeroVariableStateUnitTests, stateIsCopiedOnlyOnRequest) {
+    const auto isStateCopy = [&](const FakeLevelZero::Copy& copy) {
+        return std::any_of(stateBuffers.begin(), stateBuffers.end(), [&](const StateBuffers& buffers) {
+            return copy.dst == buffers.first || copy.dst == buffers.second || copy.src == buffers.first ||
+                   copy.src == buffers.second;
+        });
+    };
+    const auto countStateCopies = [&]() {
+        size_t count = 0;
+        for (const auto& submission : FakeLevelZero::instance().getSubmissions()) {
+            const auto& copies = submission.copies;
+            count += static_cast<size_t>(std::count_if(copies.begin(), copies.end(), isStateCopy));
+        }
+        return count;
+    };
+
+    for (size_t i = 0; i < 3; ++i) {
+        infer(1.f);
+    }
+    // The initial state is uploaded when the request is created on the discrete device
+    const auto initialCopies = countStateCopies();
+    EXPECT_EQ(initialCopies, GetParam() ? 0u : 1u);
+
+    // Only the device copy of the state is updated by the inferences, it's read back on GetState
+    EXPECT_EQ(readBlob(state->GetState()), 3.f);
+    EXPECT_EQ(countStateCopies(), GetParam() ? 0u : initialCopies + 1);
+}
+
+TEST_P(ZeroVariableStateUnitTests, setStateAndResetAreSeenByNextInference) {
+    infer(1.f);
+    infer(1.f);
+
+    const auto newState = make_blob_with_precision(dataDesc());
+    newState->allocate();
+    fillBlob(newState, 10.f);
+    state->SetState(newState);
+    EXPECT_EQ(infer(1.f), 11.f);
+
+    state->Reset();
+    EXPECT_EQ(infer(1.f), 1.f);
+    EXPECT_EQ(readBlob(state->GetState()), 1.f);
+}
+
+INSTANTIATE_TEST_SUITE_P(IntegratedAndDiscrete, ZeroVariableStateUnitTests, ::testing::Bool(),
+                         [](const ::testing::TestParamInfo<bool>& info) {
+                             return info.param ? "Integrated" : "Discrete";
+                         });
@@ -4,12 +4,15 @@
 //
 
 #include "vpux/utils/IE/blob.hpp"
+#include "vpux/utils/IE/loop.hpp"
 
 #include <precision_utils.h>
 #include <blob_factory.hpp>
 #include <inference_engine.hpp>
 
 #include <ngraph/function.hpp>
+#include <ngraph/graph_util.hpp>
+#include <ngraph/op/constant.hpp>
 
 #include <opencv2/core.hpp>
 #include <opencv2/imgcodecs.hpp>
@@ -21,6 +24,8 @@
 #include <llvm/Support/FileSystem.h>
 #include <llvm/Support/Path.h>
 
+#include <algorithm>
+#include <cctype>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
@@ -57,6 +62,10 @@ DEFINE_bool(run_infer, false, "Run infer");
 
 DEFINE_bool(raw_export, false, "Raw export");
 
+DEFINE_bool(single_compile, true,
+            "Compile the whole network once with the compiler exposing all analyzed layers as debug outputs, "
+            "instead of compiling a sub-network per layer");
+
 DEFINE_string(input_precision, "", "Input precision (optional)");
 DEFINE_string(input_layout, "", "Input layout (optional)");
 DEFINE_string(output_precision, "", "Output precision (optional)");
@@ -128,6 +137,7 @@ void parseCommandLine(int argc, char* argv[]) {
     std::cout << "    Run ref:" << FLAGS_run_ref << std::endl;
     std::cout << "    Run infer:" << FLAGS_run_infer << std::endl;
     std::cout << "    Raw export: " << FLAGS_raw_export << std::endl;
+    std::cout << "    Single compile: " << FLAGS_single_compile << std::endl;
     std::cout << "    Input precision: " << FLAGS_input_precision << std::endl;
     std::cout << "    Input layout: " << FLAGS_input_layout << std::endl;
     std::cout << "    Output precision: " << FLAGS_output_precision << std::endl;
@@ -221,6 +231,16 @@ std::string getLayerFileBaseName(size_t layerInd, const std::string& layerName)
     return strm.str();
 }
 
+// The outputs follow the Inference Engine naming: the layer name for the layers with one output
+// and `<layer>.<port>` for the layers with several outputs
+std::string getOutputName(const std::shared_ptr<ngraph::Node>& node, size_t port) {
+    if (node->get_output_size() == 1) {
+        return node->get_friendly_name();
+    }
+
+    return node->get_friendly_name() + "." + std::to_string(port);
+}
+
 //
 // BMP diff map
 //
@@ -854,12 +874,85 @@ std::shared_ptr<ngraph::Function> buildFunc(const std::string& name, const ngrap
             newResult->set_friendly_name(lastNode->get_friendly_name() + "_" + std::to_string(output.get_index()));
         }
 
-        newResults.push_back(std::make_shared<ngraph::op::Result>(output));
+        newResults.push_back(newResult);
     }
 
     return std::make_shared<ngraph::Function>(newResults, newParameters, name);
 }
 
+//
+// Report
+//
+
+std::tuple<LayerStats, ie::Blob::Ptr> compareOutputs(const ie::Blob::Ptr& refBlob, const ie::Blob::Ptr& actualBlob) {
+    const auto refOutput = vpux::toDefLayout(vpux::toPrecision(ie::as<ie::MemoryBlob>(refBlob), ie::Precision::FP32));
+    ie::MemoryBlob::Ptr actualOutput =
+            vpux::toDefLayout(vpux::toPrecision(ie::as<ie::MemoryBlob>(actualBlob), ie::Precision::FP32));
+
+    // The compiler might change the rank of the intermediate results exposed as debug outputs,
+    // the order of the elements is kept, so they are compared in the reference shape
+    const auto& refDesc = refOutput->getTensorDesc();
+    if (actualOutput->getTensorDesc().getDims() != refDesc.getDims() && actualOutput->size() == refOutput->size()) {
+        const auto reshapedOutput = ie::as<ie::MemoryBlob>(make_blob_with_precision(refDesc));
+        reshapedOutput->allocate();
+
+        std::copy_n(actualOutput->cbuffer().as<const float*>(), actualOutput->size(),
+                    reshapedOutput->buffer().as<float*>());
+        actualOutput = reshapedOutput;
+    }
+
+    return compare(refOutput, actualOutput);
+}
+
+void reportLayer(const std::string& layerName, const std::string& layerBaseName, const LayerStats& stats,
+                 const ie::Blob::Ptr& diffBlob, std::ofstream& htmlNet) {
+    const auto htmlLayerFileName = layerBaseName + ".html";
+    const auto htmlLayerFilePath = joinPath(outputReportLayersDir, htmlLayerFileName);
+
+    std::ofstream htmlLayer(htmlLayerFilePath);
+    IE_ASSERT(htmlLayer.is_open());
+
+    htmlLayer << "<html>" << std::endl;
+    htmlLayer << "    <head>" << std::endl;
+    htmlLayer << "        <title>Layer " << layerName << "</title>" << std::endl;
+    htmlLayer << "    </head>" << std::endl;
+    htmlLayer << "    <body>" << std::endl;
+    htmlLayer << "         <h1>Layer " << layerName << "</h1>" << std::endl;
+
+    htmlLayer << "         <h2>Statistics</h2>" << std::endl;
+    printStats(stats, htmlLayer);
+
+    dumpDiffMaps(diffBlob, layerBaseName, htmlLayer);
+
+    htmlLayer << "    </body>" << std::endl;
+    htmlLayer << "</html>" << std::endl;
+
+    htmlNet << "             <tr>" << std::endl;
+    htmlNet << "                 <td>" << layerName << "</td>" << std::endl;
+    htmlNet << "                 <td>" << stats.diff.abs.max << "</td>" << std::endl;
+    htmlNet << "                 <td>" << stats.diff.rel.max << "</td>" << std::endl;
+    htmlNet << "                 <td><a href=\"layers/" << htmlLayerFileName << "\">RESULTS</a></td>" << std::endl;
+    htmlNet << "             </tr>" << std::endl;
+}
+
+void reportLayerFailure(const std::string& layerName, std::ofstream& htmlNet) {
+    htmlNet << "             <tr>" << std::endl;
+    htmlNet << "                 <td>" << layerName << "</td>" << std::endl;
+    htmlNet << "                 <td>NONE</td>" << std::endl;
+    htmlNet << "                 <td>NONE</td>" << std::endl;
+    htmlNet << "                 <td><span style=\"color:red;font-weight:bold\">FATAL ERROR</span></td>" << std::endl;
+    htmlNet << "             </tr>" << std::endl;
+}
+
+void reportLayerUnavailable(const std::string& layerName, std::ofstream& htmlNet) {
+    htmlNet << "             <tr>" << std::endl;
+    htmlNet << "                 <td>" << layerName << "</td>" << std::endl;
+    htmlNet << "                 <td>NONE</td>" << std::endl;
+    htmlNet << "                 <td>NONE</td>" << std::endl;
+    htmlNet << "                 <td><span style=\"color:gray\">NOT AVAILABLE</span></td>" << std::endl;
+    htmlNet << "             </tr>" << std::endl;
+}
+
 std::ostream& operator<<(std::ostream& os, const ie::SizeVector& sz) {
     os << "[";
 
@@ -880,103 +973,11 @@ std::ostream& operator<<(std::ostream& os, const ie::SizeVector& sz) {
     return os;
 }
 
-}  // namespace
-
 //
-// Main
+// Per-layer compilation
 //
 
-int main(int argc, char* argv[]) {
-    parseCommandLine(argc, argv);
-
-    setupDirectories();
-    setupInferenceEngine();
-
-    const auto baseNetFileName = FLAGS_network_name + ".xml";
-    const auto baseBinFileName = FLAGS_network_name + ".bin";
-
-    const auto baseNetFilePath = joinPath(inputBaseDir, baseNetFileName);
-    const auto baseBinFilePath = joinPath(inputBaseDir, baseBinFileName);
-
-    if (outputBaseDir != inputBaseDir) {
-        fs::copy_file(baseNetFilePath, joinPath(outputBaseDir, baseNetFileName));
-        fs::copy_file(baseBinFilePath, joinPath(outputBaseDir, baseBinFileName));
-    }
-
-    std::cout << "Load base network " << baseNetFileName << std::endl;
-    auto baseNet = ieCore.ReadNetwork(baseNetFilePath);
-    setInputOutputInfo(baseNet);
-    std::cout << std::endl;
-
-    const auto baseInputInfo = baseNet.getInputsInfo();
-    const auto baseOutputInfo = baseNet.getOutputsInfo();
-
-    ie::BlobMap inputs;
-    if (FLAGS_run_ref || FLAGS_run_infer) {
-        // TODO: support multiple inputs
-
-        std::cout << "Load input file " << FLAGS_input_file << std::endl;
-        IE_ASSERT(baseInputInfo.size() == 1);
-        const auto inputName = baseInputInfo.begin()->first;
-        const auto inputDesc = baseInputInfo.begin()->second->getTensorDesc();
-        const auto inputBlob = loadInput(inputDesc);
-        std::cout << std::endl;
-
-        inputs.emplace(inputName, inputBlob);
-    }
-
-    std::ofstream htmlNet;
-    Path htmlLayersBaseFilePath;
-
-    if (FLAGS_run_infer) {
-        const auto htmlNetFilePath = joinPath(outputReportDir, (FLAGS_network_name + ".html"));
-        htmlNet.open(htmlNetFilePath);
-        IE_ASSERT(htmlNet.is_open());
-
-        htmlNet << "<html>" << std::endl;
-        htmlNet << "    <head>" << std::endl;
-        htmlNet << "        <title>" << FLAGS_network_name << "</title>" << std::endl;
-        htmlNet << "    </head>" << std::endl;
-        htmlNet << "    <body>" << std::endl;
-
-        htmlNet << "         <h1>" << FLAGS_network_name << "</h1>" << std::endl;
-
-        htmlNet << "         <h2>Network inputs</h2>" << std::endl;
-        htmlNet << "         <table border=\"1\">" << std::endl;
-        htmlNet << "             <tr><th>Name</th><th>Precision</th><th>Dims</th><th>Layout</th></tr>" << std::endl;
-        for (const auto& p : baseInputInfo) {
-            const auto& desc = p.second->getTensorDesc();
-
-            htmlNet << "             <tr>" << std::endl;
-            htmlNet << "                 <td>" << p.first << "</td>" << std::endl;
-            htmlNet << "                 <td>" << desc.getPrecision() << "</td>" << std::endl;
-            htmlNet << "                 <td>" << desc.getDims() << "</td>" << std::endl;
-            htmlNet << "                 <td>" << desc.getLayout() << "</td>" << std::endl;
-            htmlNet << "             </tr>" << std::endl;
-        }
-        htmlNet << "         </table>" << std::endl;
-
-        htmlNet << "         <h2>Network outputs</h2>" << std::endl;
-        htmlNet << "         <table border=\"1\">" << std::endl;
-        htmlNet << "             <tr><th>Name</th><th>Precision</th><th>Dims</th><th>Layout</th></tr>" << std::endl;
-        for (const auto& p : baseOutputInfo) {
-            const auto& desc = p.second->getTensorDesc();
-
-            htmlNet << "             <tr>" << std::endl;
-            htmlNet << "                 <td>" << p.first << "</td>" << std::endl;
-            htmlNet << "                 <td>" << desc.getPrecision() << "</td>" << std::endl;
-            htmlNet << "                 <td>" << desc.getDims() << "</td>" << std::endl;
-            htmlNet << "                 <td>" << desc.getLayout() << "</td>" << std::endl;
-            htmlNet << "             </tr>" << std::endl;
-        }
-        htmlNet << "         </table>" << std::endl;
-
-        htmlNet << "         <h2>Network layers</h2>" << std::endl;
-        htmlNet << "         <table border=\"1\">" << std::endl;
-        htmlNet << "             <tr><th>Name</th><th>Max Abs Diff</th><th>Max Rel Diff</th><th>Results</th></tr>"
-                << std::endl;
-    }
-
+void runPerLayerCompile(ie::CNNNetwork& baseNet, const ie::BlobMap& inputs, std::ofstream& htmlNet) {
     const auto baseFunc = baseNet.getFunction();
     IE_ASSERT(baseFunc != nullptr);
 
@@ -997,11 +998,6 @@ int main(int argc, char* argv[]) {
             continue;
         }
 
-        // TODO: support multiple outputs
-        if (baseNode->get_output_size() != 1) {
-            continue;
-        }
-
         std::cout << "Build sub-network up to layer " << layerName << std::endl;
 
         const auto layerBaseName = getLayerFileBaseName(baseNodes.size() - 1, baseNode->get_friendly_name());
@@ -1061,66 +1057,339 @@ int main(int argc, char* argv[]) {
                 std::cout << "    Run infer on " << FLAGS_actual_device << std::endl;
                 const auto actualOutputs = runInfer(actualExeNet, inputs);
 
-                const auto htmlLayerFileName = layerBaseName + ".html";
-                const auto htmlLayerFilePath = joinPath(outputReportLayersDir, htmlLayerFileName);
+                std::cout << "    Compare with reference" << std::endl;
 
-                std::ofstream htmlLayer(htmlLayerFilePath);
-                IE_ASSERT(htmlLayer.is_open());
+                for (size_t port = 0; port < baseNode->get_output_size(); ++port) {
+                    const auto outputName = getOutputName(baseNode, port);
+                    const auto outputBaseName = getLayerFileBaseName(baseNodes.size() - 1, outputName);
 
-                htmlLayer << "<html>" << std::endl;
-                htmlLayer << "    <head>" << std::endl;
-                htmlLayer << "        <title>Layer " << layerName << "</title>" << std::endl;
-                htmlLayer << "    </head>" << std::endl;
-                htmlLayer << "    <body>" << std::endl;
-                htmlLayer << "         <h1>Layer " << layerName << "</h1>" << std::endl;
+                    const auto refOutput = refOutputs.find(outputName);
+                    const auto actualOutput = actualOutputs.find(outputName);
+                    if (refOutput == refOutputs.end() || actualOutput == actualOutputs.end()) {
+                        std::cerr << "    Output " << outputName << " is missing" << std::endl;
+                        reportLayerFailure(outputName, htmlNet);
+                        continue;
+                    }
 
-                std::cout << "    Compare with reference" << std::endl;
+                    LayerStats stats;
+                    ie::Blob::Ptr diffBlob;
+                    std::tie(stats, diffBlob) = compareOutputs(refOutput->second, actualOutput->second);
+
+                    reportLayer(outputName, outputBaseName, stats, diffBlob, htmlNet);
+                }
+            }
+        } catch (const std::exception& err) {
+            std::cerr << "    Failed to cut network on layer " << layerName << std::endl;
+            std::cerr << "    " << err.what() << std::endl;
+
+            if (FLAGS_run_infer) {
+                reportLayerFailure(layerName, htmlNet);
+            }
+        }
+
+        std::cout << std::endl;
+    }
+}
+
+//
+// Single compilation
+//
+
+// The key of the plugin private property with the compiler pipeline options
+constexpr char COMPILATION_MODE_PARAMS_KEY[] = "NPU_COMPILATION_MODE_PARAMS";
+
+struct DebugLayer final {
+    std::string name;
+    std::string baseName;
+    std::string error;
+    bool isAvailable = true;
+
+    LayerStats stats;
+    ie::Blob::Ptr diffBlob;
+};
+
+bool isValidDebugOutputName(const std::string& layerName) {
+    // The names are passed to the compiler as a comma separated pipeline option value
+    return std::none_of(layerName.begin(), layerName.end(), [](char c) {
+        return c == ',' || std::isspace(static_cast<unsigned char>(c));
+    });
+}
+
+void runSingleCompile(ie::CNNNetwork& baseNet, const ie::BlobMap& inputs, std::ofstream& htmlNet) {
+    const auto baseFunc = baseNet.getFunction();
+    IE_ASSERT(baseFunc != nullptr);
+
+    // The analyzed layers are added as extra outputs to the copy of the network for the reference device.
+    // The actual network is compiled as is, the compiler exposes the results of the same layers after its own
+    // optimizations, so the fusions and the schedule stay the same as for the original network.
+    const auto debugNetName = FLAGS_network_name + "_debug";
+    auto refNet = ie::CNNNetwork(ngraph::clone_function(*baseFunc));
+
+    std::cout << "Build network with debug outputs" << std::endl;
+
+    std::vector<DebugLayer> layers;
+    std::string debugOutputs;
+    size_t layerInd = 0;
+
+    for (const auto& baseNode : baseFunc->get_ordered_ops()) {
+        if (ngraph::is_type<ngraph::op::Parameter>(baseNode) || ngraph::is_type<ngraph::op::Result>(baseNode)) {
+            continue;
+        }
+
+        const auto& layerName = baseNode->get_friendly_name();
+        const auto curLayerInd = layerInd++;
 
-                // TODO: support multiple outputs
-                IE_ASSERT(refOutputs.size() == 1);
-                IE_ASSERT(actualOutputs.size() == 1);
+        if (!checkFilter(layerName, baseNode->get_type_name())) {
+            continue;
+        }
 
-                const auto refOutput = vpux::toDefLayout(
-                        vpux::toPrecision(ie::as<ie::MemoryBlob>(refOutputs.begin()->second), ie::Precision::FP32));
-                const auto actualOutput = vpux::toDefLayout(
-                        vpux::toPrecision(ie::as<ie::MemoryBlob>(actualOutputs.begin()->second), ie::Precision::FP32));
+        // Constants are not computed on the device, there is nothing to compare
+        if (ngraph::is_type<ngraph::op::Constant>(baseNode)) {
+            continue;
+        }
 
-                LayerStats stats;
-                ie::Blob::Ptr diffBlob;
-                std::tie(stats, diffBlob) = compare(refOutput, actualOutput);
+        const auto isValidName = isValidDebugOutputName(layerName);
+        if (isValidName) {
+            debugOutputs += (debugOutputs.empty() ? "" : ",") + layerName;
+        }
 
-                htmlLayer << "         <h2>Statistics</h2>" << std::endl;
-                printStats(stats, htmlLayer);
+        for (size_t port = 0; port < baseNode->get_output_size(); ++port) {
+            DebugLayer layer;
+            layer.name = getOutputName(baseNode, port);
+            layer.baseName = getLayerFileBaseName(curLayerInd, layer.name);
 
-                dumpDiffMaps(diffBlob, layerBaseName, htmlLayer);
+            if (!isValidName) {
+                layer.error = "The layer name can't be passed to the compiler";
+            }
 
-                htmlLayer << "    </body>" << std::endl;
-                htmlLayer << "</html>" << std::endl;
+            try {
+                refNet.addOutput(layerName, port);
+            } catch (const std::exception& err) {
+                std::cerr << "    Failed to add output for layer " << layer.name << std::endl;
+                std::cerr << "    " << err.what() << std::endl;
 
-                htmlNet << "             <tr>" << std::endl;
-                htmlNet << "                 <td>" << layerName << "</td>" << std::endl;
-                htmlNet << "                 <td>" << stats.diff.abs.max << "</td>" << std::endl;
-                htmlNet << "                 <td>" << stats.diff.rel.max << "</td>" << std::endl;
-                htmlNet << "                 <td><a href=\"layers/" << htmlLayerFileName << "\">RESULTS</a></td>"
-                        << std::endl;
-                htmlNet << "             </tr>" << std::endl;
+                layer.error = err.what();
             }
-        } catch (const std::exception& err) {
-            std::cerr << "    Failed to cut network on layer " << layerName << std::endl;
-            std::cerr << "    " << err.what() << std::endl;
 
-            if (FLAGS_run_infer) {
-                htmlNet << "             <tr>" << std::endl;
-                htmlNet << "                 <td>" << layerName << "</td>" << std::endl;
-                htmlNet << "                 <td>NONE</td>" << std::endl;
-                htmlNet << "                 <td>NONE</td>" << std::endl;
-                htmlNet << "                 <td><span style=\"color:red;font-weight:bold\">FATAL ERROR</span></td>"
-                        << std::endl;
-                htmlNet << "             </tr>" << std::endl;
+            layers.push_back(std::move(layer));
+        }
+    }
+
+    setInputOutputInfo(refNet);
+
+    std::cout << "    Number of debug outputs: " << refNet.getOutputsInfo().size() << std::endl;
+    std::cout << std::endl;
+
+    ie::ExecutableNetwork actualExeNet;
+    if (FLAGS_run_compile) {
+        serializeNetwork(refNet, debugNetName);
+
+        std::cout << "Compile network for " << FLAGS_actual_device << std::endl;
+
+        auto actualNet = ie::CNNNetwork(ngraph::clone_function(*baseFunc));
+        setInputOutputInfo(actualNet);
+
+        const std::map<std::string, std::string> actualConfig = {
+                {COMPILATION_MODE_PARAMS_KEY, "debug-outputs=" + debugOutputs}};
+        actualExeNet = ieCore.LoadNetwork(actualNet, FLAGS_actual_device, actualConfig);
+
+        // The debug outputs are created by the compiler, only the imported network exposes them
+        if (FLAGS_run_infer) {
+            std::stringstream compiledNet;
+            actualExeNet.Export(compiledNet);
+            actualExeNet = ieCore.ImportNetwork(compiledNet, FLAGS_actual_device);
+        } else {
+            exportNetwork(actualExeNet, debugNetName + ".compiled");
+        }
+    } else if (FLAGS_run_infer) {
+        std::cout << "Import network for " << FLAGS_actual_device << std::endl;
+
+        actualExeNet = importNetwork(debugNetName + ".compiled");
+    }
+
+    ie::BlobMap refOutputs;
+    if (FLAGS_run_ref) {
+        std::cout << "Calc reference with " << FLAGS_ref_device << std::endl;
+
+        std::map<std::string, std::string> refConfig;
+
+        if (FLAGS_ref_device == "CPU") {
+            refConfig.emplace("LP_TRANSFORMS_MODE", CONFIG_VALUE(NO));
+        }
+
+        auto refExeNet = ieCore.LoadNetwork(refNet, FLAGS_ref_device, refConfig);
+        refOutputs = runInfer(refExeNet, inputs);
+
+        if (!FLAGS_run_infer) {
+            for (const auto& p : refOutputs) {
+                dumpBlob(p.second, cleanName(p.first) + ".blob");
             }
         }
+    } else if (FLAGS_run_infer) {
+        std::cout << "Import reference" << std::endl;
+
+        for (const auto& p : refNet.getOutputsInfo()) {
+            const auto blob = importBlob(p.second->getTensorDesc(), cleanName(p.first) + ".blob");
+            refOutputs.insert({p.first, blob});
+        }
+    }
+
+    if (!FLAGS_run_infer) {
+        return;
+    }
+
+    std::cout << "Run infer on " << FLAGS_actual_device << std::endl;
+    const auto actualOutputs = runInfer(actualExeNet, inputs);
+
+    std::cout << "    Number of exposed debug outputs: " << actualOutputs.size() << std::endl;
 
+    // The compiler doesn't expose the layers which were removed, decomposed or fused with their consumers
+    for (auto& layer : layers) {
+        if (layer.error.empty() && actualOutputs.count(layer.name) == 0) {
+            layer.isAvailable = false;
+        }
+    }
+
+    std::cout << "Compare with reference" << std::endl;
+
+    vpux::loop_1d(vpux::LoopExecPolicy::Parallel, static_cast<int64_t>(layers.size()), [&](int64_t ind) {
+        auto& layer = layers[static_cast<size_t>(ind)];
+        if (!layer.error.empty() || !layer.isAvailable) {
+            return;
+        }
+
+        try {
+            std::tie(layer.stats, layer.diffBlob) =
+                    compareOutputs(refOutputs.at(layer.name), actualOutputs.at(layer.name));
+        } catch (const std::exception& err) {
+            layer.error = err.what();
+        }
+    });
+
+    for (auto& layer : layers) {
+        if (!layer.error.empty()) {
+            std::cerr << "    Failed to compare layer " << layer.name << std::endl;
+            std::cerr << "    " << layer.error << std::endl;
+
+            reportLayerFailure(layer.name, htmlNet);
+            continue;
+        }
+
+        if (!layer.isAvailable) {
+            std::cout << "    Layer " << layer.name << " is not available in the compiled network" << std::endl;
+
+            reportLayerUnavailable(layer.name, htmlNet);
+            continue;
+        }
+
+        reportLayer(layer.name, layer.baseName, layer.stats, layer.diffBlob, htmlNet);
+
+        // Difference maps are not needed anymore, release the memory as soon as possible
+        layer.diffBlob = nullptr;
+    }
+}
+
+}  // namespace
+
+//
+// Main
+//
+
+int main(int argc, char* argv[]) {
+    parseCommandLine(argc, argv);
+
+    setupDirectories();
+    setupInferenceEngine();
+
+    const auto baseNetFileName = FLAGS_network_name + ".xml";
+    const auto baseBinFileName = FLAGS_network_name + ".bin";
+
+    const auto baseNetFilePath = joinPath(inputBaseDir, baseNetFileName);
+    const auto baseBinFilePath = joinPath(inputBaseDir, baseBinFileName);
+
+    if (outputBaseDir != inputBaseDir) {
+        fs::copy_file(baseNetFilePath, joinPath(outputBaseDir, baseNetFileName));
+        fs::copy_file(baseBinFilePath, joinPath(outputBaseDir, baseBinFileName));
+    }
+
+    std::cout << "Load base network " << baseNetFileName << std::endl;
+    auto baseNet = ieCore.ReadNetwork(baseNetFilePath);
+    setInputOutputInfo(baseNet);
+    std::cout << std::endl;
+
+    const auto baseInputInfo = baseNet.getInputsInfo();
+    const auto baseOutputInfo = baseNet.getOutputsInfo();
+
+    ie::BlobMap inputs;
+    if (FLAGS_run_ref || FLAGS_run_infer) {
+        // TODO: support multiple inputs
+
+        std::cout << "Load input file " << FLAGS_input_file << std::endl;
+        IE_ASSERT(baseInputInfo.size() == 1);
+        const auto inputName = baseInputInfo.begin()->first;
+        const auto inputDesc = baseInputInfo.begin()->second->getTensorDesc();
+        const auto inputBlob = loadInput(inputDesc);
         std::cout << std::endl;
+
+        inputs.emplace(inputName, inputBlob);
+    }
+
+    std::ofstream htmlNet;
+    Path htmlLayersBaseFilePath;
+
+    if (FLAGS_run_infer) {
+        const auto htmlNetFilePath = joinPath(outputReportDir, (FLAGS_network_name + ".html"));
+        htmlNet.open(htmlNetFilePath);
+        IE_ASSERT(htmlNet.is_open());
+
+        htmlNet << "<html>" << std::endl;
+        htmlNet << "    <head>" << std::endl;
+        htmlNet << "        <title>" << FLAGS_network_name << "</title>" << std::endl;
+        htmlNet << "    </head>" << std::endl;
+        htmlNet << "    <body>" << std::endl;
+
+        htmlNet << "         <h1>" << FLAGS_network_name << "</h1>" << std::endl;
+
+        htmlNet << "         <h2>Network inputs</h2>" << std::endl;
+        htmlNet << "         <table border=\"1\">" << std::endl;
+        htmlNet << "             <tr><th>Name</th><th>Precision</th><th>Dims</th><th>Layout</th></tr>" << std::endl;
+        for (const auto& p : baseInputInfo) {
+            const auto& desc = p.second->getTensorDesc();
+
+            htmlNet << "             <tr>" << std::endl;
+            htmlNet << "                 <td>" << p.first << "</td>" << std::endl;
+            htmlNet << "                 <td>" << desc.getPrecision() << "</td>" << std::endl;
+            htmlNet << "                 <td>" << desc.getDims() << "</td>" << std::endl;
+            htmlNet << "                 <td>" << desc.getLayout() << "</td>" << std::endl;
+            htmlNet << "             </tr>" << std::endl;
+        }
+        htmlNet << "         </table>" << std::endl;
+
+        htmlNet << "         <h2>Network outputs</h2>" << std::endl;
+        htmlNet << "         <table border=\"1\">" << std::endl;
+        htmlNet << "             <tr><th>Name</th><th>Precision</th><th>Dims</th><th>Layout</th></tr>" << std::endl;
+        for (const auto& p : baseOutputInfo) {
+            const auto& desc = p.second->getTensorDesc();
+
+            htmlNet << "             <tr>" << std::endl;
+            htmlNet << "                 <td>" << p.first << "</td>" << std::endl;
+            htmlNet << "                 <td>" << desc.getPrecision() << "</td>" << std::endl;
+            htmlNet << "                 <td>" << desc.getDims() << "</td>" << std::endl;
+            htmlNet << "                 <td>" << desc.getLayout() << "</td>" << std::endl;
+            htmlNet << "             </tr>" << std::endl;
+        }
+        htmlNet << "         </table>" << std::endl;
+
+        htmlNet << "         <h2>Network layers</h2>" << std::endl;
+        htmlNet << "         <table border=\"1\">" << std::endl;
+        htmlNet << "             <tr><th>Name</th><th>Max Abs Diff</th><th>Max Rel Diff</th><th>Results</th></tr>"
+                << std::endl;
+    }
+
+    if (FLAGS_single_compile) {
+        runSingleCompile(baseNet, inputs, htmlNet);
+    } else {
+        runPerLayerCompile(baseNet, inputs, htmlNet);
     }
 
     if (FLAGS_run_ref) {
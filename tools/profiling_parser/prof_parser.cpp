@@ -16,6 +16,7 @@
 #include <schema/profiling_generated.h>
 
 #include "vpux/utils/IE/profiling.hpp"
+#include "vpux/utils/plugin/profiling_compare.hpp"
 #include "vpux/utils/plugin/profiling_meta.hpp"
 #include "vpux/utils/plugin/profiling_parser.hpp"
 
@@ -30,6 +31,9 @@ DEFINE_bool(g, false, "Profiling data is from FPGA");
 DEFINE_bool(v, false, "Increased verbosity of DPU tasks parsing (include variant level tasks)");
 DEFINE_bool(vv, false, "Highest verbosity of tasks parsing (Currently same as -v)");
 DEFINE_bool(m, false, "Dump profiling metadata");
+DEFINE_string(cb, "", "Precompiled blob of the reference run to compare with, -b is used if empty");
+DEFINE_string(cp, "", "Profiling result binary of the reference run to compare with");
+DEFINE_string(s, "delta", "Sort key of the compared layers (delta, name, before or after)");
 
 static bool validateFile(const char* flagName, const std::string& pathToFile) {
     if (pathToFile.empty()) {
@@ -87,6 +91,12 @@ static void parseCommandLine(int argc, char* argv[], const std::string& usage) {
     if (!FLAGS_m && !validateFile("-p", FLAGS_p)) {
         throw std::runtime_error("Invalid -p parameter value");
     }
+    if (!FLAGS_cp.empty() && !validateFile("-cp", FLAGS_cp)) {
+        throw std::runtime_error("Invalid -cp parameter value");
+    }
+    if (!FLAGS_cb.empty() && !validateFile("-cb", FLAGS_cb)) {
+        throw std::runtime_error("Invalid -cb parameter value");
+    }
 }
 
 static void printCommandLineParameters() {
@@ -98,9 +108,60 @@ static void printCommandLineParameters() {
     std::cout << "    Verbosity:             " << verbosityToStr(getVerbosity()) << std::endl;
     std::cout << "    FPGA:                  " << FLAGS_g << std::endl;
     std::cout << "    Dump metadata:         " << FLAGS_m << std::endl;
+    if (!FLAGS_cp.empty()) {
+        std::cout << "    Reference blob file:   " << (FLAGS_cb.empty() ? FLAGS_b : FLAGS_cb) << std::endl;
+        std::cout << "    Reference profiling:   " << FLAGS_cp << std::endl;
+        std::cout << "    Sort key:              " << FLAGS_s << std::endl;
+    }
     std::cout << std::endl;
 }
 
+static std::vector<uint8_t> readBinaryFile(const std::string& path) {
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    file.seekg(0, file.end);
+    const size_t length = file.tellg();
+    file.seekg(0, file.beg);
+    std::vector<uint8_t> data(length);
+    file.read(reinterpret_cast<char*>(data.data()), data.size());
+    return data;
+}
+
+static std::vector<vpux::profiling::TaskInfo> getTasks(const std::vector<uint8_t>& blob,
+                                                       const std::vector<uint8_t>& profiling) {
+    // Cluster level tasks are needed to detect the change of the number of clusters
+    return vpux::profiling::getTaskInfo(blob.data(), blob.size(), profiling.data(), profiling.size(),
+                                        vpux::profiling::TaskType::ALL, VerbosityLevel::MEDIUM, FLAGS_g);
+}
+
+// Aligns the tasks of the reference run (-cb, -cp) with the ones of the analyzed run (-b, -p)
+static void compareProfiling(const std::vector<uint8_t>& blob, const std::vector<uint8_t>& profiling) {
+    const auto refBlob = FLAGS_cb.empty() ? blob : readBinaryFile(FLAGS_cb);
+    const auto refProfiling = readBinaryFile(FLAGS_cp);
+
+    auto comparison = vpux::profiling::compareProfiling(getTasks(refBlob, refProfiling), getTasks(blob, profiling));
+    vpux::profiling::sortLayerDiffs(comparison.layers, vpux::profiling::parseCompareSortKey(FLAGS_s));
+
+    std::ofstream outFile;
+    if (!FLAGS_o.empty()) {
+        outFile.open(FLAGS_o);
+        if (!outFile.good()) {
+            throw std::runtime_error("Can't open output file " + FLAGS_o);
+        }
+    }
+    std::ostream& output = FLAGS_o.empty() ? std::cout : outFile;
+
+    switch (getOutputFormat()) {
+    case OutputType::TEXT:
+        vpux::profiling::printComparisonAsText(comparison, output);
+        break;
+    case OutputType::JSON:
+        vpux::profiling::printComparisonAsJson(comparison, output);
+        break;
+    default:
+        throw std::runtime_error("Only text and json formats are supported for comparison");
+    }
+}
+
 static void dumpProfilingMetadata(const uint8_t* blobData, size_t blobSize) {
     const uint8_t* sectionData = vpux::profiling::getProfilingSectionPtr(blobData, blobSize);
 
@@ -112,20 +173,14 @@ static void dumpProfilingMetadata(const uint8_t* blobData, size_t blobSize) {
 
 int main(int argc, char** argv) {
     static const char* usage = "Usage: prof_parser -b <blob path> -p <profiling.bin path> [-f json|text] "
-                               "[-o <output.file>] [-v|vv] [-g] [-m]";
+                               "[-o <output.file>] [-v|vv] [-g] [-m] "
+                               "[-cp <reference profiling.bin path> [-cb <reference blob path>] "
+                               "[-s delta|name|before|after]]";
     try {
         parseCommandLine(argc, argv, usage);
         printCommandLineParameters();
 
-        std::string blobPath(FLAGS_b);
-        std::ifstream blob_file;
-        blob_file.open(blobPath, std::ios::in | std::ios::binary);
-        blob_file.seekg(0, blob_file.end);
-        size_t blob_length = blob_file.tellg();
-        blob_file.seekg(0, blob_file.beg);
-        std::vector<uint8_t> blob_bin(blob_length);
-        blob_file.read(reinterpret_cast<char*>(blob_bin.data()), blob_bin.size());
-        blob_file.close();
+        const auto blob_bin = readBinaryFile(FLAGS_b);
 
         if (FLAGS_m) {
             if (!FLAGS_o.empty() || !FLAGS_p.empty()) {
@@ -136,15 +191,12 @@ int main(int argc, char** argv) {
             return 0;
         }
 
-        std::string profResult(FLAGS_p);
-        std::fstream profiling_results;
-        profiling_results.open(profResult, std::ios::in | std::ios::binary);
-        profiling_results.seekg(0, profiling_results.end);
-        size_t profiling_length = profiling_results.tellg();
-        profiling_results.seekg(0, profiling_results.beg);
-        std::vector<uint8_t> output_bin(profiling_length);
-        profiling_results.read(reinterpret_cast<char*>(output_bin.data()), output_bin.size());
-        profiling_results.close();
+        const auto output_bin = readBinaryFile(FLAGS_p);
+
+        if (!FLAGS_cp.empty()) {
+            compareProfiling(blob_bin, output_bin);
+            return 0;
+        }
 
         auto blobData = std::make_pair(blob_bin.data(), blob_bin.size());
         auto profilingData = std::make_pair(output_bin.data(), output_bin.size());
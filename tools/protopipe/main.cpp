@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: Apache 2.0
 //
 
+#include <algorithm>
 #include <future>
 #include <iostream>
 
@@ -15,46 +16,64 @@ struct PerformanceMetrics {
     double avg_latency_ms;
     double min_latency_ms;
     double max_latency_ms;
+    double p50_latency_ms;
+    double p90_latency_ms;
+    double p99_latency_ms;
+    double p999_latency_ms;
+    double avg_queue_delay_ms;
+    double p99_queue_delay_ms;
+    double avg_service_time_ms;
+    double p99_service_time_ms;
+    // NB: -1 if stream has no deadline.
+    int64_t deadline_misses;
     int64_t total_frames;
     int64_t elapsed;
     double fps;
     int64_t dropped;
 };
 
-PerformanceMetrics calculateMetrics(const SimulationExecutor::Output& simout) {
-    if (simout.latency.empty()) {
-        throw std::logic_error("Latency vector is empty after simulation");
-    }
-
-    if (simout.seq_ids.empty()) {
-        throw std::logic_error("Frame id vector is empty after simulation");
+PerformanceMetrics calculateMetrics(const SimulationExecutor::Output& simout, const bool has_deadline) {
+    if (simout.latency.count() == 0) {
+        throw std::logic_error("No frames have been processed during simulation");
     }
 
     PerformanceMetrics metrics;
 
-    metrics.first_latency_ms = simout.latency[0] / 1000.0;
-    metrics.avg_latency_ms = utils::avg(simout.latency) / 1000.0;
-    metrics.min_latency_ms = utils::min(simout.latency) / 1000.0;
-    metrics.max_latency_ms = utils::max(simout.latency) / 1000.0;
+    metrics.first_latency_ms = simout.first_latency / 1000.0;
+    metrics.avg_latency_ms = simout.latency.avg() / 1000.0;
+    metrics.min_latency_ms = simout.latency.min() / 1000.0;
+    metrics.max_latency_ms = simout.latency.max() / 1000.0;
+    metrics.p50_latency_ms = simout.latency.percentile(50) / 1000.0;
+    metrics.p90_latency_ms = simout.latency.percentile(90) / 1000.0;
+    metrics.p99_latency_ms = simout.latency.percentile(99) / 1000.0;
+    metrics.p999_latency_ms = simout.latency.percentile(99.9) / 1000.0;
+    metrics.avg_queue_delay_ms = simout.queue_delay.avg() / 1000.0;
+    metrics.p99_queue_delay_ms = simout.queue_delay.percentile(99) / 1000.0;
+    metrics.avg_service_time_ms = simout.service_time.avg() / 1000.0;
+    metrics.p99_service_time_ms = simout.service_time.percentile(99) / 1000.0;
+    metrics.deadline_misses = has_deadline ? simout.deadline_misses : -1;
     metrics.elapsed = static_cast<int64_t>(simout.elapsed / 1000.0);
 
-    metrics.fps = simout.latency.size() / static_cast<double>(metrics.elapsed) * 1000;
+    metrics.fps = simout.latency.count() / static_cast<double>(metrics.elapsed) * 1000;
 
-    metrics.dropped = 0;
-    int64_t prev_seq_id = simout.seq_ids[0];
-    for (size_t i = 1; i < simout.seq_ids.size(); ++i) {
-        metrics.dropped += simout.seq_ids[i] - prev_seq_id - 1;
-        prev_seq_id = simout.seq_ids[i];
-    }
-
-    metrics.total_frames = simout.seq_ids.back() + 1;
+    metrics.dropped = simout.dropped;
+    metrics.total_frames = simout.total_frames;
     return metrics;
 };
 
 std::ostream& operator<<(std::ostream& os, const PerformanceMetrics& metrics) {
     os << "throughput: " << metrics.fps << " FPS, latency: min: " << metrics.min_latency_ms
-       << " ms, avg: " << metrics.avg_latency_ms << " ms, max: " << metrics.max_latency_ms
+       << " ms, avg: " << metrics.avg_latency_ms << " ms, p50: " << metrics.p50_latency_ms
+       << " ms, p90: " << metrics.p90_latency_ms << " ms, p99: " << metrics.p99_latency_ms
+       << " ms, p99.9: " << metrics.p999_latency_ms << " ms, max: " << metrics.max_latency_ms
+       << " ms, queueing delay: avg: " << metrics.avg_queue_delay_ms << " ms, p99: " << metrics.p99_queue_delay_ms
+       << " ms, service time: avg: " << metrics.avg_service_time_ms << " ms, p99: " << metrics.p99_service_time_ms
        << " ms, frames dropped: " << metrics.dropped << "/" << metrics.total_frames;
+    if (metrics.deadline_misses != -1) {
+        const auto processed = metrics.total_frames - metrics.dropped;
+        os << ", deadline misses: " << metrics.deadline_misses << "/" << processed << " ("
+           << 100.0 * metrics.deadline_misses / std::max<int64_t>(processed, 1) << "%)";
+    }
     return os;
 }
 
@@ -63,12 +82,18 @@ static constexpr char cfg_message[] = "Path to the configuration file.";
 static constexpr char pipeline_message[] = "Optional. Enable pipelined execution.";
 static constexpr char drop_message[] = "Optional. Drop frames if they come earlier than pipeline is completed.";
 static constexpr char api1_message[] = "Optional. Use legacy Inference Engine API.";
+static constexpr char stats_output_message[] =
+        "Optional. Path to the file to dump periodic throughput and latency snapshots of every stream. "
+        "CSV format is used for *.csv files, JSON lines otherwise.";
+static constexpr char stats_interval_message[] = "Optional. Period of the snapshots in seconds (default: 10).";
 
 DEFINE_bool(h, false, help_message);
 DEFINE_string(cfg, "", cfg_message);
 DEFINE_bool(pipeline, false, pipeline_message);
 DEFINE_bool(drop_frames, false, drop_message);
 DEFINE_bool(ov_api_1_0, false, api1_message);
+DEFINE_string(stats_output, "", stats_output_message);
+DEFINE_uint32(stats_interval, 10, stats_interval_message);
 
 static void showUsage() {
     std::cout << "protopipe [OPTIONS]" << std::endl;
@@ -79,6 +104,8 @@ static void showUsage() {
     std::cout << "    -pipeline    " << pipeline_message << std::endl;
     std::cout << "    -drop_frames " << drop_message << std::endl;
     std::cout << "    -ov_api_1_0  " << api1_message << std::endl;
+    std::cout << "    -stats_output <value>   " << stats_output_message << std::endl;
+    std::cout << "    -stats_interval <value> " << stats_interval_message << std::endl;
     std::cout << std::endl;
 }
 
@@ -98,6 +125,13 @@ bool parseCommandLine(int* argc, char*** argv) {
     std::cout << "    Config file:           " << FLAGS_cfg << std::endl;
     std::cout << "    Pipelining is enabled: " << std::boolalpha << FLAGS_pipeline << std::endl;
     std::cout << "    Use old OpenVINO API:  " << std::boolalpha << FLAGS_ov_api_1_0 << std::endl;
+    if (!FLAGS_stats_output.empty()) {
+        if (FLAGS_stats_interval == 0) {
+            throw std::invalid_argument("Statistics interval must be positive");
+        }
+        std::cout << "    Statistics output:     " << FLAGS_stats_output << " (every " << FLAGS_stats_interval
+                  << " s)" << std::endl;
+    }
     return true;
 }
 
@@ -110,7 +144,13 @@ int main(int argc, char* argv[]) {
         auto provider = std::make_shared<ScenarioProvider>(FLAGS_cfg, FLAGS_ov_api_1_0);
         auto scenarios = provider->createScenarios();
 
-        for (auto&& scenario : scenarios) {
+        ITimeSeriesWriter::Ptr stats_writer;
+        if (!FLAGS_stats_output.empty()) {
+            stats_writer = ITimeSeriesWriter::create(FLAGS_stats_output);
+        }
+
+        for (size_t scenario_idx = 0; scenario_idx < scenarios.size(); ++scenario_idx) {
+            auto&& scenario = scenarios[scenario_idx];
             using O = SimulationExecutor::Output;
             std::vector<std::future<O>> results;
             std::vector<std::packaged_task<O()>> tasks;
@@ -129,6 +169,9 @@ int main(int argc, char* argv[]) {
                                            std::move(proto->compile_args));
                 }
                 exec->setSource(std::move(proto->inputs));
+                exec->setStatisticsInfo(SimulationExecutor::StatisticsInfo{
+                        scenario_idx, executors.size(), proto->deadline_in_us,
+                        static_cast<int64_t>(FLAGS_stats_interval) * 1000000, stats_writer});
                 executors.push_back(std::move(exec));
             }
 
@@ -169,7 +212,7 @@ int main(int argc, char* argv[]) {
                 std::stringstream ss;
                 ss << "stream " << std::to_string(i) << ": ";
                 try {
-                    ss << calculateMetrics(results[i].get());
+                    ss << calculateMetrics(results[i].get(), scenario.protocols[i]->deadline_in_us != 0);
                 } catch (const std::exception& e) {
                     any_stream_failed = true;
                     ss << e.what();
@@ -0,0 +1,132 @@
+//
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "arrival_process.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <stdexcept>
+
+// NB: Time is measured in whole microseconds, so frames can't arrive more often than once per microsecond.
+// Otherwise zero intervals would never advance the arrival time.
+static constexpr double kMaxRate = 1e6;
+static constexpr int64_t kMinIntervalUs = 1;
+
+static void checkRate(double rate) {
+    if (rate <= 0.0 || rate > kMaxRate) {
+        throw std::logic_error("Arrival rate must be in (0, " + std::to_string(kMaxRate) +
+                               "] frames per second, got: " + std::to_string(rate));
+    }
+}
+
+// NB: Rounding of the short random intervals mustn't produce zero.
+static int64_t toIntervalUs(double interval) {
+    return std::max(kMinIntervalUs, static_cast<int64_t>(std::llround(interval)));
+}
+
+// NB: Distributions are parametrized by rate per microsecond.
+static double ratePerUs(double rate) {
+    checkRate(rate);
+    return rate / 1e6;
+}
+
+PeriodicArrival::PeriodicArrival(double rate) {
+    checkRate(rate);
+    m_interval_us = static_cast<int64_t>(1000 * 1000 / rate);
+}
+
+int64_t PeriodicArrival::next() {
+    return m_interval_us;
+}
+
+IArrivalProcess::Ptr PeriodicArrival::clone() const {
+    return std::make_shared<PeriodicArrival>(*this);
+}
+
+PoissonArrival::PoissonArrival(double rate, uint64_t seed): m_gen(seed), m_dist(ratePerUs(rate)) {
+}
+
+int64_t PoissonArrival::next() {
+    return toIntervalUs(m_dist(m_gen));
+}
+
+IArrivalProcess::Ptr PoissonArrival::clone() const {
+    return std::make_shared<PoissonArrival>(*this);
+}
+
+BurstyArrival::BurstyArrival(double rate, int64_t on_us, int64_t off_us, uint64_t seed)
+        : m_gen(seed), m_dist(ratePerUs(rate)), m_on_us(on_us), m_off_us(off_us), m_on_left_us(on_us) {
+    if (m_on_us <= 0 || m_off_us < 0) {
+        throw std::logic_error("Bursty arrival requires positive \"on\" and non-negative \"off\" periods");
+    }
+}
+
+int64_t BurstyArrival::next() {
+    /*
+     *     on          off         on
+     *  |-*--*-*---|----------|--*-*------|---->
+     *
+     * NB: Interval which doesn't fit into the rest of the "on" period
+     * is continued in the next "on" period after the "off" one.
+     */
+    int64_t interval = 0;
+    auto gap = toIntervalUs(m_dist(m_gen));
+    while (gap > m_on_left_us) {
+        gap -= m_on_left_us;
+        interval += m_on_left_us + m_off_us;
+        m_on_left_us = m_on_us;
+    }
+    m_on_left_us -= gap;
+    return interval + gap;
+}
+
+IArrivalProcess::Ptr BurstyArrival::clone() const {
+    return std::make_shared<BurstyArrival>(*this);
+}
+
+static std::vector<int64_t> readIntervals(const std::string& filepath) {
+    std::ifstream file(filepath);
+    if (!file.is_open()) {
+        throw std::logic_error("Failed to open arrival trace file: " + filepath);
+    }
+
+    std::vector<int64_t> timestamps;
+    int64_t ts = 0;
+    while (file >> ts) {
+        timestamps.push_back(ts);
+    }
+    if (!file.eof()) {
+        throw std::logic_error("Failed to parse arrival trace file: " + filepath);
+    }
+    if (timestamps.size() < 2) {
+        throw std::logic_error("Arrival trace file must contain at least two timestamps: " + filepath);
+    }
+
+    std::vector<int64_t> intervals;
+    for (size_t i = 1; i < timestamps.size(); ++i) {
+        if (timestamps[i] - timestamps[i - 1] < kMinIntervalUs) {
+            throw std::logic_error("Timestamps in arrival trace file must be in strictly ascending order: " +
+                                   filepath);
+        }
+        intervals.push_back(timestamps[i] - timestamps[i - 1]);
+    }
+    return intervals;
+}
+
+TraceArrival::TraceArrival(const std::string& filepath)
+        : m_intervals(std::make_shared<const std::vector<int64_t>>(readIntervals(filepath))) {
+}
+
+int64_t TraceArrival::next() {
+    const auto interval = (*m_intervals)[m_pos];
+    m_pos = (m_pos + 1) % m_intervals->size();
+    return interval;
+}
+
+IArrivalProcess::Ptr TraceArrival::clone() const {
+    // NB: Trace itself is shared between copies.
+    return std::make_shared<TraceArrival>(*this);
+}
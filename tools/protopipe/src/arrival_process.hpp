@@ -0,0 +1,78 @@
+//
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+// NB: Generates intervals between consecutive frame arrivals.
+// Arrivals don't depend on how fast frames are processed (open-loop).
+struct IArrivalProcess {
+    using Ptr = std::shared_ptr<IArrivalProcess>;
+    // NB: Returns the interval to the next arrival in microseconds, it is always positive.
+    virtual int64_t next() = 0;
+    // NB: Every source must have its own copy since processes are stateful.
+    virtual Ptr clone() const = 0;
+    virtual ~IArrivalProcess() = default;
+};
+
+class PeriodicArrival : public IArrivalProcess {
+public:
+    explicit PeriodicArrival(double rate);
+
+    int64_t next() override;
+    IArrivalProcess::Ptr clone() const override;
+
+private:
+    int64_t m_interval_us;
+};
+
+// NB: Exponentially distributed intervals with the given mean rate (frames per second).
+class PoissonArrival : public IArrivalProcess {
+public:
+    PoissonArrival(double rate, uint64_t seed);
+
+    int64_t next() override;
+    IArrivalProcess::Ptr clone() const override;
+
+private:
+    std::mt19937_64 m_gen;
+    std::exponential_distribution<double> m_dist;
+};
+
+// NB: Poisson arrivals with the given rate during "on" periods and no arrivals during "off" periods.
+class BurstyArrival : public IArrivalProcess {
+public:
+    BurstyArrival(double rate, int64_t on_us, int64_t off_us, uint64_t seed);
+
+    int64_t next() override;
+    IArrivalProcess::Ptr clone() const override;
+
+private:
+    std::mt19937_64 m_gen;
+    std::exponential_distribution<double> m_dist;
+    int64_t m_on_us;
+    int64_t m_off_us;
+    // NB: Time left till the end of the current "on" period.
+    int64_t m_on_left_us;
+};
+
+// NB: Replays the intervals between timestamps recorded in the trace file, repeatedly.
+class TraceArrival : public IArrivalProcess {
+public:
+    // NB: Trace file contains one timestamp in microseconds per line in strictly ascending order.
+    explicit TraceArrival(const std::string& filepath);
+
+    int64_t next() override;
+    IArrivalProcess::Ptr clone() const override;
+
+private:
+    std::shared_ptr<const std::vector<int64_t>> m_intervals;
+    size_t m_pos = 0;
+};
@@ -130,6 +130,34 @@ struct convert<Network> {
     }
 };
 
+template <>
+struct convert<Arrival> {
+    static bool decode(const Node& node, Arrival& arrival) {
+        if (!node["type"]) {
+            throw std::logic_error("Arrival must contain \"type\" key");
+        }
+        arrival.type = node["type"].as<std::string>();
+        if (arrival.type != "periodic" && arrival.type != "poisson" && arrival.type != "bursty" &&
+            arrival.type != "trace") {
+            throw std::logic_error("Unsupported arrival type: " + arrival.type);
+        }
+
+        arrival.rate = node["rate"] ? node["rate"].as<double>() : 0.0;
+        arrival.on_time_in_ms = node["on_time_in_ms"] ? node["on_time_in_ms"].as<uint64_t>() : 0;
+        arrival.off_time_in_ms = node["off_time_in_ms"] ? node["off_time_in_ms"].as<uint64_t>() : 0;
+        arrival.seed = node["seed"] ? node["seed"].as<uint64_t>() : 0;
+
+        if (arrival.type == "trace") {
+            if (!node["file"]) {
+                throw std::logic_error("Trace arrival must contain \"file\" key");
+            }
+            arrival.trace_file = node["file"].as<std::string>();
+        }
+
+        return true;
+    }
+};
+
 template <>
 struct convert<Stream> {
     static bool decode(const Node& node, Stream& stream) {
@@ -140,6 +168,16 @@ struct convert<Stream> {
         stream.after_stream_delay = node["after_stream_delay"] ? node["after_stream_delay"].as<uint64_t>() : 0;
         stream.iteration_count = node["iteration_count"] ? node["iteration_count"].as<size_t>() : 0;
         stream.exec_time_in_secs = node["exec_time_in_secs"] ? node["exec_time_in_secs"].as<size_t>() : 0;
+        stream.deadline_in_us = node["deadline_in_us"] ? node["deadline_in_us"].as<uint64_t>() : 0;
+
+        if (node["arrival"]) {
+            auto arrival = node["arrival"].as<Arrival>();
+            // NB: Rate might be omitted for the same rate as target_fps.
+            if (arrival.rate == 0.0) {
+                arrival.rate = stream.target_fps;
+            }
+            stream.arrival = cv::util::make_optional(std::move(arrival));
+        }
 
         // Set default exec_time to 60 seconds if both iteration count and exec time are not set
         if (stream.iteration_count == 0 && stream.exec_time_in_secs == 0) {
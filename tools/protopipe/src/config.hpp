@@ -11,7 +11,8 @@
 #include <string>
 #include <vector>
 
-#include <opencv2/gapi/util/variant.hpp>  // variant
+#include <opencv2/gapi/util/optional.hpp>  // optional
+#include <opencv2/gapi/util/variant.hpp>   // variant
 
 struct Network {
     Path path;
@@ -30,6 +31,17 @@ struct Network {
     LayerVariantAttr<std::string> output_data;
 };
 
+struct Arrival {
+    // NB: Possible values: periodic, poisson, bursty, trace.
+    std::string type;
+    // NB: Frames per second (for bursty - during "on" periods).
+    double rate = 0.0;
+    uint64_t on_time_in_ms = 0;
+    uint64_t off_time_in_ms = 0;
+    std::string trace_file;
+    uint64_t seed = 0;
+};
+
 struct Stream {
     std::vector<Network> networks;
     uint32_t target_fps;
@@ -37,6 +49,9 @@ struct Stream {
     uint64_t after_stream_delay;
     size_t exec_time_in_secs;
     size_t iteration_count;
+    // NB: If not set, frames are produced with target_fps rate.
+    cv::util::optional<Arrival> arrival;
+    uint64_t deadline_in_us;
 };
 using Streams = std::vector<Stream>;
 
@@ -7,10 +7,29 @@
 
 #include <opencv2/gapi/streaming/meta.hpp>
 
+DummySource::DummySource(IArrivalProcess::Ptr arrival, const cv::Mat& mat)
+        : m_latency(0), m_drop_frames(false), m_timer(IWaitable::create()), m_arrival(std::move(arrival)), m_mat(mat) {
+}
+
+DummySource::DummySource(const DummySource& other)
+        : m_latency(other.m_latency),
+          m_drop_frames(other.m_drop_frames),
+          m_timer(other.m_timer),
+          // NB: Arrival process is stateful, so copy mustn't affect the original arrivals.
+          m_arrival(other.m_arrival ? other.m_arrival->clone() : nullptr),
+          m_mat(other.m_mat),
+          m_next_tick_ts(other.m_next_tick_ts),
+          m_curr_seq_id(other.m_curr_seq_id) {
+}
+
 bool DummySource::pull(cv::gapi::wip::Data& data) {
     using namespace std::chrono;
     using namespace cv::gapi::streaming;
 
+    if (m_arrival) {
+        return pullArrival(data);
+    }
+
     // NB: Wait m_latency before return the first frame.
     if (m_next_tick_ts == -1) {
         m_next_tick_ts = utils::timestamp<ts_t>() + m_latency;
@@ -58,7 +77,9 @@ bool DummySource::pull(cv::gapi::wip::Data& data) {
     // after assigning it to the data.
     cv::Mat mat = m_mat;
 
-    data.meta[meta_tag::timestamp] = utils::timestamp<ts_t>();
+    const auto ts = utils::timestamp<ts_t>();
+    data.meta[meta_tag::timestamp] = ts;
+    data.meta[kDispatchTimestampTag] = ts;
     data.meta[meta_tag::seq_id] = m_curr_seq_id++;
     data = mat;
     m_next_tick_ts += m_latency;
@@ -66,6 +87,48 @@ bool DummySource::pull(cv::gapi::wip::Data& data) {
     return true;
 }
 
+bool DummySource::pullArrival(cv::gapi::wip::Data& data) {
+    using namespace cv::gapi::streaming;
+
+    // NB: The first frame arrives after the first interval.
+    if (m_next_tick_ts == -1) {
+        m_next_tick_ts = utils::timestamp<ts_t>() + m_arrival->next();
+    }
+
+    int64_t curr_ts = utils::timestamp<ts_t>();
+    if (m_drop_frames) {
+        /*
+         *                         curr_ts
+         *          x       x  x      |     +
+         *    ------|-------|--|------*-----|------->
+         *
+         * NB: Drop all frames which have already arrived, but haven't been pulled yet.
+         */
+        while (m_next_tick_ts < curr_ts) {
+            m_next_tick_ts += m_arrival->next();
+            ++m_curr_seq_id;
+        }
+    }
+
+    // NB: Otherwise frames which have already arrived are returned immediately
+    // one by one in the arrival order, the difference between the pull time and
+    // the arrival time is the queueing delay.
+    if (curr_ts < m_next_tick_ts) {
+        m_timer->wait(ts_t{m_next_tick_ts - curr_ts});
+    }
+    // NB: Just increase reference counter not to release mat memory
+    // after assigning it to the data.
+    cv::Mat mat = m_mat;
+
+    data.meta[meta_tag::timestamp] = m_next_tick_ts;
+    data.meta[kDispatchTimestampTag] = utils::timestamp<ts_t>();
+    data.meta[meta_tag::seq_id] = m_curr_seq_id++;
+    data = mat;
+    m_next_tick_ts += m_arrival->next();
+
+    return true;
+}
+
 cv::GMetaArg DummySource::descr_of() const {
     return cv::GMetaArg{cv::descr_of(m_mat)};
 }
@@ -12,13 +12,22 @@
 #include <opencv2/gapi.hpp>
 #include <opencv2/gapi/streaming/source.hpp>  // cv::gapi::wip::IStreamSource
 
+#include "arrival_process.hpp"
 #include "timer.hpp"
 #include "utils.hpp"
 
 class DummySource final : public cv::gapi::wip::IStreamSource {
 public:
+    // NB: Meta tag of the time when frame is pulled from the source.
+    // Timestamp meta contains the time when frame arrives.
+    static constexpr const char* kDispatchTimestampTag = "protopipe.dispatch_timestamp";
+
     template <typename DurationT>
     DummySource(const DurationT latency, const cv::Mat& mat);
+    // NB: Open-loop source: frames arrive according to the arrival process
+    // regardless of how fast they are pulled, so late pulls accumulate queueing delay.
+    DummySource(IArrivalProcess::Ptr arrival, const cv::Mat& mat);
+    DummySource(const DummySource& other);
 
     bool pull(cv::gapi::wip::Data& data) override;
     cv::GMetaArg descr_of() const override;
@@ -27,9 +36,12 @@ public:
     void setDropFrames(const bool drop_frames);
 
 private:
+    bool pullArrival(cv::gapi::wip::Data& data);
+
     int64_t m_latency;
     bool m_drop_frames;
     IWaitable::Ptr m_timer;
+    IArrivalProcess::Ptr m_arrival;
 
     cv::Mat m_mat;
     int64_t m_next_tick_ts = -1;
@@ -136,6 +136,25 @@ cv::gapi::GNetPackage ScenarioProvider::createInferenceParams(const std::string&
     return m_use_ov_old_api ? createIEParams(tag, network) : createOVParams(tag, network);
 }
 
+static IArrivalProcess::Ptr createArrivalProcess(const Arrival& arrival, const size_t stream_id) {
+    // NB: Streams with the same arrival config mustn't produce the same arrivals.
+    const uint64_t seed = arrival.seed + stream_id;
+    if (arrival.type == "periodic") {
+        return std::make_shared<PeriodicArrival>(arrival.rate);
+    }
+    if (arrival.type == "poisson") {
+        return std::make_shared<PoissonArrival>(arrival.rate, seed);
+    }
+    if (arrival.type == "bursty") {
+        return std::make_shared<BurstyArrival>(arrival.rate, arrival.on_time_in_ms * 1000,
+                                               arrival.off_time_in_ms * 1000, seed);
+    }
+    if (arrival.type == "trace") {
+        return std::make_shared<TraceArrival>(arrival.trace_file);
+    }
+    throw std::logic_error("Unsupported arrival type: " + arrival.type);
+}
+
 static cv::Mat createFromBinFile(const std::string& filename, const std::vector<int>& dims, const int prec) {
     cv::Mat mat;
     utils::createNDMat(mat, dims, prec);
@@ -244,11 +263,19 @@ std::vector<Scenario> ScenarioProvider::createScenarios() {
                     if (layer_idx == 0) {
                         // NB: First layer of the first model connects directly to source.
                         if (network_idx == 0) {
-                            // NB: 0 is special value means no limit fps for source.
-                            const auto latency_in_us =
-                                    stream.target_fps != 0 ? static_cast<uint32_t>(1000 * 1000 / stream.target_fps) : 0;
                             using S = cv::gapi::wip::IStreamSource::Ptr;
-                            S src = std::make_shared<DummySource>(std::chrono::microseconds{latency_in_us}, layer_data);
+                            S src;
+                            if (stream.arrival.has_value()) {
+                                src = std::make_shared<DummySource>(
+                                        createArrivalProcess(stream.arrival.value(), stream_id), layer_data);
+                            } else {
+                                // NB: 0 is special value means no limit fps for source.
+                                const auto latency_in_us =
+                                        stream.target_fps != 0 ? static_cast<uint32_t>(1000 * 1000 / stream.target_fps)
+                                                               : 0;
+                                src = std::make_shared<DummySource>(std::chrono::microseconds{latency_in_us},
+                                                                    layer_data);
+                            }
                             builder.addGraphInput(curr_id);
                             pipeline_inputs += cv::gin(src);
                         } else {
@@ -308,7 +335,8 @@ std::vector<Scenario> ScenarioProvider::createScenarios() {
                     std::make_shared<StreamSimulation>(builder.build(), num_outputs, std::move(validation_info));
             std::shared_ptr<ExecutionProtocol> protocol(new ExecutionProtocol{
                     std::move(simulation), std::move(pipeline_inputs),
-                    cv::compile_args(networks, cv::gapi::kernels<GCPUDummy>()), std::move(criterion)});
+                    cv::compile_args(networks, cv::gapi::kernels<GCPUDummy>()), std::move(criterion),
+                    static_cast<int64_t>(stream.deadline_in_us)});
 
             scenario.protocols.push_back(std::move(protocol));
             ++stream_id;
@@ -17,6 +17,8 @@ struct ExecutionProtocol {
     cv::GRunArgs inputs;
     cv::GCompileArgs compile_args;
     ITermCriterion::Ptr criterion;
+    // NB: 0 - no deadline.
+    int64_t deadline_in_us = 0;
 };
 
 struct Scenario {
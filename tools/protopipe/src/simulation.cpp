@@ -6,6 +6,9 @@
 #include "simulation.hpp"
 #include "simulation_executor.hpp"
 
+// FIXME: Ideally simulation shouldn't know about specific type of source.
+#include "dummy_source.hpp"
+
 cv::GProtoArgs GraphInputs::produce() {
     if (m_inputs.empty()) {
         throw std::logic_error("GraphInputs is empty");
@@ -23,6 +26,7 @@ cv::GProtoArgs GraphOutputs::produce() {
     cv::GMat g = cv::util::get<cv::GMat>(outputs[0]);
     outputs.emplace_back(cv::gapi::streaming::timestamp(g).strip());
     outputs.emplace_back(cv::gapi::streaming::seq_id(g).strip());
+    outputs.emplace_back(cv::gapi::streaming::meta<int64_t>(g, DummySource::kDispatchTimestampTag).strip());
     return outputs;
 }
 
@@ -38,6 +38,20 @@ void SimulationExecutor::setSource(cv::GRunArgs&& ins) {
     m_pipeline_inputs = std::move(ins);
 }
 
+void SimulationExecutor::setStatisticsInfo(StatisticsInfo&& info) {
+    m_stats_info = std::move(info);
+}
+
+FrameStatistics SimulationExecutor::createFrameStatistics() const {
+    return FrameStatistics{m_stats_info.scenario_idx, m_stats_info.stream_idx, m_stats_info.deadline_us,
+                           m_stats_info.window_us, m_stats_info.writer};
+}
+
+SimulationExecutor::Output SimulationExecutor::makeOutput(const FrameStatistics& stats, int64_t elapsed) {
+    return Output{stats.latency(), stats.queueDelay(),      stats.serviceTime(), stats.firstLatency(),
+                  stats.dropped(), stats.deadlineMisses(), stats.totalFrames(), elapsed};
+}
+
 SyncExecutor::SyncExecutor(cv::GCompiled&& compiled): m_compiled(std::move(compiled)) {
 }
 
@@ -67,7 +81,8 @@ void SyncExecutor::runWarmup() {
 
     int64_t ts = -1;
     int64_t seq_id = -1;
-    pipeline_outputs += cv::gout(ts, seq_id);
+    int64_t dispatch_ts = -1;
+    pipeline_outputs += cv::gout(ts, seq_id, dispatch_ts);
 
     m_compiled(std::move(pipeline_inputs), std::move(pipeline_outputs));
 }
@@ -95,39 +110,42 @@ SimulationExecutor::Output SyncExecutor::runLoop(ITermCriterion::Ptr criterion)
     using namespace std::chrono;
     using clock_t = high_resolution_clock;
 
-    SimulationExecutor::Output simout;
+    auto stats = createFrameStatistics();
     int64_t ts = -1;
     int64_t seq_id = -1;
+    int64_t dispatch_ts = -1;
 
     criterion->init();
 
     auto start = clock_t::now();
+    stats.start();
     while (criterion->check()) {
         auto pipeline_inputs = fetchInputs(cv::GRunArgs{m_pipeline_inputs});
         auto pipeline_outputs = outputs();
-        pipeline_outputs += cv::gout(ts, seq_id);
+        pipeline_outputs += cv::gout(ts, seq_id, dispatch_ts);
 
         m_compiled(std::move(pipeline_inputs), std::move(pipeline_outputs));
 
-        simout.latency.push_back(utils::timestamp<microseconds>() - ts);
-        simout.seq_ids.push_back(seq_id);
+        stats.record(utils::timestamp<microseconds>() - ts, dispatch_ts - ts, seq_id);
 
         postIterationCallback();
         criterion->update();
     }
 
-    simout.elapsed = duration_cast<microseconds>(clock_t::now() - start).count();
-    return simout;
+    stats.finish();
+
+    return makeOutput(stats, duration_cast<microseconds>(clock_t::now() - start).count());
 };
 
 PipelinedExecutor::PipelinedExecutor(cv::GStreamingCompiled&& stream): m_stream(std::move(stream)) {
 }
 
 void PipelinedExecutor::runWarmup() {
-    cv::optional<int64_t> ts, seq_id;
+    cv::optional<int64_t> ts, seq_id, dispatch_ts;
     auto pipeline_outputs = outputs();
     pipeline_outputs.emplace_back(cv::gout(ts)[0]);
     pipeline_outputs.emplace_back(cv::gout(seq_id)[0]);
+    pipeline_outputs.emplace_back(cv::gout(dispatch_ts)[0]);
 
     m_stream.setSource(copyInputs(m_pipeline_inputs));
     m_stream.start();
@@ -143,8 +161,8 @@ SimulationExecutor::Output PipelinedExecutor::runLoop(ITermCriterion::Ptr criter
     using namespace std::chrono;
     using clock_t = high_resolution_clock;
 
-    SimulationExecutor::Output simout;
-    cv::optional<int64_t> ts, seq_id;
+    auto stats = createFrameStatistics();
+    cv::optional<int64_t> ts, seq_id, dispatch_ts;
 
     m_stream.setSource(cv::GRunArgs{m_pipeline_inputs});
     m_stream.start();
@@ -152,11 +170,13 @@ SimulationExecutor::Output PipelinedExecutor::runLoop(ITermCriterion::Ptr criter
     criterion->init();
 
     auto start = clock_t::now();
+    stats.start();
     while (criterion->check()) {
         auto pipeline_outputs = outputs();
         // FIXME: No cv::GOptRunAgsP::operator+=
         pipeline_outputs.emplace_back(cv::gout(ts)[0]);
         pipeline_outputs.emplace_back(cv::gout(seq_id)[0]);
+        pipeline_outputs.emplace_back(cv::gout(dispatch_ts)[0]);
 
         if (!m_stream.pull(cv::GOptRunArgsP{pipeline_outputs})) {
             // FIXME: Need to handle early stop somehow...
@@ -166,18 +186,19 @@ SimulationExecutor::Output PipelinedExecutor::runLoop(ITermCriterion::Ptr criter
         if (!ts.has_value()) {
             throw std::logic_error("PipelinedExecutor failed to obtain timestamp!");
         }
-        simout.latency.push_back(utils::timestamp<microseconds>() - ts.value());
-
         if (!seq_id.has_value()) {
             throw std::logic_error("PipelinedExecutor failed to obtain timestamp!");
         }
-        simout.seq_ids.push_back(seq_id.value());
+        if (!dispatch_ts.has_value()) {
+            throw std::logic_error("PipelinedExecutor failed to obtain dispatch timestamp!");
+        }
+        stats.record(utils::timestamp<microseconds>() - ts.value(), dispatch_ts.value() - ts.value(), seq_id.value());
 
         postIterationCallback();
         criterion->update();
     }
     m_stream.stop();
+    stats.finish();
 
-    simout.elapsed = duration_cast<microseconds>(clock_t::now() - start).count();
-    return simout;
+    return makeOutput(stats, duration_cast<microseconds>(clock_t::now() - start).count());
 }
@@ -13,6 +13,7 @@
 #include <opencv2/gapi/streaming/meta.hpp>
 
 #include "criterion.hpp"
+#include "statistics.hpp"
 #include "utils.hpp"
 
 class SimulationExecutor {
@@ -20,12 +21,32 @@ public:
     using Ptr = std::shared_ptr<SimulationExecutor>;
 
     struct Output {
-        std::vector<int64_t> latency;
-        std::vector<int64_t> seq_ids;
+        // NB: Since frame arrival till its completion.
+        LatencyHistogram latency;
+        // NB: Since frame arrival till it's pulled from the source.
+        LatencyHistogram queue_delay;
+        // NB: Since frame is pulled from the source till its completion.
+        LatencyHistogram service_time;
+        int64_t first_latency;
+        int64_t dropped;
+        int64_t deadline_misses;
+        int64_t total_frames;
         int64_t elapsed;
     };
 
+    struct StatisticsInfo {
+        size_t scenario_idx = 0;
+        size_t stream_idx = 0;
+        // NB: Frames with latency above deadline are counted as missed, 0 - no deadline.
+        int64_t deadline_us = 0;
+        // NB: Period of the time series snapshots.
+        int64_t window_us = 0;
+        // NB: Time series aren't collected if writer isn't set.
+        ITimeSeriesWriter::Ptr writer;
+    };
+
     virtual void setSource(cv::GRunArgs&& sources);
+    void setStatisticsInfo(StatisticsInfo&& info);
     virtual Output runLoop(ITermCriterion::Ptr criterion) = 0;
 
     virtual void runWarmup(){/* do nothing (default) */};
@@ -36,7 +57,11 @@ public:
     virtual ~SimulationExecutor() = default;
 
 protected:
+    FrameStatistics createFrameStatistics() const;
+    static Output makeOutput(const FrameStatistics& stats, int64_t elapsed);
+
     cv::GRunArgs m_pipeline_inputs;
+    StatisticsInfo m_stats_info;
 };
 
 class SyncExecutor : public SimulationExecutor {
@@ -0,0 +1,299 @@
+//
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "statistics.hpp"
+#include "utils.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+
+static constexpr int kSubBucketBits = 7;
+static constexpr int64_t kSubBucketCount = int64_t{1} << kSubBucketBits;
+static constexpr int64_t kSubBucketHalfCount = kSubBucketCount / 2;
+
+static int mostSignificantBit(uint64_t value) {
+    int msb = 0;
+    while (value >>= 1) {
+        ++msb;
+    }
+    return msb;
+}
+
+size_t LatencyHistogram::bucketIndex(int64_t value) {
+    /*
+     * NB: [0, kSubBucketCount) values are mapped 1:1.
+     * Every next [2^k, 2^(k+1)) range is mapped to kSubBucketHalfCount buckets:
+     *
+     *    shift = k - (kSubBucketBits - 1)
+     *    index = shift * kSubBucketHalfCount + (value >> shift)
+     *
+     * where (value >> shift) is always in [kSubBucketHalfCount, kSubBucketCount).
+     */
+    if (value < kSubBucketCount) {
+        return static_cast<size_t>(value);
+    }
+    const int shift = mostSignificantBit(static_cast<uint64_t>(value)) - (kSubBucketBits - 1);
+    return static_cast<size_t>(shift * kSubBucketHalfCount + (value >> shift));
+}
+
+int64_t LatencyHistogram::bucketUpperBound(size_t idx) {
+    const auto index = static_cast<int64_t>(idx);
+    if (index < kSubBucketCount) {
+        return index;
+    }
+    const int64_t shift = index / kSubBucketHalfCount - 1;
+    const int64_t mantissa = index - shift * kSubBucketHalfCount;
+    return ((mantissa + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(int64_t value) {
+    value = std::max<int64_t>(value, 0);
+
+    const auto idx = bucketIndex(value);
+    if (idx >= m_counts.size()) {
+        m_counts.resize(idx + 1, 0);
+    }
+    ++m_counts[idx];
+
+    m_min = m_count == 0 ? value : std::min(m_min, value);
+    m_max = m_count == 0 ? value : std::max(m_max, value);
+    m_sum += value;
+    ++m_count;
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    if (other.m_count == 0) {
+        return;
+    }
+    if (other.m_counts.size() > m_counts.size()) {
+        m_counts.resize(other.m_counts.size(), 0);
+    }
+    for (size_t i = 0; i < other.m_counts.size(); ++i) {
+        m_counts[i] += other.m_counts[i];
+    }
+
+    m_min = m_count == 0 ? other.m_min : std::min(m_min, other.m_min);
+    m_max = m_count == 0 ? other.m_max : std::max(m_max, other.m_max);
+    m_sum += other.m_sum;
+    m_count += other.m_count;
+}
+
+void LatencyHistogram::reset() {
+    std::fill(m_counts.begin(), m_counts.end(), 0);
+    m_count = 0;
+    m_min = 0;
+    m_max = 0;
+    m_sum = 0.0;
+}
+
+int64_t LatencyHistogram::count() const {
+    return m_count;
+}
+
+int64_t LatencyHistogram::min() const {
+    return m_min;
+}
+
+int64_t LatencyHistogram::max() const {
+    return m_max;
+}
+
+double LatencyHistogram::avg() const {
+    return m_count == 0 ? 0.0 : m_sum / m_count;
+}
+
+int64_t LatencyHistogram::percentile(double percentile) const {
+    if (m_count == 0) {
+        return 0;
+    }
+    if (percentile <= 0.0) {
+        return m_min;
+    }
+
+    const auto rank = std::max<int64_t>(
+            1, static_cast<int64_t>(std::ceil(std::min(percentile, 100.0) / 100.0 * static_cast<double>(m_count))));
+    int64_t cumulative = 0;
+    for (size_t idx = 0; idx < m_counts.size(); ++idx) {
+        cumulative += m_counts[idx];
+        if (cumulative >= rank) {
+            // NB: Bucket bound might exceed the real maximum value.
+            return std::min(bucketUpperBound(idx), m_max);
+        }
+    }
+    return m_max;
+}
+
+namespace {
+
+class CsvWriter : public ITimeSeriesWriter {
+public:
+    explicit CsvWriter(const std::string& filepath);
+    void write(const WindowSnapshot& snapshot) override;
+
+private:
+    std::mutex m_mutex;
+    std::ofstream m_file;
+};
+
+CsvWriter::CsvWriter(const std::string& filepath): m_file(filepath) {
+    if (!m_file.is_open()) {
+        throw std::runtime_error("Failed to open file: " + filepath);
+    }
+    m_file << "scenario,stream,start_ms,end_ms,frames,dropped,deadline_misses,fps,"
+              "min_ms,avg_ms,p50_ms,p90_ms,p99_ms,p99.9_ms,max_ms,queue_avg_ms,queue_p99_ms"
+           << std::endl;
+}
+
+void CsvWriter::write(const WindowSnapshot& s) {
+    const double duration_ms = (s.end_us - s.start_us) / 1000.0;
+    const double fps = duration_ms > 0 ? s.frames / duration_ms * 1000.0 : 0.0;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_file << s.scenario_idx << "," << s.stream_idx << "," << s.start_us / 1000.0 << "," << s.end_us / 1000.0 << ","
+           << s.frames << "," << s.dropped << "," << s.deadline_misses << "," << fps << "," << s.latency.min() / 1000.0
+           << "," << s.latency.avg() / 1000.0 << "," << s.latency.percentile(50) / 1000.0 << ","
+           << s.latency.percentile(90) / 1000.0 << "," << s.latency.percentile(99) / 1000.0 << ","
+           << s.latency.percentile(99.9) / 1000.0 << "," << s.latency.max() / 1000.0 << ","
+           << s.queue_delay.avg() / 1000.0 << "," << s.queue_delay.percentile(99) / 1000.0 << std::endl;
+}
+
+class JsonWriter : public ITimeSeriesWriter {
+public:
+    explicit JsonWriter(const std::string& filepath);
+    void write(const WindowSnapshot& snapshot) override;
+
+private:
+    std::mutex m_mutex;
+    std::ofstream m_file;
+};
+
+JsonWriter::JsonWriter(const std::string& filepath): m_file(filepath) {
+    if (!m_file.is_open()) {
+        throw std::runtime_error("Failed to open file: " + filepath);
+    }
+}
+
+void JsonWriter::write(const WindowSnapshot& s) {
+    const double duration_ms = (s.end_us - s.start_us) / 1000.0;
+    const double fps = duration_ms > 0 ? s.frames / duration_ms * 1000.0 : 0.0;
+
+    // NB: One object per line, so the file can be processed while the run is in progress.
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_file << "{\"scenario\": " << s.scenario_idx << ", \"stream\": " << s.stream_idx
+           << ", \"start_ms\": " << s.start_us / 1000.0 << ", \"end_ms\": " << s.end_us / 1000.0
+           << ", \"frames\": " << s.frames << ", \"dropped\": " << s.dropped
+           << ", \"deadline_misses\": " << s.deadline_misses << ", \"fps\": " << fps
+           << ", \"latency_ms\": {\"min\": " << s.latency.min() / 1000.0 << ", \"avg\": " << s.latency.avg() / 1000.0
+           << ", \"p50\": " << s.latency.percentile(50) / 1000.0 << ", \"p90\": " << s.latency.percentile(90) / 1000.0
+           << ", \"p99\": " << s.latency.percentile(99) / 1000.0
+           << ", \"p99.9\": " << s.latency.percentile(99.9) / 1000.0 << ", \"max\": " << s.latency.max() / 1000.0
+           << "}, \"queue_delay_ms\": {\"avg\": " << s.queue_delay.avg() / 1000.0
+           << ", \"p99\": " << s.queue_delay.percentile(99) / 1000.0 << "}}" << std::endl;
+}
+
+}  // anonymous namespace
+
+ITimeSeriesWriter::Ptr ITimeSeriesWriter::create(const std::string& filepath) {
+    const std::string csv_ext = ".csv";
+    if (filepath.size() >= csv_ext.size() &&
+        filepath.compare(filepath.size() - csv_ext.size(), csv_ext.size(), csv_ext) == 0) {
+        return std::make_shared<CsvWriter>(filepath);
+    }
+    return std::make_shared<JsonWriter>(filepath);
+}
+
+FrameStatistics::FrameStatistics(size_t scenario_idx, size_t stream_idx, int64_t deadline_us, int64_t window_us,
+                                 ITimeSeriesWriter::Ptr writer)
+        : m_scenario_idx(scenario_idx),
+          m_stream_idx(stream_idx),
+          m_deadline_us(deadline_us),
+          m_window_us(window_us),
+          m_writer(std::move(writer)) {
+}
+
+void FrameStatistics::start() {
+    m_start_ts = utils::timestamp<std::chrono::microseconds>();
+    m_window_start_ts = m_start_ts;
+}
+
+void FrameStatistics::record(int64_t latency_us, int64_t queue_delay_us, int64_t seq_id) {
+    if (m_first_latency == -1) {
+        m_first_latency = latency_us;
+    } else {
+        // NB: Source skips seq_id for every dropped frame.
+        const auto dropped = seq_id - m_last_seq_id - 1;
+        m_dropped += dropped;
+        m_window_dropped += dropped;
+    }
+    m_last_seq_id = seq_id;
+
+    const bool deadline_missed = m_deadline_us != 0 && latency_us > m_deadline_us;
+    m_deadline_misses += deadline_missed;
+
+    m_latency.record(latency_us);
+    m_queue_delay.record(queue_delay_us);
+    m_service_time.record(latency_us - queue_delay_us);
+
+    if (m_writer) {
+        m_window_latency.record(latency_us);
+        m_window_queue_delay.record(queue_delay_us);
+        m_window_deadline_misses += deadline_missed;
+        ++m_window_frames;
+        const auto now = utils::timestamp<std::chrono::microseconds>();
+        if (now - m_window_start_ts >= m_window_us) {
+            flushWindow(now);
+        }
+    }
+}
+
+void FrameStatistics::finish() {
+    if (m_writer && m_window_frames != 0) {
+        flushWindow(utils::timestamp<std::chrono::microseconds>());
+    }
+}
+
+void FrameStatistics::flushWindow(int64_t now) {
+    m_writer->write(WindowSnapshot{m_scenario_idx, m_stream_idx, m_window_start_ts - m_start_ts, now - m_start_ts,
+                                   m_window_frames, m_window_dropped, m_window_deadline_misses, m_window_latency,
+                                   m_window_queue_delay});
+    m_window_start_ts = now;
+    m_window_frames = 0;
+    m_window_dropped = 0;
+    m_window_deadline_misses = 0;
+    m_window_latency.reset();
+    m_window_queue_delay.reset();
+}
+
+const LatencyHistogram& FrameStatistics::latency() const {
+    return m_latency;
+}
+
+const LatencyHistogram& FrameStatistics::queueDelay() const {
+    return m_queue_delay;
+}
+
+const LatencyHistogram& FrameStatistics::serviceTime() const {
+    return m_service_time;
+}
+
+int64_t FrameStatistics::firstLatency() const {
+    return m_first_latency;
+}
+
+int64_t FrameStatistics::dropped() const {
+    return m_dropped;
+}
+
+int64_t FrameStatistics::deadlineMisses() const {
+    return m_deadline_misses;
+}
+
+int64_t FrameStatistics::totalFrames() const {
+    return m_last_seq_id + 1;
+}
@@ -0,0 +1,114 @@
+//
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// NB: HDR-style latency histogram with constant memory footprint.
+// Values are grouped into log-linear buckets: every power of two range is split
+// into the same number of linear sub-buckets, so the relative error of any
+// reported percentile doesn't exceed 1/kSubBucketHalfCount (~1.6%).
+// Values below kSubBucketCount are recorded exactly.
+class LatencyHistogram {
+public:
+    void record(int64_t value);
+    void merge(const LatencyHistogram& other);
+    void reset();
+
+    int64_t count() const;
+    int64_t min() const;
+    int64_t max() const;
+    double avg() const;
+    // NB: percentile is in [0, 100] range.
+    int64_t percentile(double percentile) const;
+
+private:
+    static size_t bucketIndex(int64_t value);
+    static int64_t bucketUpperBound(size_t idx);
+
+    std::vector<int64_t> m_counts;
+    int64_t m_count = 0;
+    int64_t m_min = 0;
+    int64_t m_max = 0;
+    double m_sum = 0.0;
+};
+
+// NB: Statistics of the frames processed within a window of time.
+struct WindowSnapshot {
+    size_t scenario_idx;
+    size_t stream_idx;
+    // NB: Relative to the start of the stream execution.
+    int64_t start_us;
+    int64_t end_us;
+    int64_t frames;
+    int64_t dropped;
+    int64_t deadline_misses;
+    LatencyHistogram latency;
+    LatencyHistogram queue_delay;
+};
+
+// NB: Thread-safe sink for periodic snapshots, shared by all streams.
+class ITimeSeriesWriter {
+public:
+    using Ptr = std::shared_ptr<ITimeSeriesWriter>;
+    virtual void write(const WindowSnapshot& snapshot) = 0;
+    virtual ~ITimeSeriesWriter() = default;
+
+    // NB: Format is deduced from the file extension:
+    // ".csv" - CSV with header, otherwise JSON object per line.
+    static Ptr create(const std::string& filepath);
+};
+
+// NB: Accumulates per-frame statistics of the stream in constant memory.
+class FrameStatistics {
+public:
+    // NB: deadline_us - maximum allowed latency of the frame since its arrival, 0 - no deadline.
+    FrameStatistics(size_t scenario_idx, size_t stream_idx, int64_t deadline_us, int64_t window_us,
+                    ITimeSeriesWriter::Ptr writer);
+
+    void start();
+    // NB: latency_us - time since frame arrival till its completion,
+    // queue_delay_us - time since frame arrival till it's pulled from the source.
+    void record(int64_t latency_us, int64_t queue_delay_us, int64_t seq_id);
+    void finish();
+
+    const LatencyHistogram& latency() const;
+    const LatencyHistogram& queueDelay() const;
+    const LatencyHistogram& serviceTime() const;
+    int64_t firstLatency() const;
+    int64_t dropped() const;
+    int64_t deadlineMisses() const;
+    // NB: Number of frames produced by the source (including dropped).
+    int64_t totalFrames() const;
+
+private:
+    void flushWindow(int64_t now);
+
+    size_t m_scenario_idx;
+    size_t m_stream_idx;
+    int64_t m_deadline_us;
+    int64_t m_window_us;
+    ITimeSeriesWriter::Ptr m_writer;
+
+    LatencyHistogram m_latency;
+    LatencyHistogram m_queue_delay;
+    LatencyHistogram m_service_time;
+    int64_t m_first_latency = -1;
+    int64_t m_dropped = 0;
+    int64_t m_deadline_misses = 0;
+    int64_t m_last_seq_id = -1;
+
+    int64_t m_start_ts = 0;
+    int64_t m_window_start_ts = 0;
+    int64_t m_window_frames = 0;
+    int64_t m_window_dropped = 0;
+    int64_t m_window_deadline_misses = 0;
+    LatencyHistogram m_window_latency;
+    LatencyHistogram m_window_queue_delay;
+};
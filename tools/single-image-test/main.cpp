@@ -21,9 +21,16 @@
 
 #include <gflags/gflags.h>
 
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <exception>
 #include <fstream>
+#include <functional>
 #include <iomanip>
 #include <iostream>
+#include <mutex>
+#include <numeric>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -89,6 +96,17 @@ DEFINE_uint32(sem_seg_ignore_label, std::numeric_limits<uint32_t>::max(), "The n
 DEFINE_string(dataset, "NONE",
               "The dataset used to train the model. Useful for instances such as semantic segmentation to visualize "
               "the accuracy per-class");
+
+// for benchmark mode
+DEFINE_bool(benchmark, false,
+            "Run throughput benchmark with the already loaded network after the inference (OV 2.0 API only)");
+DEFINE_uint32(nireq, 4, "Number of concurrent infer requests for benchmark mode");
+DEFINE_uint32(warmup_iter, 10, "Number of warm-up iterations for benchmark mode, not included into statistics");
+DEFINE_uint32(niter, 0, "Number of iterations for benchmark mode (0 - limited by 'benchmark_time')");
+DEFINE_uint32(benchmark_time, 10, "Duration of benchmark mode in seconds, used if 'niter' isn't set");
+DEFINE_uint32(validate_every, 0,
+              "Validate every K-th output against the reference in benchmark mode (0 - disabled, requires 'run_test')");
+
 std::vector<std::string> camVid12 = {"Sky",        "Building", "Pole", "Road",       "Pavement",  "Tree",
                                      "SignSymbol", "Fence",    "Car",  "Pedestrian", "Bicyclist", "Unlabeled"};
 
@@ -161,6 +179,17 @@ void parseCommandLine(int argc, char* argv[]) {
             std::cout << "    Threshold:        " << FLAGS_rrmse_loss_threshold << std::endl;
         }
     }
+    std::cout << "    Benchmark:                        " << FLAGS_benchmark << std::endl;
+    if (FLAGS_benchmark) {
+        std::cout << "    Infer requests:   " << FLAGS_nireq << std::endl;
+        std::cout << "    Warm-up:          " << FLAGS_warmup_iter << std::endl;
+        if (FLAGS_niter != 0) {
+            std::cout << "    Iterations:       " << FLAGS_niter << std::endl;
+        } else {
+            std::cout << "    Time:             " << FLAGS_benchmark_time << " s" << std::endl;
+        }
+        std::cout << "    Validate every:   " << FLAGS_validate_every << std::endl;
+    }
     std::cout << "    Log level:                        " << FLAGS_log_level << std::endl;
     std::cout << std::endl;
 }
@@ -2091,6 +2120,254 @@ bool testMeanIoU(const ie::BlobMap& actBlobs, const ie::BlobMap& refBlobs, const
     return compare_mean_IoU(iou, semSegThreshold, classes);
 };
 
+//
+// Outputs validation
+//
+
+static ie::BlobMap wrapOutputs(const TensorMap& outTensors, const ov::Layout& outUserLayout,
+                               const ov::Layout& outModelLayout, bool printWarnings) {
+    ie::BlobMap outputs;
+    // NB: Make a view over ov::Tensor
+    for (const auto& p : outTensors) {
+        const auto shape = p.second.get_shape();
+        ov::Layout outLayerUserLayout;
+        if (outUserLayout.empty()) {
+            ov::Layout outLayerModelLayout;
+            if (outModelLayout.empty()) {
+                outLayerModelLayout = getLayoutByRank(shape.size());
+                if (printWarnings) {
+                    std::cout << "WARNING: Casting output ov::Tensor to ie::Blob. Since --oml option isn't set, "
+                                 "output model layout for layer \""
+                              << p.first << "\" is infered from shape: " << toString(shape) << " rank ("
+                              << shape.size() << ") as " << outLayerModelLayout.to_string() << std::endl;
+                }
+            } else {
+                outLayerModelLayout = outModelLayout;
+            }
+            outLayerUserLayout = outLayerModelLayout;
+        } else {
+            outLayerUserLayout = outUserLayout;
+        }
+
+        outputs.emplace(p.first, toIE(p.second, outLayerUserLayout));
+    }
+    return outputs;
+}
+
+static bool testOutputs(const ie::BlobMap& outputs, const ie::BlobMap& refOutputs, const TensorDescMap& inDescMap,
+                        const TensorMap& outTensors) {
+    if (strEq(FLAGS_mode, "classification")) {
+        return testClassification(outputs, refOutputs);
+    } else if (strEq(FLAGS_mode, "raw")) {
+        return testRAW(outputs, refOutputs);
+    } else if (strEq(FLAGS_mode, "cosim")) {
+        return testCoSim(outputs, refOutputs);
+    } else if (strEq(FLAGS_mode, "rrmse")) {
+        return testRRMSE(outputs, refOutputs);
+    } else if (strEq(FLAGS_mode, "ssd")) {
+        return testSSDDetection(outputs, refOutputs, inDescMap);
+    } else if (strEq(FLAGS_mode, "yolo_v2")) {
+        return testYoloV2(outputs, refOutputs, inDescMap);
+    } else if (strEq(FLAGS_mode, "yolo_v3")) {
+        return testYoloV3(outputs, refOutputs, inDescMap);
+    } else if (strEq(FLAGS_mode, "yolo_v4")) {
+        return testYoloV4(outputs, refOutputs, inDescMap);
+    } else if (strEq(FLAGS_mode, "psnr")) {
+        const auto shape = outTensors.begin()->second.get_shape();
+        const auto dstHeight = shape[2];
+        const auto dstWidth = shape[3];
+
+        return testPSNR(outputs, refOutputs, dstHeight, dstWidth);
+    } else if (strEq(FLAGS_mode, "mean_iou")) {
+        return testMeanIoU(outputs, refOutputs, inDescMap);
+    }
+    throw std::logic_error("Unknown mode " + FLAGS_mode);
+}
+
+//
+// Benchmark mode
+//
+
+struct BenchmarkStatistics {
+    // Latencies of the successfully completed iterations only
+    std::vector<double> latenciesMs;
+    size_t failedIterations = 0;
+    double durationMs = 0.0;
+    size_t validated = 0;
+    size_t failed = 0;
+};
+
+using BenchmarkValidateF = std::function<bool(const TensorMap&)>;
+
+// Runs iterations on the pool of asynchronous infer requests until 'iterations' are started
+// or 'timeLimit' is exceeded (if 'iterations' is 0).
+// Outputs of every 'validateEvery'-th iteration are validated once the request is completed,
+// before the request is started again.
+static BenchmarkStatistics runBenchmarkPhase(std::vector<ov::InferRequest>& requests, ov::CompiledModel& compiledModel,
+                                             size_t iterations, std::chrono::milliseconds timeLimit,
+                                             size_t validateEvery, const BenchmarkValidateF& validate) {
+    BenchmarkStatistics stats;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<size_t> idleRequests;
+    std::vector<Time::time_point> startTimes(requests.size());
+    std::vector<bool> pendingValidation(requests.size(), false);
+    std::exception_ptr error;
+
+    for (size_t idx = 0; idx < requests.size(); ++idx) {
+        idleRequests.push_back(idx);
+        requests[idx].set_callback([&, idx](std::exception_ptr ex) {
+            const auto endTime = Time::now();
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (ex != nullptr) {
+                    ++stats.failedIterations;
+                    if (error == nullptr) {
+                        error = ex;
+                    }
+                } else {
+                    stats.latenciesMs.push_back(
+                            std::chrono::duration<double, std::milli>(endTime - startTimes[idx]).count());
+                }
+                idleRequests.push_back(idx);
+            }
+            cv.notify_one();
+        });
+    }
+
+    const auto validateRequest = [&](size_t idx) {
+        if (!pendingValidation[idx]) {
+            return;
+        }
+        pendingValidation[idx] = false;
+
+        TensorMap outTensors;
+        for (const auto& outputInfo : compiledModel.outputs()) {
+            const auto name = outputInfo.get_any_name();
+            outTensors.emplace(name, requests[idx].get_tensor(name));
+        }
+
+        ++stats.validated;
+        if (!validate(outTensors)) {
+            ++stats.failed;
+        }
+    };
+
+    const auto startTime = Time::now();
+    const auto isFinished = [&](size_t started) {
+        return iterations != 0 ? started >= iterations : Time::now() - startTime >= timeLimit;
+    };
+
+    for (size_t started = 0; !isFinished(started); ++started) {
+        size_t idx = 0;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.wait(lock, [&] {
+                return !idleRequests.empty() || error != nullptr;
+            });
+            if (error != nullptr) {
+                break;
+            }
+            idx = idleRequests.back();
+            idleRequests.pop_back();
+        }
+
+        // NB: Outputs of the previous iteration are overwritten by the next one.
+        validateRequest(idx);
+        pendingValidation[idx] = validateEvery != 0 && started % validateEvery == 0;
+
+        startTimes[idx] = Time::now();
+        try {
+            requests[idx].start_async();
+        } catch (...) {
+            // NB: Running requests must be completed before leaving, since callbacks refer to the local state.
+            std::lock_guard<std::mutex> lock(mutex);
+            ++stats.failedIterations;
+            error = std::current_exception();
+            idleRequests.push_back(idx);
+            break;
+        }
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&] {
+            return idleRequests.size() == requests.size();
+        });
+    }
+    stats.durationMs = std::chrono::duration<double, std::milli>(Time::now() - startTime).count();
+
+    for (size_t idx = 0; idx < requests.size(); ++idx) {
+        // NB: Callback refers to the local state of this function.
+        requests[idx].set_callback([](std::exception_ptr) {});
+        if (error == nullptr) {
+            validateRequest(idx);
+        }
+    }
+
+    if (error != nullptr) {
+        std::cerr << "Benchmark stopped: " << stats.failedIterations << " iteration(s) failed, "
+                  << stats.latenciesMs.size() << " completed" << std::endl;
+        std::rethrow_exception(error);
+    }
+    return stats;
+}
+
+static BenchmarkStatistics runBenchmark(ov::CompiledModel& compiledModel, const TensorMap& inputs,
+                                        const BenchmarkValidateF& validate) {
+    IE_ASSERT(FLAGS_nireq > 0) << "Number of infer requests must be positive";
+
+    std::vector<ov::InferRequest> requests;
+    for (uint32_t i = 0; i < FLAGS_nireq; ++i) {
+        auto request = compiledModel.create_infer_request();
+        for (const auto& p : inputs) {
+            request.set_tensor(p.first, p.second);
+        }
+        requests.push_back(std::move(request));
+    }
+
+    const auto timeLimit = std::chrono::milliseconds(static_cast<int64_t>(FLAGS_benchmark_time) * 1000);
+
+    if (FLAGS_warmup_iter != 0) {
+        std::cout << "Benchmark warm-up: " << FLAGS_warmup_iter << " iterations" << std::endl;
+        runBenchmarkPhase(requests, compiledModel, FLAGS_warmup_iter, timeLimit, 0, nullptr);
+    }
+
+    std::cout << "Benchmark with " << FLAGS_nireq << " infer requests" << std::endl;
+    const auto validateEvery = validate ? FLAGS_validate_every : 0;
+    return runBenchmarkPhase(requests, compiledModel, FLAGS_niter, timeLimit, validateEvery, validate);
+}
+
+static void printBenchmarkStatistics(size_t numberOfTestCase, BenchmarkStatistics& stats) {
+    IE_ASSERT(!stats.latenciesMs.empty()) << "No iterations have been completed during benchmark";
+
+    auto& latencies = stats.latenciesMs;
+    std::sort(latencies.begin(), latencies.end());
+
+    const auto percentile = [&](double p) {
+        const auto rank = static_cast<size_t>(std::ceil(p / 100.0 * latencies.size()));
+        return latencies[std::min(std::max<size_t>(rank, 1), latencies.size()) - 1];
+    };
+    const auto avg = std::accumulate(latencies.begin(), latencies.end(), 0.0) / latencies.size();
+
+    std::cout << "Benchmark results for " << numberOfTestCase << "-th test case:" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "    Iterations:   " << latencies.size() << std::endl;
+    std::cout << "    Duration:     " << stats.durationMs << " ms" << std::endl;
+    std::cout << "    Throughput:   " << latencies.size() * 1000.0 / stats.durationMs << " FPS" << std::endl;
+    std::cout << "    Latency:" << std::endl;
+    std::cout << "        Min:      " << latencies.front() << " ms" << std::endl;
+    std::cout << "        Average:  " << avg << " ms" << std::endl;
+    std::cout << "        Median:   " << percentile(50) << " ms" << std::endl;
+    std::cout << "        90%:      " << percentile(90) << " ms" << std::endl;
+    std::cout << "        99%:      " << percentile(99) << " ms" << std::endl;
+    std::cout << "        Max:      " << latencies.back() << " ms" << std::endl;
+    if (stats.validated != 0) {
+        std::cout << "    Validated:    " << stats.validated << ", failed: " << stats.failed << std::endl;
+    }
+}
+
 static int runSingleImageTestOV20() {
     std::cout << "Run single image test with OV 2.0 API" << std::endl;
     try {
@@ -2354,31 +2631,10 @@ static int runSingleImageTestOV20() {
 
             printPerformanceCountsAndLatency(numberOfTestCase, outInference.second, endTime - startTime);
 
-            // NB: Make a view over ov::Tensor
-            for (const auto& p : outTensors) {
-                const auto shape = p.second.get_shape();
-                ov::Layout outLayerUserLayout;
-                if (outUserLayout.empty()) {
-                    ov::Layout outLayerModelLayout;
-                    if (outModelLayout.empty()) {
-                        outLayerModelLayout = getLayoutByRank(shape.size());
-                        std::cout << "WARNING: Casting output ov::Tensor to ie::Blob. Since --oml option isn't set, "
-                                     "output model layout for layer \""
-                                  << p.first << "\" is infered from shape: " << toString(shape) << " rank ("
-                                  << shape.size() << ") as " << outLayerModelLayout.to_string() << std::endl;
-                    } else {
-                        outLayerModelLayout = outModelLayout;
-                    }
-                    outLayerUserLayout = outLayerModelLayout;
-                } else {
-                    outLayerUserLayout = outUserLayout;
-                }
-
-                outputs.emplace(p.first, toIE(p.second, outLayerUserLayout));
-            }
+            outputs = wrapOutputs(outTensors, outUserLayout, outModelLayout, /*printWarnings=*/true);
 
+            ie::BlobMap refOutputs;
             if (FLAGS_run_test) {
-                ie::BlobMap refOutputs;
                 size_t outputInd = 0;
                 for (const auto& p : outputs) {
                     std::ostringstream ostr;
@@ -2407,82 +2663,10 @@ static int runSingleImageTestOV20() {
                     dumpBlob(ie::as<ie::MemoryBlob>(p.second), blobFileName);
                     ++outputInd;
                 }
-                if (strEq(FLAGS_mode, "classification")) {
-                    if (testClassification(outputs, refOutputs)) {
-                        std::cout << "PASSED" << std::endl;
-                    } else {
-                        std::cout << "FAILED" << std::endl;
-                        return EXIT_FAILURE;
-                    }
-                } else if (strEq(FLAGS_mode, "raw")) {
-                    if (testRAW(outputs, refOutputs)) {
-                        std::cout << "PASSED" << std::endl;
-                    } else {
-                        std::cout << "FAILED" << std::endl;
-                        return EXIT_FAILURE;
-                    }
-                } else if (strEq(FLAGS_mode, "cosim")) {
-                    if (testCoSim(outputs, refOutputs)) {
-                        std::cout << "PASSED" << std::endl;
-                    } else {
-                        std::cout << "FAILED" << std::endl;
-                        return EXIT_FAILURE;
-                    }
-                } else if (strEq(FLAGS_mode, "rrmse")) {
-                    if (testRRMSE(outputs, refOutputs)) {
-                        std::cout << "PASSED" << std::endl;
-                    } else {
-                        std::cout << "FAILED" << std::endl;
-                        return EXIT_FAILURE;
-                    }
-                } else if (strEq(FLAGS_mode, "ssd")) {
-                    if (testSSDDetection(outputs, refOutputs, inDescMap)) {
-                        std::cout << "PASSED" << std::endl;
-                    } else {
-                        std::cout << "FAILED" << std::endl;
-                        return EXIT_FAILURE;
-                    }
-                } else if (strEq(FLAGS_mode, "yolo_v2")) {
-                    if (testYoloV2(outputs, refOutputs, inDescMap)) {
-                        std::cout << "PASSED" << std::endl;
-                    } else {
-                        std::cout << "FAILED" << std::endl;
-                        return EXIT_FAILURE;
-                    }
-                } else if (strEq(FLAGS_mode, "yolo_v3")) {
-                    if (testYoloV3(outputs, refOutputs, inDescMap)) {
-                        std::cout << "PASSED" << std::endl;
-                    } else {
-                        std::cout << "FAILED" << std::endl;
-                        return EXIT_FAILURE;
-                    }
-                } else if (strEq(FLAGS_mode, "yolo_v4")) {
-                    if (testYoloV4(outputs, refOutputs, inDescMap)) {
-                        std::cout << "PASSED" << std::endl;
-                    } else {
-                        std::cout << "FAILED" << std::endl;
-                        return EXIT_FAILURE;
-                    }
-                } else if (strEq(FLAGS_mode, "psnr")) {
-                    const auto shape = outTensors.begin()->second.get_shape();
-                    const auto dstHeight = shape[2];
-                    const auto dstWidth = shape[3];
-
-                    if (testPSNR(outputs, refOutputs, dstHeight, dstWidth)) {
-                        std::cout << "PASSED" << std::endl;
-                    } else {
-                        std::cout << "FAILED" << std::endl;
-                        return EXIT_FAILURE;
-                    }
-                } else if (strEq(FLAGS_mode, "mean_iou")) {
-                    if (testMeanIoU(outputs, refOutputs, inDescMap)) {
-                        std::cout << "PASSED" << std::endl;
-                    } else {
-                        std::cout << "FAILED" << std::endl;
-                        return EXIT_FAILURE;
-                    }
+                if (testOutputs(outputs, refOutputs, inDescMap, outTensors)) {
+                    std::cout << "PASSED" << std::endl;
                 } else {
-                    std::cout << "Unknown mode " << FLAGS_mode << std::endl;
+                    std::cout << "FAILED" << std::endl;
                     return EXIT_FAILURE;
                 }
             } else {
@@ -2498,6 +2682,25 @@ static int runSingleImageTestOV20() {
                     ++outputInd;
                 }
             }
+
+            if (FLAGS_benchmark) {
+                BenchmarkValidateF validate;
+                if (FLAGS_validate_every != 0) {
+                    IE_ASSERT(FLAGS_run_test) << "Option 'validate_every' requires 'run_test'";
+                    validate = [&](const TensorMap& benchmarkOutTensors) {
+                        const auto benchmarkOutputs = wrapOutputs(benchmarkOutTensors, outUserLayout, outModelLayout,
+                                                                  /*printWarnings=*/false);
+                        return testOutputs(benchmarkOutputs, refOutputs, inDescMap, benchmarkOutTensors);
+                    };
+                }
+
+                auto stats = runBenchmark(compiledModel, in_tensors, validate);
+                printBenchmarkStatistics(numberOfTestCase, stats);
+                if (stats.failed != 0) {
+                    std::cout << "FAILED" << std::endl;
+                    return EXIT_FAILURE;
+                }
+            }
         }
     }  // try
     catch (const std::exception& ex) {
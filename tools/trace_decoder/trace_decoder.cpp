@@ -0,0 +1,61 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include <fstream>
+#include <iostream>
+
+#include <gflags/gflags.h>
+
+#include "vpux/utils/core/trace_decoder.hpp"
+
+DEFINE_string(i, "", "Binary trace dumped by the NPU plugin or compiler (IE_NPU_TRACE_FILE)");
+DEFINE_string(f, "text", "Format to use (text or perfetto)");
+DEFINE_string(o, "", "Output file, stdout by default");
+
+static void parseCommandLine(int argc, char* argv[], const std::string& usage) {
+    gflags::SetUsageMessage(usage);
+    gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+    if (FLAGS_i.empty()) {
+        throw std::runtime_error("Missing -i parameter value");
+    }
+    if (FLAGS_f != "text" && FLAGS_f != "perfetto") {
+        throw std::runtime_error("Unknown output format: " + FLAGS_f + ". Valid formats: text, perfetto");
+    }
+}
+
+int main(int argc, char** argv) {
+    static const char* usage = "Usage: trace_decoder -i <trace.bin path> [-f text|perfetto] [-o <output.file>]";
+    try {
+        parseCommandLine(argc, argv, usage);
+
+        std::ifstream input(FLAGS_i, std::ios::in | std::ios::binary);
+        if (!input.good()) {
+            throw std::runtime_error("Can't open input file " + FLAGS_i);
+        }
+        const auto trace = vpux::readTrace(input);
+
+        std::ofstream outFile;
+        if (!FLAGS_o.empty()) {
+            outFile.open(FLAGS_o);
+            if (!outFile.good()) {
+                throw std::runtime_error("Can't open output file " + FLAGS_o);
+            }
+        }
+        std::ostream& output = FLAGS_o.empty() ? std::cout : outFile;
+
+        if (FLAGS_f == "perfetto") {
+            vpux::printTraceAsPerfetto(trace, output);
+        } else {
+            vpux::printTraceAsText(trace, output);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        std::cerr << usage << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
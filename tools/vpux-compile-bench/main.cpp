@@ -0,0 +1,419 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "models.hpp"
+#include "pass_statistics.hpp"
+
+#include "vpux/al/config/common.hpp"
+#include "vpux/al/config/compiler.hpp"
+
+#include "vpux/compiler/VPU30XX/pipeline_strategy.hpp"
+#include "vpux/compiler/VPU37XX/pipeline_strategy.hpp"
+#include "vpux/compiler/frontend/IE.hpp"
+#include "vpux/compiler/init.hpp"
+#include "vpux/compiler/interfaces_registry.hpp"
+#include "vpux/compiler/options_mapper.hpp"
+#include "vpux/compiler/utils/logging.hpp"
+
+#include "vpux/utils/core/error.hpp"
+#include "vpux/utils/core/logger.hpp"
+#include "vpux/utils/core/process_memory.hpp"
+#include "vpux/utils/core/range.hpp"
+
+#include <mlir/IR/MLIRContext.h>
+#include <mlir/Pass/PassManager.h>
+#include <mlir/Support/Timing.h>
+
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/ADT/StringRef.h>
+#include <llvm/Support/JSON.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <gflags/gflags.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace vpux;
+using namespace vpux::bench;
+
+DEFINE_string(models, "resnet,transformer,unet", "Comma separated list of synthetic models: resnet, transformer, unet");
+DEFINE_string(sizes, "small,medium", "Comma separated list of synthetic model sizes: small, medium, large");
+DEFINE_string(platforms, "3700,3720", "Comma separated list of platforms to compile for");
+DEFINE_uint32(iterations, 3, "Number of compilations per model, the minimum time over iterations is reported");
+DEFINE_bool(threads, false,
+            "Enable MLIR multithreading. Per-pass peak memory is only precise when multithreading is disabled");
+DEFINE_string(output, "compile_bench.json", "Path to the output JSON report");
+DEFINE_string(baseline, "", "Path to the baseline JSON report to compare against");
+DEFINE_double(time_threshold, 0.15, "Allowed relative compile time increase over the baseline");
+DEFINE_double(memory_threshold, 0.10, "Allowed relative peak memory increase over the baseline");
+DEFINE_double(min_pass_time, 5.0, "Passes faster than this time (ms) in the baseline are not checked for regressions");
+
+namespace {
+
+//
+// Command line
+//
+
+std::vector<std::string> splitList(const std::string& str) {
+    llvm::SmallVector<llvm::StringRef> parts;
+    llvm::StringRef(str).split(parts, ',', -1, false);
+
+    std::vector<std::string> result;
+    for (const auto& part : parts) {
+        result.push_back(part.trim().str());
+    }
+    return result;
+}
+
+// Checks the values up front, so a typo doesn't fail the run after the long compilations of the previous models
+void checkListValues(const std::string& list, const std::vector<std::string>& supported, StringRef what) {
+    for (const auto& value : splitList(list)) {
+        VPUX_THROW_WHEN(std::find(supported.begin(), supported.end(), value) == supported.end(),
+                        "Unsupported synthetic model {0} '{1}', supported values are: {2}", what, value,
+                        llvm::join(supported, ", "));
+    }
+}
+
+void parseCommandLine(int argc, char* argv[]) {
+    std::ostringstream usage;
+    usage << "Usage: " << argv[0] << " [<options>]";
+    gflags::SetUsageMessage(usage.str());
+
+    gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+    VPUX_THROW_WHEN(FLAGS_iterations == 0, "Number of iterations must be positive");
+    checkListValues(FLAGS_models, getSyntheticModelKinds(), "kind");
+    checkListValues(FLAGS_sizes, getSyntheticModelSizes(), "size");
+
+    std::cout << "Parameters:" << std::endl;
+    std::cout << "    Models:           " << FLAGS_models << std::endl;
+    std::cout << "    Sizes:            " << FLAGS_sizes << std::endl;
+    std::cout << "    Platforms:        " << FLAGS_platforms << std::endl;
+    std::cout << "    Iterations:       " << FLAGS_iterations << std::endl;
+    std::cout << "    Multithreading:   " << std::boolalpha << FLAGS_threads << std::endl;
+    std::cout << "    Output:           " << FLAGS_output << std::endl;
+    std::cout << "    Baseline:         " << FLAGS_baseline << std::endl;
+    std::cout << std::endl;
+}
+
+//
+// BenchResult
+//
+
+struct BenchResult final {
+    std::string model;
+    std::string size;
+    std::string platform;
+
+    double wallTimeMs = std::numeric_limits<double>::max();
+    double importTimeMs = std::numeric_limits<double>::max();
+    double pipelineTimeMs = std::numeric_limits<double>::max();
+    int64_t peakRSS = 0;
+
+    std::vector<PassStatistics> passes;
+
+    std::string key() const {
+        return model + "/" + size + "/" + platform;
+    }
+};
+
+//
+// compileOnce
+//
+
+std::unique_ptr<IPipelineStrategy> createPipelineStrategy(VPU::ArchKind arch) {
+    switch (arch) {
+    case VPU::ArchKind::VPUX30XX:
+        return std::make_unique<PipelineStrategy30XX>();
+    case VPU::ArchKind::VPUX37XX:
+        return std::make_unique<PipelineStrategy37XX>();
+    default:
+        VPUX_THROW("Unsupported arch kind: {0}", arch);
+    }
+}
+
+// Runs the same stages as the compiler up to the end of the pass pipeline: import with nGraph passes and the default
+// HW pipeline. Blob serialization is excluded, its cost doesn't depend on the passes.
+void compileOnce(const std::shared_ptr<ov::Model>& origModel, const std::string& platform, BenchResult& result) {
+    using Clock = std::chrono::steady_clock;
+
+    const auto options = std::make_shared<OptionsDesc>();
+    registerCommonOptions(*options);
+    registerCompilerOptions(*options);
+
+    Config config(options);
+    config.update({{PLATFORM::key().str(), platform}, {COMPILATION_MODE::key().str(), "DefaultHW"}});
+
+    const auto arch = getArchKind(config);
+    Logger log("vpux-compile-bench", LogLevel::Warning);
+
+    // nGraph passes modify the model in place
+    auto model = origModel->clone();
+
+    mlir::DialectRegistry registry;
+    registerDialects(registry);
+    registerCommonInterfaces(registry);
+    createInterfacesRegistry(arch)->registerInterfaces(registry);
+
+    mlir::MLIRContext ctx(registry);
+    if (!FLAGS_threads) {
+        ctx.disableMultithreading();
+    }
+    addLogging(ctx, log);
+
+    mlir::DefaultTimingManager tm;
+    tm.setEnabled(false);
+    auto rootTiming = tm.getRootScope();
+
+    resetPeakRSS();
+    const auto compileStart = Clock::now();
+
+    const auto module = IE::importNetwork(&ctx, model, /*sharedConstants=*/true, rootTiming,
+                                          /*enableProfiling=*/false, /*stubLayers=*/false, arch, log);
+    const auto importFinish = Clock::now();
+    auto peakRSS = getPeakRSS();
+
+    mlir::PassManager pm(&ctx, mlir::OpPassManager::Nesting::Implicit);
+    addLogging(pm, log);
+
+    PassStatisticsCollector collector(/*resetPeakPerPass=*/!FLAGS_threads);
+    pm.addInstrumentation(collector.createInstrumentation());
+
+    createPipelineStrategy(arch)->buildPipeline(pm, config, rootTiming, log);
+
+    const auto pipelineStart = Clock::now();
+    VPUX_THROW_UNLESS(mlir::succeeded(pm.run(module.get())), "Compilation of '{0}' for '{1}' failed", result.key(),
+                      platform);
+    const auto pipelineFinish = Clock::now();
+
+    const auto toMs = [](Clock::duration duration) {
+        return std::chrono::duration<double, std::milli>(duration).count();
+    };
+
+    result.wallTimeMs = std::min(result.wallTimeMs, toMs(pipelineFinish - compileStart));
+    result.importTimeMs = std::min(result.importTimeMs, toMs(importFinish - compileStart));
+    result.pipelineTimeMs = std::min(result.pipelineTimeMs, toMs(pipelineFinish - pipelineStart));
+
+    const auto passes = collector.getStatistics();
+    for (const auto& pass : passes) {
+        peakRSS = std::max(peakRSS, pass.peakRSS);
+    }
+    result.peakRSS = std::max(result.peakRSS, std::max(peakRSS, getPeakRSS()));
+
+    if (result.passes.empty()) {
+        result.passes = passes;
+        return;
+    }
+
+    VPUX_THROW_UNLESS(result.passes.size() == passes.size(), "Pass pipeline differs between iterations");
+    for (auto i : irange(passes.size())) {
+        result.passes[i].timeMs = std::min(result.passes[i].timeMs, passes[i].timeMs);
+        result.passes[i].peakRSS = std::max(result.passes[i].peakRSS, passes[i].peakRSS);
+        result.passes[i].rssDelta = std::max(result.passes[i].rssDelta, passes[i].rssDelta);
+    }
+}
+
+//
+// JSON report
+//
+
+void writeReport(const std::vector<BenchResult>& results, const std::string& path) {
+    std::error_code err;
+    llvm::raw_fd_ostream stream(path, err);
+    VPUX_THROW_WHEN(err, "Failed to open file '{0}' for write : {1}", path, err.message());
+
+    llvm::json::OStream json(stream, 2);
+    json.object([&] {
+        json.attribute("version", 1);
+        json.attributeArray("results", [&] {
+            for (const auto& result : results) {
+                json.object([&] {
+                    json.attribute("model", result.model);
+                    json.attribute("size", result.size);
+                    json.attribute("platform", result.platform);
+                    json.attribute("wall_time_ms", result.wallTimeMs);
+                    json.attribute("import_time_ms", result.importTimeMs);
+                    json.attribute("pipeline_time_ms", result.pipelineTimeMs);
+                    json.attribute("peak_rss_kb", result.peakRSS);
+                    json.attributeArray("passes", [&] {
+                        for (const auto& pass : result.passes) {
+                            json.object([&] {
+                                json.attribute("name", pass.name);
+                                json.attribute("time_ms", pass.timeMs);
+                                json.attribute("peak_rss_kb", pass.peakRSS);
+                                json.attribute("rss_delta_kb", pass.rssDelta);
+                            });
+                        }
+                    });
+                });
+            }
+        });
+    });
+
+    stream << "\n";
+}
+
+std::map<std::string, BenchResult> readReport(const std::string& path) {
+    auto buffer = llvm::MemoryBuffer::getFile(path);
+    VPUX_THROW_UNLESS(buffer, "Failed to open baseline file '{0}' : {1}", path, buffer.getError().message());
+
+    auto parsed = llvm::json::parse(buffer.get()->getBuffer());
+    VPUX_THROW_UNLESS(parsed, "Failed to parse baseline file '{0}' : {1}", path, llvm::toString(parsed.takeError()));
+
+    const auto* root = parsed->getAsObject();
+    const auto* results = root != nullptr ? root->getArray("results") : nullptr;
+    VPUX_THROW_WHEN(results == nullptr, "Baseline file '{0}' has no results", path);
+
+    std::map<std::string, BenchResult> baseline;
+    for (const auto& value : *results) {
+        const auto* obj = value.getAsObject();
+        VPUX_THROW_WHEN(obj == nullptr, "Wrong result entry in baseline file '{0}'", path);
+
+        BenchResult result;
+        result.model = obj->getString("model").value_or("").str();
+        result.size = obj->getString("size").value_or("").str();
+        result.platform = obj->getString("platform").value_or("").str();
+        result.wallTimeMs = obj->getNumber("wall_time_ms").value_or(0.0);
+        result.importTimeMs = obj->getNumber("import_time_ms").value_or(0.0);
+        result.pipelineTimeMs = obj->getNumber("pipeline_time_ms").value_or(0.0);
+        result.peakRSS = obj->getInteger("peak_rss_kb").value_or(0);
+
+        if (const auto* passes = obj->getArray("passes")) {
+            for (const auto& passValue : *passes) {
+                const auto* passObj = passValue.getAsObject();
+                if (passObj == nullptr) {
+                    continue;
+                }
+
+                PassStatistics pass;
+                pass.name = passObj->getString("name").value_or("").str();
+                pass.timeMs = passObj->getNumber("time_ms").value_or(0.0);
+                pass.peakRSS = passObj->getInteger("peak_rss_kb").value_or(0);
+                pass.rssDelta = passObj->getInteger("rss_delta_kb").value_or(0);
+                result.passes.push_back(pass);
+            }
+        }
+
+        baseline[result.key()] = std::move(result);
+    }
+
+    return baseline;
+}
+
+//
+// Regression check
+//
+
+size_t compareWithBaseline(const std::vector<BenchResult>& results,
+                           const std::map<std::string, BenchResult>& baseline) {
+    size_t regressions = 0;
+
+    const auto check = [&](const std::string& what, double value, double reference, double threshold,
+                           StringRef units) {
+        if (reference <= 0.0 || value <= reference * (1.0 + threshold)) {
+            return;
+        }
+
+        ++regressions;
+        std::cout << "    REGRESSION " << what << ": " << reference << " " << units.str() << " -> " << value << " "
+                  << units.str() << " (+" << (value / reference - 1.0) * 100.0 << "%)" << std::endl;
+    };
+
+    for (const auto& result : results) {
+        const auto baselineIt = baseline.find(result.key());
+        if (baselineIt == baseline.end()) {
+            std::cout << result.key() << ": no baseline" << std::endl;
+            continue;
+        }
+
+        const auto& reference = baselineIt->second;
+        std::cout << result.key() << ": " << reference.wallTimeMs << " ms -> " << result.wallTimeMs << " ms, "
+                  << reference.peakRSS << " KB -> " << result.peakRSS << " KB" << std::endl;
+
+        check("wall time", result.wallTimeMs, reference.wallTimeMs, FLAGS_time_threshold, "ms");
+        check("peak RSS", static_cast<double>(result.peakRSS), static_cast<double>(reference.peakRSS),
+              FLAGS_memory_threshold, "KB");
+
+        std::map<std::string, const PassStatistics*> referencePasses;
+        for (const auto& pass : reference.passes) {
+            referencePasses[pass.name] = &pass;
+        }
+
+        for (const auto& pass : result.passes) {
+            const auto passIt = referencePasses.find(pass.name);
+            if (passIt == referencePasses.end() || passIt->second->timeMs < FLAGS_min_pass_time) {
+                continue;
+            }
+
+            check(pass.name + " time", pass.timeMs, passIt->second->timeMs, FLAGS_time_threshold, "ms");
+            check(pass.name + " peak RSS", static_cast<double>(pass.peakRSS),
+                  static_cast<double>(passIt->second->peakRSS), FLAGS_memory_threshold, "KB");
+        }
+    }
+
+    return regressions;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        parseCommandLine(argc, argv);
+
+        std::vector<BenchResult> results;
+
+        for (const auto& kind : splitList(FLAGS_models)) {
+            for (const auto& size : splitList(FLAGS_sizes)) {
+                const auto model = createSyntheticModel(kind, size);
+
+                for (const auto& platform : splitList(FLAGS_platforms)) {
+                    BenchResult result;
+                    result.model = kind;
+                    result.size = size;
+                    result.platform = platform;
+
+                    for (uint32_t iter = 0; iter < FLAGS_iterations; ++iter) {
+                        compileOnce(model, platform, result);
+                    }
+
+                    std::cout << result.key() << ": " << result.wallTimeMs << " ms (import " << result.importTimeMs
+                              << " ms, pipeline " << result.pipelineTimeMs << " ms), peak RSS " << result.peakRSS
+                              << " KB" << std::endl;
+
+                    results.push_back(std::move(result));
+                }
+            }
+        }
+
+        writeReport(results, FLAGS_output);
+        std::cout << "Report is written to " << FLAGS_output << std::endl;
+
+        if (!FLAGS_baseline.empty()) {
+            std::cout << std::endl << "Comparison with " << FLAGS_baseline << ":" << std::endl;
+
+            const auto regressions = compareWithBaseline(results, readReport(FLAGS_baseline));
+            if (regressions != 0) {
+                std::cout << regressions << " regression(s) found" << std::endl;
+                return EXIT_FAILURE;
+            }
+
+            std::cout << "No regressions found" << std::endl;
+        }
+    } catch (const std::exception& ex) {
+        std::cerr << ex.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
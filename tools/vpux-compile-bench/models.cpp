@@ -0,0 +1,287 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "models.hpp"
+
+#include "vpux/utils/core/error.hpp"
+
+#include <openvino/opsets/opset10.hpp>
+
+#include <cstdint>
+#include <map>
+
+namespace opset = ov::opset10;
+
+namespace {
+
+//
+// Constants
+//
+
+// Deterministic pseudo-random weights, so the same model is generated on every run
+class WeightsGenerator final {
+public:
+    std::shared_ptr<ov::Node> create(const ov::Shape& shape) {
+        std::vector<float> values(ov::shape_size(shape));
+        for (auto& value : values) {
+            _state = _state * 6364136223846793005ULL + 1442695040888963407ULL;
+            const auto normalized = static_cast<float>(_state >> 40) / static_cast<float>(1ULL << 24);
+            value = (normalized - 0.5f) * 0.2f;
+        }
+
+        return opset::Constant::create(ov::element::f32, shape, values);
+    }
+
+private:
+    uint64_t _state = 42;
+};
+
+std::shared_ptr<ov::Node> createScalar(float value) {
+    return opset::Constant::create(ov::element::f32, ov::Shape{1}, {value});
+}
+
+std::shared_ptr<ov::Node> createShape(const std::vector<int64_t>& values) {
+    return opset::Constant::create(ov::element::i64, ov::Shape{values.size()}, values);
+}
+
+//
+// Convolution helpers
+//
+
+ov::Output<ov::Node> conv(WeightsGenerator& weights, const ov::Output<ov::Node>& input, size_t outChannels,
+                          size_t kernel, size_t stride) {
+    const auto inChannels = input.get_shape()[1];
+    const auto pad = static_cast<std::ptrdiff_t>(kernel / 2);
+
+    const auto filter = weights.create(ov::Shape{outChannels, inChannels, kernel, kernel});
+    const auto convOp = std::make_shared<opset::Convolution>(input, filter, ov::Strides{stride, stride},
+                                                             ov::CoordinateDiff{pad, pad}, ov::CoordinateDiff{pad, pad},
+                                                             ov::Strides{1, 1});
+
+    const auto bias = weights.create(ov::Shape{1, outChannels, 1, 1});
+    return std::make_shared<opset::Add>(convOp, bias);
+}
+
+ov::Output<ov::Node> convRelu(WeightsGenerator& weights, const ov::Output<ov::Node>& input, size_t outChannels,
+                              size_t kernel, size_t stride) {
+    return std::make_shared<opset::Relu>(conv(weights, input, outChannels, kernel, stride));
+}
+
+ov::Output<ov::Node> upsample(WeightsGenerator& weights, const ov::Output<ov::Node>& input, size_t outChannels) {
+    const auto inChannels = input.get_shape()[1];
+
+    const auto filter = weights.create(ov::Shape{inChannels, outChannels, 2, 2});
+    return std::make_shared<opset::ConvolutionBackpropData>(input, filter, ov::Strides{2, 2}, ov::CoordinateDiff{0, 0},
+                                                            ov::CoordinateDiff{0, 0}, ov::Strides{1, 1});
+}
+
+std::shared_ptr<ov::Model> makeModel(const std::shared_ptr<opset::Parameter>& param, const ov::Output<ov::Node>& out,
+                                     const std::string& name) {
+    param->set_friendly_name("input");
+    param->output(0).get_tensor().set_names({"input"});
+
+    const auto result = std::make_shared<opset::Result>(out);
+    result->set_friendly_name("output");
+    result->output(0).get_tensor().set_names({"output"});
+
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, name);
+}
+
+//
+// ResNet-like
+//
+
+struct ResNetParams final {
+    size_t resolution;
+    size_t channels;
+    size_t stages;
+    size_t blocksPerStage;
+};
+
+std::shared_ptr<ov::Model> createResNet(const ResNetParams& params) {
+    WeightsGenerator weights;
+
+    const auto param = std::make_shared<opset::Parameter>(ov::element::f32,
+                                                          ov::Shape{1, 3, params.resolution, params.resolution});
+
+    auto x = convRelu(weights, param, params.channels, 7, 2);
+    x = std::make_shared<ov::op::v1::MaxPool>(x, ov::Strides{2, 2}, ov::Shape{1, 1}, ov::Shape{1, 1},
+                                              ov::Shape{3, 3}, ov::op::RoundingType::FLOOR);
+
+    auto channels = params.channels;
+    for (size_t stage = 0; stage < params.stages; ++stage) {
+        for (size_t block = 0; block < params.blocksPerStage; ++block) {
+            const auto stride = (stage > 0 && block == 0) ? 2 : 1;
+            const auto outChannels = (stage > 0 && block == 0) ? channels * 2 : channels;
+
+            auto shortcut = x;
+            if (stride != 1 || outChannels != channels) {
+                shortcut = conv(weights, x, outChannels, 1, stride);
+            }
+
+            auto y = convRelu(weights, x, outChannels / 4, 1, 1);
+            y = convRelu(weights, y, outChannels / 4, 3, stride);
+            y = conv(weights, y, outChannels, 1, 1);
+
+            x = std::make_shared<opset::Relu>(std::make_shared<opset::Add>(y, shortcut));
+            channels = outChannels;
+        }
+    }
+
+    const auto pool = std::make_shared<opset::ReduceMean>(x, createShape({2, 3}), true);
+    const auto flat = std::make_shared<opset::Reshape>(pool, createShape({1, static_cast<int64_t>(channels)}), false);
+    const auto fc = std::make_shared<opset::MatMul>(flat, weights.create(ov::Shape{channels, 1000}), false, false);
+    const auto prob = std::make_shared<opset::Softmax>(fc, 1);
+
+    return makeModel(param, prob, "resnet");
+}
+
+//
+// Transformer block
+//
+
+struct TransformerParams final {
+    size_t sequence;
+    size_t hidden;
+    size_t layers;
+};
+
+ov::Output<ov::Node> linear(WeightsGenerator& weights, const ov::Output<ov::Node>& input, size_t inSize,
+                            size_t outSize) {
+    const auto matMul =
+            std::make_shared<opset::MatMul>(input, weights.create(ov::Shape{inSize, outSize}), false, false);
+    return std::make_shared<opset::Add>(matMul, weights.create(ov::Shape{1, 1, outSize}));
+}
+
+ov::Output<ov::Node> layerNorm(WeightsGenerator& weights, const ov::Output<ov::Node>& input, size_t hidden) {
+    const auto mvn =
+            std::make_shared<opset::MVN>(input, createShape({2}), true, 1e-5f, ov::op::MVNEpsMode::INSIDE_SQRT);
+    const auto scaled = std::make_shared<opset::Multiply>(mvn, weights.create(ov::Shape{1, 1, hidden}));
+    return std::make_shared<opset::Add>(scaled, weights.create(ov::Shape{1, 1, hidden}));
+}
+
+std::shared_ptr<ov::Model> createTransformer(const TransformerParams& params) {
+    WeightsGenerator weights;
+
+    const auto seq = static_cast<int64_t>(params.sequence);
+    const auto hidden = static_cast<int64_t>(params.hidden);
+    const int64_t headSize = 64;
+    const auto heads = hidden / headSize;
+
+    const auto param =
+            std::make_shared<opset::Parameter>(ov::element::f32, ov::Shape{1, params.sequence, params.hidden});
+
+    const auto splitHeads = [&](const ov::Output<ov::Node>& input) -> ov::Output<ov::Node> {
+        const auto reshape = std::make_shared<opset::Reshape>(input, createShape({1, seq, heads, headSize}), false);
+        return std::make_shared<opset::Transpose>(reshape, createShape({0, 2, 1, 3}));
+    };
+
+    ov::Output<ov::Node> x = param;
+    for (size_t layer = 0; layer < params.layers; ++layer) {
+        const auto q = splitHeads(linear(weights, x, params.hidden, params.hidden));
+        const auto k = splitHeads(linear(weights, x, params.hidden, params.hidden));
+        const auto v = splitHeads(linear(weights, x, params.hidden, params.hidden));
+
+        const auto scores = std::make_shared<opset::MatMul>(q, k, false, true);
+        const auto scaled = std::make_shared<opset::Multiply>(scores, createScalar(1.0f / 8.0f));
+        const auto attention = std::make_shared<opset::Softmax>(scaled, 3);
+        const auto context = std::make_shared<opset::MatMul>(attention, v, false, false);
+
+        const auto merged = std::make_shared<opset::Transpose>(context, createShape({0, 2, 1, 3}));
+        const auto flat = std::make_shared<opset::Reshape>(merged, createShape({1, seq, hidden}), false);
+        const auto projected = linear(weights, flat, params.hidden, params.hidden);
+
+        x = layerNorm(weights, std::make_shared<opset::Add>(projected, x), params.hidden);
+
+        auto ffn = linear(weights, x, params.hidden, params.hidden * 4);
+        ffn = std::make_shared<opset::Gelu>(ffn);
+        ffn = linear(weights, ffn, params.hidden * 4, params.hidden);
+
+        x = layerNorm(weights, std::make_shared<opset::Add>(ffn, x), params.hidden);
+    }
+
+    return makeModel(param, x, "transformer");
+}
+
+//
+// UNet-like
+//
+
+struct UNetParams final {
+    size_t resolution;
+    size_t channels;
+    size_t depth;
+};
+
+std::shared_ptr<ov::Model> createUNet(const UNetParams& params) {
+    WeightsGenerator weights;
+
+    const auto param = std::make_shared<opset::Parameter>(ov::element::f32,
+                                                          ov::Shape{1, 3, params.resolution, params.resolution});
+
+    std::vector<ov::Output<ov::Node>> skips;
+
+    ov::Output<ov::Node> x = param;
+    auto channels = params.channels;
+    for (size_t level = 0; level < params.depth; ++level) {
+        x = convRelu(weights, x, channels, 3, 1);
+        x = convRelu(weights, x, channels, 3, 1);
+        skips.push_back(x);
+
+        x = std::make_shared<ov::op::v1::MaxPool>(x, ov::Strides{2, 2}, ov::Shape{0, 0}, ov::Shape{0, 0},
+                                                  ov::Shape{2, 2}, ov::op::RoundingType::FLOOR);
+        channels *= 2;
+    }
+
+    x = convRelu(weights, x, channels, 3, 1);
+    x = convRelu(weights, x, channels, 3, 1);
+
+    for (size_t level = params.depth; level > 0; --level) {
+        channels /= 2;
+
+        const auto up = upsample(weights, x, channels);
+        x = std::make_shared<opset::Concat>(ov::OutputVector{up, skips[level - 1]}, 1);
+        x = convRelu(weights, x, channels, 3, 1);
+        x = convRelu(weights, x, channels, 3, 1);
+    }
+
+    const auto out = std::make_shared<opset::Sigmoid>(conv(weights, x, 1, 1, 1));
+
+    return makeModel(param, out, "unet");
+}
+
+}  // namespace
+
+//
+// createSyntheticModel
+//
+
+std::shared_ptr<ov::Model> vpux::bench::createSyntheticModel(const std::string& kind, const std::string& size) {
+    const std::map<std::string, size_t> sizeIndices = {{"small", 0}, {"medium", 1}, {"large", 2}};
+    const auto sizeIt = sizeIndices.find(size);
+    VPUX_THROW_WHEN(sizeIt == sizeIndices.end(), "Unsupported synthetic model size '{0}'", size);
+    const auto ind = sizeIt->second;
+
+    if (kind == "resnet") {
+        const ResNetParams params[] = {{56, 32, 2, 1}, {112, 64, 3, 2}, {224, 64, 4, 3}};
+        return createResNet(params[ind]);
+    } else if (kind == "transformer") {
+        const TransformerParams params[] = {{64, 128, 2}, {128, 256, 4}, {256, 512, 8}};
+        return createTransformer(params[ind]);
+    } else if (kind == "unet") {
+        const UNetParams params[] = {{64, 16, 2}, {128, 32, 3}, {256, 32, 4}};
+        return createUNet(params[ind]);
+    }
+
+    VPUX_THROW("Unsupported synthetic model kind '{0}'", kind);
+}
+
+std::vector<std::string> vpux::bench::getSyntheticModelKinds() {
+    return {"resnet", "transformer", "unet"};
+}
+
+std::vector<std::string> vpux::bench::getSyntheticModelSizes() {
+    return {"small", "medium", "large"};
+}
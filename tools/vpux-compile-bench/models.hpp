@@ -0,0 +1,29 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include <openvino/core/model.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace vpux {
+namespace bench {
+
+//
+// Synthetic models
+//
+
+// Builds a parameterized model with the given topology kind ("resnet", "transformer", "unet")
+// and size ("small", "medium", "large"). Weights are generated, no external files are used.
+std::shared_ptr<ov::Model> createSyntheticModel(const std::string& kind, const std::string& size);
+
+std::vector<std::string> getSyntheticModelKinds();
+std::vector<std::string> getSyntheticModelSizes();
+
+}  // namespace bench
+}  // namespace vpux
@@ -0,0 +1,103 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "pass_statistics.hpp"
+
+#include "vpux/utils/core/process_memory.hpp"
+
+#include <mlir/Pass/Pass.h>
+
+#include <algorithm>
+
+using namespace vpux::bench;
+
+//
+// PassStatisticsInstrumentation
+//
+
+namespace vpux {
+namespace bench {
+
+class PassStatisticsInstrumentation final : public mlir::PassInstrumentation {
+public:
+    explicit PassStatisticsInstrumentation(PassStatisticsCollector& collector): _collector(collector) {
+    }
+
+    void runBeforePass(mlir::Pass* pass, mlir::Operation* op) final {
+        _collector.passStarted(pass, op);
+    }
+
+    void runAfterPass(mlir::Pass* pass, mlir::Operation* op) final {
+        _collector.passFinished(pass, op);
+    }
+
+    void runAfterPassFailed(mlir::Pass* pass, mlir::Operation* op) final {
+        _collector.passFinished(pass, op);
+    }
+
+private:
+    PassStatisticsCollector& _collector;
+};
+
+}  // namespace bench
+}  // namespace vpux
+
+//
+// PassStatisticsCollector
+//
+
+std::unique_ptr<mlir::PassInstrumentation> vpux::bench::PassStatisticsCollector::createInstrumentation() {
+    return std::make_unique<PassStatisticsInstrumentation>(*this);
+}
+
+std::vector<PassStatistics> vpux::bench::PassStatisticsCollector::getStatistics() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _statistics;
+}
+
+void vpux::bench::PassStatisticsCollector::passStarted(mlir::Pass* pass, mlir::Operation* op) {
+    // Pass adaptors, which run nested pipelines, have no argument - their time is covered by the nested passes
+    if (pass->getArgument().empty()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (_statisticsIndices.count(pass) == 0) {
+        const auto argument = pass->getArgument().str();
+        const auto occurrence = _occurrences[argument]++;
+
+        _statisticsIndices[pass] = _statistics.size();
+        _statistics.push_back({argument + "#" + std::to_string(occurrence)});
+    }
+
+    if (_resetPeakPerPass) {
+        resetPeakRSS();
+    }
+
+    _runningPasses[{pass, op}] = {Clock::now(), getCurrentRSS()};
+}
+
+void vpux::bench::PassStatisticsCollector::passFinished(mlir::Pass* pass, mlir::Operation* op) {
+    const auto finish = Clock::now();
+
+    if (pass->getArgument().empty()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    const auto runningIt = _runningPasses.find({pass, op});
+    if (runningIt == _runningPasses.end()) {
+        return;
+    }
+
+    auto& statistics = _statistics[_statisticsIndices.at(pass)];
+    statistics.timeMs += std::chrono::duration<double, std::milli>(finish - runningIt->second.start).count();
+    statistics.peakRSS = std::max(statistics.peakRSS, getPeakRSS());
+    statistics.rssDelta += getCurrentRSS() - runningIt->second.startRSS;
+
+    _runningPasses.erase(runningIt);
+}
@@ -0,0 +1,72 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include <mlir/Pass/PassInstrumentation.h>
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace vpux {
+namespace bench {
+
+//
+// PassStatistics
+//
+
+struct PassStatistics final {
+    // pass argument with the occurrence index in the pipeline, e.g. "canonicalize#3"
+    std::string name;
+    double timeMs = 0.0;
+    // peak RSS observed while the pass was running, only precise when passes are not run concurrently
+    int64_t peakRSS = 0;
+    int64_t rssDelta = 0;
+};
+
+//
+// PassStatisticsCollector
+//
+
+class PassStatisticsCollector final {
+public:
+    explicit PassStatisticsCollector(bool resetPeakPerPass): _resetPeakPerPass(resetPeakPerPass) {
+    }
+
+    std::unique_ptr<mlir::PassInstrumentation> createInstrumentation();
+
+    std::vector<PassStatistics> getStatistics() const;
+
+private:
+    friend class PassStatisticsInstrumentation;
+
+    void passStarted(mlir::Pass* pass, mlir::Operation* op);
+    void passFinished(mlir::Pass* pass, mlir::Operation* op);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct RunningPass final {
+        Clock::time_point start;
+        int64_t startRSS;
+    };
+
+    bool _resetPeakPerPass;
+
+    mutable std::mutex _mutex;
+    std::vector<PassStatistics> _statistics;
+    std::map<mlir::Pass*, size_t> _statisticsIndices;
+    std::map<std::string, size_t> _occurrences;
+    std::map<std::pair<mlir::Pass*, mlir::Operation*>, RunningPass> _runningPasses;
+};
+
+}  // namespace bench
+}  // namespace vpux